@@ -15,8 +15,8 @@ static void event_cb(lv_event_t * e)
         *s = LV_MAX(*s, 20);
     }
     else if(code == LV_EVENT_DRAW_POST_END) {
-        int32_t id = lv_chart_get_pressed_point(chart);
-        if(id == LV_CHART_POINT_NONE) return;
+        uint32_t id = lv_chart_get_pressed_point(chart);
+        if(id == LV_CHART_POINT_ID_NONE) return;
 
         LV_LOG_USER("Selected point %d", (int)id);
 
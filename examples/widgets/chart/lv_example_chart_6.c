@@ -7,20 +7,20 @@ static lv_chart_cursor_t * cursor;
 
 static void event_cb(lv_event_t * e)
 {
-    static int32_t last_id = -1;
+    static uint32_t last_id = LV_CHART_POINT_ID_NONE;
     lv_event_code_t code = lv_event_get_code(e);
     lv_obj_t * obj = lv_event_get_target(e);
 
     if(code == LV_EVENT_VALUE_CHANGED) {
         last_id = lv_chart_get_pressed_point(obj);
-        if(last_id != LV_CHART_POINT_NONE) {
+        if(last_id != LV_CHART_POINT_ID_NONE) {
             lv_chart_set_cursor_point(obj, cursor, NULL, last_id);
         }
     }
     else if(code == LV_EVENT_DRAW_PART_END) {
         lv_obj_draw_part_dsc_t * dsc = lv_event_get_draw_part_dsc(e);
         if(!lv_obj_draw_part_check_type(dsc, &lv_chart_class, LV_CHART_DRAW_PART_CURSOR)) return;
-        if(dsc->p1 == NULL || dsc->p2 == NULL || dsc->p1->y != dsc->p2->y || last_id < 0) return;
+        if(dsc->p1 == NULL || dsc->p2 == NULL || dsc->p1->y != dsc->p2->y || last_id == LV_CHART_POINT_ID_NONE) return;
 
         lv_coord_t * data_array = lv_chart_get_y_array(chart, ser);
         lv_coord_t v = data_array[last_id];
@@ -1,7 +1,7 @@
 class ExampleChart_6():
 
     def __init__(self):
-        self.last_id = -1
+        self.last_id = lv.CHART_POINT_ID.NONE
         #
         # Show cursor on the clicked point
         #
@@ -42,7 +42,7 @@ class ExampleChart_6():
         if code == lv.EVENT.VALUE_CHANGED:
             # print("last_id: ",self.last_id)
             self.last_id = chart.get_pressed_point()
-            if self.last_id != lv.CHART_POINT.NONE:
+            if self.last_id != lv.CHART_POINT_ID.NONE:
                 p = lv.point_t()
                 chart.get_point_pos_by_id(self.ser, self.last_id, p)
                 chart.set_cursor_point(self.cursor, None, self.last_id)
@@ -54,7 +54,7 @@ class ExampleChart_6():
                 # print("p1, p2", dsc.p1,dsc.p2)
                 # print("p1.y, p2.y", dsc.p1.y, dsc.p2.y)
                 # print("last_id: ",self.last_id)
-            if dsc.part == lv.PART.CURSOR and dsc.p1 and dsc.p2 and dsc.p1.y == dsc.p2.y and self.last_id >= 0:
+            if dsc.part == lv.PART.CURSOR and dsc.p1 and dsc.p2 and dsc.p1.y == dsc.p2.y and self.last_id != lv.CHART_POINT_ID.NONE:
 
                 v = self.ser_p[self.last_id]
 
@@ -9,8 +9,8 @@ static void add_data(lv_timer_t * t)
 
     lv_chart_set_next_value(chart, ser, lv_rand(10, 90));
 
-    uint16_t p = lv_chart_get_point_count(chart);
-    uint16_t s = lv_chart_get_x_start_point(chart, ser);
+    uint32_t p = lv_chart_get_point_count(chart);
+    uint32_t s = lv_chart_get_x_start_point(chart, ser);
     lv_coord_t * a = lv_chart_get_y_array(chart, ser);
 
     a[(s + 1) % p] = LV_CHART_POINT_NONE;
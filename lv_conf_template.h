@@ -127,6 +127,15 @@
  *0: to disable caching*/
 #define LV_IMG_CACHE_DEF_SIZE   0
 
+/*Default memory budget of the image cache in bytes. The least recently used images are closed to stay in the budget.
+ *Only the memory allocated by the decoders for the decoded images is counted.
+ *0: no limit, only the number of images is limited by LV_IMG_CACHE_DEF_SIZE*/
+#define LV_IMG_CACHE_DEF_MEM_SIZE   0
+
+/*1: Allow decoding the images in the background while a placeholder is drawn. Requires LV_IMG_CACHE_DEF_SIZE > 0.
+ *See lv_img_cache_set_async_worker()*/
+#define LV_IMG_CACHE_ASYNC  0
+
 /*Number of stops allowed per gradient. Increase this to allow more stops.
  *This adds (sizeof(lv_color_t) + 1) bytes per additional stop*/
 #define LV_GRADIENT_MAX_STOPS       2
@@ -383,6 +392,12 @@
     #define LV_FONT_SUBPX_BGR 0  /*0: RGB; 1:BGR order*/
 #endif
 
+/*Number of glyph widths (letter pairs to consider kerning) to remember per all fonts.
+ *Text measurement (label sizing, line wrapping, spans) asks the width of the same letters again and again.
+ *Use a power of 2. Each entry needs 16 bytes (24 on 64 bit systems).
+ *0: to disable caching*/
+#define LV_FONT_WIDTH_CACHE_SIZE 0
+
 /*=================
  *  TEXT SETTINGS
  *=================*/
@@ -457,6 +472,7 @@
 #if LV_USE_LABEL
     #define LV_LABEL_TEXT_SELECTION 1 /*Enable selecting text of the label*/
     #define LV_LABEL_LONG_TXT_HINT 1  /*Store some extra info in labels to speed up drawing of very long texts*/
+    #define LV_LABEL_IMG_CACHE_SIZE 0 /*Memory for the texts of labels rendered to images [bytes]. See lv_label_set_img_cache(). 0: disable*/
 #endif
 
 #define LV_USE_LINE       1
@@ -527,10 +543,6 @@
 #define LV_USE_WIN        1
 
 #define LV_USE_SPAN       1
-#if LV_USE_SPAN
-    /*A line text can contain maximum num of span descriptor */
-    #define LV_SPAN_SNIPPET_STACK_SIZE 64
-#endif
 
 /*-----------
  * Themes
@@ -609,9 +621,19 @@
 /*BMP decoder library*/
 #define LV_USE_BMP 0
 
+/*Decoder for the images converted to the layout of the display by `scripts/img_to_nimg.py`*/
+#define LV_USE_NIMG 0
+
 /* JPG + split JPG decoder library.
  * Split JPG is a custom format optimized for embedded systems. */
 #define LV_USE_SJPG 0
+#if LV_USE_SJPG
+    /*Number of decoded fragments (16 rows by default) to keep. Scrolling back over them doesn't decode them again*/
+    #define LV_SJPG_FRAME_CACHE_CNT 4
+
+    /*1: Decode the next fragment in the scroll direction in advance, after the image is drawn*/
+    #define LV_SJPG_PREFETCH 1
+#endif
 
 /*GIF decoder library*/
 #define LV_USE_GIF 0
@@ -634,10 +656,21 @@
         #define LV_FREETYPE_CACHE_FT_FACES 0
         #define LV_FREETYPE_CACHE_FT_SIZES 0
     #endif
+    /*Memory used by LVGL to keep the rendered glyphs of any face, size and style [bytes] (0: disable)
+     *The glyphs remain cached when a font is destroyed and created again. See `lv_ft_glyph_cache_set_size()`*/
+    #define LV_FREETYPE_GLYPH_CACHE_SIZE 0
 #endif
 
 /*Rlottie library*/
 #define LV_USE_RLOTTIE 0
+#if LV_USE_RLOTTIE
+    /*1: Render the next frame in the background while the current one is shown (`lottie_animation_render_async()`)*/
+    #define LV_RLOTTIE_ASYNC 0
+
+    /*Keep every rendered frame of an animation if all of them fit into this many bytes (0: disable)
+     *A frame needs `width x height x LV_IMG_PX_SIZE_ALPHA_BYTE` bytes. Once a loop is played the frames are only copied*/
+    #define LV_RLOTTIE_CACHE_SIZE 0
+#endif
 
 /*FFmpeg library for image decoding and playing videos
  *Supports all major image formats so do not enable other image decoder with it*/
@@ -645,6 +678,14 @@
 #if LV_USE_FFMPEG
     /*Dump input information to stderr*/
     #define LV_FFMPEG_DUMP_FORMAT 0
+
+    /*Number of frame buffers of a video player. One is shown, the others are decoded in advance.
+     *Each needs `width x height x pixel size` bytes. At least 2.*/
+    #define LV_FFMPEG_FRAME_QUEUE_SIZE 3
+
+    /*1: Decode the frames of the video players in a thread (requires POSIX threads)
+     *0: Decode them in the players' timers*/
+    #define LV_FFMPEG_USE_THREAD 0
 #endif
 
 /*-----------
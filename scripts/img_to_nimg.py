@@ -0,0 +1,146 @@
+#!/usr/bin/env python3
+
+'''
+Converts an image (PNG, JPG, BMP, ...) to LVGL's native image format (.nimg).
+The pixels are stored in the layout of the display's `lv_color_t` so they can be drawn without decoding.
+Dependencies: Python 3, Pillow
+'''
+
+import argparse
+import os
+import re
+import sys
+
+NIMG_MAGIC = b"LVNI"
+NIMG_VERSION = 1
+NIMG_HEADER_SIZE = 16
+
+NIMG_FLAG_ALPHA = 0x01
+NIMG_FLAG_COLOR_16_SWAP = 0x04
+
+NIMG_TILE_VISIBLE = 0
+NIMG_TILE_TRANSP = 1
+
+
+def color_bytes(r, g, b, color_depth, swap):
+    '''Pack a color like `lv_color_t` stores it'''
+    if color_depth == 32:
+        return bytes((b, g, r, 0xff))
+    if color_depth == 16:
+        c = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+        return bytes((c >> 8, c & 0xff)) if swap else bytes((c & 0xff, c >> 8))
+    if color_depth == 8:
+        return bytes(((r >> 5) << 5 | (g >> 5) << 2 | (b >> 6),))
+    if color_depth == 1:
+        return bytes(((r >> 7) | (g >> 7) | (b >> 7),))
+    raise ValueError("Unsupported color depth: %d" % color_depth)
+
+
+def tile_type(pixels, w, h, tx, ty, tile_size):
+    for y in range(ty * tile_size, min((ty + 1) * tile_size, h)):
+        for x in range(tx * tile_size, min((tx + 1) * tile_size, w)):
+            if pixels[y * w + x][3] != 0:
+                return NIMG_TILE_VISIBLE
+    return NIMG_TILE_TRANSP
+
+
+def convert(pixels, w, h, color_depth=16, swap=False, tile_size=16):
+    '''
+    Create a native image from RGBA pixels
+    :param pixels: list of (r, g, b, a) tuples row by row
+    :return: the content of the .nimg file
+    '''
+    alpha = any(p[3] != 0xff for p in pixels)
+    flags = 0
+    if alpha:
+        flags |= NIMG_FLAG_ALPHA
+    else:
+        tile_size = 0       # No transparent tiles
+    if color_depth == 16 and swap:
+        flags |= NIMG_FLAG_COLOR_16_SWAP
+
+    tiles = bytearray()
+    if tile_size:
+        for ty in range((h + tile_size - 1) // tile_size):
+            for tx in range((w + tile_size - 1) // tile_size):
+                tiles.append(tile_type(pixels, w, h, tx, ty, tile_size))
+
+    data_offset = (NIMG_HEADER_SIZE + len(tiles) + 3) & ~3
+
+    out = bytearray(NIMG_MAGIC)
+    out += bytes((NIMG_VERSION, color_depth, flags, tile_size))
+    out += w.to_bytes(2, byteorder='little')
+    out += h.to_bytes(2, byteorder='little')
+    out += data_offset.to_bytes(4, byteorder='little')
+    out += tiles
+    out += bytes(data_offset - len(out))
+
+    for r, g, b, a in pixels:
+        if alpha and a == 0:
+            r = g = b = 0
+        out += color_bytes(r, g, b, color_depth, swap)
+        if alpha:
+            if color_depth == 32:
+                out[-1] = a
+            else:
+                out.append(a)
+
+    return out
+
+
+def c_array(data, name, w, h, alpha):
+    c_code = '#include "lvgl/lvgl.h"\n\n'
+    c_code += "const LV_ATTRIBUTE_MEM_ALIGN uint8_t " + name + "_map[] = {\n"
+    for i in range(0, len(data), 16):
+        c_code += "    " + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",\n"
+    c_code += "};\n\n"
+    c_code += "const lv_img_dsc_t " + name + " = {\n"
+    c_code += "    .header.always_zero = 0,\n"
+    c_code += "    .header.w = " + str(w) + ",\n"
+    c_code += "    .header.h = " + str(h) + ",\n"
+    c_code += "    .header.cf = " + ("LV_IMG_CF_RAW_ALPHA" if alpha else "LV_IMG_CF_RAW") + ",\n"
+    c_code += "    .data_size = " + str(len(data)) + ",\n"
+    c_code += "    .data = " + name + "_map,\n"
+    c_code += "};\n"
+    return c_code
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Convert an image to LVGL's native image format")
+    parser.add_argument("input", help="the image to convert")
+    parser.add_argument("--color-depth", type=int, choices=[1, 8, 16, 32], default=16,
+                        help="LV_COLOR_DEPTH of the display (default: 16)")
+    parser.add_argument("--swap", action="store_true", help="LV_COLOR_16_SWAP is enabled")
+    parser.add_argument("--tile-size", type=int, default=16,
+                        help="size of the tiles marked as transparent (0: no tiles, default: 16)")
+    parser.add_argument("--format", choices=["bin", "c"], default="bin",
+                        help="write a .nimg file or a C array (default: bin)")
+    parser.add_argument("-o", "--output", help="output file (default: the input's name with .nimg or .c)")
+    args = parser.parse_args()
+
+    if args.tile_size < 0 or args.tile_size > 255:
+        sys.exit("The tile size needs to be in 0..255")
+
+    from PIL import Image
+    im = Image.open(args.input).convert("RGBA")
+    w, h = im.size
+    # The size needs to fit into the 11 bit fields of lv_img_header_t
+    if w > 2047 or h > 2047:
+        sys.exit("The image is too large, it can be at most 2047x2047 px")
+
+    data = convert(list(im.getdata()), w, h, args.color_depth, args.swap, args.tile_size)
+
+    name = re.sub(r"\W", "_", os.path.splitext(os.path.basename(args.input))[0])
+    out_path = args.output or name + (".nimg" if args.format == "bin" else ".c")
+    if args.format == "bin":
+        with open(out_path, "wb") as f:
+            f.write(data)
+    else:
+        with open(out_path, "w") as f:
+            f.write(c_array(data, name, w, h, data[6] & NIMG_FLAG_ALPHA))
+
+    print("%s: %d x %d, %d bytes" % (out_path, w, h, len(data)))
+
+
+if __name__ == "__main__":
+    main()
@@ -263,6 +263,19 @@ void * lv_obj_get_event_user_data(struct _lv_obj_t * obj, lv_event_cb_t event_cb
     return NULL;
 }
 
+bool _lv_obj_has_event_cb(const lv_obj_t * obj, lv_event_code_t code)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    if(obj->spec_attr == NULL) return false;
+
+    uint32_t i;
+    for(i = 0; i < obj->spec_attr->event_dsc_cnt; i++) {
+        lv_event_code_t filter = obj->spec_attr->event_dsc[i].filter & ~LV_EVENT_PREPROCESS;
+        if(obj->spec_attr->event_dsc[i].cb && (filter == LV_EVENT_ALL || filter == code)) return true;
+    }
+    return false;
+}
+
 lv_indev_t * lv_event_get_indev(lv_event_t * e)
 {
 
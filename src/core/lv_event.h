@@ -272,6 +272,14 @@ bool lv_obj_remove_event_dsc(struct _lv_obj_t * obj, struct _lv_event_dsc_t * ev
  */
 void * lv_obj_get_event_user_data(struct _lv_obj_t * obj, lv_event_cb_t event_cb);
 
+/**
+ * Check if an object has an event callback which is called for an event
+ * @param obj               pointer to an object
+ * @param code              the event code. The callbacks added with `LV_EVENT_ALL` match too.
+ * @return                  true: there is at least one such callback
+ */
+bool _lv_obj_has_event_cb(const struct _lv_obj_t * obj, lv_event_code_t code);
+
 /**
  * Get the input device passed as parameter to indev related events.
  * @param e     pointer to an event
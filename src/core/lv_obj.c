@@ -133,6 +133,7 @@ void lv_init(void)
     _lv_img_decoder_init();
 #if LV_IMG_CACHE_DEF_SIZE
     lv_img_cache_set_size(LV_IMG_CACHE_DEF_SIZE);
+    lv_img_cache_set_mem_size(LV_IMG_CACHE_DEF_MEM_SIZE);
 #endif
     /*Test if the IDE has UTF-8 encoding*/
     char * txt = "Á";
@@ -183,6 +184,7 @@ void lv_init(void)
 void lv_deinit(void)
 {
     _lv_gc_clear_roots();
+    lv_font_width_cache_invalidate(NULL);
 
     lv_disp_set_default(NULL);
     lv_mem_deinit();
@@ -187,6 +187,7 @@ typedef struct _lv_obj_t {
     uint16_t style_cnt  : 6;
     uint16_t h_layout   : 1;
     uint16_t w_layout   : 1;
+    uint16_t skip_children : 1;     /**< Internal: the object draws its children itself (e.g. from an image)*/
 } lv_obj_t;
 
 
@@ -59,6 +59,7 @@ typedef struct _lv_obj_class_t {
     lv_coord_t height_def;
     uint32_t editable : 2;             /**< Value from ::lv_obj_class_editable_t*/
     uint32_t group_def : 2;            /**< Value from ::lv_obj_class_group_def_t*/
+    uint32_t items_state_self : 1;     /**< The widget invalidates its `LV_PART_ITEMS` itself when its state changes*/
     uint32_t instance_size : 16;
 } lv_obj_class_t;
 
@@ -58,6 +58,7 @@ static void fade_in_anim_ready(lv_anim_t * a);
  *  STATIC VARIABLES
  **********************/
 static bool style_refr = true;
+static uint32_t style_refr_cnt;
 
 /**********************
  *      MACROS
@@ -151,6 +152,7 @@ void lv_obj_remove_style(lv_obj_t * obj, lv_style_t * style, lv_style_selector_t
 
 void lv_obj_report_style_change(lv_style_t * style)
 {
+    style_refr_cnt++;
     if(!style_refr) return;
     lv_disp_t * d = lv_disp_get_next(NULL);
 
@@ -167,6 +169,7 @@ void lv_obj_refresh_style(lv_obj_t * obj, lv_style_selector_t selector, lv_style
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
+    style_refr_cnt++;
     if(!style_refr) return;
 
     lv_obj_invalidate(obj);
@@ -365,14 +368,30 @@ lv_style_value_t _lv_obj_style_apply_color_filter(const lv_obj_t * obj, uint32_t
     return v;
 }
 
+uint32_t _lv_obj_style_get_refr_cnt(void)
+{
+    return style_refr_cnt;
+}
+
 _lv_style_state_cmp_t _lv_obj_style_state_compare(lv_obj_t * obj, lv_state_t state1, lv_state_t state2)
 {
     _lv_style_state_cmp_t res = _LV_STYLE_STATE_CMP_SAME;
 
+    /*Some widgets redraw their items themselves when their state changes*/
+    bool skip_items = false;
+    const lv_obj_class_t * class_p;
+    for(class_p = obj->class_p; class_p; class_p = class_p->base_class) {
+        if(class_p->items_state_self) {
+            skip_items = true;
+            break;
+        }
+    }
+
     /*Are there any new styles for the new state?*/
     uint32_t i;
     for(i = 0; i < obj->style_cnt; i++) {
         if(obj->styles[i].is_trans) continue;
+        if(skip_items && lv_obj_style_get_selector_part(obj->styles[i].selector) == LV_PART_ITEMS) continue;
 
         lv_state_t state_act = lv_obj_style_get_selector_state(obj->styles[i].selector);
         /*The style is valid for a state but not the other*/
@@ -168,6 +168,13 @@ lv_style_value_t _lv_obj_style_apply_color_filter(const struct _lv_obj_t * obj,
 void _lv_obj_style_create_transition(struct _lv_obj_t * obj, lv_part_t part, lv_state_t prev_state,
                                      lv_state_t new_state, const _lv_obj_style_transition_dsc_t * tr);
 
+/**
+ * Get how many times the style of any object has been refreshed.
+ * Used internally to tell whether the draw descriptors cached by a widget are still valid.
+ * @return      a number which changes when a style is changed
+ */
+uint32_t _lv_obj_style_get_refr_cnt(void);
+
 /**
  * Used internally to compare the appearance of an object in 2 states
  * @param obj
@@ -72,6 +72,7 @@ static void call_flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_
  **********************/
 static uint32_t px_num;
 static lv_disp_t * disp_refr; /*Display being refreshed*/
+static lv_obj_t * obj_refr;   /*Object being drawn*/
 
 #if LV_USE_PERF_MONITOR
     static perf_monitor_t   perf_monitor;
@@ -129,6 +130,9 @@ void lv_refr_obj(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj)
     /*Do not refresh hidden objects*/
     if(lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) return;
 
+    lv_obj_t * obj_refr_ori = obj_refr;
+    obj_refr = obj;
+
     const lv_area_t * clip_area_ori = draw_ctx->clip_area;
     lv_area_t clip_coords_for_obj;
 
@@ -165,7 +169,7 @@ void lv_refr_obj(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj)
 
     /*With overflow visible keep the previous clip area to let the children visible out of this object too
      *With not overflow visible limit the clip are to the object's coordinates to clip the children*/
-    bool refr_children = true;
+    bool refr_children = obj->skip_children == 0;
     lv_area_t clip_coords_for_children;
     if(lv_obj_has_flag(obj, LV_OBJ_FLAG_OVERFLOW_VISIBLE)) {
         clip_coords_for_children  = *clip_area_ori;
@@ -197,6 +201,7 @@ void lv_refr_obj(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj)
     }
 
     draw_ctx->clip_area = clip_area_ori;
+    obj_refr = obj_refr_ori;
 }
 
 /**
@@ -281,6 +286,63 @@ void _lv_refr_set_disp_refreshing(lv_disp_t * disp)
     disp_refr = disp;
 }
 
+/**
+ * Get the object which is being drawn by `lv_refr_obj`
+ * @return the object being drawn or NULL
+ */
+lv_obj_t * _lv_refr_get_obj_refreshing(void)
+{
+    return obj_refr;
+}
+
+/**
+ * Render into a buffer instead of the display, e.g. to draw an object into an image.
+ * A fake display with the resolution of the object's display and the draw unit of the object's display is used.
+ * @param obj       the object to render
+ * @param buf       buffer for `area` with `cf` color format. The already drawn pixels are blended with.
+ * @param area      the area of the screen to render into `buf`
+ * @param cf        color format of `buf`, e.g. `LV_IMG_CF_TRUE_COLOR_ALPHA`
+ * @param render_cb draw with this callback, or NULL to draw the object and its children with `lv_refr_obj`
+ * @param user_data passed to `render_cb`
+ * @return LV_RES_OK: rendered; LV_RES_INV: out of memory
+ */
+lv_res_t _lv_obj_render_to_buf(lv_obj_t * obj, void * buf, const lv_area_t * area, lv_img_cf_t cf,
+                               _lv_obj_render_cb_t render_cb, void * user_data)
+{
+    lv_disp_t * obj_disp = lv_obj_get_disp(obj);
+    lv_disp_drv_t driver;
+    lv_disp_drv_init(&driver);
+    /*In lack of a better idea use the resolution of the object's display*/
+    driver.hor_res = lv_disp_get_hor_res(obj_disp);
+    driver.ver_res = lv_disp_get_ver_res(obj_disp);
+    lv_disp_drv_use_generic_set_px_cb(&driver, cf);
+
+    lv_disp_t fake_disp;
+    lv_memset_00(&fake_disp, sizeof(lv_disp_t));
+    fake_disp.driver = &driver;
+
+    lv_draw_ctx_t * draw_ctx = lv_mem_alloc(obj_disp->driver->draw_ctx_size);
+    LV_ASSERT_MALLOC(draw_ctx);
+    if(draw_ctx == NULL) return LV_RES_INV;
+    obj_disp->driver->draw_ctx_init(&driver, draw_ctx);
+    draw_ctx->clip_area = area;
+    draw_ctx->buf_area = area;
+    draw_ctx->buf = buf;
+    driver.draw_ctx = draw_ctx;
+
+    lv_disp_t * refr_ori = _lv_refr_get_disp_refreshing();
+    _lv_refr_set_disp_refreshing(&fake_disp);
+
+    if(render_cb) render_cb(obj, draw_ctx, user_data);
+    else lv_refr_obj(draw_ctx, obj);
+
+    _lv_refr_set_disp_refreshing(refr_ori);
+    obj_disp->driver->draw_ctx_deinit(&driver, draw_ctx);
+    lv_mem_free(draw_ctx);
+
+    return LV_RES_OK;
+}
+
 /**
  * Called periodically to handle the refreshing
  * @param tmr pointer to the timer itself
@@ -721,8 +783,9 @@ static lv_obj_t * lv_refr_get_top_obj(const lv_area_t * area_p, lv_obj_t * obj)
         lv_event_send(obj, LV_EVENT_COVER_CHECK, &info);
         if(info.res == LV_COVER_RES_MASKED) return NULL;
 
+        /*Don't start drawing from the children if the object draws them itself*/
         uint32_t i;
-        uint32_t child_cnt = lv_obj_get_child_cnt(obj);
+        uint32_t child_cnt = obj->skip_children ? 0 : lv_obj_get_child_cnt(obj);
         for(i = 0; i < child_cnt; i++) {
             lv_obj_t * child = obj->spec_attr->children[i];
             found_p = lv_refr_get_top_obj(area_p, child);
@@ -26,6 +26,11 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+/**
+ * Draws into the draw context of `_lv_obj_render_to_buf`
+ */
+typedef void (*_lv_obj_render_cb_t)(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx, void * user_data);
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -85,6 +90,26 @@ lv_disp_t * _lv_refr_get_disp_refreshing(void);
  */
 void _lv_refr_set_disp_refreshing(lv_disp_t * disp);
 
+/**
+ * Get the object which is being drawn by `lv_refr_obj`
+ * @return the object being drawn or NULL
+ */
+lv_obj_t * _lv_refr_get_obj_refreshing(void);
+
+/**
+ * Render into a buffer instead of the display, e.g. to draw an object into an image.
+ * A fake display with the resolution of the object's display and the draw unit of the object's display is used.
+ * @param obj       the object to render
+ * @param buf       buffer for `area` with `cf` color format. The already drawn pixels are blended with.
+ * @param area      the area of the screen to render into `buf`
+ * @param cf        color format of `buf`, e.g. `LV_IMG_CF_TRUE_COLOR_ALPHA`
+ * @param render_cb draw with this callback, or NULL to draw the object and its children with `lv_refr_obj`
+ * @param user_data passed to `render_cb`
+ * @return LV_RES_OK: rendered; LV_RES_INV: out of memory
+ */
+lv_res_t _lv_obj_render_to_buf(lv_obj_t * obj, void * buf, const lv_area_t * area, lv_img_cf_t cf,
+                               _lv_obj_render_cb_t render_cb, void * user_data);
+
 #if LV_USE_PERF_MONITOR
 /**
  * Reset FPS counter
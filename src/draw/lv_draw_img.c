@@ -17,6 +17,8 @@
 /*********************
  *      DEFINES
  *********************/
+/*Read about this many bytes of decoded pixels at once if the image needs to be read by areas*/
+#define IMG_READ_BLOCK_SIZE 4096
 
 /**********************
  *      TYPEDEFS
@@ -30,6 +32,9 @@ LV_ATTRIBUTE_FAST_MEM static lv_res_t decode_and_draw(lv_draw_ctx_t * draw_ctx,
 
 static void show_error(lv_draw_ctx_t * draw_ctx, const lv_area_t * coords, const char * msg);
 static void draw_cleanup(_lv_img_cache_entry_t * cache);
+#if LV_IMG_CACHE_ASYNC
+    static void draw_placeholder(lv_draw_ctx_t * draw_ctx, const lv_draw_img_dsc_t * draw_dsc, const lv_area_t * coords);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -232,6 +237,14 @@ LV_ATTRIBUTE_FAST_MEM static lv_res_t decode_and_draw(lv_draw_ctx_t * draw_ctx,
 {
     if(draw_dsc->opa <= LV_OPA_MIN) return LV_RES_OK;
 
+#if LV_IMG_CACHE_ASYNC
+    /*Draw a placeholder while the image is decoded in the background*/
+    if(_lv_img_cache_async_start(src, draw_dsc->recolor, draw_dsc->frame_id)) {
+        draw_placeholder(draw_ctx, draw_dsc, coords);
+        return LV_RES_OK;
+    }
+#endif
+
     _lv_img_cache_entry_t * cdsc = _lv_img_cache_open(src, draw_dsc->recolor, draw_dsc->frame_id);
 
     if(cdsc == NULL) return LV_RES_INV;
@@ -278,7 +291,7 @@ LV_ATTRIBUTE_FAST_MEM static lv_res_t decode_and_draw(lv_draw_ctx_t * draw_ctx,
         lv_draw_img_decoded(draw_ctx, draw_dsc, coords, cdsc->dec_dsc.img_data, cf);
         draw_ctx->clip_area = clip_area_ori;
     }
-    /*The whole uncompressed image is not available. Try to read it line-by-line*/
+    /*The whole uncompressed image is not available. Read it in blocks of lines*/
     else {
         lv_area_t mask_com; /*Common area of mask and coords*/
         bool union_ok;
@@ -290,38 +303,34 @@ LV_ATTRIBUTE_FAST_MEM static lv_res_t decode_and_draw(lv_draw_ctx_t * draw_ctx,
         }
 
         int32_t width = lv_area_get_width(&mask_com);
+        uint32_t px_size = cf == LV_IMG_CF_TRUE_COLOR_ALPHA ? LV_IMG_PX_SIZE_ALPHA_BYTE : LV_COLOR_SIZE / 8;
+        int32_t block_h = LV_MAX(IMG_READ_BLOCK_SIZE / (width * px_size), 1);
+        block_h = LV_MIN(block_h, lv_area_get_height(&mask_com));
 
-        uint8_t  * buf = lv_mem_buf_get(lv_area_get_width(&mask_com) *
-                                        LV_IMG_PX_SIZE_ALPHA_BYTE);  /*+1 because of the possible alpha byte*/
+        uint8_t * buf = lv_mem_buf_get(width * px_size * block_h);
 
         const lv_area_t * clip_area_ori = draw_ctx->clip_area;
-        lv_area_t line;
-        lv_area_copy(&line, &mask_com);
-        lv_area_set_height(&line, 1);
-        int32_t x = mask_com.x1 - coords->x1;
-        int32_t y = mask_com.y1 - coords->y1;
-        int32_t row;
-        lv_res_t read_res;
-        for(row = mask_com.y1; row <= mask_com.y2; row++) {
-            lv_area_t mask_line;
-            union_ok = _lv_area_intersect(&mask_line, clip_area_ori, &line);
-            if(union_ok == false) continue;
-
-            read_res = lv_img_decoder_read_line(&cdsc->dec_dsc, x, y, width, buf);
+        lv_area_t block;
+        block.x1 = mask_com.x1;
+        block.x2 = mask_com.x2;
+        for(block.y1 = mask_com.y1; block.y1 <= mask_com.y2; block.y1 += block_h) {
+            block.y2 = LV_MIN(block.y1 + block_h - 1, mask_com.y2);
+
+            lv_area_t read_area = block;
+            lv_area_move(&read_area, -coords->x1, -coords->y1);
+            lv_res_t read_res = lv_img_decoder_read_area(&cdsc->dec_dsc, &read_area, buf);
             if(read_res != LV_RES_OK) {
-                lv_img_decoder_close(&cdsc->dec_dsc);
-                LV_LOG_WARN("Image draw can't read the line");
+                LV_LOG_WARN("Image draw can't read the area");
                 lv_mem_buf_release(buf);
                 draw_cleanup(cdsc);
+                /*Don't keep the broken image in the cache*/
+                lv_img_cache_invalidate_src(src);
                 draw_ctx->clip_area = clip_area_ori;
                 return LV_RES_INV;
             }
 
-            draw_ctx->clip_area = &mask_line;
-            lv_draw_img_decoded(draw_ctx, draw_dsc, &line, buf, cf);
-            line.y1++;
-            line.y2++;
-            y++;
+            draw_ctx->clip_area = &block;
+            lv_draw_img_decoded(draw_ctx, draw_dsc, &block, buf, cf);
         }
         draw_ctx->clip_area = clip_area_ori;
         lv_mem_buf_release(buf);
@@ -346,10 +355,37 @@ static void show_error(lv_draw_ctx_t * draw_ctx, const lv_area_t * coords, const
 
 static void draw_cleanup(_lv_img_cache_entry_t * cache)
 {
-    /*Automatically close images with no caching*/
-#if LV_IMG_CACHE_DEF_SIZE == 0
-    lv_img_decoder_close(&cache->dec_dsc);
-#else
-    LV_UNUSED(cache);
-#endif
+    /*Let the cache evict the image again (or close it with no caching)*/
+    _lv_img_cache_release(cache);
 }
+
+#if LV_IMG_CACHE_ASYNC
+static void draw_placeholder(lv_draw_ctx_t * draw_ctx, const lv_draw_img_dsc_t * draw_dsc, const lv_area_t * coords)
+{
+    const void * placeholder = _lv_img_cache_async_get_placeholder();
+    if(placeholder == NULL) return;
+
+    lv_img_header_t header;
+    if(lv_img_decoder_get_info(placeholder, &header) != LV_RES_OK) return;
+
+    /*Draw the placeholder in the middle of the image but not out of it*/
+    lv_area_t clip_com;
+    if(_lv_area_intersect(&clip_com, draw_ctx->clip_area, coords) == false) return;
+
+    lv_area_t placeholder_area;
+    placeholder_area.x1 = coords->x1 + (lv_area_get_width(coords) - header.w) / 2;
+    placeholder_area.y1 = coords->y1 + (lv_area_get_height(coords) - header.h) / 2;
+    placeholder_area.x2 = placeholder_area.x1 + header.w - 1;
+    placeholder_area.y2 = placeholder_area.y1 + header.h - 1;
+
+    lv_draw_img_dsc_t placeholder_dsc;
+    lv_draw_img_dsc_init(&placeholder_dsc);
+    placeholder_dsc.opa = draw_dsc->opa;
+    placeholder_dsc.blend_mode = draw_dsc->blend_mode;
+
+    const lv_area_t * clip_area_ori = draw_ctx->clip_area;
+    draw_ctx->clip_area = &clip_com;
+    decode_and_draw(draw_ctx, &placeholder_dsc, &placeholder_area, placeholder);
+    draw_ctx->clip_area = clip_area_ori;
+}
+#endif
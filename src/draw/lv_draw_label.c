@@ -219,8 +219,15 @@ LV_ATTRIBUTE_FAST_MEM void lv_draw_label(lv_draw_ctx_t * draw_ctx, const lv_draw
         cmd_state = CMD_STATE_WAIT;
         i         = 0;
 #if LV_USE_BIDI
-        char * bidi_txt = lv_mem_buf_get(line_end - line_start + 1);
-        _lv_bidi_process_paragraph(txt + line_start, bidi_txt, line_end - line_start, base_dir, NULL, 0);
+        char * bidi_buf = NULL;
+        const char * bidi_txt = NULL;
+        if(dsc->bidi_cache) bidi_txt = _lv_bidi_cache_get_line(dsc->bidi_cache, txt, line_start, line_end - line_start,
+                                                                   base_dir);
+        if(bidi_txt == NULL) {
+            bidi_buf = lv_mem_buf_get(line_end - line_start + 1);
+            _lv_bidi_process_paragraph(txt + line_start, bidi_buf, line_end - line_start, base_dir, NULL, 0);
+            bidi_txt = bidi_buf;
+        }
 #else
         const char * bidi_txt = txt + line_start;
 #endif
@@ -231,7 +238,13 @@ LV_ATTRIBUTE_FAST_MEM void lv_draw_label(lv_draw_ctx_t * draw_ctx, const lv_draw
 #if LV_USE_BIDI
                 logical_char_pos = _lv_txt_encoded_get_char_id(txt, line_start);
                 uint32_t t = _lv_txt_encoded_get_char_id(bidi_txt, i);
-                logical_char_pos += _lv_bidi_get_logical_pos(bidi_txt, NULL, line_end - line_start, base_dir, t, NULL);
+                if(bidi_buf == NULL) {
+                    logical_char_pos += _lv_bidi_cache_get_logical_pos(dsc->bidi_cache, txt, line_start, line_end - line_start,
+                                                                       base_dir, t, NULL);
+                }
+                else {
+                    logical_char_pos += _lv_bidi_get_logical_pos(bidi_txt, NULL, line_end - line_start, base_dir, t, NULL);
+                }
 #else
                 logical_char_pos = _lv_txt_encoded_get_char_id(txt, line_start + i);
 #endif
@@ -329,7 +342,7 @@ LV_ATTRIBUTE_FAST_MEM void lv_draw_label(lv_draw_ctx_t * draw_ctx, const lv_draw
         }
 
 #if LV_USE_BIDI
-        lv_mem_buf_release(bidi_txt);
+        if(bidi_buf) lv_mem_buf_release(bidi_buf);
         bidi_txt = NULL;
 #endif
         /*Go to next line*/
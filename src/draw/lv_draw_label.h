@@ -40,6 +40,9 @@ typedef struct {
     lv_coord_t ofs_y;
     lv_opa_t opa;
     lv_base_dir_t bidi_dir;
+#if LV_USE_BIDI
+    lv_bidi_cache_t * bidi_cache;   /*Optional cache of the processed lines of the text, owned by the caller*/
+#endif
     lv_text_align_t align;
     lv_text_flag_t flag;
     lv_text_decor_t decor : 3;
@@ -12,29 +12,72 @@
 #include "lv_draw_img.h"
 #include "../hal/lv_hal_tick.h"
 #include "../misc/lv_gc.h"
+#include "../misc/lv_timer.h"
+#include "../core/lv_refr.h"
+#include "../core/lv_obj.h"
+
+#if LV_IMG_CACHE_ASYNC && !defined(__GNUC__) && defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L && \
+    !defined(__STDC_NO_ATOMICS__)
+    #include <stdatomic.h>
+    #define ASYNC_USE_C11_FENCE 1
+#endif
 
 /*********************
  *      DEFINES
  *********************/
-/*Decrement life with this value on every open*/
-#define LV_IMG_CACHE_AGING 1
-
-/*Boost life by this factor (multiply time_to_open with this value)*/
-#define LV_IMG_CACHE_LIFE_GAIN 1
-
-/*Don't let life to be greater than this limit because it would require a lot of time to
- * "die" from very high values*/
-#define LV_IMG_CACHE_LIFE_LIMIT 1000
+/*Marks the end of the hash chains, the LRU list and the free list*/
+#define ENTRY_NONE  0xFFFF
 
 /**********************
  *      TYPEDEFS
  **********************/
+#if LV_IMG_CACHE_ASYNC
+typedef enum {
+    ASYNC_JOB_PENDING,      /*Given to the worker*/
+    ASYNC_JOB_OPENED,       /*Decoded by the worker*/
+    ASYNC_JOB_ERROR,        /*The worker couldn't open the image*/
+    ASYNC_JOB_FAILED,       /*The error was handled. Draw it synchronously to show the error*/
+} async_job_state_t;
+
+struct _lv_img_cache_async_job_t {
+    lv_img_decoder_dsc_t dec_dsc;   /*Opened by the worker*/
+    const void * src;               /*Source of the image. Paths are copied*/
+    lv_color_t color;
+    int32_t frame_id;
+    uint32_t hash;
+    lv_ll_t obj_ll;                 /*The objects drawing the image. They are invalidated when it's ready*/
+    volatile uint8_t state;         /*Written by the worker. Use `async_state_get/set`*/
+    uint8_t cancelled : 1;          /*The source was invalidated while the worker was decoding it*/
+};
+#endif
 
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 #if LV_IMG_CACHE_DEF_SIZE
     static bool lv_img_cache_match(const void * src1, const void * src2);
+    static uint32_t get_hash(const void * src, lv_color_t color, int32_t frame_id);
+    static uint32_t get_entry_size(const _lv_img_cache_entry_t * entry);
+    static void lru_unlink(uint16_t id);
+    static void lru_add_head(uint16_t id);
+    static void hash_unlink(uint16_t id);
+    static void entry_remove(uint16_t id);
+    static bool evict_lru(uint16_t keep_id);
+    static uint16_t entry_find(const void * src, lv_color_t color, int32_t frame_id, uint32_t hash);
+    static uint16_t entry_take(void);
+    static void entry_add(uint16_t id, uint32_t hash);
+#endif
+#if LV_IMG_CACHE_ASYNC
+    static bool is_async_src(const void * src);
+    static bool disp_is_valid(const lv_disp_t * disp);
+    static lv_img_cache_async_job_t * async_job_find(const void * src, lv_color_t color, int32_t frame_id,
+                                                     uint32_t hash);
+    static void async_job_del(lv_img_cache_async_job_t * job);
+    static bool async_job_add_obj(lv_img_cache_async_job_t * job, lv_obj_t * obj);
+    static uint8_t async_state_get(lv_img_cache_async_job_t * job);
+    static void async_state_set(lv_img_cache_async_job_t * job, uint8_t state);
+    static void async_invalidate_src(const void * src);
+    static void async_timer_cb(lv_timer_t * timer);
 #endif
 
 /**********************
@@ -42,6 +85,17 @@
  **********************/
 #if LV_IMG_CACHE_DEF_SIZE
     static uint16_t entry_cnt;
+    static uint32_t bucket_cnt;     /*Can be 0x10000 for the maximal entry count*/
+    static uint16_t * buckets;
+    static uint16_t lru_head = ENTRY_NONE;
+    static uint16_t lru_tail = ENTRY_NONE;
+    static uint16_t free_head = ENTRY_NONE;
+#endif
+static lv_img_cache_stat_t cache_stat;
+#if LV_IMG_CACHE_ASYNC
+    static lv_img_cache_async_worker_cb_t async_worker_cb;
+    static const void * async_placeholder;
+    static lv_timer_t * async_timer;
 #endif
 
 /**********************
@@ -55,14 +109,13 @@
 /**
  * Open an image using the image decoder interface and cache it.
  * The image will be left open meaning if the image decoder open callback allocated memory then it will remain.
- * The image is closed if a new image is opened and the new image takes its place in the cache.
+ * The least recently used image is closed if there is no free entry or the memory budget is exceeded.
  * @param src source of the image. Path to file or pointer to an `lv_img_dsc_t` variable
  * @param color color The color of the image with `LV_IMG_CF_ALPHA_...`
  * @return pointer to the cache entry or NULL if can open the image
  */
 _lv_img_cache_entry_t * _lv_img_cache_open(const void * src, lv_color_t color, int32_t frame_id)
 {
-    /*Is the image cached?*/
     _lv_img_cache_entry_t * cached_src = NULL;
 
 #if LV_IMG_CACHE_DEF_SIZE
@@ -73,50 +126,32 @@ _lv_img_cache_entry_t * _lv_img_cache_open(const void * src, lv_color_t color, i
 
     _lv_img_cache_entry_t * cache = LV_GC_ROOT(_lv_img_cache_array);
 
-    /*Decrement all lifes. Make the entries older*/
-    uint16_t i;
-    for(i = 0; i < entry_cnt; i++) {
-        if(cache[i].life > INT32_MIN + LV_IMG_CACHE_AGING) {
-            cache[i].life -= LV_IMG_CACHE_AGING;
-        }
-    }
-
-    for(i = 0; i < entry_cnt; i++) {
-        if(color.full == cache[i].dec_dsc.color.full &&
-           frame_id == cache[i].dec_dsc.frame_id &&
-           lv_img_cache_match(src, cache[i].dec_dsc.src)) {
-            /*If opened increment its life.
-             *Image difficult to open should live longer to keep avoid frequent their recaching.
-             *Therefore increase `life` with `time_to_open`*/
-            cached_src = &cache[i];
-            cached_src->life += cached_src->dec_dsc.time_to_open * LV_IMG_CACHE_LIFE_GAIN;
-            if(cached_src->life > LV_IMG_CACHE_LIFE_LIMIT) cached_src->life = LV_IMG_CACHE_LIFE_LIMIT;
-            LV_LOG_TRACE("image source found in the cache");
-            break;
-        }
+    /*Is the image cached?*/
+    uint32_t hash = get_hash(src, color, frame_id);
+    uint16_t id = entry_find(src, color, frame_id, hash);
+    if(id != ENTRY_NONE) {
+        cached_src = &cache[id];
+        /*Make it the most recently used one*/
+        lru_unlink(id);
+        lru_add_head(id);
+        cached_src->ref_cnt++;
+        cache_stat.hit_cnt++;
+        LV_LOG_TRACE("image source found in the cache");
+        return cached_src;
     }
 
     /*The image is not cached then cache it now*/
-    if(cached_src) return cached_src;
+    cache_stat.miss_cnt++;
 
-    /*Find an entry to reuse. Select the entry with the least life*/
-    cached_src = &cache[0];
-    for(i = 1; i < entry_cnt; i++) {
-        if(cache[i].life < cached_src->life) {
-            cached_src = &cache[i];
-        }
-    }
-
-    /*Close the decoder to reuse if it was opened (has a valid source)*/
-    if(cached_src->dec_dsc.src) {
-        lv_img_decoder_close(&cached_src->dec_dsc);
-        LV_LOG_INFO("image draw: cache miss, close and reuse an entry");
-    }
-    else {
-        LV_LOG_INFO("image draw: cache miss, cached to an empty entry");
+    id = entry_take();
+    if(id == ENTRY_NONE) {
+        LV_LOG_WARN("lv_img_cache_open: all the entries are in use");
+        return NULL;
     }
+    cached_src = &cache[id];
 #else
     cached_src = &LV_GC_ROOT(_lv_img_cache_single);
+    cache_stat.miss_cnt++;
 #endif
     /*Open the image and measure the time to open*/
     uint32_t t_start  = lv_tick_get();
@@ -124,12 +159,14 @@ _lv_img_cache_entry_t * _lv_img_cache_open(const void * src, lv_color_t color, i
     if(open_res == LV_RES_INV) {
         LV_LOG_WARN("Image draw cannot open the image resource");
         lv_memset_00(cached_src, sizeof(_lv_img_cache_entry_t));
-        cached_src->life = INT32_MIN; /*Make the empty entry very "weak" to force its us*/
+#if LV_IMG_CACHE_DEF_SIZE
+        /*Give back the entry*/
+        cached_src->hash_next = free_head;
+        free_head = id;
+#endif
         return NULL;
     }
 
-    cached_src->life = 0;
-
     /*If `time_to_open` was not set in the open function set it here*/
     if(cached_src->dec_dsc.time_to_open == 0) {
         cached_src->dec_dsc.time_to_open = lv_tick_elaps(t_start);
@@ -137,9 +174,30 @@ _lv_img_cache_entry_t * _lv_img_cache_open(const void * src, lv_color_t color, i
 
     if(cached_src->dec_dsc.time_to_open == 0) cached_src->dec_dsc.time_to_open = 1;
 
+    cached_src->ref_cnt = 1;
+
+#if LV_IMG_CACHE_DEF_SIZE
+    entry_add(id, hash);
+#endif
+
     return cached_src;
 }
 
+/**
+ * Tell that an entry returned by `_lv_img_cache_open` is not used anymore.
+ * With disabled caching it closes the image.
+ * @param entry pointer to a cache entry
+ */
+void _lv_img_cache_release(_lv_img_cache_entry_t * entry)
+{
+    if(entry->ref_cnt) entry->ref_cnt--;
+
+    /*Automatically close images with no caching*/
+#if LV_IMG_CACHE_DEF_SIZE == 0
+    lv_img_decoder_close(&entry->dec_dsc);
+#endif
+}
+
 /**
  * Set the number of images to be cached.
  * More cached images mean more opened image at same time which might mean more memory usage.
@@ -156,19 +214,65 @@ void lv_img_cache_set_size(uint16_t new_entry_cnt)
         /*Clean the cache before free it*/
         lv_img_cache_invalidate_src(NULL);
         lv_mem_free(LV_GC_ROOT(_lv_img_cache_array));
+        LV_GC_ROOT(_lv_img_cache_array) = NULL;
     }
 
-    /*Reallocate the cache*/
-    LV_GC_ROOT(_lv_img_cache_array) = lv_mem_alloc(sizeof(_lv_img_cache_entry_t) * new_entry_cnt);
+    entry_cnt = 0;
+    buckets = NULL;
+    lru_head = ENTRY_NONE;
+    lru_tail = ENTRY_NONE;
+    free_head = ENTRY_NONE;
+    cache_stat.entry_max = 0;
+    cache_stat.entry_cnt = 0;
+    cache_stat.mem_used = 0;
+
+    /*ENTRY_NONE is reserved to mark the end of the lists*/
+    if(new_entry_cnt == ENTRY_NONE) new_entry_cnt--;
+    if(new_entry_cnt == 0) return;
+
+    /*Have at least as many hash buckets as entries*/
+    uint32_t new_bucket_cnt = 1;
+    while(new_bucket_cnt < new_entry_cnt) new_bucket_cnt <<= 1;
+
+    /*Reallocate the cache. The hash buckets are stored after the entries*/
+    size_t entries_size = sizeof(_lv_img_cache_entry_t) * new_entry_cnt;
+    LV_GC_ROOT(_lv_img_cache_array) = lv_mem_alloc(entries_size + sizeof(uint16_t) * new_bucket_cnt);
     LV_ASSERT_MALLOC(LV_GC_ROOT(_lv_img_cache_array));
-    if(LV_GC_ROOT(_lv_img_cache_array) == NULL) {
-        entry_cnt = 0;
-        return;
-    }
+    if(LV_GC_ROOT(_lv_img_cache_array) == NULL) return;
+
     entry_cnt = new_entry_cnt;
+    bucket_cnt = new_bucket_cnt;
+    buckets = (uint16_t *)&LV_GC_ROOT(_lv_img_cache_array)[entry_cnt];
+    cache_stat.entry_max = entry_cnt;
+
+    /*Clean the cache and put all the entries to the free list*/
+    _lv_img_cache_entry_t * cache = LV_GC_ROOT(_lv_img_cache_array);
+    lv_memset_00(cache, entries_size);
+    lv_memset_ff(buckets, sizeof(uint16_t) * bucket_cnt);
+
+    uint16_t i;
+    for(i = 0; i < entry_cnt; i++) {
+        cache[i].hash_next = i + 1 < entry_cnt ? i + 1 : ENTRY_NONE;
+    }
+    free_head = 0;
+#endif
+}
+
+/**
+ * Limit the memory used by the decoded images in the cache.
+ * The least recently used images are closed to stay in the budget.
+ * @param mem_size the budget in bytes. 0: no limit, only the number of entries is limited
+ */
+void lv_img_cache_set_mem_size(size_t mem_size)
+{
+    cache_stat.mem_max = mem_size;
 
-    /*Clean the cache*/
-    lv_memset_00(LV_GC_ROOT(_lv_img_cache_array), entry_cnt * sizeof(_lv_img_cache_entry_t));
+#if LV_IMG_CACHE_DEF_SIZE
+    if(cache_stat.mem_max) {
+        while(cache_stat.mem_used > cache_stat.mem_max) {
+            if(evict_lru(ENTRY_NONE) == false) break;
+        }
+    }
 #endif
 }
 
@@ -185,17 +289,207 @@ void lv_img_cache_invalidate_src(const void * src)
 
     uint16_t i;
     for(i = 0; i < entry_cnt; i++) {
+        if(cache[i].dec_dsc.src == NULL) continue;
         if(src == NULL || lv_img_cache_match(src, cache[i].dec_dsc.src)) {
-            if(cache[i].dec_dsc.src != NULL) {
-                lv_img_decoder_close(&cache[i].dec_dsc);
-            }
-
-            lv_memset_00(&cache[i], sizeof(_lv_img_cache_entry_t));
+            entry_remove(i);
         }
     }
 #endif
+
+#if LV_IMG_CACHE_ASYNC
+    async_invalidate_src(src);
+#endif
+}
+
+/**
+ * Get the statistics of the image cache
+ * @param stat pointer to a variable to store the statistics
+ */
+void lv_img_cache_get_stat(lv_img_cache_stat_t * stat)
+{
+    LV_ASSERT_NULL(stat);
+    lv_memcpy(stat, &cache_stat, sizeof(lv_img_cache_stat_t));
 }
 
+#if LV_IMG_CACHE_ASYNC
+
+/**
+ * Decode the not cached files and `LV_IMG_CF_RAW...` images (e.g. PNG or JPG in a C array) in the background.
+ * While an image is decoded a placeholder is drawn instead of it and its area is invalidated when it's ready.
+ * The image decoders run in the worker's thread so they and the memory allocator need to be thread safe.
+ * @param worker_cb a function to give the jobs to a worker. NULL to decode the images synchronously again.
+ */
+void lv_img_cache_set_async_worker(lv_img_cache_async_worker_cb_t worker_cb)
+{
+    async_worker_cb = worker_cb;
+
+    if(LV_GC_ROOT(_lv_img_cache_async_ll).n_size == 0) {
+        _lv_ll_init(&LV_GC_ROOT(_lv_img_cache_async_ll), sizeof(lv_img_cache_async_job_t));
+    }
+
+    /*The timer is deleted when there is no worker and all of its jobs are handled*/
+    if(worker_cb && async_timer == NULL) {
+        async_timer = lv_timer_create(async_timer_cb, LV_DISP_DEF_REFR_PERIOD, NULL);
+    }
+}
+
+/**
+ * Set an image to draw while an image is decoded in the background.
+ * @param src an image source or NULL to draw nothing
+ */
+void lv_img_cache_set_async_placeholder(const void * src)
+{
+    async_placeholder = src;
+}
+
+/**
+ * Decode the image of a job. Needs to be called by the worker (in its own thread) once for every job.
+ * @param job the job given to the worker
+ */
+void lv_img_cache_async_job_run(lv_img_cache_async_job_t * job)
+{
+    uint32_t t_start = lv_tick_get();
+    lv_res_t res = lv_img_decoder_open(&job->dec_dsc, job->src, job->color, job->frame_id);
+    if(res == LV_RES_OK) {
+        if(job->dec_dsc.time_to_open == 0) job->dec_dsc.time_to_open = lv_tick_elaps(t_start);
+        if(job->dec_dsc.time_to_open == 0) job->dec_dsc.time_to_open = 1;
+    }
+
+    /*Written last as the LVGL thread checks it*/
+    async_state_set(job, res == LV_RES_OK ? ASYNC_JOB_OPENED : ASYNC_JOB_ERROR);
+}
+
+/**
+ * Add the images decoded by the worker to the cache and invalidate their areas.
+ */
+void lv_img_cache_async_process(void)
+{
+    lv_ll_t * ll = &LV_GC_ROOT(_lv_img_cache_async_ll);
+    if(ll->n_size == 0) return;
+
+    _lv_img_cache_entry_t * cache = LV_GC_ROOT(_lv_img_cache_array);
+    lv_img_cache_async_job_t * job = _lv_ll_get_head(ll);
+    while(job) {
+        lv_img_cache_async_job_t * job_next = _lv_ll_get_next(ll, job);
+        uint8_t state = async_state_get(job);
+        if(state == ASYNC_JOB_PENDING || state == ASYNC_JOB_FAILED) {
+            job = job_next;
+            continue;
+        }
+
+        if(job->cancelled) {
+            if(state == ASYNC_JOB_OPENED) lv_img_decoder_close(&job->dec_dsc);
+            async_job_del(job);
+            job = job_next;
+            continue;
+        }
+
+        /*Invalidate the objects where they are now*/
+        lv_obj_t ** obj_p;
+        _LV_LL_READ(&job->obj_ll, obj_p) {
+            if(lv_obj_is_valid(*obj_p)) lv_obj_invalidate(*obj_p);
+        }
+
+        if(state == ASYNC_JOB_ERROR) {
+            /*Keep the job to not start it again. The image will be drawn synchronously to show the error.*/
+            LV_LOG_WARN("the image couldn't be decoded in the background");
+            async_state_set(job, ASYNC_JOB_FAILED);
+            job = job_next;
+            continue;
+        }
+
+        uint16_t id = entry_cnt ? entry_take() : ENTRY_NONE;
+        if(id == ENTRY_NONE) {
+            LV_LOG_WARN("no free entry for the image decoded in the background");
+            lv_img_decoder_close(&job->dec_dsc);
+        }
+        else {
+            lv_memcpy(&cache[id].dec_dsc, &job->dec_dsc, sizeof(lv_img_decoder_dsc_t));
+            cache[id].ref_cnt = 0;
+            entry_add(id, job->hash);
+        }
+
+        async_job_del(job);
+        job = job_next;
+    }
+}
+
+/**
+ * Start decoding an image in the background if it's not cached yet.
+ * @param src source of the image
+ * @param color the color of the image with `LV_IMG_CF_ALPHA_...`
+ * @param frame_id the index of the frame
+ * @return true: the image is being decoded, draw the placeholder;
+ *         false: the image needs to be opened with `_lv_img_cache_open`
+ */
+bool _lv_img_cache_async_start(const void * src, lv_color_t color, int32_t frame_id)
+{
+    if(async_worker_cb == NULL || entry_cnt == 0) return false;
+    if(src == async_placeholder || !is_async_src(src)) return false;
+
+    /*E.g. snapshots are drawn with a temporary display and they need the image right now*/
+    lv_disp_t * disp = _lv_refr_get_disp_refreshing();
+    if(!disp_is_valid(disp)) return false;
+
+    /*The object drawing the image will be invalidated when it's ready*/
+    lv_obj_t * obj = _lv_refr_get_obj_refreshing();
+    if(obj == NULL) return false;
+
+    uint32_t hash = get_hash(src, color, frame_id);
+    if(entry_find(src, color, frame_id, hash) != ENTRY_NONE) return false;
+
+    lv_img_cache_async_job_t * job = async_job_find(src, color, frame_id, hash);
+    if(job) {
+        if(async_state_get(job) == ASYNC_JOB_FAILED) return false;
+        return async_job_add_obj(job, obj);
+    }
+
+    job = _lv_ll_ins_tail(&LV_GC_ROOT(_lv_img_cache_async_ll));
+    LV_ASSERT_MALLOC(job);
+    if(job == NULL) return false;
+
+    lv_memset_00(job, sizeof(lv_img_cache_async_job_t));
+    _lv_ll_init(&job->obj_ll, sizeof(lv_obj_t *));
+    if(!async_job_add_obj(job, obj)) {
+        async_job_del(job);
+        return false;
+    }
+
+    if(lv_img_src_get_type(src) == LV_IMG_SRC_FILE) {
+        char * path = lv_mem_alloc(strlen(src) + 1);
+        LV_ASSERT_MALLOC(path);
+        if(path == NULL) {
+            async_job_del(job);
+            return false;
+        }
+        strcpy(path, src);
+        job->src = path;
+    }
+    else {
+        job->src = src;
+    }
+
+    job->color = color;
+    job->frame_id = frame_id;
+    job->hash = hash;
+    job->state = ASYNC_JOB_PENDING;
+    cache_stat.miss_cnt++;
+
+    async_worker_cb(job);
+    return true;
+}
+
+/**
+ * Get the placeholder image set by `lv_img_cache_set_async_placeholder`
+ * @return the placeholder image source or NULL
+ */
+const void * _lv_img_cache_async_get_placeholder(void)
+{
+    return async_placeholder;
+}
+
+#endif /*LV_IMG_CACHE_ASYNC*/
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -212,4 +506,321 @@ static bool lv_img_cache_match(const void * src1, const void * src2)
         return false;
     return strcmp(src1, src2) == 0;
 }
+
+/**
+ * FNV-1a hash of the source (the path for files, the address for variables), color and frame ID
+ */
+static uint32_t get_hash(const void * src, lv_color_t color, int32_t frame_id)
+{
+    uint32_t hash = 2166136261u;
+    if(lv_img_src_get_type(src) == LV_IMG_SRC_VARIABLE) {
+        uintptr_t p = (uintptr_t)src;
+        uint32_t i;
+        for(i = 0; i < sizeof(uintptr_t); i++) {
+            hash = (hash ^ (uint8_t)p) * 16777619u;
+            p >>= 8;
+        }
+    }
+    else {
+        const uint8_t * s = src;
+        while(*s) {
+            hash = (hash ^ *s) * 16777619u;
+            s++;
+        }
+    }
+
+    hash = (hash ^ color.full) * 16777619u;
+    hash = (hash ^ (uint32_t)frame_id) * 16777619u;
+    return hash;
+}
+
+/**
+ * Memory allocated for the decoded image. Images drawn directly from their variable don't use extra memory.
+ */
+static uint32_t get_entry_size(const _lv_img_cache_entry_t * entry)
+{
+    const lv_img_decoder_dsc_t * dsc = &entry->dec_dsc;
+    if(dsc->img_data == NULL) return 0;
+    if(dsc->src_type == LV_IMG_SRC_VARIABLE) {
+        const lv_img_dsc_t * img_dsc = dsc->src;
+        if(dsc->img_data >= img_dsc->data && dsc->img_data < img_dsc->data + img_dsc->data_size) return 0;
+    }
+
+    return lv_img_buf_get_img_size(dsc->header.w, dsc->header.h, dsc->header.cf);
+}
+
+static void lru_unlink(uint16_t id)
+{
+    _lv_img_cache_entry_t * cache = LV_GC_ROOT(_lv_img_cache_array);
+    _lv_img_cache_entry_t * entry = &cache[id];
+
+    if(entry->lru_prev != ENTRY_NONE) cache[entry->lru_prev].lru_next = entry->lru_next;
+    else lru_head = entry->lru_next;
+
+    if(entry->lru_next != ENTRY_NONE) cache[entry->lru_next].lru_prev = entry->lru_prev;
+    else lru_tail = entry->lru_prev;
+}
+
+static void lru_add_head(uint16_t id)
+{
+    _lv_img_cache_entry_t * cache = LV_GC_ROOT(_lv_img_cache_array);
+    cache[id].lru_prev = ENTRY_NONE;
+    cache[id].lru_next = lru_head;
+    if(lru_head != ENTRY_NONE) cache[lru_head].lru_prev = id;
+    else lru_tail = id;
+    lru_head = id;
+}
+
+static void hash_unlink(uint16_t id)
+{
+    _lv_img_cache_entry_t * cache = LV_GC_ROOT(_lv_img_cache_array);
+    uint16_t * next_p = &buckets[cache[id].hash & (bucket_cnt - 1)];
+    while(*next_p != ENTRY_NONE) {
+        if(*next_p == id) {
+            *next_p = cache[id].hash_next;
+            return;
+        }
+        next_p = &cache[*next_p].hash_next;
+    }
+}
+
+/**
+ * Close the image of an entry and put the entry to the free list
+ */
+static void entry_remove(uint16_t id)
+{
+    _lv_img_cache_entry_t * cache = LV_GC_ROOT(_lv_img_cache_array);
+    _lv_img_cache_entry_t * entry = &cache[id];
+
+    hash_unlink(id);
+    lru_unlink(id);
+    lv_img_decoder_close(&entry->dec_dsc);
+
+    cache_stat.entry_cnt--;
+    cache_stat.mem_used -= entry->size;
+
+    lv_memset_00(entry, sizeof(_lv_img_cache_entry_t));
+    entry->hash_next = free_head;
+    free_head = id;
+}
+
+/**
+ * Close the least recently used image which is not referenced
+ * @param keep_id an entry not to close
+ * @return true: an entry was freed; false: all the entries are in use
+ */
+static bool evict_lru(uint16_t keep_id)
+{
+    _lv_img_cache_entry_t * cache = LV_GC_ROOT(_lv_img_cache_array);
+    uint16_t id = lru_tail;
+    while(id != ENTRY_NONE) {
+        if(id != keep_id && cache[id].ref_cnt == 0) {
+            entry_remove(id);
+            cache_stat.evict_cnt++;
+            return true;
+        }
+        id = cache[id].lru_prev;
+    }
+
+    return false;
+}
+
+/**
+ * Find a cached image
+ * @return index of the entry or `ENTRY_NONE` if not found
+ */
+static uint16_t entry_find(const void * src, lv_color_t color, int32_t frame_id, uint32_t hash)
+{
+    _lv_img_cache_entry_t * cache = LV_GC_ROOT(_lv_img_cache_array);
+    uint16_t id = buckets[hash & (bucket_cnt - 1)];
+    while(id != ENTRY_NONE) {
+        _lv_img_cache_entry_t * entry = &cache[id];
+        if(entry->hash == hash &&
+           color.full == entry->dec_dsc.color.full &&
+           frame_id == entry->dec_dsc.frame_id &&
+           lv_img_cache_match(src, entry->dec_dsc.src)) {
+            return id;
+        }
+        id = entry->hash_next;
+    }
+
+    return ENTRY_NONE;
+}
+
+/**
+ * Take a free entry or close the least recently used one
+ * @return index of the entry or `ENTRY_NONE` if all the entries are in use
+ */
+static uint16_t entry_take(void)
+{
+    if(free_head == ENTRY_NONE) {
+        if(evict_lru(ENTRY_NONE) == false) return ENTRY_NONE;
+        LV_LOG_INFO("image draw: cache miss, close and reuse an entry");
+    }
+    else {
+        LV_LOG_INFO("image draw: cache miss, cached to an empty entry");
+    }
+
+    uint16_t id = free_head;
+    free_head = LV_GC_ROOT(_lv_img_cache_array)[id].hash_next;
+    return id;
+}
+
+/**
+ * Add an entry with an opened image to the hash bucket and to the head of the LRU list,
+ * then close the least recently used images to get back into the memory budget.
+ * The new image is kept even if it's alone larger than the budget.
+ */
+static void entry_add(uint16_t id, uint32_t hash)
+{
+    _lv_img_cache_entry_t * entry = &LV_GC_ROOT(_lv_img_cache_array)[id];
+    entry->hash = hash;
+    entry->size = get_entry_size(entry);
+
+    uint16_t * bucket = &buckets[hash & (bucket_cnt - 1)];
+    entry->hash_next = *bucket;
+    *bucket = id;
+    lru_add_head(id);
+
+    cache_stat.entry_cnt++;
+    cache_stat.mem_used += entry->size;
+
+    if(cache_stat.mem_max) {
+        while(cache_stat.mem_used > cache_stat.mem_max) {
+            if(evict_lru(id) == false) break;
+        }
+    }
+}
+#endif
+
+#if LV_IMG_CACHE_ASYNC
+/**
+ * Files and raw images (e.g. PNG or JPG in a C array) need slow decoders.
+ * Other images are drawn directly from their variable.
+ */
+static bool is_async_src(const void * src)
+{
+    lv_img_src_t src_type = lv_img_src_get_type(src);
+    if(src_type == LV_IMG_SRC_FILE) return true;
+    if(src_type != LV_IMG_SRC_VARIABLE) return false;
+
+    lv_img_cf_t cf = ((const lv_img_dsc_t *)src)->header.cf;
+    return cf == LV_IMG_CF_RAW || cf == LV_IMG_CF_RAW_ALPHA || cf == LV_IMG_CF_RAW_CHROMA_KEYED;
+}
+
+static bool disp_is_valid(const lv_disp_t * disp)
+{
+    if(disp == NULL) return false;
+
+    lv_disp_t * d = lv_disp_get_next(NULL);
+    while(d) {
+        if(d == disp) return true;
+        d = lv_disp_get_next(d);
+    }
+    return false;
+}
+
+static lv_img_cache_async_job_t * async_job_find(const void * src, lv_color_t color, int32_t frame_id, uint32_t hash)
+{
+    lv_img_cache_async_job_t * job;
+    _LV_LL_READ(&LV_GC_ROOT(_lv_img_cache_async_ll), job) {
+        if(job->cancelled == 0 && job->hash == hash && job->color.full == color.full && job->frame_id == frame_id &&
+           lv_img_cache_match(src, job->src)) {
+            return job;
+        }
+    }
+    return NULL;
+}
+
+static void async_job_del(lv_img_cache_async_job_t * job)
+{
+    if(job->src && lv_img_src_get_type(job->src) == LV_IMG_SRC_FILE) lv_mem_free((void *)job->src);
+    _lv_ll_clear(&job->obj_ll);
+    _lv_ll_remove(&LV_GC_ROOT(_lv_img_cache_async_ll), job);
+    lv_mem_free(job);
+}
+
+/**
+ * Forget the jobs of a source. The jobs still processed by the worker are deleted when they are finished.
+ */
+static void async_invalidate_src(const void * src)
+{
+    lv_ll_t * ll = &LV_GC_ROOT(_lv_img_cache_async_ll);
+    if(ll->n_size == 0) return;
+
+    lv_img_cache_async_job_t * job = _lv_ll_get_head(ll);
+    while(job) {
+        lv_img_cache_async_job_t * job_next = _lv_ll_get_next(ll, job);
+        if(src == NULL || lv_img_cache_match(src, job->src)) {
+            uint8_t state = async_state_get(job);
+            if(state == ASYNC_JOB_PENDING) {
+                job->cancelled = 1;
+            }
+            else {
+                if(state == ASYNC_JOB_OPENED) lv_img_decoder_close(&job->dec_dsc);
+                async_job_del(job);
+            }
+        }
+        job = job_next;
+    }
+}
+
+/**
+ * Remember an object to invalidate when the image of the job is ready
+ * @return false if there was not enough memory
+ */
+static bool async_job_add_obj(lv_img_cache_async_job_t * job, lv_obj_t * obj)
+{
+    lv_obj_t ** obj_p;
+    _LV_LL_READ(&job->obj_ll, obj_p) {
+        if(*obj_p == obj) return true;
+    }
+
+    obj_p = _lv_ll_ins_tail(&job->obj_ll);
+    LV_ASSERT_MALLOC(obj_p);
+    if(obj_p == NULL) return false;
+    *obj_p = obj;
+    return true;
+}
+
+/**
+ * The worker writes the decoded image before the state, so the state is stored with release and loaded with
+ * acquire ordering to see the image in the LVGL thread too.
+ * Without GCC builtins or C11 atomics the compiler and the CPU need to keep the order of `volatile` accesses.
+ */
+static uint8_t async_state_get(lv_img_cache_async_job_t * job)
+{
+#if defined(__GNUC__)
+    return __atomic_load_n(&job->state, __ATOMIC_ACQUIRE);
+#elif defined(ASYNC_USE_C11_FENCE)
+    uint8_t state = job->state;
+    atomic_thread_fence(memory_order_acquire);
+    return state;
+#else
+    return job->state;
+#endif
+}
+
+static void async_state_set(lv_img_cache_async_job_t * job, uint8_t state)
+{
+#if defined(__GNUC__)
+    __atomic_store_n(&job->state, state, __ATOMIC_RELEASE);
+#elif defined(ASYNC_USE_C11_FENCE)
+    atomic_thread_fence(memory_order_release);
+    job->state = state;
+#else
+    job->state = state;
+#endif
+}
+
+static void async_timer_cb(lv_timer_t * timer)
+{
+    LV_UNUSED(timer);
+    lv_img_cache_async_process();
+
+    if(async_worker_cb == NULL && _lv_ll_get_head(&LV_GC_ROOT(_lv_img_cache_async_ll)) == NULL) {
+        lv_timer_del(async_timer);
+        async_timer = NULL;
+    }
+}
 #endif
@@ -18,6 +18,13 @@ extern "C" {
 /*********************
  *      DEFINES
  *********************/
+#if LV_IMG_CACHE_ASYNC && LV_IMG_CACHE_DEF_SIZE == 0
+#error "LV_IMG_CACHE_ASYNC requires the image cache. Set LV_IMG_CACHE_DEF_SIZE > 0 in lv_conf.h"
+#endif
+
+#if LV_IMG_CACHE_DEF_SIZE >= 0xFFFF
+#error "LV_IMG_CACHE_DEF_SIZE needs to be less than 65535"
+#endif
 
 /**********************
  *      TYPEDEFS
@@ -31,12 +38,43 @@ extern "C" {
 typedef struct {
     lv_img_decoder_dsc_t dec_dsc; /**< Image information*/
 
-    /** Count the cache entries's life. Add `time_to_open` to `life` when the entry is used.
-     * Decrement all lifes by one every in every ::lv_img_cache_open.
-     * If life == 0 the entry can be reused*/
-    int32_t life;
+    uint32_t hash;          /**< Hash of the source, color and frame ID. Used to find the entry quickly*/
+    uint32_t size;          /**< Memory owned by the decoded image [bytes]. Counted in the memory budget*/
+
+    /** Number of users drawing the image right now.
+     * Referenced entries are never evicted. See ::_lv_img_cache_release*/
+    uint16_t ref_cnt;
+    uint16_t hash_next;     /**< Index of the next entry in the same hash bucket (or in the free list)*/
+    uint16_t lru_prev;      /**< Index of the more recently used entry*/
+    uint16_t lru_next;      /**< Index of the less recently used entry*/
 } _lv_img_cache_entry_t;
 
+/**
+ * Statistics of the image cache. See ::lv_img_cache_get_stat
+ */
+typedef struct {
+    uint32_t hit_cnt;       /**< Number of opens served from the cache*/
+    uint32_t miss_cnt;      /**< Number of opens which required decoding the image*/
+    uint32_t evict_cnt;     /**< Number of images closed to free an entry or memory*/
+    uint16_t entry_cnt;     /**< Number of images in the cache now*/
+    uint16_t entry_max;     /**< Maximal number of cached images. Set by ::lv_img_cache_set_size*/
+    size_t mem_used;        /**< Memory used by the decoded images in the cache [bytes]*/
+    size_t mem_max;         /**< Memory budget of the cache [bytes]. 0: no limit*/
+} lv_img_cache_stat_t;
+
+#if LV_IMG_CACHE_ASYNC
+/**
+ * An image to decode in the background. See ::lv_img_cache_set_async_worker
+ */
+typedef struct _lv_img_cache_async_job_t lv_img_cache_async_job_t;
+
+/**
+ * Called in the LVGL thread to give a job to a worker (e.g. to put it into the queue of a worker thread).
+ * The worker needs to call ::lv_img_cache_async_job_run with the job.
+ */
+typedef void (*lv_img_cache_async_worker_cb_t)(lv_img_cache_async_job_t * job);
+#endif
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -44,7 +82,8 @@ typedef struct {
 /**
  * Open an image using the image decoder interface and cache it.
  * The image will be left open meaning if the image decoder open callback allocated memory then it will remain.
- * The image is closed if a new image is opened and the new image takes its place in the cache.
+ * The least recently used image is closed if there is no free entry or the memory budget is exceeded.
+ * The returned entry is referenced (not evicted) until ::_lv_img_cache_release is called.
  * @param src source of the image. Path to file or pointer to an `lv_img_dsc_t` variable
  * @param color The color of the image with `LV_IMG_CF_ALPHA_...`
  * @param frame_id the index of the frame. Used only with animated images, set 0 for normal images
@@ -52,13 +91,27 @@ typedef struct {
  */
 _lv_img_cache_entry_t * _lv_img_cache_open(const void * src, lv_color_t color, int32_t frame_id);
 
+/**
+ * Tell that an entry returned by ::_lv_img_cache_open is not used anymore.
+ * With disabled caching it closes the image.
+ * @param entry pointer to a cache entry
+ */
+void _lv_img_cache_release(_lv_img_cache_entry_t * entry);
+
 /**
  * Set the number of images to be cached.
  * More cached images mean more opened image at same time which might mean more memory usage.
  * E.g. if 20 PNG or JPG images are open in the RAM they consume memory while opened in the cache.
  * @param new_entry_cnt number of image to cache
  */
-void lv_img_cache_set_size(uint16_t new_slot_num);
+void lv_img_cache_set_size(uint16_t new_entry_cnt);
+
+/**
+ * Limit the memory used by the decoded images in the cache.
+ * The least recently used images are closed to stay in the budget.
+ * @param mem_size the budget in bytes. 0: no limit, only the number of entries is limited
+ */
+void lv_img_cache_set_mem_size(size_t mem_size);
 
 /**
  * Invalidate an image source in the cache.
@@ -67,6 +120,62 @@ void lv_img_cache_set_size(uint16_t new_slot_num);
  */
 void lv_img_cache_invalidate_src(const void * src);
 
+/**
+ * Get the statistics of the image cache
+ * @param stat pointer to a variable to store the statistics
+ */
+void lv_img_cache_get_stat(lv_img_cache_stat_t * stat);
+
+#if LV_IMG_CACHE_ASYNC
+
+/**
+ * Decode the not cached files and `LV_IMG_CF_RAW...` images (e.g. PNG or JPG in a C array) in the background.
+ * While an image is decoded a placeholder is drawn instead of it and its area is invalidated when it's ready.
+ * The image decoders run in the worker's thread so they and the memory allocator need to be thread safe.
+ * @param worker_cb a function to give the jobs to a worker. NULL to decode the images synchronously again.
+ */
+void lv_img_cache_set_async_worker(lv_img_cache_async_worker_cb_t worker_cb);
+
+/**
+ * Set an image to draw while an image is decoded in the background.
+ * It's drawn in the middle of the image's area with the built-in decoder, so it should be a small C array image.
+ * (E.g. a "loading" icon or a low resolution version of the images.)
+ * @param src an image source or NULL to draw nothing
+ */
+void lv_img_cache_set_async_placeholder(const void * src);
+
+/**
+ * Decode the image of a job. Needs to be called by the worker (in its own thread) once for every job.
+ * @param job the job given to the worker
+ */
+void lv_img_cache_async_job_run(lv_img_cache_async_job_t * job);
+
+/**
+ * Add the images decoded by the worker to the cache and invalidate their areas.
+ * It's called periodically by a timer but can be called directly to handle the finished jobs right now.
+ */
+void lv_img_cache_async_process(void);
+
+/**
+ * Start decoding an image in the background if it's not cached yet.
+ * Only the displays are drawn asynchronously, not e.g. the snapshots.
+ * The object being drawn is invalidated when the image is ready.
+ * @param src source of the image
+ * @param color the color of the image with `LV_IMG_CF_ALPHA_...`
+ * @param frame_id the index of the frame
+ * @return true: the image is being decoded, draw the placeholder;
+ *         false: the image needs to be opened with ::_lv_img_cache_open
+ */
+bool _lv_img_cache_async_start(const void * src, lv_color_t color, int32_t frame_id);
+
+/**
+ * Get the placeholder image set by ::lv_img_cache_set_async_placeholder
+ * @return the placeholder image source or NULL
+ */
+const void * _lv_img_cache_async_get_placeholder(void);
+
+#endif /*LV_IMG_CACHE_ASYNC*/
+
 /**********************
  *      MACROS
  **********************/
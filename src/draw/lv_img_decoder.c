@@ -11,6 +11,7 @@
 #include "../draw/lv_draw_img.h"
 #include "../misc/lv_ll.h"
 #include "../misc/lv_gc.h"
+#include "../misc/lv_math.h"
 
 /*********************
  *      DEFINES
@@ -18,6 +19,9 @@
 #define CF_BUILT_IN_FIRST LV_IMG_CF_TRUE_COLOR
 #define CF_BUILT_IN_LAST LV_IMG_CF_ALPHA_8BIT
 
+/*Read the rows of files in chunks of about this size*/
+#define FILE_CHUNK_SIZE 4096
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -31,12 +35,15 @@ typedef struct {
 /**********************
  *  STATIC PROTOTYPES
  **********************/
-static lv_res_t lv_img_decoder_built_in_line_true_color(lv_img_decoder_dsc_t * dsc, lv_coord_t x, lv_coord_t y,
-                                                        lv_coord_t len, uint8_t * buf);
-static lv_res_t lv_img_decoder_built_in_line_alpha(lv_img_decoder_dsc_t * dsc, lv_coord_t x, lv_coord_t y,
-                                                   lv_coord_t len, uint8_t * buf);
-static lv_res_t lv_img_decoder_built_in_line_indexed(lv_img_decoder_dsc_t * dsc, lv_coord_t x, lv_coord_t y,
-                                                     lv_coord_t len, uint8_t * buf);
+static lv_res_t lv_img_decoder_built_in_area_true_color(lv_img_decoder_dsc_t * dsc, const lv_area_t * area,
+                                                        uint8_t * buf);
+static lv_res_t lv_img_decoder_built_in_area_bits(lv_img_decoder_dsc_t * dsc, const lv_area_t * area, uint8_t * buf);
+static void decode_alpha_row(lv_img_decoder_dsc_t * dsc, lv_coord_t x, lv_coord_t len, const uint8_t * row,
+                             uint8_t * buf);
+static void decode_indexed_row(lv_img_decoder_dsc_t * dsc, lv_coord_t x, lv_coord_t len, const uint8_t * row,
+                               uint8_t * buf);
+static uint32_t get_row_size(lv_img_cf_t cf, lv_coord_t w);
+static uint32_t get_palette_size(lv_img_cf_t cf);
 
 /**********************
  *  STATIC VARIABLES
@@ -70,6 +77,7 @@ void _lv_img_decoder_init(void)
     lv_img_decoder_set_info_cb(decoder, lv_img_decoder_built_in_info);
     lv_img_decoder_set_open_cb(decoder, lv_img_decoder_built_in_open);
     lv_img_decoder_set_read_line_cb(decoder, lv_img_decoder_built_in_read_line);
+    lv_img_decoder_set_read_area_cb(decoder, lv_img_decoder_built_in_read_area);
     lv_img_decoder_set_close_cb(decoder, lv_img_decoder_built_in_close);
 }
 
@@ -181,6 +189,36 @@ lv_res_t lv_img_decoder_read_line(lv_img_decoder_dsc_t * dsc, lv_coord_t x, lv_c
     return res;
 }
 
+/**
+ * Read a rectangular area from an opened image.
+ * @param dsc pointer to `lv_img_decoder_dsc_t` used in `lv_img_decoder_open`
+ * @param area the area to read in image coordinates
+ * @param buf store the data here
+ * @return LV_RES_OK: success; LV_RES_INV: an error occurred
+ */
+lv_res_t lv_img_decoder_read_area(lv_img_decoder_dsc_t * dsc, const lv_area_t * area, uint8_t * buf)
+{
+    if(dsc->decoder->read_area_cb) return dsc->decoder->read_area_cb(dsc->decoder, dsc, area, buf);
+    if(dsc->decoder->read_line_cb == NULL) return LV_RES_INV;
+
+    /*Read line by line with the pixel size the drawing expects*/
+    lv_img_cf_t cf = dsc->header.cf;
+    uint32_t px_size;
+    if(lv_img_cf_is_chroma_keyed(cf)) px_size = LV_COLOR_SIZE / 8;
+    else if(lv_img_cf_has_alpha(cf)) px_size = LV_IMG_PX_SIZE_ALPHA_BYTE;
+    else px_size = LV_COLOR_SIZE / 8;
+
+    lv_coord_t w = lv_area_get_width(area);
+    lv_coord_t y;
+    for(y = area->y1; y <= area->y2; y++) {
+        lv_res_t res = dsc->decoder->read_line_cb(dsc->decoder, dsc, area->x1, y, w, buf);
+        if(res != LV_RES_OK) return res;
+        buf += w * px_size;
+    }
+
+    return LV_RES_OK;
+}
+
 /**
  * Close a decoding session
  * @param dsc pointer to `lv_img_decoder_dsc_t` used in `lv_img_decoder_open`
@@ -253,6 +291,16 @@ void lv_img_decoder_set_read_line_cb(lv_img_decoder_t * decoder, lv_img_decoder_
     decoder->read_line_cb = read_line_cb;
 }
 
+/**
+ * Set a callback to decode a rectangular area of an image at once
+ * @param decoder pointer to an image decoder
+ * @param read_area_cb a function to read an area of an image
+ */
+void lv_img_decoder_set_read_area_cb(lv_img_decoder_t * decoder, lv_img_decoder_read_area_f_t read_area_cb)
+{
+    decoder->read_area_cb = read_area_cb;
+}
+
 /**
  * Set a callback to close a decoding session. E.g. close files and free other resources.
  * @param decoder pointer to an image decoder
@@ -453,6 +501,27 @@ lv_res_t lv_img_decoder_built_in_open(lv_img_decoder_t * decoder, lv_img_decoder
  */
 lv_res_t lv_img_decoder_built_in_read_line(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc, lv_coord_t x,
                                            lv_coord_t y, lv_coord_t len, uint8_t * buf)
+{
+    lv_area_t area;
+    area.x1 = x;
+    area.y1 = y;
+    area.x2 = x + len - 1;
+    area.y2 = y;
+
+    return lv_img_decoder_built_in_read_area(decoder, dsc, &area, buf);
+}
+
+/**
+ * Decode the pixels of a rectangular area and store them in `buf` row by row.
+ * The rows of files are read in large chunks instead of seeking to every line.
+ * @param decoder pointer to the decoder the function associated with
+ * @param dsc pointer to decoder descriptor
+ * @param area the area to decode in image coordinates
+ * @param buf a buffer to store the decoded pixels
+ * @return LV_RES_OK: ok; LV_RES_INV: failed
+ */
+lv_res_t lv_img_decoder_built_in_read_area(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc,
+                                           const lv_area_t * area, uint8_t * buf)
 {
     LV_UNUSED(decoder); /*Unused*/
 
@@ -460,19 +529,17 @@ lv_res_t lv_img_decoder_built_in_read_line(lv_img_decoder_t * decoder, lv_img_de
 
     if(dsc->header.cf == LV_IMG_CF_TRUE_COLOR || dsc->header.cf == LV_IMG_CF_TRUE_COLOR_ALPHA ||
        dsc->header.cf == LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED) {
-        /*For TRUE_COLOR images read line required only for files.
+        /*For TRUE_COLOR images read area required only for files.
          *For variables the image data was returned in `open`*/
         if(dsc->src_type == LV_IMG_SRC_FILE) {
-            res = lv_img_decoder_built_in_line_true_color(dsc, x, y, len, buf);
+            res = lv_img_decoder_built_in_area_true_color(dsc, area, buf);
         }
     }
     else if(dsc->header.cf == LV_IMG_CF_ALPHA_1BIT || dsc->header.cf == LV_IMG_CF_ALPHA_2BIT ||
-            dsc->header.cf == LV_IMG_CF_ALPHA_4BIT || dsc->header.cf == LV_IMG_CF_ALPHA_8BIT) {
-        res = lv_img_decoder_built_in_line_alpha(dsc, x, y, len, buf);
-    }
-    else if(dsc->header.cf == LV_IMG_CF_INDEXED_1BIT || dsc->header.cf == LV_IMG_CF_INDEXED_2BIT ||
+            dsc->header.cf == LV_IMG_CF_ALPHA_4BIT || dsc->header.cf == LV_IMG_CF_ALPHA_8BIT ||
+            dsc->header.cf == LV_IMG_CF_INDEXED_1BIT || dsc->header.cf == LV_IMG_CF_INDEXED_2BIT ||
             dsc->header.cf == LV_IMG_CF_INDEXED_4BIT || dsc->header.cf == LV_IMG_CF_INDEXED_8BIT) {
-        res = lv_img_decoder_built_in_line_indexed(dsc, x, y, len, buf);
+        res = lv_img_decoder_built_in_area_bits(dsc, area, buf);
     }
     else {
         LV_LOG_WARN("Built-in image decoder read not supports the color format");
@@ -508,33 +575,141 @@ void lv_img_decoder_built_in_close(lv_img_decoder_t * decoder, lv_img_decoder_ds
  *   STATIC FUNCTIONS
  **********************/
 
-static lv_res_t lv_img_decoder_built_in_line_true_color(lv_img_decoder_dsc_t * dsc, lv_coord_t x, lv_coord_t y,
-                                                        lv_coord_t len, uint8_t * buf)
+static lv_res_t lv_img_decoder_built_in_area_true_color(lv_img_decoder_dsc_t * dsc, const lv_area_t * area,
+                                                        uint8_t * buf)
 {
     lv_img_decoder_built_in_data_t * user_data = dsc->user_data;
+    lv_fs_file_t * f = &user_data->f;
+    uint32_t px_size = lv_img_cf_get_px_size(dsc->header.cf) >> 3;
+    uint32_t row_size = dsc->header.w * px_size;
+    uint32_t area_row_size = lv_area_get_width(area) * px_size;
+    uint32_t row_cnt = lv_area_get_height(area);
+    uint32_t pos = 4 + area->y1 * row_size + area->x1 * px_size;   /*+4 to skip the header*/
+    uint32_t br;
     lv_fs_res_t res;
-    uint8_t px_size = lv_img_cf_get_px_size(dsc->header.cf);
 
-    uint32_t pos = ((y * dsc->header.w + x) * px_size) >> 3;
-    pos += 4; /*Skip the header*/
-    res = lv_fs_seek(&user_data->f, pos, LV_FS_SEEK_SET);
-    if(res != LV_FS_RES_OK) {
-        LV_LOG_WARN("Built-in image decoder seek failed");
-        return LV_RES_INV;
+    /*Full rows are stored continuously. Read them at once.*/
+    if(area_row_size == row_size) {
+        res = lv_fs_seek(f, pos, LV_FS_SEEK_SET);
+        if(res == LV_FS_RES_OK) res = lv_fs_read(f, buf, row_size * row_cnt, &br);
+        if(res != LV_FS_RES_OK || br != row_size * row_cnt) {
+            LV_LOG_WARN("Built-in image decoder read failed");
+            return LV_RES_INV;
+        }
+        return LV_RES_OK;
     }
-    uint32_t btr = len * (px_size >> 3);
-    uint32_t br  = 0;
-    res = lv_fs_read(&user_data->f, buf, btr, &br);
-    if(res != LV_FS_RES_OK || btr != br) {
-        LV_LOG_WARN("Built-in image decoder read failed");
-        return LV_RES_INV;
+
+    /*Reading chunks of full rows is worth it only if the most of the rows is needed*/
+    uint32_t chunk_row_cnt = FILE_CHUNK_SIZE / row_size;
+    if(chunk_row_cnt > row_cnt) chunk_row_cnt = row_cnt;
+    uint8_t * chunk = NULL;
+    if(chunk_row_cnt > 1 && area_row_size * 2 >= row_size) chunk = lv_mem_buf_get(chunk_row_cnt * row_size);
+
+    if(chunk == NULL) {
+        uint32_t i;
+        for(i = 0; i < row_cnt; i++) {
+            res = lv_fs_seek(f, pos, LV_FS_SEEK_SET);
+            if(res == LV_FS_RES_OK) res = lv_fs_read(f, buf, area_row_size, &br);
+            if(res != LV_FS_RES_OK || br != area_row_size) {
+                LV_LOG_WARN("Built-in image decoder read failed");
+                return LV_RES_INV;
+            }
+            pos += row_size;
+            buf += area_row_size;
+        }
+        return LV_RES_OK;
+    }
+
+    while(row_cnt) {
+        uint32_t n = LV_MIN(chunk_row_cnt, row_cnt);
+        /*The last row is needed only until the end of the area*/
+        uint32_t btr = (n - 1) * row_size + area_row_size;
+        res = lv_fs_seek(f, pos, LV_FS_SEEK_SET);
+        if(res == LV_FS_RES_OK) res = lv_fs_read(f, chunk, btr, &br);
+        if(res != LV_FS_RES_OK || br != btr) {
+            LV_LOG_WARN("Built-in image decoder read failed");
+            lv_mem_buf_release(chunk);
+            return LV_RES_INV;
+        }
+
+        uint32_t i;
+        for(i = 0; i < n; i++) {
+            lv_memcpy(buf, chunk + i * row_size, area_row_size);
+            buf += area_row_size;
+        }
+        pos += n * row_size;
+        row_cnt -= n;
+    }
+
+    lv_mem_buf_release(chunk);
+    return LV_RES_OK;
+}
+
+/**
+ * Read the area of alpha only and indexed images
+ */
+static lv_res_t lv_img_decoder_built_in_area_bits(lv_img_decoder_dsc_t * dsc, const lv_area_t * area, uint8_t * buf)
+{
+    lv_img_cf_t cf = dsc->header.cf;
+    bool indexed = cf >= LV_IMG_CF_INDEXED_1BIT && cf <= LV_IMG_CF_INDEXED_8BIT;
+    uint32_t row_size = get_row_size(cf, dsc->header.w);
+    uint32_t data_ofs = get_palette_size(cf);
+    lv_coord_t len = lv_area_get_width(area);
+    uint32_t out_row_size = len * LV_IMG_PX_SIZE_ALPHA_BYTE;
+    lv_coord_t y;
+
+    if(dsc->src_type == LV_IMG_SRC_VARIABLE) {
+        const lv_img_dsc_t * img_dsc = dsc->src;
+        const uint8_t * row = img_dsc->data + data_ofs + area->y1 * row_size;
+        for(y = area->y1; y <= area->y2; y++) {
+            if(indexed) decode_indexed_row(dsc, area->x1, len, row, buf);
+            else decode_alpha_row(dsc, area->x1, len, row, buf);
+            row += row_size;
+            buf += out_row_size;
+        }
+        return LV_RES_OK;
     }
 
+    /*Read as many rows at once as fit into a chunk*/
+    lv_img_decoder_built_in_data_t * user_data = dsc->user_data;
+    uint32_t row_cnt = lv_area_get_height(area);
+    uint32_t chunk_row_cnt = LV_MAX(FILE_CHUNK_SIZE / row_size, 1);
+    if(chunk_row_cnt > row_cnt) chunk_row_cnt = row_cnt;
+    uint8_t * chunk = lv_mem_buf_get(chunk_row_cnt * row_size);
+    if(chunk == NULL) return LV_RES_INV;
+
+    uint32_t pos = 4 + data_ofs + area->y1 * row_size;   /*+4 to skip the header*/
+    while(row_cnt) {
+        uint32_t n = LV_MIN(chunk_row_cnt, row_cnt);
+        uint32_t br;
+        lv_fs_res_t res = lv_fs_seek(&user_data->f, pos, LV_FS_SEEK_SET);
+        if(res == LV_FS_RES_OK) res = lv_fs_read(&user_data->f, chunk, n * row_size, &br);
+        if(res != LV_FS_RES_OK || br != n * row_size) {
+            LV_LOG_WARN("Built-in image decoder read failed");
+            lv_mem_buf_release(chunk);
+            return LV_RES_INV;
+        }
+
+        uint32_t i;
+        for(i = 0; i < n; i++) {
+            if(indexed) decode_indexed_row(dsc, area->x1, len, chunk + i * row_size, buf);
+            else decode_alpha_row(dsc, area->x1, len, chunk + i * row_size, buf);
+            buf += out_row_size;
+        }
+        pos += n * row_size;
+        row_cnt -= n;
+    }
+
+    lv_mem_buf_release(chunk);
     return LV_RES_OK;
 }
 
-static lv_res_t lv_img_decoder_built_in_line_alpha(lv_img_decoder_dsc_t * dsc, lv_coord_t x, lv_coord_t y,
-                                                   lv_coord_t len, uint8_t * buf)
+/**
+ * Decode `len` pixels of an alpha only image from `x`
+ * @param row the data of the row in the image
+ */
+static void decode_alpha_row(lv_img_decoder_dsc_t * dsc, lv_coord_t x, lv_coord_t len, const uint8_t * row,
+                             uint8_t * buf)
 {
     const lv_opa_t alpha1_opa_table[2]  = {0, 255};          /*Opacity mapping with bpp = 1 (Just for compatibility)*/
     const lv_opa_t alpha2_opa_table[4]  = {0, 85, 170, 255}; /*Opacity mapping with bpp = 2*/
@@ -563,51 +738,30 @@ static lv_res_t lv_img_decoder_built_in_line_alpha(lv_img_decoder_dsc_t * dsc, l
     uint8_t px_size            = lv_img_cf_get_px_size(dsc->header.cf);
     uint16_t mask              = (1 << px_size) - 1; /*E.g. px_size = 2; mask = 0x03*/
 
-    lv_coord_t w = 0;
-    uint32_t ofs = 0;
+    const uint8_t * data_tmp = row;
     int8_t pos   = 0;
     switch(dsc->header.cf) {
         case LV_IMG_CF_ALPHA_1BIT:
-            w = (dsc->header.w + 7) >> 3; /*E.g. w = 20 -> w = 2 + 1*/
-            ofs += w * y + (x >> 3); /*First pixel*/
+            data_tmp += x >> 3; /*First pixel*/
             pos = 7 - (x & 0x7);
             opa_table = alpha1_opa_table;
             break;
         case LV_IMG_CF_ALPHA_2BIT:
-            w = (dsc->header.w + 3) >> 2; /*E.g. w = 13 -> w = 3 + 1 (bytes)*/
-            ofs += w * y + (x >> 2); /*First pixel*/
+            data_tmp += x >> 2; /*First pixel*/
             pos = 6 - (x & 0x3) * 2;
             opa_table = alpha2_opa_table;
             break;
         case LV_IMG_CF_ALPHA_4BIT:
-            w = (dsc->header.w + 1) >> 1; /*E.g. w = 13 -> w = 6 + 1 (bytes)*/
-            ofs += w * y + (x >> 1); /*First pixel*/
+            data_tmp += x >> 1; /*First pixel*/
             pos = 4 - (x & 0x1) * 4;
             opa_table = alpha4_opa_table;
             break;
         case LV_IMG_CF_ALPHA_8BIT:
-            w = dsc->header.w; /*E.g. x = 7 -> w = 7 (bytes)*/
-            ofs += w * y + x;  /*First pixel*/
+            data_tmp += x;  /*First pixel*/
             pos = 0;
             break;
     }
 
-    lv_img_decoder_built_in_data_t * user_data = dsc->user_data;
-    uint8_t * fs_buf = lv_mem_buf_get(w);
-    if(fs_buf == NULL) return LV_RES_INV;
-
-    const uint8_t * data_tmp = NULL;
-    if(dsc->src_type == LV_IMG_SRC_VARIABLE) {
-        const lv_img_dsc_t * img_dsc = dsc->src;
-
-        data_tmp = img_dsc->data + ofs;
-    }
-    else {
-        lv_fs_seek(&user_data->f, ofs + 4, LV_FS_SEEK_SET); /*+4 to skip the header*/
-        lv_fs_read(&user_data->f, fs_buf, w, NULL);
-        data_tmp = fs_buf;
-    }
-
     for(i = 0; i < len; i++) {
         uint8_t val_act = (*data_tmp >> pos) & mask;
 
@@ -620,61 +774,41 @@ static lv_res_t lv_img_decoder_built_in_line_alpha(lv_img_decoder_dsc_t * dsc, l
             data_tmp++;
         }
     }
-    lv_mem_buf_release(fs_buf);
-    return LV_RES_OK;
 }
 
-static lv_res_t lv_img_decoder_built_in_line_indexed(lv_img_decoder_dsc_t * dsc, lv_coord_t x, lv_coord_t y,
-                                                     lv_coord_t len, uint8_t * buf)
+/**
+ * Decode `len` pixels of an indexed image from `x`
+ * @param row the data of the row in the image
+ */
+static void decode_indexed_row(lv_img_decoder_dsc_t * dsc, lv_coord_t x, lv_coord_t len, const uint8_t * row,
+                               uint8_t * buf)
 {
     uint8_t px_size = lv_img_cf_get_px_size(dsc->header.cf);
     uint16_t mask   = (1 << px_size) - 1; /*E.g. px_size = 2; mask = 0x03*/
 
-    lv_coord_t w = 0;
+    const uint8_t * data_tmp = row;
     int8_t pos   = 0;
-    uint32_t ofs = 0;
     switch(dsc->header.cf) {
         case LV_IMG_CF_INDEXED_1BIT:
-            w = (dsc->header.w + 7) >> 3; /*E.g. w = 20 -> w = 2 + 1*/
-            ofs += w * y + (x >> 3); /*First pixel*/
-            ofs += 8;                /*Skip the palette*/
+            data_tmp += x >> 3; /*First pixel*/
             pos = 7 - (x & 0x7);
             break;
         case LV_IMG_CF_INDEXED_2BIT:
-            w = (dsc->header.w + 3) >> 2; /*E.g. w = 13 -> w = 3 + 1 (bytes)*/
-            ofs += w * y + (x >> 2); /*First pixel*/
-            ofs += 16;               /*Skip the palette*/
+            data_tmp += x >> 2; /*First pixel*/
             pos = 6 - (x & 0x3) * 2;
             break;
         case LV_IMG_CF_INDEXED_4BIT:
-            w = (dsc->header.w + 1) >> 1; /*E.g. w = 13 -> w = 6 + 1 (bytes)*/
-            ofs += w * y + (x >> 1); /*First pixel*/
-            ofs += 64;               /*Skip the palette*/
+            data_tmp += x >> 1; /*First pixel*/
             pos = 4 - (x & 0x1) * 4;
             break;
         case LV_IMG_CF_INDEXED_8BIT:
-            w = dsc->header.w; /*E.g. x = 7 -> w = 7 (bytes)*/
-            ofs += w * y + x;  /*First pixel*/
-            ofs += 1024;       /*Skip the palette*/
+            data_tmp += x;  /*First pixel*/
             pos = 0;
             break;
     }
 
     lv_img_decoder_built_in_data_t * user_data = dsc->user_data;
 
-    uint8_t * fs_buf = lv_mem_buf_get(w);
-    if(fs_buf == NULL) return LV_RES_INV;
-    const uint8_t * data_tmp = NULL;
-    if(dsc->src_type == LV_IMG_SRC_VARIABLE) {
-        const lv_img_dsc_t * img_dsc = dsc->src;
-        data_tmp                     = img_dsc->data + ofs;
-    }
-    else {
-        lv_fs_seek(&user_data->f, ofs + 4, LV_FS_SEEK_SET); /*+4 to skip the header*/
-        lv_fs_read(&user_data->f, fs_buf, w, NULL);
-        data_tmp = fs_buf;
-    }
-
     lv_coord_t i;
     for(i = 0; i < len; i++) {
         uint8_t val_act = (*data_tmp >> pos) & mask;
@@ -699,6 +833,43 @@ static lv_res_t lv_img_decoder_built_in_line_indexed(lv_img_decoder_dsc_t * dsc,
             data_tmp++;
         }
     }
-    lv_mem_buf_release(fs_buf);
-    return LV_RES_OK;
+}
+
+/**
+ * Get the size of a row of an alpha only or indexed image in bytes
+ */
+static uint32_t get_row_size(lv_img_cf_t cf, lv_coord_t w)
+{
+    switch(cf) {
+        case LV_IMG_CF_ALPHA_1BIT:
+        case LV_IMG_CF_INDEXED_1BIT:
+            return (w + 7) >> 3; /*E.g. w = 20 -> w = 2 + 1*/
+        case LV_IMG_CF_ALPHA_2BIT:
+        case LV_IMG_CF_INDEXED_2BIT:
+            return (w + 3) >> 2; /*E.g. w = 13 -> w = 3 + 1 (bytes)*/
+        case LV_IMG_CF_ALPHA_4BIT:
+        case LV_IMG_CF_INDEXED_4BIT:
+            return (w + 1) >> 1; /*E.g. w = 13 -> w = 6 + 1 (bytes)*/
+        default:
+            return w;
+    }
+}
+
+/**
+ * Get the size of the palette before the pixels of indexed images in bytes
+ */
+static uint32_t get_palette_size(lv_img_cf_t cf)
+{
+    switch(cf) {
+        case LV_IMG_CF_INDEXED_1BIT:
+            return 8;
+        case LV_IMG_CF_INDEXED_2BIT:
+            return 16;
+        case LV_IMG_CF_INDEXED_4BIT:
+            return 64;
+        case LV_IMG_CF_INDEXED_8BIT:
+            return 1024;
+        default:
+            return 0;
+    }
 }
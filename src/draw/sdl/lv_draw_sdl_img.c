@@ -200,17 +200,16 @@ bool lv_draw_sdl_img_load_texture(lv_draw_sdl_ctx_t * ctx, lv_draw_sdl_cache_key
         else {
             *texture = upload_img_texture(ctx->renderer, dsc);
         }
-#if LV_IMG_CACHE_DEF_SIZE == 0
-        lv_img_decoder_close(dsc);
-#endif
     }
     if(texture && cdsc) {
         *header = SDL_malloc(sizeof(lv_draw_sdl_img_header_t));
         SDL_memcpy(&(*header)->base, &cdsc->dec_dsc.header, sizeof(lv_img_header_t));
         (*header)->rect = rect;
         lv_draw_sdl_texture_cache_put_advanced(ctx, key, key_size, *texture, *header, SDL_free, tex_flags);
+        _lv_img_cache_release(cdsc);
     }
     else {
+        if(cdsc) _lv_img_cache_release(cdsc);
         lv_draw_sdl_texture_cache_put(ctx, key, key_size, NULL);
         return false;
     }
@@ -204,32 +204,8 @@ static lv_res_t decoder_read_line(lv_img_decoder_t * decoder, lv_img_decoder_dsc
     lv_fs_read(&b->f, buf, len * (b->bpp / 8), NULL);
 
 #if LV_COLOR_DEPTH == 32
-    if(b->bpp == 32) {
-        lv_coord_t i;
-        for(i = 0; i < len; i++) {
-            uint8_t b0 = buf[i * 4];
-            uint8_t b1 = buf[i * 4 + 1];
-            uint8_t b2 = buf[i * 4 + 2];
-            uint8_t b3 = buf[i * 4 + 3];
-            lv_color32_t * c = (lv_color32_t *)&buf[i * 4];
-            c->ch.red = b2;
-            c->ch.green = b1;
-            c->ch.blue = b0;
-            c->ch.alpha = b3;
-        }
-    }
-    if(b->bpp == 24) {
-        lv_coord_t i;
-
-        for(i = len - 1; i >= 0; i--) {
-            uint8_t * t = &buf[i * 3];
-            lv_color32_t * c = (lv_color32_t *)&buf[i * 4];
-            c->ch.red = t[2];
-            c->ch.green = t[1];
-            c->ch.blue = t[0];
-            c->ch.alpha = 0xff;
-        }
-    }
+    if(b->bpp == 32) lv_color_conv_to_native_alpha(buf, buf, len, LV_COLOR_CONV_BGRA8888);
+    if(b->bpp == 24) lv_color_conv_to_native(buf, buf, len, LV_COLOR_CONV_BGR888);
 #endif
 
     return LV_RES_OK;
@@ -15,6 +15,11 @@
 #include <libavutil/samplefmt.h>
 #include <libavutil/timestamp.h>
 #include <libswscale/swscale.h>
+#include <stdarg.h>
+#include <stdio.h>
+#if LV_FFMPEG_USE_THREAD
+    #include <pthread.h>
+#endif
 
 /*********************
  *      DEFINES
@@ -37,23 +42,59 @@
 
 #define FRAME_DEF_REFR_PERIOD   33  /*[ms]*/
 
+#if LV_FFMPEG_FRAME_QUEUE_SIZE < 2
+    #error "LV_FFMPEG_FRAME_QUEUE_SIZE needs to be at least 2 (one frame is shown, the others are decoded)"
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
+struct ffmpeg_frame_s {
+    uint8_t * data;     /*The frame in the display's color format*/
+    int64_t pts;        /*Presentation time [ms]*/
+};
+
 struct ffmpeg_context_s {
     AVFormatContext * fmt_ctx;
     AVCodecContext * video_dec_ctx;
     AVStream * video_stream;
-    uint8_t * video_src_data[4];
-    uint8_t * video_dst_data[4];
+    uint8_t * video_dst_data[4];        /*Where the next frame is scaled to*/
     struct SwsContext * sws_ctx;
     AVFrame * frame;
     AVPacket pkt;
     int video_stream_idx;
-    int video_src_linesize[4];
     int video_dst_linesize[4];
     enum AVPixelFormat video_dst_pix_fmt;
     bool has_alpha;
+    bool frame_ready;                   /*A frame was scaled to `video_dst_data`*/
+    int64_t frame_pts;                  /*Presentation time of that frame [ms]*/
+    int64_t first_pts;
+
+    /*Frame queue of the player. The decoder thread fills it, the LVGL timer shows the frames.
+     *The frame before `frame_head` is the shown one, so at most `LV_FFMPEG_FRAME_QUEUE_SIZE - 1` frames are waiting.*/
+    struct ffmpeg_frame_s frames[LV_FFMPEG_FRAME_QUEUE_SIZE];
+    uint32_t frame_buf_cnt;             /*Number of allocated frames*/
+    uint32_t frame_head;                /*The next frame to show*/
+    uint32_t frame_cnt;                 /*Number of decoded frames waiting*/
+    bool eof;                           /*The decoder has reached the end of the video or failed*/
+    char err_msg[128];                  /*Set by the decoder instead of logging as it might run in a thread*/
+    bool err_pending;                   /*`err_msg` is not logged yet*/
+#if LV_FFMPEG_USE_THREAD
+    bool quit;                          /*Ask the decoder thread to exit*/
+    bool thread_running;
+    bool sync_inited;
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+#endif
+
+    /*Playback clock*/
+    uint32_t play_start;                /*The tick when the frame with pts = 0 should be shown*/
+    uint32_t pause_tick;
+    int frame_period;                   /*[ms]*/
+    bool clock_valid;
+    bool paused;
+    lv_ffmpeg_player_stat_t stat;
 };
 
 #pragma pack(1)
@@ -77,7 +118,7 @@ static struct ffmpeg_context_s * ffmpeg_open_file(const char * path);
 static void ffmpeg_close(struct ffmpeg_context_s * ffmpeg_ctx);
 static void ffmpeg_close_src_ctx(struct ffmpeg_context_s * ffmpeg_ctx);
 static void ffmpeg_close_dst_ctx(struct ffmpeg_context_s * ffmpeg_ctx);
-static int ffmpeg_image_allocate(struct ffmpeg_context_s * ffmpeg_ctx);
+static int ffmpeg_image_allocate(struct ffmpeg_context_s * ffmpeg_ctx, uint32_t buf_cnt);
 static int ffmpeg_get_img_header(const char * path, lv_img_header_t * header);
 static int ffmpeg_get_frame_refr_period(struct ffmpeg_context_s * ffmpeg_ctx);
 static uint8_t * ffmpeg_get_img_data(struct ffmpeg_context_s * ffmpeg_ctx);
@@ -85,14 +126,23 @@ static int ffmpeg_update_next_frame(struct ffmpeg_context_s * ffmpeg_ctx);
 static int ffmpeg_output_video_frame(struct ffmpeg_context_s * ffmpeg_ctx);
 static bool ffmpeg_pix_fmt_has_alpha(enum AVPixelFormat pix_fmt);
 static bool ffmpeg_pix_fmt_is_yuv(enum AVPixelFormat pix_fmt);
+static void ffmpeg_set_error(struct ffmpeg_context_s * ffmpeg_ctx, const char * fmt, ...);
+
+static void ffmpeg_lock(struct ffmpeg_context_s * ffmpeg_ctx);
+static void ffmpeg_unlock(struct ffmpeg_context_s * ffmpeg_ctx);
+static void ffmpeg_signal(struct ffmpeg_context_s * ffmpeg_ctx);
+static bool ffmpeg_player_decode_frame(struct ffmpeg_context_s * ffmpeg_ctx);
+static void ffmpeg_player_log_error(struct ffmpeg_context_s * ffmpeg_ctx);
+static int ffmpeg_player_thread_start(struct ffmpeg_context_s * ffmpeg_ctx);
+static void ffmpeg_player_thread_stop(struct ffmpeg_context_s * ffmpeg_ctx);
+#if LV_FFMPEG_USE_THREAD
+    static void * ffmpeg_player_thread(void * arg);
+#endif
+static void ffmpeg_player_rewind(struct ffmpeg_context_s * ffmpeg_ctx);
 
 static void lv_ffmpeg_player_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void lv_ffmpeg_player_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 
-#if LV_COLOR_DEPTH != 32
-    static void convert_color_depth(uint8_t * img, uint32_t px_cnt);
-#endif
-
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -151,6 +201,8 @@ lv_res_t lv_ffmpeg_player_set_src(lv_obj_t * obj, const char * path)
     lv_ffmpeg_player_t * player = (lv_ffmpeg_player_t *)obj;
 
     if(player->ffmpeg_ctx) {
+        lv_img_cache_invalidate_src(&player->imgdsc);
+        ffmpeg_player_thread_stop(player->ffmpeg_ctx);
         ffmpeg_close(player->ffmpeg_ctx);
         player->ffmpeg_ctx = NULL;
     }
@@ -164,12 +216,28 @@ lv_res_t lv_ffmpeg_player_set_src(lv_obj_t * obj, const char * path)
         goto failed;
     }
 
-    if(ffmpeg_image_allocate(player->ffmpeg_ctx) < 0) {
+    if(ffmpeg_image_allocate(player->ffmpeg_ctx, LV_FFMPEG_FRAME_QUEUE_SIZE) < 0) {
         LV_LOG_ERROR("ffmpeg image allocate failed");
         ffmpeg_close(player->ffmpeg_ctx);
+        player->ffmpeg_ctx = NULL;
         goto failed;
     }
 
+    int period = ffmpeg_get_frame_refr_period(player->ffmpeg_ctx);
+
+    if(period > 0) {
+        LV_LOG_INFO("frame refresh period = %d ms, rate = %d fps",
+                    period, 1000 / period);
+    }
+    else {
+        LV_LOG_WARN("unable to get frame refresh period");
+        period = FRAME_DEF_REFR_PERIOD;
+    }
+
+    /*The frames are shown by their timestamps, check them twice per frame to show them in time*/
+    player->ffmpeg_ctx->frame_period = period;
+    lv_timer_set_period(player->timer, LV_MAX(period / 2, 1));
+
     bool has_alpha = player->ffmpeg_ctx->has_alpha;
     int width = player->ffmpeg_ctx->video_dec_ctx->width;
     int height = player->ffmpeg_ctx->video_dec_ctx->height;
@@ -187,21 +255,18 @@ lv_res_t lv_ffmpeg_player_set_src(lv_obj_t * obj, const char * path)
     player->imgdsc.header.h = height;
     player->imgdsc.data_size = data_size;
     player->imgdsc.header.cf = has_alpha ? LV_IMG_CF_TRUE_COLOR_ALPHA : LV_IMG_CF_TRUE_COLOR;
-    player->imgdsc.data = ffmpeg_get_img_data(player->ffmpeg_ctx);
+    player->imgdsc.data = player->ffmpeg_ctx->frames[0].data;
 
-    lv_img_set_src(&player->img.obj, &(player->imgdsc));
-
-    int period = ffmpeg_get_frame_refr_period(player->ffmpeg_ctx);
-
-    if(period > 0) {
-        LV_LOG_INFO("frame refresh period = %d ms, rate = %d fps",
-                    period, 1000 / period);
-        lv_timer_set_period(player->timer, period);
-    }
-    else {
-        LV_LOG_WARN("unable to get frame refresh period");
+    /*Start decoding the first frames already. The first buffer is shown now, start after it.*/
+    player->ffmpeg_ctx->frame_head = 1;
+    if(ffmpeg_player_thread_start(player->ffmpeg_ctx) < 0) {
+        ffmpeg_close(player->ffmpeg_ctx);
+        player->ffmpeg_ctx = NULL;
+        goto failed;
     }
 
+    lv_img_set_src(&player->img.obj, &(player->imgdsc));
+
     res = LV_RES_OK;
 
 failed:
@@ -219,25 +284,36 @@ void lv_ffmpeg_player_set_cmd(lv_obj_t * obj, lv_ffmpeg_player_cmd_t cmd)
     }
 
     lv_timer_t * timer = player->timer;
+    struct ffmpeg_context_s * ffmpeg_ctx = player->ffmpeg_ctx;
 
     switch(cmd) {
         case LV_FFMPEG_PLAYER_CMD_START:
-            av_seek_frame(player->ffmpeg_ctx->fmt_ctx,
-                          0, 0, AVSEEK_FLAG_BACKWARD);
+            ffmpeg_player_rewind(ffmpeg_ctx);
+            ffmpeg_lock(ffmpeg_ctx);
+            lv_memset_00(&ffmpeg_ctx->stat, sizeof(ffmpeg_ctx->stat));
+            ffmpeg_unlock(ffmpeg_ctx);
             lv_timer_resume(timer);
             LV_LOG_INFO("ffmpeg player start");
             break;
         case LV_FFMPEG_PLAYER_CMD_STOP:
-            av_seek_frame(player->ffmpeg_ctx->fmt_ctx,
-                          0, 0, AVSEEK_FLAG_BACKWARD);
+            ffmpeg_player_rewind(ffmpeg_ctx);
             lv_timer_pause(timer);
             LV_LOG_INFO("ffmpeg player stop");
             break;
         case LV_FFMPEG_PLAYER_CMD_PAUSE:
+            if(!ffmpeg_ctx->paused) {
+                ffmpeg_ctx->paused = true;
+                ffmpeg_ctx->pause_tick = lv_tick_get();
+            }
             lv_timer_pause(timer);
             LV_LOG_INFO("ffmpeg player pause");
             break;
         case LV_FFMPEG_PLAYER_CMD_RESUME:
+            /*Continue the clock from where it was paused*/
+            if(ffmpeg_ctx->paused) {
+                ffmpeg_ctx->paused = false;
+                ffmpeg_ctx->play_start += lv_tick_elaps(ffmpeg_ctx->pause_tick);
+            }
             lv_timer_resume(timer);
             LV_LOG_INFO("ffmpeg player resume");
             break;
@@ -254,6 +330,21 @@ void lv_ffmpeg_player_set_auto_restart(lv_obj_t * obj, bool en)
     player->auto_restart = en;
 }
 
+void lv_ffmpeg_player_get_stat(lv_obj_t * obj, lv_ffmpeg_player_stat_t * stat)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_ffmpeg_player_t * player = (lv_ffmpeg_player_t *)obj;
+
+    if(!player->ffmpeg_ctx) {
+        lv_memset_00(stat, sizeof(lv_ffmpeg_player_stat_t));
+        return;
+    }
+
+    ffmpeg_lock(player->ffmpeg_ctx);
+    *stat = player->ffmpeg_ctx->stat;
+    ffmpeg_unlock(player->ffmpeg_ctx);
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -289,27 +380,21 @@ static lv_res_t decoder_open(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t *
             return LV_RES_INV;
         }
 
-        if(ffmpeg_image_allocate(ffmpeg_ctx) < 0) {
+        if(ffmpeg_image_allocate(ffmpeg_ctx, 1) < 0) {
             LV_LOG_ERROR("ffmpeg image allocate failed");
             ffmpeg_close(ffmpeg_ctx);
             return LV_RES_INV;
         }
 
         if(ffmpeg_update_next_frame(ffmpeg_ctx) < 0) {
+            LV_LOG_ERROR("ffmpeg update frame failed: %s", ffmpeg_ctx->err_msg);
             ffmpeg_close(ffmpeg_ctx);
-            LV_LOG_ERROR("ffmpeg update frame failed");
             return LV_RES_INV;
         }
 
         ffmpeg_close_src_ctx(ffmpeg_ctx);
         uint8_t * img_data = ffmpeg_get_img_data(ffmpeg_ctx);
 
-#if LV_COLOR_DEPTH != 32
-        if(ffmpeg_ctx->has_alpha) {
-            convert_color_depth(img_data, dsc->header.w * dsc->header.h);
-        }
-#endif
-
         dsc->user_data = ffmpeg_ctx;
         dsc->img_data = img_data;
 
@@ -327,25 +412,6 @@ static void decoder_close(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc
     ffmpeg_close(ffmpeg_ctx);
 }
 
-#if LV_COLOR_DEPTH != 32
-
-static void convert_color_depth(uint8_t * img, uint32_t px_cnt)
-{
-    lv_color32_t * img_src_p = (lv_color32_t *)img;
-    struct lv_img_pixel_color_s * img_dst_p = (struct lv_img_pixel_color_s *)img;
-
-    for(uint32_t i = 0; i < px_cnt; i++) {
-        lv_color32_t temp = *img_src_p;
-        img_dst_p->c = lv_color_hex(temp.full);
-        img_dst_p->alpha = temp.ch.alpha;
-
-        img_src_p++;
-        img_dst_p++;
-    }
-}
-
-#endif
-
 static uint8_t * ffmpeg_get_img_data(struct ffmpeg_context_s * ffmpeg_ctx)
 {
     uint8_t * img_data = ffmpeg_ctx->video_dst_data[0];
@@ -398,76 +464,50 @@ static int ffmpeg_output_video_frame(struct ffmpeg_context_s * ffmpeg_ctx)
         /* To handle this change, one could call av_image_alloc again and
          * decode the following frames into another rawvideo file.
          */
-        LV_LOG_ERROR("Width, height and pixel format have to be "
-                     "constant in a rawvideo file, but the width, height or "
-                     "pixel format of the input video changed:\n"
-                     "old: width = %d, height = %d, format = %s\n"
-                     "new: width = %d, height = %d, format = %s\n",
-                     width,
-                     height,
-                     av_get_pix_fmt_name(ffmpeg_ctx->video_dec_ctx->pix_fmt),
-                     frame->width, frame->height,
-                     av_get_pix_fmt_name(frame->format));
+        ffmpeg_set_error(ffmpeg_ctx, "The width, height and pixel format of the video changed "
+                         "from %d x %d, %s to %d x %d, %s",
+                         width, height, av_get_pix_fmt_name(ffmpeg_ctx->video_dec_ctx->pix_fmt),
+                         frame->width, frame->height, av_get_pix_fmt_name(frame->format));
         goto failed;
     }
 
-    LV_LOG_TRACE("video_frame coded_n:%d", frame->coded_picture_number);
-
-    /* copy decoded frame to destination buffer:
-     * this is required since rawvideo expects non aligned data
-     */
-    av_image_copy(ffmpeg_ctx->video_src_data, ffmpeg_ctx->video_src_linesize,
-                  (const uint8_t **)(frame->data), frame->linesize,
-                  ffmpeg_ctx->video_dec_ctx->pix_fmt, width, height);
-
-    if(ffmpeg_ctx->sws_ctx == NULL) {
-        int swsFlags = SWS_BILINEAR;
-
-        if(ffmpeg_pix_fmt_is_yuv(ffmpeg_ctx->video_dec_ctx->pix_fmt)) {
-
-            /* When the video width and height are not multiples of 8,
-             * and there is no size change in the conversion,
-             * a blurry screen will appear on the right side
-             * This problem was discovered in 2012 and
-             * continues to exist in version 4.1.3 in 2019
-             * This problem can be avoided by increasing SWS_ACCURATE_RND
-             */
-            if((width & 0x7) || (height & 0x7)) {
-                LV_LOG_WARN("The width(%d) and height(%d) the image "
-                            "is not a multiple of 8, "
-                            "the decoding speed may be reduced",
-                            width, height);
-                swsFlags |= SWS_ACCURATE_RND;
-            }
-        }
-
-        ffmpeg_ctx->sws_ctx = sws_getContext(
-                                  width, height, ffmpeg_ctx->video_dec_ctx->pix_fmt,
-                                  width, height, ffmpeg_ctx->video_dst_pix_fmt,
-                                  swsFlags,
-                                  NULL, NULL, NULL);
-    }
-
-    if(!ffmpeg_ctx->has_alpha) {
-        int lv_linesize = sizeof(lv_color_t) * width;
-        int dst_linesize = ffmpeg_ctx->video_dst_linesize[0];
-        if(dst_linesize != lv_linesize) {
-            LV_LOG_WARN("ffmpeg linesize = %d, but lvgl image require %d",
-                        dst_linesize,
-                        lv_linesize);
-            ffmpeg_ctx->video_dst_linesize[0] = lv_linesize;
-        }
-    }
-
+    /*Scale directly from the decoder's frame to the display's color format*/
     ret = sws_scale(
               ffmpeg_ctx->sws_ctx,
-              (const uint8_t * const *)(ffmpeg_ctx->video_src_data),
-              ffmpeg_ctx->video_src_linesize,
+              (const uint8_t * const *)(frame->data),
+              frame->linesize,
               0,
               height,
               ffmpeg_ctx->video_dst_data,
               ffmpeg_ctx->video_dst_linesize);
 
+    if(ret < 0) {
+        ffmpeg_set_error(ffmpeg_ctx, "Could not scale the frame (%d)", ret);
+        goto failed;
+    }
+
+#if LV_COLOR_DEPTH != 32
+    if(ffmpeg_ctx->has_alpha) {
+        lv_color_conv_to_native_alpha(ffmpeg_ctx->video_dst_data[0], ffmpeg_ctx->video_dst_data[0], width * height,
+                                      LV_COLOR_CONV_BGRA8888);
+    }
+#endif
+
+    /*Presentation time in ms from the first frame*/
+    int64_t pts = frame->best_effort_timestamp;
+    if(pts == AV_NOPTS_VALUE) {
+        ffmpeg_ctx->frame_pts += ffmpeg_ctx->frame_period;
+    }
+    else {
+        pts = av_rescale_q(pts, ffmpeg_ctx->video_stream->time_base, (AVRational) {
+            1, 1000
+        });
+        if(ffmpeg_ctx->first_pts == AV_NOPTS_VALUE) ffmpeg_ctx->first_pts = pts;
+        ffmpeg_ctx->frame_pts = pts - ffmpeg_ctx->first_pts;
+    }
+
+    ffmpeg_ctx->frame_ready = true;
+
 failed:
     return ret;
 }
@@ -480,8 +520,7 @@ static int ffmpeg_decode_packet(AVCodecContext * dec, const AVPacket * pkt,
     /* submit the packet to the decoder */
     ret = avcodec_send_packet(dec, pkt);
     if(ret < 0) {
-        LV_LOG_ERROR("Error submitting a packet for decoding (%s)",
-                     av_err2str(ret));
+        ffmpeg_set_error(ffmpeg_ctx, "Error submitting a packet for decoding (%s)", av_err2str(ret));
         return ret;
     }
 
@@ -498,7 +537,7 @@ static int ffmpeg_decode_packet(AVCodecContext * dec, const AVPacket * pkt,
                 return 0;
             }
 
-            LV_LOG_ERROR("Error during decoding (%s)", av_err2str(ret));
+            ffmpeg_set_error(ffmpeg_ctx, "Error during decoding (%s)", av_err2str(ret));
             return ret;
         }
 
@@ -509,7 +548,6 @@ static int ffmpeg_decode_packet(AVCodecContext * dec, const AVPacket * pkt,
 
         av_frame_unref(ffmpeg_ctx->frame);
         if(ret < 0) {
-            LV_LOG_WARN("ffmpeg_decode_packet ended %d", ret);
             return ret;
         }
     }
@@ -632,11 +670,14 @@ static int ffmpeg_update_next_frame(struct ffmpeg_context_s * ffmpeg_ctx)
 {
     int ret = 0;
 
+    ffmpeg_ctx->frame_ready = false;
+    ffmpeg_ctx->err_msg[0] = '\0';
+
     while(1) {
 
         /* read frames from the file */
-        if(av_read_frame(ffmpeg_ctx->fmt_ctx, &(ffmpeg_ctx->pkt)) >= 0) {
-            bool is_image = false;
+        int read_res = av_read_frame(ffmpeg_ctx->fmt_ctx, &(ffmpeg_ctx->pkt));
+        if(read_res >= 0) {
 
             /* check if the packet belongs to a stream we are interested in,
              * otherwise skip it
@@ -644,22 +685,25 @@ static int ffmpeg_update_next_frame(struct ffmpeg_context_s * ffmpeg_ctx)
             if(ffmpeg_ctx->pkt.stream_index == ffmpeg_ctx->video_stream_idx) {
                 ret = ffmpeg_decode_packet(ffmpeg_ctx->video_dec_ctx,
                                            &(ffmpeg_ctx->pkt), ffmpeg_ctx);
-                is_image = true;
             }
 
             av_packet_unref(&(ffmpeg_ctx->pkt));
 
             if(ret < 0) {
-                LV_LOG_WARN("video frame is empty %d", ret);
                 break;
             }
 
-            /* Used to filter data that is not an image */
-            if(is_image) {
+            /* Continue until the decoder gives a whole frame
+             * (it might need more packets, e.g. before B-frames)
+             */
+            if(ffmpeg_ctx->frame_ready) {
                 break;
             }
         }
         else {
+            if(read_res != AVERROR_EOF) {
+                ffmpeg_set_error(ffmpeg_ctx, "Could not read a frame (%s)", av_err2str(read_res));
+            }
             ret = -1;
             break;
         }
@@ -668,6 +712,18 @@ static int ffmpeg_update_next_frame(struct ffmpeg_context_s * ffmpeg_ctx)
     return ret;
 }
 
+/**
+ * Save an error of the decoder. The decoder can run in a thread where LVGL can't be used,
+ * so it's logged later by the caller in LVGL's context.
+ */
+static void ffmpeg_set_error(struct ffmpeg_context_s * ffmpeg_ctx, const char * fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    vsnprintf(ffmpeg_ctx->err_msg, sizeof(ffmpeg_ctx->err_msg), fmt, args);
+    va_end(args);
+}
+
 struct ffmpeg_context_s * ffmpeg_open_file(const char * path)
 {
     if(path == NULL || strlen(path) == 0) {
@@ -706,6 +762,7 @@ struct ffmpeg_context_s * ffmpeg_open_file(const char * path)
         ffmpeg_ctx->has_alpha = ffmpeg_pix_fmt_has_alpha(ffmpeg_ctx->video_dec_ctx->pix_fmt);
 
         ffmpeg_ctx->video_dst_pix_fmt = (ffmpeg_ctx->has_alpha ? AV_PIX_FMT_BGRA : AV_PIX_FMT_TRUE_COLOR);
+        ffmpeg_ctx->first_pts = AV_NOPTS_VALUE;
     }
 
 #if LV_FFMPEG_AV_DUMP_FORMAT != 0
@@ -725,40 +782,81 @@ failed:
     return NULL;
 }
 
-static int ffmpeg_image_allocate(struct ffmpeg_context_s * ffmpeg_ctx)
+static int ffmpeg_image_allocate(struct ffmpeg_context_s * ffmpeg_ctx, uint32_t buf_cnt)
 {
     int ret;
+    uint32_t i;
 
-    /* allocate image where the decoded image will be put */
-    ret = av_image_alloc(
-              ffmpeg_ctx->video_src_data,
-              ffmpeg_ctx->video_src_linesize,
-              ffmpeg_ctx->video_dec_ctx->width,
-              ffmpeg_ctx->video_dec_ctx->height,
-              ffmpeg_ctx->video_dec_ctx->pix_fmt,
-              4);
+    /* allocate the images where the decoded frames will be scaled to.
+     * The decoder's frames are scaled directly, no source buffer is needed.
+     */
+    for(i = 0; i < buf_cnt; i++) {
+        ret = av_image_alloc(
+                  ffmpeg_ctx->video_dst_data,
+                  ffmpeg_ctx->video_dst_linesize,
+                  ffmpeg_ctx->video_dec_ctx->width,
+                  ffmpeg_ctx->video_dec_ctx->height,
+                  ffmpeg_ctx->video_dst_pix_fmt,
+                  4);
 
-    if(ret < 0) {
-        LV_LOG_ERROR("Could not allocate src raw video buffer");
-        return ret;
+        if(ret < 0) {
+            LV_LOG_ERROR("Could not allocate dst raw video buffer");
+            return ret;
+        }
+
+        ffmpeg_ctx->frames[i].data = ffmpeg_ctx->video_dst_data[0];
+        ffmpeg_ctx->frame_buf_cnt++;
     }
 
-    LV_LOG_INFO("alloc video_src_bufsize = %d", ret);
+    LV_LOG_INFO("allocate %d x video_dst_bufsize = %d", (int)buf_cnt, ret);
 
-    ret = av_image_alloc(
-              ffmpeg_ctx->video_dst_data,
-              ffmpeg_ctx->video_dst_linesize,
-              ffmpeg_ctx->video_dec_ctx->width,
-              ffmpeg_ctx->video_dec_ctx->height,
-              ffmpeg_ctx->video_dst_pix_fmt,
-              4);
+    ffmpeg_ctx->video_dst_data[0] = ffmpeg_ctx->frames[0].data;
 
-    if(ret < 0) {
-        LV_LOG_ERROR("Could not allocate dst raw video buffer");
-        return ret;
+    int width = ffmpeg_ctx->video_dec_ctx->width;
+    int height = ffmpeg_ctx->video_dec_ctx->height;
+
+    if(!ffmpeg_ctx->has_alpha) {
+        int lv_linesize = sizeof(lv_color_t) * width;
+        int dst_linesize = ffmpeg_ctx->video_dst_linesize[0];
+        if(dst_linesize != lv_linesize) {
+            LV_LOG_WARN("ffmpeg linesize = %d, but lvgl image require %d",
+                        dst_linesize,
+                        lv_linesize);
+            ffmpeg_ctx->video_dst_linesize[0] = lv_linesize;
+        }
+    }
+
+    /*Create the scaler here, the frames might be decoded in a thread which can't log*/
+    int swsFlags = SWS_BILINEAR;
+
+    if(ffmpeg_pix_fmt_is_yuv(ffmpeg_ctx->video_dec_ctx->pix_fmt)) {
+
+        /* When the video width and height are not multiples of 8,
+         * and there is no size change in the conversion,
+         * a blurry screen will appear on the right side
+         * This problem was discovered in 2012 and
+         * continues to exist in version 4.1.3 in 2019
+         * This problem can be avoided by increasing SWS_ACCURATE_RND
+         */
+        if((width & 0x7) || (height & 0x7)) {
+            LV_LOG_WARN("The width(%d) and height(%d) the image "
+                        "is not a multiple of 8, "
+                        "the decoding speed may be reduced",
+                        width, height);
+            swsFlags |= SWS_ACCURATE_RND;
+        }
     }
 
-    LV_LOG_INFO("allocate video_dst_bufsize = %d", ret);
+    ffmpeg_ctx->sws_ctx = sws_getContext(
+                              width, height, ffmpeg_ctx->video_dec_ctx->pix_fmt,
+                              width, height, ffmpeg_ctx->video_dst_pix_fmt,
+                              swsFlags,
+                              NULL, NULL, NULL);
+
+    if(ffmpeg_ctx->sws_ctx == NULL) {
+        LV_LOG_ERROR("Could not create the scaler");
+        return -1;
+    }
 
     ffmpeg_ctx->frame = av_frame_alloc();
 
@@ -780,18 +878,17 @@ static void ffmpeg_close_src_ctx(struct ffmpeg_context_s * ffmpeg_ctx)
     avcodec_free_context(&(ffmpeg_ctx->video_dec_ctx));
     avformat_close_input(&(ffmpeg_ctx->fmt_ctx));
     av_frame_free(&(ffmpeg_ctx->frame));
-    if(ffmpeg_ctx->video_src_data[0] != NULL) {
-        av_free(ffmpeg_ctx->video_src_data[0]);
-        ffmpeg_ctx->video_src_data[0] = NULL;
-    }
 }
 
 static void ffmpeg_close_dst_ctx(struct ffmpeg_context_s * ffmpeg_ctx)
 {
-    if(ffmpeg_ctx->video_dst_data[0] != NULL) {
-        av_free(ffmpeg_ctx->video_dst_data[0]);
-        ffmpeg_ctx->video_dst_data[0] = NULL;
+    uint32_t i;
+    for(i = 0; i < ffmpeg_ctx->frame_buf_cnt; i++) {
+        av_free(ffmpeg_ctx->frames[i].data);
+        ffmpeg_ctx->frames[i].data = NULL;
     }
+    ffmpeg_ctx->frame_buf_cnt = 0;
+    ffmpeg_ctx->video_dst_data[0] = NULL;
 }
 
 static void ffmpeg_close(struct ffmpeg_context_s * ffmpeg_ctx)
@@ -804,33 +901,258 @@ static void ffmpeg_close(struct ffmpeg_context_s * ffmpeg_ctx)
     sws_freeContext(ffmpeg_ctx->sws_ctx);
     ffmpeg_close_src_ctx(ffmpeg_ctx);
     ffmpeg_close_dst_ctx(ffmpeg_ctx);
+#if LV_FFMPEG_USE_THREAD
+    if(ffmpeg_ctx->sync_inited) {
+        pthread_mutex_destroy(&ffmpeg_ctx->lock);
+        pthread_cond_destroy(&ffmpeg_ctx->cond);
+    }
+#endif
     free(ffmpeg_ctx);
 
     LV_LOG_INFO("ffmpeg_ctx closed");
 }
 
+static void ffmpeg_lock(struct ffmpeg_context_s * ffmpeg_ctx)
+{
+#if LV_FFMPEG_USE_THREAD
+    pthread_mutex_lock(&ffmpeg_ctx->lock);
+#else
+    LV_UNUSED(ffmpeg_ctx);
+#endif
+}
+
+static void ffmpeg_unlock(struct ffmpeg_context_s * ffmpeg_ctx)
+{
+#if LV_FFMPEG_USE_THREAD
+    pthread_mutex_unlock(&ffmpeg_ctx->lock);
+#else
+    LV_UNUSED(ffmpeg_ctx);
+#endif
+}
+
+/**
+ * Tell the decoder thread that a frame buffer got free or it should quit
+ */
+static void ffmpeg_signal(struct ffmpeg_context_s * ffmpeg_ctx)
+{
+#if LV_FFMPEG_USE_THREAD
+    pthread_cond_signal(&ffmpeg_ctx->cond);
+#else
+    LV_UNUSED(ffmpeg_ctx);
+#endif
+}
+
+/**
+ * Decode the next frame into the first free buffer of the queue.
+ * Called by the decoder thread or by the player's timer if there is no thread, so it can't use LVGL.
+ * @param ffmpeg_ctx pointer to the context of a player
+ * @return false: the video has ended or failed
+ */
+static bool ffmpeg_player_decode_frame(struct ffmpeg_context_s * ffmpeg_ctx)
+{
+    ffmpeg_lock(ffmpeg_ctx);
+    uint32_t idx = (ffmpeg_ctx->frame_head + ffmpeg_ctx->frame_cnt) % LV_FFMPEG_FRAME_QUEUE_SIZE;
+    ffmpeg_unlock(ffmpeg_ctx);
+
+    ffmpeg_ctx->video_dst_data[0] = ffmpeg_ctx->frames[idx].data;
+    int ret = ffmpeg_update_next_frame(ffmpeg_ctx);
+
+    ffmpeg_lock(ffmpeg_ctx);
+    if(ret < 0 || !ffmpeg_ctx->frame_ready) {
+        ffmpeg_ctx->eof = true;
+        if(ffmpeg_ctx->err_msg[0] != '\0') {
+            ffmpeg_ctx->stat.errors++;
+            ffmpeg_ctx->err_pending = true;
+        }
+        ffmpeg_unlock(ffmpeg_ctx);
+        return false;
+    }
+    ffmpeg_ctx->frames[idx].pts = ffmpeg_ctx->frame_pts;
+    ffmpeg_ctx->frame_cnt++;
+    ffmpeg_ctx->stat.decoded++;
+    ffmpeg_unlock(ffmpeg_ctx);
+
+    return true;
+}
+
+/**
+ * Log the error of the decoder if it's not logged yet. Call it only in LVGL's context.
+ * @param ffmpeg_ctx pointer to the context of a player
+ */
+static void ffmpeg_player_log_error(struct ffmpeg_context_s * ffmpeg_ctx)
+{
+    char msg[sizeof(ffmpeg_ctx->err_msg)];
+
+    ffmpeg_lock(ffmpeg_ctx);
+    bool pending = ffmpeg_ctx->err_pending;
+    if(pending) {
+        lv_memcpy(msg, ffmpeg_ctx->err_msg, sizeof(msg));
+        ffmpeg_ctx->err_pending = false;
+    }
+    ffmpeg_unlock(ffmpeg_ctx);
+
+    if(pending) {
+        LV_LOG_ERROR("ffmpeg video decoding failed: %s", msg);
+    }
+}
+
+#if LV_FFMPEG_USE_THREAD
+
+static void * ffmpeg_player_thread(void * arg)
+{
+    struct ffmpeg_context_s * ffmpeg_ctx = arg;
+
+    while(1) {
+        /*Wait for a free frame. The one before the head is shown, don't touch it.*/
+        pthread_mutex_lock(&ffmpeg_ctx->lock);
+        while(!ffmpeg_ctx->quit && ffmpeg_ctx->frame_cnt == LV_FFMPEG_FRAME_QUEUE_SIZE - 1) {
+            pthread_cond_wait(&ffmpeg_ctx->cond, &ffmpeg_ctx->lock);
+        }
+        bool quit = ffmpeg_ctx->quit;
+        pthread_mutex_unlock(&ffmpeg_ctx->lock);
+
+        if(quit) break;
+
+        if(!ffmpeg_player_decode_frame(ffmpeg_ctx)) break;
+    }
+
+    return NULL;
+}
+
+static int ffmpeg_player_thread_start(struct ffmpeg_context_s * ffmpeg_ctx)
+{
+    if(!ffmpeg_ctx->sync_inited) {
+        pthread_mutex_init(&ffmpeg_ctx->lock, NULL);
+        pthread_cond_init(&ffmpeg_ctx->cond, NULL);
+        ffmpeg_ctx->sync_inited = true;
+    }
+
+    /*Don't lose the error of the previous run*/
+    ffmpeg_player_log_error(ffmpeg_ctx);
+
+    ffmpeg_ctx->quit = false;
+    ffmpeg_ctx->eof = false;
+
+    if(pthread_create(&ffmpeg_ctx->thread, NULL, ffmpeg_player_thread, ffmpeg_ctx) != 0) {
+        LV_LOG_ERROR("Could not create the decoder thread");
+        return -1;
+    }
+
+    ffmpeg_ctx->thread_running = true;
+    return 0;
+}
+
+static void ffmpeg_player_thread_stop(struct ffmpeg_context_s * ffmpeg_ctx)
+{
+    if(!ffmpeg_ctx->thread_running) return;
+
+    pthread_mutex_lock(&ffmpeg_ctx->lock);
+    ffmpeg_ctx->quit = true;
+    pthread_cond_signal(&ffmpeg_ctx->cond);
+    pthread_mutex_unlock(&ffmpeg_ctx->lock);
+
+    pthread_join(ffmpeg_ctx->thread, NULL);
+    ffmpeg_ctx->thread_running = false;
+}
+
+#else
+
+/*Without a thread the player's timer decodes the frames*/
+static int ffmpeg_player_thread_start(struct ffmpeg_context_s * ffmpeg_ctx)
+{
+    ffmpeg_player_log_error(ffmpeg_ctx);
+    ffmpeg_ctx->eof = false;
+    return 0;
+}
+
+static void ffmpeg_player_thread_stop(struct ffmpeg_context_s * ffmpeg_ctx)
+{
+    LV_UNUSED(ffmpeg_ctx);
+}
+
+#endif /*LV_FFMPEG_USE_THREAD*/
+
+static void ffmpeg_player_rewind(struct ffmpeg_context_s * ffmpeg_ctx)
+{
+    ffmpeg_player_thread_stop(ffmpeg_ctx);
+
+    av_seek_frame(ffmpeg_ctx->fmt_ctx, 0, 0, AVSEEK_FLAG_BACKWARD);
+    avcodec_flush_buffers(ffmpeg_ctx->video_dec_ctx);
+
+    /*Drop the decoded frames but keep the shown one*/
+    uint32_t shown = (ffmpeg_ctx->frame_head + LV_FFMPEG_FRAME_QUEUE_SIZE - 1) % LV_FFMPEG_FRAME_QUEUE_SIZE;
+    ffmpeg_ctx->frame_head = (shown + 1) % LV_FFMPEG_FRAME_QUEUE_SIZE;
+    ffmpeg_ctx->frame_cnt = 0;
+    ffmpeg_ctx->first_pts = AV_NOPTS_VALUE;
+    ffmpeg_ctx->frame_pts = 0;
+    ffmpeg_ctx->clock_valid = false;
+    ffmpeg_ctx->paused = false;
+
+    if(ffmpeg_player_thread_start(ffmpeg_ctx) < 0) {
+        ffmpeg_ctx->eof = true;
+    }
+}
+
 static void lv_ffmpeg_player_frame_update_cb(lv_timer_t * timer)
 {
     lv_obj_t * obj = (lv_obj_t *)timer->user_data;
     lv_ffmpeg_player_t * player = (lv_ffmpeg_player_t *)obj;
+    struct ffmpeg_context_s * ffmpeg_ctx = player->ffmpeg_ctx;
 
-    if(!player->ffmpeg_ctx) {
+    if(!ffmpeg_ctx) {
         return;
     }
 
-    int has_next = ffmpeg_update_next_frame(player->ffmpeg_ctx);
+#if LV_FFMPEG_USE_THREAD == 0
+    /*Decode one frame in every call. The timer runs twice per frame period so the queue fills up.*/
+    if(!ffmpeg_ctx->eof && ffmpeg_ctx->frame_cnt < LV_FFMPEG_FRAME_QUEUE_SIZE - 1) {
+        ffmpeg_player_decode_frame(ffmpeg_ctx);
+    }
+#endif
+
+    ffmpeg_player_log_error(ffmpeg_ctx);
+
+    ffmpeg_lock(ffmpeg_ctx);
+
+    if(ffmpeg_ctx->frame_cnt == 0) {
+        bool eof = ffmpeg_ctx->eof;
+        ffmpeg_unlock(ffmpeg_ctx);
 
-    if(has_next < 0) {
-        lv_ffmpeg_player_set_cmd(obj, player->auto_restart ? LV_FFMPEG_PLAYER_CMD_START : LV_FFMPEG_PLAYER_CMD_STOP);
+        /*Nothing is decoded yet or the video has ended*/
+        if(eof) {
+            lv_ffmpeg_player_set_cmd(obj, player->auto_restart ? LV_FFMPEG_PLAYER_CMD_START : LV_FFMPEG_PLAYER_CMD_STOP);
+        }
         return;
     }
 
-#if LV_COLOR_DEPTH != 32
-    if(player->ffmpeg_ctx->has_alpha) {
-        convert_color_depth((uint8_t *)(player->imgdsc.data),
-                            player->imgdsc.header.w * player->imgdsc.header.h);
+    /*Start the clock with the first frame*/
+    if(!ffmpeg_ctx->clock_valid) {
+        ffmpeg_ctx->play_start = lv_tick_get() - (uint32_t)ffmpeg_ctx->frames[ffmpeg_ctx->frame_head].pts;
+        ffmpeg_ctx->clock_valid = true;
+    }
+
+    /*Show the latest frame which is due and drop the ones before it*/
+    int64_t clock = lv_tick_elaps(ffmpeg_ctx->play_start);
+    int32_t shown = -1;
+    while(ffmpeg_ctx->frame_cnt > 0 && ffmpeg_ctx->frames[ffmpeg_ctx->frame_head].pts <= clock) {
+        if(shown >= 0) ffmpeg_ctx->stat.dropped++;
+        shown = ffmpeg_ctx->frame_head;
+        ffmpeg_ctx->frame_head = (ffmpeg_ctx->frame_head + 1) % LV_FFMPEG_FRAME_QUEUE_SIZE;
+        ffmpeg_ctx->frame_cnt--;
+    }
+
+    if(shown >= 0) {
+        player->imgdsc.data = ffmpeg_ctx->frames[shown].data;
+        ffmpeg_ctx->stat.shown++;
+        if(clock - ffmpeg_ctx->frames[shown].pts > ffmpeg_ctx->frame_period) ffmpeg_ctx->stat.late++;
+
+        /*The previously shown frame can be reused*/
+        ffmpeg_signal(ffmpeg_ctx);
     }
-#endif
+
+    ffmpeg_unlock(ffmpeg_ctx);
+
+    if(shown < 0) return;
 
     lv_img_cache_invalidate_src(lv_img_get_src(obj));
     lv_obj_invalidate(obj);
@@ -866,8 +1188,11 @@ static void lv_ffmpeg_player_destructor(const lv_obj_class_t * class_p,
 
     lv_img_cache_invalidate_src(lv_img_get_src(obj));
 
-    ffmpeg_close(player->ffmpeg_ctx);
-    player->ffmpeg_ctx = NULL;
+    if(player->ffmpeg_ctx) {
+        ffmpeg_player_thread_stop(player->ffmpeg_ctx);
+        ffmpeg_close(player->ffmpeg_ctx);
+        player->ffmpeg_ctx = NULL;
+    }
 
     LV_TRACE_OBJ_CREATE("finished");
 }
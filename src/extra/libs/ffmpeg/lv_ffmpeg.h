@@ -34,6 +34,15 @@ typedef struct {
     struct ffmpeg_context_s * ffmpeg_ctx;
 } lv_ffmpeg_player_t;
 
+/*Playback statistics of a player*/
+typedef struct {
+    uint32_t decoded;   /*Frames decoded*/
+    uint32_t shown;     /*Frames shown*/
+    uint32_t dropped;   /*Frames decoded but skipped because a later frame was due already*/
+    uint32_t late;      /*Frames shown more than a frame period after their time*/
+    uint32_t errors;    /*Decoding errors which stopped the video. They are logged by the player's timer.*/
+} lv_ffmpeg_player_stat_t;
+
 typedef enum {
     LV_FFMPEG_PLAYER_CMD_START,
     LV_FFMPEG_PLAYER_CMD_STOP,
@@ -87,6 +96,13 @@ void lv_ffmpeg_player_set_cmd(lv_obj_t * obj, lv_ffmpeg_player_cmd_t cmd);
  */
 void lv_ffmpeg_player_set_auto_restart(lv_obj_t * obj, bool en);
 
+/**
+ * Get the playback statistics since the last start
+ * @param obj pointer to a ffmpeg_player object
+ * @param stat store the statistics here
+ */
+void lv_ffmpeg_player_get_stat(lv_obj_t * obj, lv_ffmpeg_player_stat_t * stat);
+
 /*=====================
  * Other functions
  *====================*/
@@ -20,6 +20,7 @@
 /*********************
  *      DEFINES
  *********************/
+#define GLYPH_CACHE_BUCKETS 128     /*Must be power of 2*/
 
 /**********************
  *      TYPEDEFS
@@ -31,8 +32,22 @@ typedef struct {
 typedef struct name_refer_t {
     const char * name;  /* point to font name string */
     int32_t cnt;        /* reference count */
+    uint32_t glyph_cnt; /* cached glyphs of the face, they hold one reference together */
 } name_refer_t;
 
+/* A rendered glyph kept by LVGL. The face is identified by the shared name string
+ * so the glyphs remain valid if a font with the same face, size and style is created again. */
+typedef struct glyph_cache_entry_t {
+    struct glyph_cache_entry_t * next;  /* next entry in the same hash bucket */
+    const char * name;
+    uint32_t unicode;
+    uint16_t height;
+    uint16_t style;
+    lv_font_glyph_dsc_t dsc;
+    uint8_t * bitmap;                   /* A8 bitmap with box_w * box_h bytes */
+    uint32_t size;                      /* bytes counted in the budget */
+} glyph_cache_entry_t;
+
 typedef struct {
     const void * mem;
     const char * name;
@@ -66,12 +81,25 @@ static const char * name_refer_save(const char * name);
 static void name_refer_del(const char * name);
 static const char * name_refer_find(const char * name);
 
+static bool is_ft_font(const lv_font_t * font);
+static bool glyph_cache_get(const lv_font_fmt_ft_dsc_t * dsc, uint32_t unicode, lv_font_glyph_dsc_t * dsc_out);
+static void glyph_cache_add(const lv_font_fmt_ft_dsc_t * dsc, uint32_t unicode, const lv_font_glyph_dsc_t * g,
+                            const uint8_t * buf, int32_t pitch);
+static const uint8_t * glyph_cache_get_bitmap(const lv_font_fmt_ft_dsc_t * dsc, uint32_t unicode);
+static void glyph_cache_shrink(uint32_t max_bytes);
+static name_refer_t * glyph_cache_get_refer(const char * name);
+
 /**********************
 *  STATIC VARIABLES
 **********************/
 static FT_Library library;
 static lv_ll_t names_ll;
 
+static lv_ll_t glyph_lru_ll;     /* head is the most recently used glyph */
+static glyph_cache_entry_t ** glyph_buckets;
+static glyph_cache_entry_t * glyph_last;  /* the glyph whose bitmap is returned next */
+static lv_ft_glyph_cache_stat_t glyph_stat;
+
 #if LV_FREETYPE_CACHE_SIZE >= 0
     static FTC_Manager cache_manager;
     static FTC_CMapCache cmap_cache;
@@ -107,6 +135,10 @@ bool lv_freetype_init(uint16_t max_faces, uint16_t max_sizes, uint32_t max_bytes
 
     _lv_ll_init(&names_ll, sizeof(name_refer_t));
 
+    _lv_ll_init(&glyph_lru_ll, sizeof(glyph_cache_entry_t));
+    lv_memset_00(&glyph_stat, sizeof(glyph_stat));
+    glyph_stat.max_bytes = LV_FREETYPE_GLYPH_CACHE_SIZE;
+
 #if LV_FREETYPE_CACHE_SIZE >= 0
     error = FTC_Manager_New(library, max_faces, max_sizes,
                             max_bytes, font_face_requester, NULL, &cache_manager);
@@ -152,6 +184,10 @@ Fail:
 
 void lv_freetype_destroy(void)
 {
+    lv_ft_glyph_cache_clear();
+    lv_mem_free(glyph_buckets);
+    glyph_buckets = NULL;
+
 #if LV_FREETYPE_CACHE_SIZE >= 0
     FTC_Manager_Done(cache_manager);
 #endif
@@ -169,6 +205,8 @@ bool lv_ft_font_init(lv_ft_info_t * info)
 
 void lv_ft_font_destroy(lv_font_t * font)
 {
+    lv_font_width_cache_invalidate(font);
+
 #if LV_FREETYPE_CACHE_SIZE >= 0
     lv_ft_font_destroy_cache(font);
 #else
@@ -176,6 +214,37 @@ void lv_ft_font_destroy(lv_font_t * font)
 #endif
 }
 
+void lv_ft_glyph_cache_set_size(uint32_t max_bytes)
+{
+    glyph_stat.max_bytes = max_bytes;
+    glyph_cache_shrink(max_bytes);
+}
+
+void lv_ft_glyph_cache_clear(void)
+{
+    glyph_cache_shrink(0);
+}
+
+void lv_ft_glyph_cache_get_stat(lv_ft_glyph_cache_stat_t * stat)
+{
+    *stat = glyph_stat;
+}
+
+uint32_t lv_ft_font_prewarm(const lv_font_t * font, const char * txt)
+{
+    if(font == NULL || txt == NULL || !is_ft_font(font)) return 0;
+
+    uint32_t cnt = 0;
+    uint32_t i = 0;
+    while(txt[i] != '\0') {
+        uint32_t letter = _lv_txt_encoded_next(txt, &i);
+        lv_font_glyph_dsc_t g;
+        if(font->get_glyph_dsc(font, &g, letter, 0) && glyph_last && glyph_last->unicode == letter) cnt++;
+    }
+
+    return cnt;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -247,6 +316,7 @@ static bool get_glyph_dsc_cb_cache(const lv_font_t * font,
     }
 
     lv_font_fmt_ft_dsc_t * dsc = (lv_font_fmt_ft_dsc_t *)(font->dsc);
+    if(glyph_cache_get(dsc, unicode_letter, dsc_out)) goto end;
 
     FTC_FaceID face_id = (FTC_FaceID)dsc;
     FT_Size face_size;
@@ -279,6 +349,7 @@ static bool get_glyph_dsc_cb_cache(const lv_font_t * font,
             current_face = NULL;
             return false;
         }
+        glyph_cache_add(dsc, unicode_letter, dsc_out, face->glyph->bitmap.buffer, face->glyph->bitmap.pitch);
         goto end;
     }
 
@@ -301,6 +372,7 @@ static bool get_glyph_dsc_cb_cache(const lv_font_t * font,
     dsc_out->ofs_x = sbit->left;    /*X offset of the bitmap in [pf]*/
     dsc_out->ofs_y = sbit->top - sbit->height; /*Y offset of the bitmap measured from the as line*/
     dsc_out->bpp = 8;               /*Bit per pixel: 1/2/4/8*/
+    glyph_cache_add(dsc, unicode_letter, dsc_out, sbit->buffer, sbit->pitch);
 #else
     FT_Error error = FTC_ImageCache_Lookup(image_cache, &desc_type, glyph_index, &image_glyph, NULL);
     if(error) {
@@ -320,6 +392,7 @@ static bool get_glyph_dsc_cb_cache(const lv_font_t * font,
     dsc_out->ofs_y = glyph_bitmap->top -
                      glyph_bitmap->bitmap.rows;         /*Y offset of the bitmap measured from the as line*/
     dsc_out->bpp = 8;         /*Bit per pixel: 1/2/4/8*/
+    glyph_cache_add(dsc, unicode_letter, dsc_out, glyph_bitmap->bitmap.buffer, glyph_bitmap->bitmap.pitch);
 #endif
 
 end:
@@ -332,9 +405,9 @@ end:
 
 static const uint8_t * get_glyph_bitmap_cb_cache(const lv_font_t * font, uint32_t unicode_letter)
 {
-    LV_UNUSED(unicode_letter);
-
     lv_font_fmt_ft_dsc_t * dsc = (lv_font_fmt_ft_dsc_t *)(font->dsc);
+    const uint8_t * cached = glyph_cache_get_bitmap(dsc, unicode_letter);
+    if(cached) return cached;
     if(dsc->style & FT_FONT_STYLE_BOLD) {
         if(current_face && current_face->glyph->format == FT_GLYPH_FORMAT_BITMAP) {
             return (const uint8_t *)(current_face->glyph->bitmap.buffer);
@@ -475,6 +548,8 @@ static bool get_glyph_dsc_cb_nocache(const lv_font_t * font,
     lv_font_fmt_ft_dsc_t * dsc = (lv_font_fmt_ft_dsc_t *)(font->dsc);
     FT_Face face = dsc->size->face;
 
+    if(glyph_cache_get(dsc, unicode_letter, dsc_out)) goto end;
+
     FT_UInt glyph_index = FT_Get_Char_Index(face, unicode_letter);
 
     if(face->size != dsc->size) {
@@ -515,7 +590,9 @@ static bool get_glyph_dsc_cb_nocache(const lv_font_t * font,
     dsc_out->ofs_y = face->glyph->bitmap_top -
                      face->glyph->bitmap.rows;         /*Y offset of the bitmap measured from the as line*/
     dsc_out->bpp = 8;         /*Bit per pixel: 1/2/4/8*/
+    glyph_cache_add(dsc, unicode_letter, dsc_out, face->glyph->bitmap.buffer, face->glyph->bitmap.pitch);
 
+end:
     if((dsc->style & FT_FONT_STYLE_ITALIC) && (unicode_letter_next == '\0')) {
         dsc_out->adv_w = dsc_out->box_w + dsc_out->ofs_x;
     }
@@ -525,8 +602,10 @@ static bool get_glyph_dsc_cb_nocache(const lv_font_t * font,
 
 static const uint8_t * get_glyph_bitmap_cb_nocache(const lv_font_t * font, uint32_t unicode_letter)
 {
-    LV_UNUSED(unicode_letter);
     lv_font_fmt_ft_dsc_t * dsc = (lv_font_fmt_ft_dsc_t *)(font->dsc);
+    const uint8_t * cached = glyph_cache_get_bitmap(dsc, unicode_letter);
+    if(cached) return cached;
+
     FT_Face face = dsc->size->face;
     return (const uint8_t *)(face->glyph->bitmap.buffer);
 }
@@ -675,6 +754,7 @@ static const char * name_refer_save(const char * name)
         if(refer->name) {
             lv_memcpy((void *)refer->name, name, len);
             refer->cnt = 1;
+            refer->glyph_cnt = 0;
             return refer->name;
         }
         _lv_ll_remove(&names_ll, refer);
@@ -684,4 +764,176 @@ static const char * name_refer_save(const char * name)
     return "";
 }
 
+static bool is_ft_font(const lv_font_t * font)
+{
+#if LV_FREETYPE_CACHE_SIZE >= 0
+    return font->get_glyph_dsc == get_glyph_dsc_cb_cache;
+#else
+    return font->get_glyph_dsc == get_glyph_dsc_cb_nocache;
+#endif
+}
+
+static uint32_t glyph_cache_hash(const char * name, uint32_t unicode, uint16_t height, uint16_t style)
+{
+    uint32_t h = (uint32_t)((lv_uintptr_t)name >> 3);
+    h = h * 31 + unicode;
+    h = h * 31 + height;
+    h = h * 31 + style;
+    h ^= h >> 16;
+    return h & (GLYPH_CACHE_BUCKETS - 1);
+}
+
+static glyph_cache_entry_t * glyph_cache_find(const lv_font_fmt_ft_dsc_t * dsc, uint32_t unicode)
+{
+    if(glyph_buckets == NULL) return NULL;
+
+    glyph_cache_entry_t * e = glyph_buckets[glyph_cache_hash(dsc->name, unicode, dsc->height, dsc->style)];
+    while(e) {
+        if(e->unicode == unicode && e->name == dsc->name && e->height == dsc->height && e->style == dsc->style) {
+            return e;
+        }
+        e = e->next;
+    }
+    return NULL;
+}
+
+/**
+ * Get a glyph's descriptor from the cache. Its bitmap will be returned by `glyph_cache_get_bitmap()`.
+ * @return true if the glyph was found
+ */
+static bool glyph_cache_get(const lv_font_fmt_ft_dsc_t * dsc, uint32_t unicode, lv_font_glyph_dsc_t * dsc_out)
+{
+    glyph_last = NULL;
+    if(glyph_stat.max_bytes == 0) return false;
+
+    glyph_cache_entry_t * e = glyph_cache_find(dsc, unicode);
+    if(e == NULL) {
+        glyph_stat.misses++;
+        return false;
+    }
+
+    glyph_stat.hits++;
+    _lv_ll_move_before(&glyph_lru_ll, e, _lv_ll_get_head(&glyph_lru_ll));
+    *dsc_out = e->dsc;
+    glyph_last = e;
+    return true;
+}
+
+/**
+ * Save a glyph rendered by FreeType. Old glyphs are dropped to stay in the byte budget.
+ * @param buf the bitmap of the glyph, `pitch` bytes per row
+ */
+static void glyph_cache_add(const lv_font_fmt_ft_dsc_t * dsc, uint32_t unicode, const lv_font_glyph_dsc_t * g,
+                            const uint8_t * buf, int32_t pitch)
+{
+    glyph_last = NULL;
+
+    uint32_t bitmap_size = (uint32_t)g->box_w * g->box_h;
+    uint32_t size = sizeof(glyph_cache_entry_t) + bitmap_size;
+    if(size > glyph_stat.max_bytes) return;
+    if(bitmap_size && buf == NULL) return;
+
+    if(glyph_buckets == NULL) {
+        glyph_buckets = lv_mem_alloc(sizeof(glyph_cache_entry_t *) * GLYPH_CACHE_BUCKETS);
+        LV_ASSERT_MALLOC(glyph_buckets);
+        if(glyph_buckets == NULL) return;
+        lv_memset_00(glyph_buckets, sizeof(glyph_cache_entry_t *) * GLYPH_CACHE_BUCKETS);
+    }
+
+    glyph_cache_shrink(glyph_stat.max_bytes - size);
+
+    uint8_t * bitmap = NULL;
+    if(bitmap_size) {
+        bitmap = lv_mem_alloc(bitmap_size);
+        if(bitmap == NULL) return;
+        uint32_t y;
+        for(y = 0; y < g->box_h; y++) {
+            lv_memcpy(bitmap + y * g->box_w, buf + (int32_t)y * pitch, g->box_w);
+        }
+    }
+
+    glyph_cache_entry_t * e = _lv_ll_ins_head(&glyph_lru_ll);
+    if(e == NULL) {
+        lv_mem_free(bitmap);
+        return;
+    }
+
+    /* keep the face's name alive after its fonts are destroyed */
+    name_refer_t * refer = glyph_cache_get_refer(dsc->name);
+    if(refer) {
+        if(refer->glyph_cnt == 0) refer->cnt++;
+        refer->glyph_cnt++;
+    }
+
+    e->name = dsc->name;
+    e->unicode = unicode;
+    e->height = dsc->height;
+    e->style = dsc->style;
+    e->dsc = *g;
+    e->bitmap = bitmap;
+    e->size = size;
+
+    uint32_t b = glyph_cache_hash(e->name, unicode, e->height, e->style);
+    e->next = glyph_buckets[b];
+    glyph_buckets[b] = e;
+
+    glyph_stat.used_bytes += size;
+    glyph_stat.entry_cnt++;
+    glyph_last = e;
+}
+
+/**
+ * Get the bitmap of the glyph found or added last.
+ * @return the bitmap or NULL if the glyph is not cached
+ */
+static const uint8_t * glyph_cache_get_bitmap(const lv_font_fmt_ft_dsc_t * dsc, uint32_t unicode)
+{
+    glyph_cache_entry_t * e = glyph_last;
+    if(e && e->unicode == unicode && e->name == dsc->name && e->height == dsc->height && e->style == dsc->style) {
+        return e->bitmap;
+    }
+    return NULL;
+}
+
+/**
+ * Drop the least recently used glyphs until the cache uses at most `max_bytes` bytes.
+ */
+static void glyph_cache_shrink(uint32_t max_bytes)
+{
+    while(glyph_stat.used_bytes > max_bytes) {
+        glyph_cache_entry_t * e = _lv_ll_get_tail(&glyph_lru_ll);
+        if(e == NULL) break;
+
+        glyph_cache_entry_t ** link = &glyph_buckets[glyph_cache_hash(e->name, e->unicode, e->height, e->style)];
+        while(*link != e) link = &(*link)->next;
+        *link = e->next;
+
+        if(glyph_last == e) glyph_last = NULL;
+        glyph_stat.used_bytes -= e->size;
+        glyph_stat.entry_cnt--;
+        if(max_bytes) glyph_stat.evictions++;
+
+        /* the last glyph of a face releases the reference on its name */
+        name_refer_t * refer = glyph_cache_get_refer(e->name);
+        if(refer && refer->glyph_cnt > 0) {
+            refer->glyph_cnt--;
+            if(refer->glyph_cnt == 0) name_refer_del(e->name);
+        }
+
+        _lv_ll_remove(&glyph_lru_ll, e);
+        lv_mem_free(e->bitmap);
+        lv_mem_free(e);
+    }
+}
+
+static name_refer_t * glyph_cache_get_refer(const char * name)
+{
+    name_refer_t * refer = _lv_ll_get_head(&names_ll);
+    while(refer) {
+        if(refer->name == name) return refer;
+        refer = _lv_ll_get_next(&names_ll, refer);
+    }
+    return NULL;
+}
+
 #endif /*LV_USE_FREETYPE*/
@@ -37,6 +37,15 @@ typedef struct {
     uint16_t style;     /* font style */
 } lv_ft_info_t;
 
+typedef struct {
+    uint32_t hits;          /* glyphs served from the glyph cache */
+    uint32_t misses;        /* glyphs rendered by FreeType */
+    uint32_t evictions;     /* glyphs dropped to stay in the budget */
+    uint32_t entry_cnt;     /* glyphs in the cache */
+    uint32_t used_bytes;    /* memory used by the cached glyphs */
+    uint32_t max_bytes;     /* the budget of the cache */
+} lv_ft_glyph_cache_stat_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -70,6 +79,34 @@ bool lv_ft_font_init(lv_ft_info_t * info);
  */
 void lv_ft_font_destroy(lv_font_t * font);
 
+/**
+ * Set the memory budget of the glyph cache. The glyphs rendered by FreeType are stored as A8 bitmaps
+ * and identified by face, size, style and character, so they are reused by fonts created later too.
+ * The least recently used glyphs are dropped if the budget is exceeded.
+ * @param max_bytes the new budget in bytes. 0: disable the glyph cache
+ */
+void lv_ft_glyph_cache_set_size(uint32_t max_bytes);
+
+/**
+ * Drop all the glyphs from the glyph cache.
+ */
+void lv_ft_glyph_cache_clear(void);
+
+/**
+ * Get the statistics of the glyph cache.
+ * @param stat store the statistics here
+ */
+void lv_ft_glyph_cache_get_stat(lv_ft_glyph_cache_stat_t * stat);
+
+/**
+ * Render the characters of a text and save them in the glyph cache.
+ * Useful at startup to avoid rendering glyphs while the UI is running.
+ * @param font pointer to a font created by `lv_ft_font_init()`
+ * @param txt an UTF-8 string with the characters to render
+ * @return number of characters which are in the glyph cache
+ */
+uint32_t lv_ft_font_prewarm(const lv_font_t * font, const char * txt);
+
 /**********************
  *      MACROS
  **********************/
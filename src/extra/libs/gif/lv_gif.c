@@ -10,6 +10,7 @@
 #if LV_USE_GIF
 
 #include "gifdec.h"
+#include <string.h>
 
 /*********************
  *      DEFINES
@@ -27,6 +28,11 @@
 static void lv_gif_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void lv_gif_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void next_frame_task_cb(lv_timer_t * t);
+static lv_res_t loop_end(lv_obj_t * obj);
+static void invalidate_frame_area(lv_obj_t * obj, const lv_area_t * area);
+static void ring_add_frame(lv_gif_t * gifobj, const lv_area_t * dirty);
+static void ring_start(lv_gif_t * gifobj);
+static void ring_free(lv_gif_t * gifobj);
 
 /**********************
  *  STATIC VARIABLES
@@ -62,6 +68,8 @@ void lv_gif_set_src(lv_obj_t * obj, const void * src)
     /*Close previous gif if any*/
     if(gifobj->gif) {
         lv_img_cache_invalidate_src(&gifobj->imgdsc);
+        ring_free(gifobj);
+        gifobj->ring_skip = 0;
         gd_close_gif(gifobj->gif);
         gifobj->gif = NULL;
         gifobj->imgdsc.data = NULL;
@@ -98,7 +106,37 @@ void lv_gif_set_src(lv_obj_t * obj, const void * src)
 void lv_gif_restart(lv_obj_t * obj)
 {
     lv_gif_t * gifobj = (lv_gif_t *) obj;
+    if(gifobj->gif == NULL) return;
+
+    if(gifobj->ring_ready) {
+        gifobj->ring_act = 0;
+        gifobj->imgdsc.data = gifobj->ring[0].data;
+        lv_img_cache_invalidate_src(&gifobj->imgdsc);
+        lv_obj_invalidate(obj);
+    }
+    else {
+        /*Record the loop again from its first frame*/
+        ring_free(gifobj);
+        gd_rewind(gifobj->gif);
+    }
+
+    lv_timer_resume(gifobj->timer);
+}
+
+void lv_gif_set_frame_ring(lv_obj_t * obj, uint16_t max_frames)
+{
+    lv_gif_t * gifobj = (lv_gif_t *) obj;
+    if(gifobj->ring_size == max_frames) return;
+
+    gifobj->ring_size = max_frames;
+    if(gifobj->gif == NULL) return;
+
+    /*Start recording from the beginning*/
+    bool was_ready = gifobj->ring_ready;
+    ring_free(gifobj);
+    gifobj->ring_skip = 0;
     gd_rewind(gifobj->gif);
+    if(was_ready) lv_obj_invalidate(obj);
 }
 
 /**********************
@@ -120,6 +158,7 @@ static void lv_gif_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     LV_UNUSED(class_p);
     lv_gif_t * gifobj = (lv_gif_t *) obj;
     lv_img_cache_invalidate_src(&gifobj->imgdsc);
+    ring_free(gifobj);
     gd_close_gif(gifobj->gif);
     lv_timer_del(gifobj->timer);
 }
@@ -128,28 +167,211 @@ static void next_frame_task_cb(lv_timer_t * t)
 {
     lv_obj_t * obj = t->user_data;
     lv_gif_t * gifobj = (lv_gif_t *) obj;
+
+    /*Don't decode anything until the shown frame's delay has elapsed*/
+    uint16_t delay = gifobj->ring_ready ? gifobj->ring[gifobj->ring_act].delay : gifobj->gif->gce.delay;
     uint32_t elaps = lv_tick_elaps(gifobj->last_call);
-    if(elaps < gifobj->gif->gce.delay * 10) return;
+    if(elaps < delay * 10) return;
 
     gifobj->last_call = lv_tick_get();
 
-    int has_next = gd_get_frame(gifobj->gif);
-    if(has_next == 0) {
-        /*It was the last repeat*/
-        if(gifobj->gif->loop_count == 1) {
-            lv_res_t res = lv_event_send(obj, LV_EVENT_READY, NULL);
-            if(res != LV_FS_RES_OK) return;
+    if(gifobj->ring_ready) {
+        uint16_t next = gifobj->ring_act + 1;
+        if(next == gifobj->ring_cnt) {
+            if(loop_end(obj) != LV_RES_OK) return;
+            next = 0;
         }
-        else {
-            if(gifobj->gif->loop_count > 1)  gifobj->gif->loop_count--;
-            gd_rewind(gifobj->gif);
+
+        gifobj->ring_act = next;
+        gifobj->imgdsc.data = gifobj->ring[next].data;
+        lv_img_cache_invalidate_src(&gifobj->imgdsc);
+        invalidate_frame_area(obj, &gifobj->ring[next].dirty);
+        return;
+    }
+
+    gd_GIF * gif = gifobj->gif;
+
+    /*Restoring to the background color clears the area of the previous frame*/
+    bool prev_cleared = gif->gce.disposal == 2;
+    lv_area_t prev_area;
+    lv_area_set(&prev_area, gif->fx, gif->fy, gif->fx + gif->fw - 1, gif->fy + gif->fh - 1);
+
+    int has_next = gd_get_frame(gif);
+    if(has_next == 0) {
+        if(loop_end(obj) != LV_RES_OK) return;
+
+        /*The whole loop was recorded: play the next loops from the ring*/
+        if(gifobj->ring_cnt && !gifobj->ring_skip) {
+            ring_start(gifobj);
+            invalidate_frame_area(obj, &gifobj->ring[0].dirty);
+            return;
         }
+
+        gd_rewind(gif);
     }
 
-    gd_render_frame(gifobj->gif, (uint8_t *)gifobj->imgdsc.data);
+    gd_render_frame(gif, (uint8_t *)gifobj->imgdsc.data);
+
+    lv_area_t dirty;
+    lv_area_set(&dirty, gif->fx, gif->fy, gif->fx + gif->fw - 1, gif->fy + gif->fh - 1);
+    if(prev_cleared) _lv_area_join(&dirty, &dirty, &prev_area);
+
+    if(has_next == 1) ring_add_frame(gifobj, &dirty);
 
     lv_img_cache_invalidate_src(lv_img_get_src(obj));
-    lv_obj_invalidate(obj);
+    invalidate_frame_area(obj, &dirty);
+}
+
+/**
+ * Handle the end of a loop
+ * @param obj   pointer to a gif object
+ * @return      LV_RES_INV if it was the last repeat (and the object might be deleted in `LV_EVENT_READY`)
+ */
+static lv_res_t loop_end(lv_obj_t * obj)
+{
+    lv_gif_t * gifobj = (lv_gif_t *) obj;
+
+    /*It was the last repeat*/
+    if(gifobj->gif->loop_count == 1) {
+        lv_timer_pause(gifobj->timer);
+        lv_event_send(obj, LV_EVENT_READY, NULL);
+        return LV_RES_INV;
+    }
+
+    if(gifobj->gif->loop_count > 1)  gifobj->gif->loop_count--;
+    return LV_RES_OK;
+}
+
+/**
+ * Invalidate the area of the object where an area of the image is drawn
+ * @param obj   pointer to a gif object
+ * @param area  area on the image
+ */
+static void invalidate_frame_area(lv_obj_t * obj, const lv_area_t * area)
+{
+    if(lv_area_get_width(area) <= 0 || lv_area_get_height(area) <= 0) return;
+
+    /*Only the plain case is mapped. Transformed, shifted or tiled images are invalidated entirely.*/
+    lv_img_t * img = (lv_img_t *) obj;
+    if(img->angle != 0 || img->zoom != LV_IMG_ZOOM_NONE || img->offset.x != 0 || img->offset.y != 0 ||
+       lv_obj_get_style_transform_angle(obj, LV_PART_MAIN) != 0 ||
+       lv_obj_get_style_transform_zoom(obj, LV_PART_MAIN) != LV_IMG_ZOOM_NONE ||
+       lv_obj_get_content_width(obj) != img->w || lv_obj_get_content_height(obj) != img->h) {
+        lv_obj_invalidate(obj);
+        return;
+    }
+
+    lv_area_t content;
+    lv_obj_get_content_coords(obj, &content);
+
+    lv_area_t a;
+    lv_area_copy(&a, area);
+    lv_area_move(&a, content.x1, content.y1);
+    lv_obj_invalidate_area(obj, &a);
+}
+
+/**
+ * Save the current canvas into the frame ring while the first loop is played
+ * @param gifobj    pointer to a gif object
+ * @param dirty     the area changed by the frame
+ */
+static void ring_add_frame(lv_gif_t * gifobj, const lv_area_t * dirty)
+{
+    /*Not worth it if the animation is played only once*/
+    if(gifobj->ring_size == 0 || gifobj->ring_skip || gifobj->gif->loop_count == 1) return;
+
+    if(gifobj->ring_cnt == gifobj->ring_size) {
+        LV_LOG_INFO("the loop has more than %d frames, decode it on the fly", gifobj->ring_size);
+        ring_free(gifobj);
+        gifobj->ring_skip = 1;
+        return;
+    }
+
+    if(gifobj->ring == NULL) {
+        gifobj->ring = lv_mem_alloc(sizeof(lv_gif_frame_t) * gifobj->ring_size);
+        LV_ASSERT_MALLOC(gifobj->ring);
+        if(gifobj->ring == NULL) {
+            gifobj->ring_skip = 1;
+            return;
+        }
+    }
+
+    uint32_t size = (uint32_t)gifobj->gif->width * gifobj->gif->height * LV_IMG_PX_SIZE_ALPHA_BYTE;
+    uint8_t * data = lv_mem_alloc(size);
+    if(data == NULL) {
+        LV_LOG_WARN("couldn't allocate a frame, decode it on the fly");
+        ring_free(gifobj);
+        gifobj->ring_skip = 1;
+        return;
+    }
+    lv_memcpy(data, gifobj->gif->canvas, size);
+
+    lv_gif_frame_t * frame = &gifobj->ring[gifobj->ring_cnt];
+    frame->data = data;
+    frame->delay = gifobj->gif->gce.delay;
+    lv_area_copy(&frame->dirty, dirty);
+    gifobj->ring_cnt++;
+}
+
+/**
+ * Start playing from the ring when the first loop has ended
+ * @param gifobj    pointer to a gif object
+ */
+static void ring_start(lv_gif_t * gifobj)
+{
+    /*The first frame was recorded on an empty canvas. Compare it to the last one
+     *to know what changes when the loop restarts.*/
+    const uint8_t * first = gifobj->ring[0].data;
+    const uint8_t * last = gifobj->ring[gifobj->ring_cnt - 1].data;
+    lv_coord_t w = gifobj->gif->width;
+    lv_coord_t h = gifobj->gif->height;
+    lv_area_t dirty;
+    lv_area_set(&dirty, w, h, -1, -1);
+
+    lv_coord_t x;
+    lv_coord_t y;
+    for(y = 0; y < h; y++) {
+        const uint8_t * row_first = &first[y * w * LV_IMG_PX_SIZE_ALPHA_BYTE];
+        const uint8_t * row_last = &last[y * w * LV_IMG_PX_SIZE_ALPHA_BYTE];
+        for(x = 0; x < w; x++) {
+            if(memcmp(&row_first[x * LV_IMG_PX_SIZE_ALPHA_BYTE], &row_last[x * LV_IMG_PX_SIZE_ALPHA_BYTE],
+                      LV_IMG_PX_SIZE_ALPHA_BYTE) == 0) continue;
+            dirty.x1 = LV_MIN(dirty.x1, x);
+            dirty.x2 = LV_MAX(dirty.x2, x);
+            dirty.y1 = LV_MIN(dirty.y1, y);
+            dirty.y2 = LV_MAX(dirty.y2, y);
+        }
+    }
+
+    if(dirty.x2 < dirty.x1) lv_area_set(&dirty, 0, 0, -1, -1);
+    lv_area_copy(&gifobj->ring[0].dirty, &dirty);
+
+    gifobj->ring_ready = 1;
+    gifobj->ring_act = 0;
+    gifobj->imgdsc.data = gifobj->ring[0].data;
+    lv_img_cache_invalidate_src(&gifobj->imgdsc);
+}
+
+/**
+ * Free the frame ring and return to decoding
+ * @param gifobj    pointer to a gif object
+ */
+static void ring_free(lv_gif_t * gifobj)
+{
+    if(gifobj->ring_ready) {
+        gifobj->imgdsc.data = gifobj->gif->canvas;
+        lv_img_cache_invalidate_src(&gifobj->imgdsc);
+        gifobj->ring_ready = 0;
+    }
+
+    uint16_t i;
+    for(i = 0; i < gifobj->ring_cnt; i++) {
+        lv_mem_free(gifobj->ring[i].data);
+    }
+    lv_mem_free(gifobj->ring);
+    gifobj->ring = NULL;
+    gifobj->ring_cnt = 0;
+    gifobj->ring_act = 0;
 }
 
 #endif /*LV_USE_GIF*/
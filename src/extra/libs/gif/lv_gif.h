@@ -27,12 +27,25 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+/*A decoded frame kept in the frame ring*/
+typedef struct {
+    uint8_t * data;         /*The whole canvas after rendering the frame*/
+    lv_area_t dirty;        /*The area changed compared to the previous frame*/
+    uint16_t delay;         /*How long to show the frame [10 ms]*/
+} lv_gif_frame_t;
+
 typedef struct {
     lv_img_t img;
     gd_GIF * gif;
     lv_timer_t * timer;
     lv_img_dsc_t imgdsc;
     uint32_t last_call;
+    lv_gif_frame_t * ring;  /*Decoded frames of the first loop*/
+    uint16_t ring_size;     /*Max. number of frames to keep decoded. 0: disabled*/
+    uint16_t ring_cnt;      /*Number of frames in `ring`*/
+    uint16_t ring_act;      /*Index of the shown frame while playing from the ring*/
+    uint8_t ring_ready : 1; /*1: the whole loop is in the ring and it's played from there*/
+    uint8_t ring_skip : 1;  /*1: the loop doesn't fit into the ring*/
 } lv_gif_t;
 
 extern const lv_obj_class_t lv_gif_class;
@@ -45,6 +58,15 @@ lv_obj_t * lv_gif_create(lv_obj_t * parent);
 void lv_gif_set_src(lv_obj_t * obj, const void * src);
 void lv_gif_restart(lv_obj_t * gif);
 
+/**
+ * Keep the frames of short animations decoded.
+ * The frames of the first loop are saved and if the whole loop fits into `max_frames`
+ * the next loops are played without decoding. Requires `max_frames x width x height x LV_IMG_PX_SIZE_ALPHA_BYTE` bytes.
+ * @param obj           pointer to a gif object
+ * @param max_frames    max. number of frames to keep. 0: disable (default)
+ */
+void lv_gif_set_frame_ring(lv_obj_t * obj, uint16_t max_frames);
+
 /**********************
  *      MACROS
  **********************/
@@ -22,6 +22,7 @@ extern "C" {
 #include "freetype/lv_freetype.h"
 #include "rlottie/lv_rlottie.h"
 #include "ffmpeg/lv_ffmpeg.h"
+#include "nimg/lv_nimg.h"
 
 /*********************
  *      DEFINES
@@ -0,0 +1,338 @@
+/**
+ * @file lv_nimg.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../../lvgl.h"
+#if LV_USE_NIMG
+
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    lv_fs_file_t f;
+    lv_nimg_header_t head;
+    lv_nimg_tile_t * tiles;         /*The tile table read from the file*/
+} nimg_dsc_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static lv_res_t decoder_info(lv_img_decoder_t * decoder, const void * src, lv_img_header_t * header);
+static lv_res_t decoder_open(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc);
+static lv_res_t decoder_read_line(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc,
+                                  lv_coord_t x, lv_coord_t y, lv_coord_t len, uint8_t * buf);
+static lv_res_t decoder_read_area(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc,
+                                  const lv_area_t * area, uint8_t * buf);
+static void decoder_close(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc);
+
+static bool header_parse(const uint8_t * raw, uint32_t size, lv_nimg_header_t * head);
+static bool header_read(const void * src, lv_nimg_header_t * head);
+static uint32_t get_px_size(const lv_nimg_header_t * head);
+static uint32_t get_tile_cnt(const lv_nimg_header_t * head);
+static bool is_band_transp(const nimg_dsc_t * n, const lv_area_t * area, lv_coord_t y);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_nimg_init(void)
+{
+    lv_img_decoder_t * dec = lv_img_decoder_create();
+    lv_img_decoder_set_info_cb(dec, decoder_info);
+    lv_img_decoder_set_open_cb(dec, decoder_open);
+    lv_img_decoder_set_read_line_cb(dec, decoder_read_line);
+    lv_img_decoder_set_read_area_cb(dec, decoder_read_area);
+    lv_img_decoder_set_close_cb(dec, decoder_close);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Get info about a native image
+ * @param src can be file name or pointer to an `lv_img_dsc_t` with the content of a file
+ * @param header store the info here
+ * @return LV_RES_OK: no error; LV_RES_INV: can't get the info
+ */
+static lv_res_t decoder_info(lv_img_decoder_t * decoder, const void * src, lv_img_header_t * header)
+{
+    LV_UNUSED(decoder);
+
+    lv_nimg_header_t head;
+    if(header_read(src, &head) == false) return LV_RES_INV;
+
+    header->always_zero = 0;
+    header->w = head.w;
+    header->h = head.h;
+    header->cf = head.flags & LV_NIMG_FLAG_ALPHA ? LV_IMG_CF_TRUE_COLOR_ALPHA : LV_IMG_CF_TRUE_COLOR;
+
+    return LV_RES_OK;
+}
+
+/**
+ * Open a native image. Variables are drawn directly from their data, files are read by areas.
+ */
+static lv_res_t decoder_open(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc)
+{
+    LV_UNUSED(decoder);
+
+    lv_nimg_header_t head;
+    if(header_read(dsc->src, &head) == false) return LV_RES_INV;
+
+    if(dsc->src_type == LV_IMG_SRC_VARIABLE) {
+        /*The pixels are already in the layout of the display. Nothing to decode.*/
+        dsc->img_data = ((const lv_img_dsc_t *)dsc->src)->data + head.data_offset;
+        dsc->user_data = NULL;
+        return LV_RES_OK;
+    }
+
+    nimg_dsc_t * n = lv_mem_alloc(sizeof(nimg_dsc_t));
+    LV_ASSERT_MALLOC(n);
+    if(n == NULL) return LV_RES_INV;
+    lv_memset_00(n, sizeof(nimg_dsc_t));
+    n->head = head;
+
+    lv_fs_res_t res = lv_fs_open(&n->f, dsc->src, LV_FS_MODE_RD);
+    if(res != LV_FS_RES_OK) {
+        lv_mem_free(n);
+        return LV_RES_INV;
+    }
+
+    uint32_t tile_cnt = get_tile_cnt(&head);
+    if(tile_cnt) {
+        n->tiles = lv_mem_alloc(tile_cnt);
+        LV_ASSERT_MALLOC(n->tiles);
+        uint32_t br = 0;
+        if(n->tiles) res = lv_fs_seek(&n->f, LV_NIMG_HEADER_SIZE, LV_FS_SEEK_SET);
+        if(n->tiles && res == LV_FS_RES_OK) res = lv_fs_read(&n->f, n->tiles, tile_cnt, &br);
+        if(n->tiles == NULL || res != LV_FS_RES_OK || br != tile_cnt) {
+            LV_LOG_WARN("Native image decoder can't read the tile table");
+            if(n->tiles) lv_mem_free(n->tiles);
+            lv_fs_close(&n->f);
+            lv_mem_free(n);
+            return LV_RES_INV;
+        }
+    }
+
+    dsc->user_data = n;
+    dsc->img_data = NULL;
+    return LV_RES_OK;
+}
+
+static lv_res_t decoder_read_line(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc,
+                                  lv_coord_t x, lv_coord_t y, lv_coord_t len, uint8_t * buf)
+{
+    lv_area_t area;
+    area.x1 = x;
+    area.y1 = y;
+    area.x2 = x + len - 1;
+    area.y2 = y;
+    return decoder_read_area(decoder, dsc, &area, buf);
+}
+
+/**
+ * Read an area of a native image file. The pixels are copied as they are stored.
+ * The rows of fully transparent tiles are not read but cleared.
+ */
+static lv_res_t decoder_read_area(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc,
+                                  const lv_area_t * area, uint8_t * buf)
+{
+    LV_UNUSED(decoder);
+
+    nimg_dsc_t * n = dsc->user_data;
+    if(n == NULL || dsc->src_type != LV_IMG_SRC_FILE) return LV_RES_INV;
+
+    uint32_t px_size = get_px_size(&n->head);
+    uint32_t row_size = n->head.w * px_size;
+    uint32_t area_w = lv_area_get_width(area);
+    uint32_t area_row_size = area_w * px_size;
+    uint32_t tile_size = n->tiles ? n->head.tile_size : 0;
+
+    lv_coord_t y = area->y1;
+    while(y <= area->y2) {
+        /*Handle the rows of one tile row at once*/
+        lv_coord_t band_y2 = area->y2;
+        if(tile_size) band_y2 = LV_MIN(band_y2, (lv_coord_t)((y / tile_size + 1) * tile_size - 1));
+        uint32_t row_cnt = band_y2 - y + 1;
+
+        if(tile_size && is_band_transp(n, area, y)) {
+            lv_memset_00(buf, row_cnt * area_row_size);
+        }
+        else {
+            uint32_t pos = n->head.data_offset + y * row_size + area->x1 * px_size;
+            /*Full rows are stored continuously*/
+            uint32_t btr = area_row_size == row_size ? row_size * row_cnt : area_row_size;
+            uint32_t read_cnt = area_row_size == row_size ? 1 : row_cnt;
+            uint32_t i;
+            for(i = 0; i < read_cnt; i++) {
+                uint32_t br = 0;
+                lv_fs_res_t res = lv_fs_seek(&n->f, pos, LV_FS_SEEK_SET);
+                if(res == LV_FS_RES_OK) res = lv_fs_read(&n->f, buf + i * btr, btr, &br);
+                if(res != LV_FS_RES_OK || br != btr) {
+                    LV_LOG_WARN("Native image decoder read failed");
+                    return LV_RES_INV;
+                }
+                pos += row_size;
+            }
+        }
+
+        buf += row_cnt * area_row_size;
+        y = band_y2 + 1;
+    }
+
+    return LV_RES_OK;
+}
+
+/**
+ * Free the allocated resources
+ */
+static void decoder_close(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc)
+{
+    LV_UNUSED(decoder);
+
+    nimg_dsc_t * n = dsc->user_data;
+    if(n == NULL) return;
+
+    if(dsc->src_type == LV_IMG_SRC_FILE) lv_fs_close(&n->f);
+    if(n->tiles) lv_mem_free(n->tiles);
+    lv_mem_free(n);
+    dsc->user_data = NULL;
+}
+
+/**
+ * Parse and check the header of a native image
+ * @param raw the first `LV_NIMG_HEADER_SIZE` bytes of the image
+ * @param size size of the whole image or `UINT32_MAX` if unknown
+ * @param head store the parsed header here
+ * @return true: the image can be drawn on this display; false: not a native image or made for an other display
+ */
+static bool header_parse(const uint8_t * raw, uint32_t size, lv_nimg_header_t * head)
+{
+    if(memcmp(raw, LV_NIMG_MAGIC, 4) != 0) return false;
+
+    lv_memcpy(head->magic, raw, 4);
+    head->version = raw[4];
+    head->color_depth = raw[5];
+    head->flags = raw[6];
+    head->tile_size = raw[7];
+    head->w = raw[8] | (raw[9] << 8);
+    head->h = raw[10] | (raw[11] << 8);
+    head->data_offset = raw[12] | (raw[13] << 8) | ((uint32_t)raw[14] << 16) | ((uint32_t)raw[15] << 24);
+
+    if(head->version != LV_NIMG_VERSION) {
+        LV_LOG_WARN("Native image version %d is not supported", head->version);
+        return false;
+    }
+
+    /*E.g. premultiplied colors would need to be converted back to straight alpha, so they are not supported*/
+    if(head->flags & ~(LV_NIMG_FLAG_ALPHA | LV_NIMG_FLAG_COLOR_16_SWAP)) {
+        LV_LOG_WARN("Native image has unknown flags (0x%x)", head->flags);
+        return false;
+    }
+
+    bool swap = head->flags & LV_NIMG_FLAG_COLOR_16_SWAP ? true : false;
+    if(head->color_depth != LV_COLOR_DEPTH || swap != (LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP)) {
+        LV_LOG_WARN("Native image was converted for an other color format (%d bit%s)", head->color_depth,
+                    swap ? ", swapped" : "");
+        return false;
+    }
+
+    /*The size needs to fit into the 11 bit fields of `lv_img_header_t`*/
+    if(head->w > 2047 || head->h > 2047) {
+        LV_LOG_WARN("Native image is too large (%dx%d)", head->w, head->h);
+        return false;
+    }
+
+    if(head->w == 0 || head->h == 0 || head->data_offset < LV_NIMG_HEADER_SIZE + get_tile_cnt(head)) {
+        LV_LOG_WARN("Native image header is invalid");
+        return false;
+    }
+
+    if(size != UINT32_MAX && (size < head->data_offset ||
+                              size - head->data_offset < (uint32_t)head->w * head->h * get_px_size(head))) {
+        LV_LOG_WARN("Native image is truncated");
+        return false;
+    }
+
+    return true;
+}
+
+static bool header_read(const void * src, lv_nimg_header_t * head)
+{
+    lv_img_src_t src_type = lv_img_src_get_type(src);
+
+    if(src_type == LV_IMG_SRC_VARIABLE) {
+        const lv_img_dsc_t * img_dsc = src;
+        if(img_dsc->data_size < LV_NIMG_HEADER_SIZE) return false;
+        return header_parse(img_dsc->data, img_dsc->data_size, head);
+    }
+    else if(src_type == LV_IMG_SRC_FILE) {
+        if(strcmp(lv_fs_get_ext(src), "nimg") != 0) return false;
+
+        lv_fs_file_t f;
+        if(lv_fs_open(&f, src, LV_FS_MODE_RD) != LV_FS_RES_OK) return false;
+
+        uint8_t raw[LV_NIMG_HEADER_SIZE];
+        uint32_t br = 0;
+        lv_fs_res_t res = lv_fs_read(&f, raw, LV_NIMG_HEADER_SIZE, &br);
+        lv_fs_close(&f);
+        if(res != LV_FS_RES_OK || br != LV_NIMG_HEADER_SIZE) return false;
+
+        return header_parse(raw, UINT32_MAX, head);
+    }
+
+    return false;
+}
+
+static uint32_t get_px_size(const lv_nimg_header_t * head)
+{
+    return head->flags & LV_NIMG_FLAG_ALPHA ? LV_IMG_PX_SIZE_ALPHA_BYTE : sizeof(lv_color_t);
+}
+
+static uint32_t get_tile_cnt(const lv_nimg_header_t * head)
+{
+    if(head->tile_size == 0) return 0;
+
+    uint32_t col_cnt = (head->w + head->tile_size - 1) / head->tile_size;
+    uint32_t row_cnt = (head->h + head->tile_size - 1) / head->tile_size;
+    return col_cnt * row_cnt;
+}
+
+/**
+ * Check if every tile of the area is transparent in the tile row of `y`
+ */
+static bool is_band_transp(const nimg_dsc_t * n, const lv_area_t * area, lv_coord_t y)
+{
+    uint32_t tile_size = n->head.tile_size;
+    uint32_t col_cnt = (n->head.w + tile_size - 1) / tile_size;
+    const lv_nimg_tile_t * tile = &n->tiles[(y / tile_size) * col_cnt];
+
+    uint32_t tx;
+    for(tx = area->x1 / tile_size; tx <= area->x2 / tile_size; tx++) {
+        if(tile[tx] != LV_NIMG_TILE_TRANSP) return false;
+    }
+
+    return true;
+}
+
+#endif /*LV_USE_NIMG*/
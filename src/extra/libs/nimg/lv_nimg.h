@@ -0,0 +1,84 @@
+/**
+ * @file lv_nimg.h
+ *
+ */
+
+#ifndef LV_NIMG_H
+#define LV_NIMG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../../lv_conf_internal.h"
+#if LV_USE_NIMG
+
+#include <stdint.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define LV_NIMG_MAGIC       "LVNI"
+#define LV_NIMG_VERSION     1
+
+/*Size of `lv_nimg_header_t` in the file*/
+#define LV_NIMG_HEADER_SIZE 16
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+enum {
+    LV_NIMG_FLAG_ALPHA          = 0x01, /*The pixels have an alpha byte (`LV_IMG_CF_TRUE_COLOR_ALPHA` layout)*/
+    LV_NIMG_FLAG_COLOR_16_SWAP  = 0x04, /*The bytes of the 16 bit colors are swapped*/
+};
+
+typedef uint8_t lv_nimg_flag_t;
+
+/*Tells if the pixels of a tile need to be read*/
+enum {
+    LV_NIMG_TILE_VISIBLE = 0,   /*The tile has visible pixels*/
+    LV_NIMG_TILE_TRANSP,        /*All pixels of the tile are fully transparent*/
+};
+
+typedef uint8_t lv_nimg_tile_t;
+
+/**
+ * The header at the beginning of the image. The numbers are little endian.
+ * It's followed by the `lv_nimg_tile_t` of every tile row by row and the pixels start at `data_offset`.
+ * The pixels are stored in the layout of `lv_color_t` (and the alpha byte) of the display.
+ */
+typedef struct {
+    char magic[4];              /*`LV_NIMG_MAGIC`*/
+    uint8_t version;            /*`LV_NIMG_VERSION`*/
+    uint8_t color_depth;        /*The `LV_COLOR_DEPTH` the image was converted for*/
+    lv_nimg_flag_t flags;       /*`LV_NIMG_FLAG_...`*/
+    uint8_t tile_size;          /*Width and height of the tiles (0: no tile table)*/
+    uint16_t w;
+    uint16_t h;
+    uint32_t data_offset;       /*Offset of the pixels from the beginning of the image (4 byte aligned)*/
+} lv_nimg_header_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Register the native image decoder
+ */
+void lv_nimg_init(void);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_NIMG*/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*LV_NIMG_H*/
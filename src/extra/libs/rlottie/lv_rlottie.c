@@ -28,6 +28,12 @@
 static void lv_rlottie_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void lv_rlottie_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void next_frame_task_cb(lv_timer_t * t);
+static void show_frame(lv_obj_t * obj);
+static void frame_render(lv_rlottie_t * rlottie, size_t frame);
+#if LV_RLOTTIE_ASYNC
+    static bool get_next_frame(lv_rlottie_t * rlottie, size_t * frame);
+#endif
+static void frame_cache_free(lv_rlottie_t * rlottie);
 
 /**********************
  *  STATIC VARIABLES
@@ -133,6 +139,19 @@ static void lv_rlottie_constructor(const lv_obj_class_t * class_p, lv_obj_t * ob
         memset(rlottie->allocated_buf, 0, allocaled_buf_size);
     }
 
+    /*The frames are rendered to a second buffer so the shown one can be kept until the next is ready*/
+    rlottie->render_buf = lv_mem_alloc(allocaled_buf_size);
+    LV_ASSERT_MALLOC(rlottie->render_buf);
+
+#if LV_RLOTTIE_CACHE_SIZE
+    /*Keep all the frames if they fit into the budget*/
+    size_t frame_size = (size_t)create_width * create_height * LV_IMG_PX_SIZE_ALPHA_BYTE;
+    if(rlottie->total_frames * frame_size <= LV_RLOTTIE_CACHE_SIZE) {
+        rlottie->frame_cache = lv_mem_alloc(rlottie->total_frames * sizeof(uint8_t *));
+        if(rlottie->frame_cache) lv_memset_00(rlottie->frame_cache, rlottie->total_frames * sizeof(uint8_t *));
+    }
+#endif
+
     rlottie->imgdsc.header.always_zero = 0;
     rlottie->imgdsc.header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA;
     rlottie->imgdsc.header.h = create_height;
@@ -156,7 +175,13 @@ static void lv_rlottie_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj
     LV_UNUSED(class_p);
     lv_rlottie_t * rlottie = (lv_rlottie_t *) obj;
 
+    frame_cache_free(rlottie);
+
     if(rlottie->animation) {
+        if(rlottie->async_pending) {
+            lottie_animation_render_flush(rlottie->animation);
+            rlottie->async_pending = false;
+        }
         lottie_animation_destroy(rlottie->animation);
         rlottie->animation = 0;
         rlottie->current_frame = 0;
@@ -179,50 +204,10 @@ static void lv_rlottie_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj
         rlottie->allocated_buffer_size = 0;
     }
 
+    lv_mem_free(rlottie->render_buf);
+    rlottie->render_buf = NULL;
 }
 
-#if LV_COLOR_DEPTH == 16
-static void convert_to_rgba5658(uint32_t * pix, const size_t width, const size_t height)
-{
-    /* rlottie draws in ARGB32 format, but LVGL only deal with RGB565 format with (optional 8 bit alpha channel)
-       so convert in place here the received buffer to LVGL format. */
-    uint8_t * dest = (uint8_t *)pix;
-    uint32_t * src = pix;
-    for(size_t y = 0; y < height; y++) {
-        /* Convert a 4 bytes per pixel in format ARGB to R5G6B5A8 format
-            naive way:
-                        r = ((c & 0xFF0000) >> 19)
-                        g = ((c & 0xFF00) >> 10)
-                        b = ((c & 0xFF) >> 3)
-                        rgb565 = (r << 11) | (g << 5) | b
-                        a = c >> 24;
-            That's 3 mask, 6 bitshift and 2 or operations
-
-            A bit better:
-                        r = ((c & 0xF80000) >> 8)
-                        g = ((c & 0xFC00) >> 5)
-                        b = ((c & 0xFF) >> 3)
-                        rgb565 = r | g | b
-                        a = c >> 24;
-            That's 3 mask, 3 bitshifts and 2 or operations */
-        for(size_t x = 0; x < width; x++) {
-            uint32_t in = src[x];
-#if LV_COLOR_16_SWAP == 0
-            uint16_t r = (uint16_t)(((in & 0xF80000) >> 8) | ((in & 0xFC00) >> 5) | ((in & 0xFF) >> 3));
-#else
-            /* We want: rrrr rrrr GGGg gggg bbbb bbbb => gggb bbbb rrrr rGGG */
-            uint16_t r = (uint16_t)(((in & 0xF80000) >> 16) | ((in & 0xFC00) >> 13) | ((in & 0x1C00) << 3) | ((in & 0xF8) << 5));
-#endif
-
-            lv_memcpy(dest, &r, sizeof(r));
-            dest[sizeof(r)] = (uint8_t)(in >> 24);
-            dest += LV_IMG_PX_SIZE_ALPHA_BYTE;
-        }
-        src += width;
-    }
-}
-#endif
-
 static void next_frame_task_cb(lv_timer_t * t)
 {
     lv_obj_t * obj = t->user_data;
@@ -251,7 +236,7 @@ static void next_frame_task_cb(lv_timer_t * t)
             }
         }
         else {
-            if(rlottie->current_frame < rlottie->total_frames)
+            if(rlottie->current_frame < rlottie->total_frames - 1)
                 ++rlottie->current_frame;
             else { /* Looping ? */
                 if((rlottie->play_ctrl & LV_RLOTTIE_CTRL_LOOP) == LV_RLOTTIE_CTRL_LOOP)
@@ -265,20 +250,135 @@ static void next_frame_task_cb(lv_timer_t * t)
         }
     }
 
-    lottie_animation_render(
-        rlottie->animation,
-        rlottie->current_frame,
-        rlottie->allocated_buf,
-        rlottie->imgdsc.header.w,
-        rlottie->imgdsc.header.h,
-        rlottie->scanline_width
-    );
-
-#if LV_COLOR_DEPTH == 16
-    convert_to_rgba5658(rlottie->allocated_buf, rlottie->imgdsc.header.w, rlottie->imgdsc.header.h);
-#endif
+    show_frame(obj);
+}
+
+/**
+ * Show `current_frame` from the frame cache or render it
+ * @param obj   pointer to an rlottie object
+ */
+static void show_frame(lv_obj_t * obj)
+{
+    lv_rlottie_t * rlottie = (lv_rlottie_t *) obj;
+    if(rlottie->allocated_buf == NULL || rlottie->render_buf == NULL) return;
+
+    size_t frame = rlottie->current_frame;
+    size_t frame_size = (size_t)rlottie->imgdsc.header.w * rlottie->imgdsc.header.h * LV_IMG_PX_SIZE_ALPHA_BYTE;
+    uint8_t * data = NULL;
+
+    if(rlottie->frame_cache && rlottie->frame_cache[frame]) {
+        data = rlottie->frame_cache[frame];
+    }
+    else {
+        frame_render(rlottie, frame);
+
+        if(rlottie->frame_cache) {
+            data = lv_mem_alloc(frame_size);
+            if(data) {
+                lv_memcpy(data, rlottie->render_buf, frame_size);
+                rlottie->frame_cache[frame] = data;
+            }
+            else {
+                LV_LOG_WARN("out of memory, the frames won't be cached");
+                frame_cache_free(rlottie);
+            }
+        }
 
+        /*Not cached: show the rendered buffer and render the next frame into the other*/
+        if(data == NULL) {
+            uint32_t * tmp = rlottie->allocated_buf;
+            rlottie->allocated_buf = rlottie->render_buf;
+            rlottie->render_buf = tmp;
+            data = (uint8_t *)rlottie->allocated_buf;
+        }
+    }
+
+    rlottie->imgdsc.data = data;
+    lv_img_cache_invalidate_src(&rlottie->imgdsc);
     lv_obj_invalidate(obj);
+
+#if LV_RLOTTIE_ASYNC
+    /*Render the next frame in the background while this one is shown*/
+    size_t next;
+    if(get_next_frame(rlottie, &next) && (rlottie->frame_cache == NULL || rlottie->frame_cache[next] == NULL)) {
+        lottie_animation_render_async(rlottie->animation, next, rlottie->render_buf,
+                                      rlottie->imgdsc.header.w, rlottie->imgdsc.header.h, rlottie->scanline_width);
+        rlottie->async_frame = next;
+        rlottie->async_pending = true;
+    }
+#endif
+}
+
+/**
+ * Render a frame into `render_buf` in the display's color format
+ * @param rlottie   pointer to an rlottie object
+ * @param frame     the frame to render
+ */
+static void frame_render(lv_rlottie_t * rlottie, size_t frame)
+{
+    bool rendered = false;
+    if(rlottie->async_pending) {
+        lottie_animation_render_flush(rlottie->animation);
+        rlottie->async_pending = false;
+        rendered = rlottie->async_frame == frame;
+    }
+
+    if(!rendered) {
+        lottie_animation_render(
+            rlottie->animation,
+            frame,
+            rlottie->render_buf,
+            rlottie->imgdsc.header.w,
+            rlottie->imgdsc.header.h,
+            rlottie->scanline_width
+        );
+    }
+
+#if LV_COLOR_DEPTH != 32
+    /*rlottie renders ARGB8888*/
+    lv_color_conv_to_native_alpha(rlottie->render_buf, rlottie->render_buf,
+                                  (uint32_t)rlottie->imgdsc.header.w * rlottie->imgdsc.header.h, LV_COLOR_CONV_BGRA8888);
+#endif
+}
+
+#if LV_RLOTTIE_ASYNC
+/**
+ * Get the frame which will be shown after `current_frame`
+ * @param rlottie   pointer to an rlottie object
+ * @param frame     store the next frame here
+ * @return          false if it's not known (paused or the animation ends)
+ */
+static bool get_next_frame(lv_rlottie_t * rlottie, size_t * frame)
+{
+    if((rlottie->play_ctrl & LV_RLOTTIE_CTRL_PAUSE) == LV_RLOTTIE_CTRL_PAUSE) return false;
+
+    bool loop = (rlottie->play_ctrl & LV_RLOTTIE_CTRL_LOOP) == LV_RLOTTIE_CTRL_LOOP;
+    if((rlottie->play_ctrl & LV_RLOTTIE_CTRL_BACKWARD) == LV_RLOTTIE_CTRL_BACKWARD) {
+        if(rlottie->current_frame > 0) *frame = rlottie->current_frame - 1;
+        else if(loop) *frame = rlottie->total_frames - 1;
+        else return false;
+    }
+    else {
+        if(rlottie->current_frame < rlottie->total_frames - 1) *frame = rlottie->current_frame + 1;
+        else if(loop) *frame = 0;
+        else return false;
+    }
+
+    return true;
+}
+#endif
+
+static void frame_cache_free(lv_rlottie_t * rlottie)
+{
+    if(rlottie->frame_cache == NULL) return;
+
+    size_t i;
+    for(i = 0; i < rlottie->total_frames; i++) {
+        if(rlottie->frame_cache[i] == rlottie->imgdsc.data) rlottie->imgdsc.data = (void *)rlottie->allocated_buf;
+        lv_mem_free(rlottie->frame_cache[i]);
+    }
+    lv_mem_free(rlottie->frame_cache);
+    rlottie->frame_cache = NULL;
 }
 
 #endif /*LV_USE_RLOTTIE*/
@@ -46,6 +46,10 @@ typedef struct {
     size_t scanline_width;
     lv_rlottie_ctrl_t play_ctrl;
     size_t dest_frame;
+    uint32_t * render_buf;      /*The next frame is rendered here*/
+    uint8_t ** frame_cache;     /*Rendered frames in the display's format. NULL if they don't fit into LV_RLOTTIE_CACHE_SIZE*/
+    size_t async_frame;         /*The frame being rendered in the background*/
+    bool async_pending;
 } lv_rlottie_t;
 
 extern const lv_obj_class_t lv_rlottie_class;
@@ -86,6 +86,12 @@ typedef struct {
 } io_source_t;
 
 
+typedef struct {
+    uint8_t * buf;                      //decoded RGB888 pixels of the frame
+    int index;                          //index of the cached frame or -1 if unused
+    uint32_t life;                      //to find the least recently used frame
+} sjpeg_frame_t;
+
 typedef struct {
     uint8_t * sjpeg_data;
     uint32_t sjpeg_data_size;
@@ -93,10 +99,16 @@ typedef struct {
     int sjpeg_y_res;
     int sjpeg_total_frames;
     int sjpeg_single_frame_height;
-    int sjpeg_cache_frame_index;
     uint8_t ** frame_base_array;        //to save base address of each split frames upto sjpeg_total_frames.
     int * frame_base_offset;            //to save base offset for fseek
-    uint8_t * frame_cache;
+    sjpeg_frame_t * frame_cache;        //the recently decoded frames
+    int frame_cache_cnt;
+    uint32_t frame_life;
+    uint8_t scale;                      //decode at 1/2^scale size (0..3)
+    int last_frame_index;               //the last read frame to know the scroll direction
+    int8_t scroll_dir;
+    int prefetch_frame_index;
+    lv_timer_t * prefetch_timer;
     uint8_t * workb;                    //JPG work buffer for jpeg library
     JDEC * tjpeg_jd;
     io_source_t io;
@@ -114,6 +126,11 @@ static size_t input_func(JDEC * jd, uint8_t * buff, size_t ndata);
 static int is_jpg(const uint8_t * raw_data, size_t len);
 static void lv_sjpg_cleanup(SJPEG * sjpeg);
 static void lv_sjpg_free(SJPEG * sjpeg);
+static uint8_t get_scale(const lv_img_dsc_t * img_dsc, int w, int h, int frame_h);
+static lv_res_t frame_cache_init(SJPEG * sjpeg, const lv_img_decoder_dsc_t * dsc);
+static uint8_t * frame_get(SJPEG * sjpeg, int index);
+static lv_res_t frame_decode(SJPEG * sjpeg, int index, uint8_t * buf);
+static void prefetch_timer_cb(lv_timer_t * timer);
 
 /**********************
  *  STATIC VARIABLES
@@ -173,6 +190,11 @@ static lv_res_t decoder_info(lv_img_decoder_t * decoder, const void * src, lv_im
             header->h = *raw_sjpeg_data++;
             header->h |= *raw_sjpeg_data++ << 8;
 
+            int frame_h = img_dsc->data[SJPEG_BLOCK_WIDTH_OFFSET] | (img_dsc->data[SJPEG_BLOCK_WIDTH_OFFSET + 1] << 8);
+            uint8_t scale = get_scale(img_dsc, header->w, header->h, frame_h);
+            header->w >>= scale;
+            header->h >>= scale;
+
             return ret;
 
         }
@@ -193,9 +215,9 @@ static lv_res_t decoder_info(lv_img_decoder_t * decoder, const void * src, lv_im
 
             JRESULT rc = jd_prepare(&jd_tmp, input_func, workb_temp, (size_t)TJPGD_WORKBUFF_SIZE, &io_source_temp);
             if(rc == JDR_OK) {
-                header->w = jd_tmp.width;
-                header->h = jd_tmp.height;
-
+                uint8_t scale = get_scale(img_dsc, jd_tmp.width, jd_tmp.height, jd_tmp.height);
+                header->w = jd_tmp.width >> scale;
+                header->h = jd_tmp.height >> scale;
             }
             else {
                 ret = LV_RES_INV;
@@ -395,15 +417,11 @@ static lv_res_t decoder_open(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t *
                 offset |= *data++ << 8;
                 sjpeg->frame_base_array[i] = sjpeg->frame_base_array[i - 1] + offset;
             }
-            sjpeg->sjpeg_cache_frame_index = -1;
-            sjpeg->frame_cache = (void *)lv_mem_alloc(sjpeg->sjpeg_x_res * sjpeg->sjpeg_single_frame_height * 3/*2*/);
-            if(! sjpeg->frame_cache) {
+            if(frame_cache_init(sjpeg, dsc) != LV_RES_OK) {
                 lv_sjpg_cleanup(sjpeg);
                 sjpeg = NULL;
                 return LV_RES_INV;
             }
-            sjpeg->io.img_cache_buff = sjpeg->frame_cache;
-            sjpeg->io.img_cache_x_res = sjpeg->sjpeg_x_res;
             sjpeg->workb =   lv_mem_alloc(TJPGD_WORKBUFF_SIZE);
             if(! sjpeg->workb) {
                 lv_sjpg_cleanup(sjpeg);
@@ -458,16 +476,11 @@ static lv_res_t decoder_open(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t *
                 uint8_t * img_frame_base = sjpeg->sjpeg_data;
                 sjpeg->frame_base_array[0] = img_frame_base;
 
-                sjpeg->sjpeg_cache_frame_index = -1;
-                sjpeg->frame_cache = (void *)lv_mem_alloc(sjpeg->sjpeg_x_res * sjpeg->sjpeg_single_frame_height * 3);
-                if(! sjpeg->frame_cache) {
+                if(frame_cache_init(sjpeg, dsc) != LV_RES_OK) {
                     lv_sjpg_cleanup(sjpeg);
                     sjpeg = NULL;
                     return LV_RES_INV;
                 }
-
-                sjpeg->io.img_cache_buff = sjpeg->frame_cache;
-                sjpeg->io.img_cache_x_res = sjpeg->sjpeg_x_res;
                 sjpeg->workb =   lv_mem_alloc(TJPGD_WORKBUFF_SIZE);
                 if(! sjpeg->workb) {
                     lv_sjpg_cleanup(sjpeg);
@@ -536,8 +549,6 @@ end:
                     memset(sjpeg, 0, sizeof(SJPEG));
 
                     dsc->user_data = sjpeg;
-                    sjpeg->sjpeg_data = (uint8_t *)((lv_img_dsc_t *)(dsc->src))->data;
-                    sjpeg->sjpeg_data_size = ((lv_img_dsc_t *)(dsc->src))->data_size;
                 }
                 data = buff;
                 data += 14;
@@ -577,15 +588,11 @@ end:
                     sjpeg->frame_base_offset[i] = sjpeg->frame_base_offset[i - 1] + offset;
                 }
 
-                sjpeg->sjpeg_cache_frame_index = -1; //INVALID AT BEGINNING for a forced compare mismatch at first time.
-                sjpeg->frame_cache = (void *)lv_mem_alloc(sjpeg->sjpeg_x_res * sjpeg->sjpeg_single_frame_height * 3);
-                if(! sjpeg->frame_cache) {
+                if(frame_cache_init(sjpeg, dsc) != LV_RES_OK) {
                     lv_fs_close(&lv_file);
                     lv_sjpg_cleanup(sjpeg);
                     return LV_RES_INV;
                 }
-                sjpeg->io.img_cache_buff = sjpeg->frame_cache;
-                sjpeg->io.img_cache_x_res = sjpeg->sjpeg_x_res;
                 sjpeg->workb =   lv_mem_alloc(TJPGD_WORKBUFF_SIZE);
                 if(! sjpeg->workb) {
                     lv_fs_close(&lv_file);
@@ -624,8 +631,6 @@ end:
 
                 memset(sjpeg, 0, sizeof(SJPEG));
                 dsc->user_data = sjpeg;
-                sjpeg->sjpeg_data = (uint8_t *)((lv_img_dsc_t *)(dsc->src))->data;
-                sjpeg->sjpeg_data_size = ((lv_img_dsc_t *)(dsc->src))->data_size;
             }
 
             uint8_t * workb_temp = lv_mem_alloc(TJPGD_WORKBUFF_SIZE);
@@ -665,16 +670,11 @@ end:
                 int img_frame_start_offset = 0;
                 sjpeg->frame_base_offset[0] = img_frame_start_offset;
 
-                sjpeg->sjpeg_cache_frame_index = -1;
-                sjpeg->frame_cache = (void *)lv_mem_alloc(sjpeg->sjpeg_x_res * sjpeg->sjpeg_single_frame_height * 3);
-                if(! sjpeg->frame_cache) {
+                if(frame_cache_init(sjpeg, dsc) != LV_RES_OK) {
                     lv_fs_close(&lv_file);
                     lv_sjpg_cleanup(sjpeg);
                     return LV_RES_INV;
                 }
-
-                sjpeg->io.img_cache_buff = sjpeg->frame_cache;
-                sjpeg->io.img_cache_x_res = sjpeg->sjpeg_x_res;
                 sjpeg->workb =   lv_mem_alloc(TJPGD_WORKBUFF_SIZE);
                 if(! sjpeg->workb) {
                     lv_fs_close(&lv_file);
@@ -722,143 +722,41 @@ static lv_res_t decoder_read_line(lv_img_decoder_t * decoder, lv_img_decoder_dsc
                                   lv_coord_t len, uint8_t * buf)
 {
     LV_UNUSED(decoder);
-    if(dsc->src_type == LV_IMG_SRC_VARIABLE) {
-        SJPEG * sjpeg = (SJPEG *) dsc->user_data;
-        JRESULT rc;
-
-        int sjpeg_req_frame_index = y / sjpeg->sjpeg_single_frame_height;
-
-        /*If line not from cache, refresh cache */
-        if(sjpeg_req_frame_index != sjpeg->sjpeg_cache_frame_index) {
-            sjpeg->io.raw_sjpg_data = sjpeg->frame_base_array[ sjpeg_req_frame_index ];
-            if(sjpeg_req_frame_index == (sjpeg->sjpeg_total_frames - 1)) {
-                /*This is the last frame. */
-                const uint32_t frame_offset = (uint32_t)(sjpeg->io.raw_sjpg_data - sjpeg->sjpeg_data);
-                sjpeg->io.raw_sjpg_data_size = sjpeg->sjpeg_data_size - frame_offset;
+    SJPEG * sjpeg = (SJPEG *) dsc->user_data;
+    if(sjpeg == NULL) return LV_RES_INV;
+
+    const int frame_h = sjpeg->sjpeg_single_frame_height >> sjpeg->scale;
+    const int x_res = sjpeg->sjpeg_x_res >> sjpeg->scale;
+    int sjpeg_req_frame_index = y / frame_h;
+
+    uint8_t * frame = frame_get(sjpeg, sjpeg_req_frame_index);
+    if(frame == NULL) return LV_RES_INV;
+
+#if LV_SJPG_PREFETCH
+    /*Decode the next frame in the scroll direction when there is nothing else to do*/
+    if(sjpeg_req_frame_index != sjpeg->last_frame_index) {
+        if(sjpeg->last_frame_index >= 0) sjpeg->scroll_dir = sjpeg_req_frame_index > sjpeg->last_frame_index ? 1 : -1;
+        sjpeg->last_frame_index = sjpeg_req_frame_index;
+
+        int next = sjpeg_req_frame_index + sjpeg->scroll_dir;
+        if(sjpeg->frame_cache_cnt > 1 && sjpeg->scroll_dir != 0 && next >= 0 && next < sjpeg->sjpeg_total_frames) {
+            if(sjpeg->prefetch_timer == NULL) {
+                sjpeg->prefetch_timer = lv_timer_create(prefetch_timer_cb, 0, sjpeg);
+                LV_ASSERT_MALLOC(sjpeg->prefetch_timer);
             }
-            else {
-                sjpeg->io.raw_sjpg_data_size =
-                    (uint32_t)(sjpeg->frame_base_array[sjpeg_req_frame_index + 1] - sjpeg->io.raw_sjpg_data);
+            if(sjpeg->prefetch_timer) {
+                sjpeg->prefetch_frame_index = next;
+                lv_timer_resume(sjpeg->prefetch_timer);
+                lv_timer_ready(sjpeg->prefetch_timer);
             }
-            sjpeg->io.raw_sjpg_data_next_read_pos = 0;
-            rc = jd_prepare(sjpeg->tjpeg_jd, input_func, sjpeg->workb, (size_t)TJPGD_WORKBUFF_SIZE, &(sjpeg->io));
-            if(rc != JDR_OK) return LV_RES_INV;
-            rc = jd_decomp(sjpeg->tjpeg_jd, img_data_cb, 0);
-            if(rc != JDR_OK) return LV_RES_INV;
-            sjpeg->sjpeg_cache_frame_index = sjpeg_req_frame_index;
         }
-
-        int offset = 0;
-        uint8_t * cache = (uint8_t *)sjpeg->frame_cache + x * 3 + (y % sjpeg->sjpeg_single_frame_height) * sjpeg->sjpeg_x_res *
-                          3;
-
-#if  LV_COLOR_DEPTH == 32
-        for(int i = 0; i < len; i++) {
-            buf[offset + 3] = 0xff;
-            buf[offset + 2] = *cache++;
-            buf[offset + 1] = *cache++;
-            buf[offset + 0] = *cache++;
-            offset += 4;
-        }
-
-#elif  LV_COLOR_DEPTH == 16
-
-        for(int i = 0; i < len; i++) {
-            uint16_t col_16bit = (*cache++ & 0xf8) << 8;
-            col_16bit |= (*cache++ & 0xFC) << 3;
-            col_16bit |= (*cache++ >> 3);
-#if  LV_BIG_ENDIAN_SYSTEM == 1 || LV_COLOR_16_SWAP == 1
-            buf[offset++] = col_16bit >> 8;
-            buf[offset++] = col_16bit & 0xff;
-#else
-            buf[offset++] = col_16bit & 0xff;
-            buf[offset++] = col_16bit >> 8;
-#endif // LV_BIG_ENDIAN_SYSTEM
-        }
-
-#elif  LV_COLOR_DEPTH == 8
-
-        for(int i = 0; i < len; i++) {
-            uint8_t col_8bit = (*cache++ & 0xC0);
-            col_8bit |= (*cache++ & 0xe0) >> 2;
-            col_8bit |= (*cache++ & 0xe0) >> 5;
-            buf[offset++] = col_8bit;
-        }
-#else
-#error Unsupported LV_COLOR_DEPTH
-
-
-#endif // LV_COLOR_DEPTH
-        return LV_RES_OK;
     }
-    else if(dsc->src_type == LV_IMG_SRC_FILE) {
-        SJPEG * sjpeg = (SJPEG *) dsc->user_data;
-        JRESULT rc;
-        int sjpeg_req_frame_index = y / sjpeg->sjpeg_single_frame_height;
-
-        lv_fs_file_t * lv_file_p = &(sjpeg->io.lv_file);
-        if(!lv_file_p) goto end;
-
-        /*If line not from cache, refresh cache */
-        if(sjpeg_req_frame_index != sjpeg->sjpeg_cache_frame_index) {
-            sjpeg->io.raw_sjpg_data_next_read_pos = (int)(sjpeg->frame_base_offset [ sjpeg_req_frame_index ]);
-            lv_fs_seek(&(sjpeg->io.lv_file), sjpeg->io.raw_sjpg_data_next_read_pos, LV_FS_SEEK_SET);
-
-            rc = jd_prepare(sjpeg->tjpeg_jd, input_func, sjpeg->workb, (size_t)TJPGD_WORKBUFF_SIZE, &(sjpeg->io));
-            if(rc != JDR_OK) return LV_RES_INV;
-
-            rc = jd_decomp(sjpeg->tjpeg_jd, img_data_cb, 0);
-            if(rc != JDR_OK) return LV_RES_INV;
-
-            sjpeg->sjpeg_cache_frame_index = sjpeg_req_frame_index;
-        }
-
-        int offset = 0;
-        uint8_t * cache = (uint8_t *)sjpeg->frame_cache + x * 3 + (y % sjpeg->sjpeg_single_frame_height) * sjpeg->sjpeg_x_res *
-                          3;
-
-#if LV_COLOR_DEPTH == 32
-        for(int i = 0; i < len; i++) {
-            buf[offset + 3] = 0xff;
-            buf[offset + 2] = *cache++;
-            buf[offset + 1] = *cache++;
-            buf[offset + 0] = *cache++;
-            offset += 4;
-        }
-#elif  LV_COLOR_DEPTH == 16
-
-        for(int i = 0; i < len; i++) {
-            uint16_t col_8bit = (*cache++ & 0xf8) << 8;
-            col_8bit |= (*cache++ & 0xFC) << 3;
-            col_8bit |= (*cache++ >> 3);
-#if  LV_BIG_ENDIAN_SYSTEM == 1 || LV_COLOR_16_SWAP == 1
-            buf[offset++] = col_8bit >> 8;
-            buf[offset++] = col_8bit & 0xff;
-#else
-            buf[offset++] = col_8bit & 0xff;
-            buf[offset++] = col_8bit >> 8;
-#endif // LV_BIG_ENDIAN_SYSTEM
-        }
-
-#elif  LV_COLOR_DEPTH == 8
-
-        for(int i = 0; i < len; i++) {
-            uint8_t col_8bit = (*cache++ & 0xC0);
-            col_8bit |= (*cache++ & 0xe0) >> 2;
-            col_8bit |= (*cache++ & 0xe0) >> 5;
-            buf[offset++] = col_8bit;
-        }
-
-#else
-#error Unsupported LV_COLOR_DEPTH
-
+#endif
 
-#endif // LV_COLOR_DEPTH
+    uint8_t * cache = frame + x * 3 + (y % frame_h) * x_res * 3;
+    lv_color_conv_to_native(buf, cache, len, LV_COLOR_CONV_RGB888);
 
-        return LV_RES_OK;
-    }
-end:
-    return LV_RES_INV;
+    return LV_RES_OK;
 }
 
 /**
@@ -899,7 +797,14 @@ static int is_jpg(const uint8_t * raw_data, size_t len)
 
 static void lv_sjpg_free(SJPEG * sjpeg)
 {
-    if(sjpeg->frame_cache) lv_mem_free(sjpeg->frame_cache);
+    if(sjpeg->frame_cache) {
+        int i;
+        for(i = 0; i < sjpeg->frame_cache_cnt; i++) {
+            if(sjpeg->frame_cache[i].buf) lv_mem_free(sjpeg->frame_cache[i].buf);
+        }
+        lv_mem_free(sjpeg->frame_cache);
+    }
+    if(sjpeg->prefetch_timer) lv_timer_del(sjpeg->prefetch_timer);
     if(sjpeg->frame_base_array) lv_mem_free(sjpeg->frame_base_array);
     if(sjpeg->frame_base_offset) lv_mem_free(sjpeg->frame_base_offset);
     if(sjpeg->tjpeg_jd) lv_mem_free(sjpeg->tjpeg_jd);
@@ -914,4 +819,126 @@ static void lv_sjpg_cleanup(SJPEG * sjpeg)
     lv_mem_free(sjpeg);
 }
 
+/**
+ * Get the scale to decode a JPG C array at.
+ * If the size in the image descriptor is 1/2, 1/4 or 1/8 of the JPG's size the image is decoded at that size.
+ * @param img_dsc the image descriptor of the JPG or SJPG data
+ * @param w width of the JPG
+ * @param h height of the JPG
+ * @param frame_h height of the frames of an SJPG or `h` for a normal JPG
+ * @return 0..3 to decode at 1/2^scale size
+ */
+static uint8_t get_scale(const lv_img_dsc_t * img_dsc, int w, int h, int frame_h)
+{
+    uint8_t scale;
+    for(scale = 1; scale <= 3; scale++) {
+        if((frame_h >> scale) == 0) break;
+        if(img_dsc->header.w == (w >> scale) && img_dsc->header.h == (h >> scale)) return scale;
+    }
+
+    return 0;
+}
+
+static lv_res_t frame_cache_init(SJPEG * sjpeg, const lv_img_decoder_dsc_t * dsc)
+{
+    if(dsc->src_type == LV_IMG_SRC_VARIABLE) {
+        sjpeg->scale = get_scale(dsc->src, sjpeg->sjpeg_x_res, sjpeg->sjpeg_y_res, sjpeg->sjpeg_single_frame_height);
+    }
+
+    sjpeg->frame_cache_cnt = LV_MAX(LV_MIN(LV_SJPG_FRAME_CACHE_CNT, sjpeg->sjpeg_total_frames), 1);
+    sjpeg->frame_cache = lv_mem_alloc(sizeof(sjpeg_frame_t) * sjpeg->frame_cache_cnt);
+    if(sjpeg->frame_cache == NULL) {
+        sjpeg->frame_cache_cnt = 0;
+        return LV_RES_INV;
+    }
+
+    /*The frame buffers are allocated when they are used first*/
+    int i;
+    for(i = 0; i < sjpeg->frame_cache_cnt; i++) {
+        sjpeg->frame_cache[i].buf = NULL;
+        sjpeg->frame_cache[i].index = -1;
+        sjpeg->frame_cache[i].life = 0;
+    }
+
+    sjpeg->last_frame_index = -1;
+    sjpeg->io.img_cache_x_res = sjpeg->sjpeg_x_res >> sjpeg->scale;
+    return LV_RES_OK;
+}
+
+/**
+ * Get a decoded frame from the cache or decode it in place of the least recently used frame
+ * @param sjpeg pointer to the SJPEG descriptor
+ * @param index index of the frame
+ * @return the RGB888 pixels of the frame or NULL on error
+ */
+static uint8_t * frame_get(SJPEG * sjpeg, int index)
+{
+    if(index < 0 || index >= sjpeg->sjpeg_total_frames) return NULL;
+
+    sjpeg->frame_life++;
+
+    sjpeg_frame_t * lru = &sjpeg->frame_cache[0];
+    int i;
+    for(i = 0; i < sjpeg->frame_cache_cnt; i++) {
+        sjpeg_frame_t * f = &sjpeg->frame_cache[i];
+        if(f->index == index) {
+            f->life = sjpeg->frame_life;
+            return f->buf;
+        }
+        if(f->life < lru->life) lru = f;
+    }
+
+    if(lru->buf == NULL) {
+        uint32_t frame_size = (sjpeg->sjpeg_x_res >> sjpeg->scale) * (sjpeg->sjpeg_single_frame_height >> sjpeg->scale) * 3;
+        lru->buf = lv_mem_alloc(frame_size);
+        LV_ASSERT_MALLOC(lru->buf);
+        if(lru->buf == NULL) return NULL;
+    }
+
+    lru->index = -1;
+    if(frame_decode(sjpeg, index, lru->buf) != LV_RES_OK) return NULL;
+
+    lru->index = index;
+    lru->life = sjpeg->frame_life;
+    return lru->buf;
+}
+
+static lv_res_t frame_decode(SJPEG * sjpeg, int index, uint8_t * buf)
+{
+    JRESULT rc;
+
+    sjpeg->io.img_cache_buff = buf;
+    if(sjpeg->io.type == SJPEG_IO_SOURCE_C_ARRAY) {
+        sjpeg->io.raw_sjpg_data = sjpeg->frame_base_array[index];
+        if(index == (sjpeg->sjpeg_total_frames - 1)) {
+            /*This is the last frame. */
+            const uint32_t frame_offset = (uint32_t)(sjpeg->io.raw_sjpg_data - sjpeg->sjpeg_data);
+            sjpeg->io.raw_sjpg_data_size = sjpeg->sjpeg_data_size - frame_offset;
+        }
+        else {
+            sjpeg->io.raw_sjpg_data_size =
+                (uint32_t)(sjpeg->frame_base_array[index + 1] - sjpeg->io.raw_sjpg_data);
+        }
+        sjpeg->io.raw_sjpg_data_next_read_pos = 0;
+    }
+    else {
+        sjpeg->io.raw_sjpg_data_next_read_pos = (int)(sjpeg->frame_base_offset[index]);
+        lv_fs_seek(&(sjpeg->io.lv_file), sjpeg->io.raw_sjpg_data_next_read_pos, LV_FS_SEEK_SET);
+    }
+
+    rc = jd_prepare(sjpeg->tjpeg_jd, input_func, sjpeg->workb, (size_t)TJPGD_WORKBUFF_SIZE, &(sjpeg->io));
+    if(rc != JDR_OK) return LV_RES_INV;
+    rc = jd_decomp(sjpeg->tjpeg_jd, img_data_cb, sjpeg->scale);
+    if(rc != JDR_OK) return LV_RES_INV;
+
+    return LV_RES_OK;
+}
+
+static void prefetch_timer_cb(lv_timer_t * timer)
+{
+    SJPEG * sjpeg = timer->user_data;
+    lv_timer_pause(timer);
+    frame_get(sjpeg, sjpeg->prefetch_frame_index);
+}
+
 #endif /*LV_USE_SJPG*/
@@ -112,37 +112,7 @@ lv_res_t lv_snapshot_take_to_buf(lv_obj_t * obj, lv_img_cf_t cf, lv_img_dsc_t *
     lv_memset(buf, 0x00, buff_size);
     lv_memset_00(dsc, sizeof(lv_img_dsc_t));
 
-    lv_disp_t * obj_disp = lv_obj_get_disp(obj);
-    lv_disp_drv_t driver;
-    lv_disp_drv_init(&driver);
-    /*In lack of a better idea use the resolution of the object's display*/
-    driver.hor_res = lv_disp_get_hor_res(obj_disp);
-    driver.ver_res = lv_disp_get_hor_res(obj_disp);
-    lv_disp_drv_use_generic_set_px_cb(&driver, cf);
-
-    lv_disp_t fake_disp;
-    lv_memset_00(&fake_disp, sizeof(lv_disp_t));
-    fake_disp.driver = &driver;
-
-
-    lv_draw_ctx_t * draw_ctx = lv_mem_alloc(obj_disp->driver->draw_ctx_size);
-    LV_ASSERT_MALLOC(draw_ctx);
-    if(draw_ctx == NULL) return LV_RES_INV;
-    obj_disp->driver->draw_ctx_init(fake_disp.driver, draw_ctx);
-    fake_disp.driver->draw_ctx = draw_ctx;
-    draw_ctx->clip_area = &snapshot_area;
-    draw_ctx->buf_area = &snapshot_area;
-    draw_ctx->buf = (void *)buf;
-    driver.draw_ctx = draw_ctx;
-
-    lv_disp_t * refr_ori = _lv_refr_get_disp_refreshing();
-    _lv_refr_set_disp_refreshing(&fake_disp);
-
-    lv_refr_obj(draw_ctx, obj);
-
-    _lv_refr_set_disp_refreshing(refr_ori);
-    obj_disp->driver->draw_ctx_deinit(fake_disp.driver, draw_ctx);
-    lv_mem_free(draw_ctx);
+    if(_lv_obj_render_to_buf(obj, buf, &snapshot_area, cf, NULL, NULL) != LV_RES_OK) return LV_RES_INV;
 
     dsc->data = buf;
     dsc->header.w = w;
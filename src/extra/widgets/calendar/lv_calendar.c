@@ -33,7 +33,7 @@ static void draw_part_begin_event_cb(lv_event_t * e);
 static uint8_t get_day_of_week(uint32_t year, uint32_t month, uint32_t day);
 static uint8_t get_month_length(int32_t year, int32_t month);
 static uint8_t is_leap_year(uint32_t year);
-static void highlight_update(lv_obj_t * calendar);
+static void update_btn_ctrls(lv_obj_t * calendar);
 
 /**********************
  *  STATIC VARIABLES
@@ -90,7 +90,7 @@ void lv_calendar_set_today_date(lv_obj_t * obj, uint32_t year, uint32_t month, u
     calendar->today.month        = month;
     calendar->today.day          = day;
 
-    highlight_update(obj);
+    update_btn_ctrls(obj);
 }
 
 void lv_calendar_set_highlighted_dates(lv_obj_t * obj, lv_calendar_date_t highlighted[], uint16_t date_num)
@@ -103,7 +103,7 @@ void lv_calendar_set_highlighted_dates(lv_obj_t * obj, lv_calendar_date_t highli
     calendar->highlighted_dates     = highlighted;
     calendar->highlighted_dates_num = date_num;
 
-    highlight_update(obj);
+    update_btn_ctrls(obj);
 }
 
 void lv_calendar_set_showed_date(lv_obj_t * obj, uint32_t year, uint32_t month)
@@ -121,13 +121,6 @@ void lv_calendar_set_showed_date(lv_obj_t * obj, uint32_t year, uint32_t month)
     d.day = calendar->showed_date.day;
 
     uint32_t i;
-
-    /*Remove the disabled state but revert it for day names*/
-    lv_btnmatrix_clear_btn_ctrl_all(calendar->btnm, LV_BTNMATRIX_CTRL_DISABLED);
-    for(i = 0; i < 7; i++) {
-        lv_btnmatrix_set_btn_ctrl(calendar->btnm, i, LV_BTNMATRIX_CTRL_DISABLED);
-    }
-
     uint8_t act_mo_len = get_month_length(d.year, d.month);
     uint8_t day_first = get_day_of_week(d.year, d.month, 1);
     uint8_t c;
@@ -138,23 +131,21 @@ void lv_calendar_set_showed_date(lv_obj_t * obj, uint32_t year, uint32_t month)
     uint8_t prev_mo_len = get_month_length(d.year, d.month - 1);
     for(i = 0, c = prev_mo_len - day_first + 1; i < day_first; i++, c++) {
         lv_snprintf(calendar->nums[i], sizeof(calendar->nums[0]), "%d", c);
-        lv_btnmatrix_set_btn_ctrl(calendar->btnm, i + 7, LV_BTNMATRIX_CTRL_DISABLED);
     }
 
     for(i = day_first + act_mo_len, c = 1; i < 6 * 7; i++, c++) {
         lv_snprintf(calendar->nums[i], sizeof(calendar->nums[0]), "%d", c);
-        lv_btnmatrix_set_btn_ctrl(calendar->btnm, i + 7, LV_BTNMATRIX_CTRL_DISABLED);
     }
 
-    highlight_update(obj);
+    /*The texts were changed in place so set the map again to measure them again*/
+    lv_btnmatrix_set_map(calendar->btnm, calendar->map);
+    update_btn_ctrls(obj);
 
     /*Reset the focused button if the days changes*/
     if(lv_btnmatrix_get_selected_btn(calendar->btnm) != LV_BTNMATRIX_BTN_NONE) {
         lv_btnmatrix_set_selected_btn(calendar->btnm, day_first + 7);
     }
 
-    lv_obj_invalidate(obj);
-
     /* The children of the calendar are probably headers.
      * Notify them to let the headers updated to the new date*/
     uint32_t child_cnt = lv_obj_get_child_cnt(obj);
@@ -375,28 +366,48 @@ static uint8_t get_day_of_week(uint32_t year, uint32_t month, uint32_t day)
     return day_of_week  ;
 }
 
-static void highlight_update(lv_obj_t * obj)
+/**
+ * Set the control bits of all days (disabled, today, highlighted) in one step.
+ * It's much faster than setting them one by one and also makes the button matrix
+ * measure the texts of the days again.
+ * @param obj pointer to a calendar
+ */
+static void update_btn_ctrls(lv_obj_t * obj)
 {
     lv_calendar_t * calendar = (lv_calendar_t *)obj;
-    uint16_t i;
+    lv_btnmatrix_t * btnm = (lv_btnmatrix_t *)calendar->btnm;
+    if(btnm->btn_cnt != 7 * 7) return;
 
-    /*Clear all kind of selection*/
-    lv_btnmatrix_clear_btn_ctrl_all(calendar->btnm, LV_CALENDAR_CTRL_TODAY | LV_CALENDAR_CTRL_HIGHLIGHT);
+    /*Keep the control bits not managed by the calendar*/
+    lv_btnmatrix_ctrl_t ctrl_map[7 * 7];
+    uint32_t i;
+    for(i = 0; i < 7 * 7; i++) {
+        ctrl_map[i] = btnm->ctrl_bits[i] & ~(LV_BTNMATRIX_CTRL_DISABLED | LV_CALENDAR_CTRL_TODAY |
+                                             LV_CALENDAR_CTRL_HIGHLIGHT);
+    }
 
+    /*The day names and the days of the previous and next month are disabled*/
+    uint8_t act_mo_len = get_month_length(calendar->showed_date.year, calendar->showed_date.month);
     uint8_t day_first = get_day_of_week(calendar->showed_date.year, calendar->showed_date.month, 1);
+    for(i = 0; i < 7 + (uint32_t)day_first; i++) ctrl_map[i] |= LV_BTNMATRIX_CTRL_DISABLED;
+    for(i = 7 + day_first + act_mo_len; i < 7 * 7; i++) ctrl_map[i] |= LV_BTNMATRIX_CTRL_DISABLED;
+
     if(calendar->highlighted_dates) {
         for(i = 0; i < calendar->highlighted_dates_num; i++) {
-            if(calendar->highlighted_dates[i].year == calendar->showed_date.year &&
-               calendar->highlighted_dates[i].month == calendar->showed_date.month) {
-                lv_btnmatrix_set_btn_ctrl(calendar->btnm, calendar->highlighted_dates[i].day - 1 + day_first + 7,
-                                          LV_CALENDAR_CTRL_HIGHLIGHT);
+            const lv_calendar_date_t * d = &calendar->highlighted_dates[i];
+            if(d->year == calendar->showed_date.year && d->month == calendar->showed_date.month &&
+               d->day >= 1 && d->day <= act_mo_len) {
+                ctrl_map[d->day - 1 + day_first + 7] |= LV_CALENDAR_CTRL_HIGHLIGHT;
             }
         }
     }
 
-    if(calendar->showed_date.year == calendar->today.year && calendar->showed_date.month == calendar->today.month) {
-        lv_btnmatrix_set_btn_ctrl(calendar->btnm, calendar->today.day - 1 + day_first + 7, LV_CALENDAR_CTRL_TODAY);
+    if(calendar->showed_date.year == calendar->today.year && calendar->showed_date.month == calendar->today.month &&
+       calendar->today.day >= 1 && calendar->today.day <= act_mo_len) {
+        ctrl_map[calendar->today.day - 1 + day_first + 7] |= LV_CALENDAR_CTRL_TODAY;
     }
+
+    lv_btnmatrix_set_ctrl_map(calendar->btnm, ctrl_map);
 }
 
 #endif  /*LV_USE_CALENDAR*/
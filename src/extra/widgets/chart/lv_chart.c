@@ -36,10 +36,17 @@ static void draw_div_lines(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx);
 static void draw_series_line(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx);
 static void draw_series_bar(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx);
 static void draw_series_scatter(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx);
+static void draw_series_line_crowded(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx, lv_chart_series_t * ser,
+                                     const lv_draw_line_dsc_t * line_dsc, lv_coord_t w, lv_coord_t h,
+                                     lv_coord_t x_ofs, lv_coord_t y_ofs);
 static void draw_cursors(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx);
 static void draw_axes(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx);
 static uint32_t get_index_from_x(lv_obj_t * obj, lv_coord_t x);
-static void invalidate_point(lv_obj_t * obj, uint16_t i);
+static void invalidate_point(lv_obj_t * obj, uint32_t i);
+static void invalidate_points(lv_obj_t * obj, uint32_t first, uint32_t last);
+static void invalidate_env(lv_obj_t * obj, lv_chart_series_t * ser);
+static bool refr_env(lv_obj_t * obj, lv_chart_series_t * ser, lv_coord_t w, lv_coord_t h);
+static lv_coord_t get_x_from_index(uint32_t i, lv_coord_t w, uint32_t cnt);
 static void new_points_alloc(lv_obj_t * obj, lv_chart_series_t * ser, uint32_t cnt, lv_coord_t ** a);
 lv_chart_tick_dsc_t * get_tick_gsc(lv_obj_t * obj, lv_chart_axis_t axis);
 
@@ -101,7 +108,7 @@ void lv_chart_set_type(lv_obj_t * obj, lv_chart_type_t type)
     lv_chart_refresh(obj);
 }
 
-void lv_chart_set_point_count(lv_obj_t * obj, uint16_t cnt)
+void lv_chart_set_point_count(lv_obj_t * obj, uint32_t cnt)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
@@ -165,6 +172,7 @@ void lv_chart_set_update_mode(lv_obj_t * obj, lv_chart_update_mode_t update_mode
     if(chart->update_mode == update_mode) return;
 
     chart->update_mode = update_mode;
+    invalidate_env(obj, NULL);
     lv_obj_invalidate(obj);
 }
 
@@ -251,7 +259,7 @@ lv_chart_type_t lv_chart_get_type(const lv_obj_t * obj)
     return chart->type;
 }
 
-uint16_t lv_chart_get_point_count(const lv_obj_t * obj)
+uint32_t lv_chart_get_point_count(const lv_obj_t * obj)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
@@ -259,7 +267,7 @@ uint16_t lv_chart_get_point_count(const lv_obj_t * obj)
     return chart->point_cnt;
 }
 
-uint16_t lv_chart_get_x_start_point(const lv_obj_t * obj, lv_chart_series_t * ser)
+uint32_t lv_chart_get_x_start_point(const lv_obj_t * obj, lv_chart_series_t * ser)
 {
     LV_UNUSED(obj);
     LV_ASSERT_NULL(ser);
@@ -267,7 +275,7 @@ uint16_t lv_chart_get_x_start_point(const lv_obj_t * obj, lv_chart_series_t * se
     return ser->start_point;
 }
 
-void lv_chart_get_point_pos_by_id(lv_obj_t * obj, lv_chart_series_t * ser, uint16_t id, lv_point_t * p_out)
+void lv_chart_get_point_pos_by_id(lv_obj_t * obj, lv_chart_series_t * ser, uint32_t id, lv_point_t * p_out)
 {
     LV_ASSERT_NULL(obj);
     LV_ASSERT_NULL(ser);
@@ -275,7 +283,7 @@ void lv_chart_get_point_pos_by_id(lv_obj_t * obj, lv_chart_series_t * ser, uint1
 
     lv_chart_t * chart  = (lv_chart_t *)obj;
     if(id >= chart->point_cnt) {
-        LV_LOG_WARN("Invalid index: %d", id);
+        LV_LOG_WARN("Invalid index: %" LV_PRIu32, id);
         p_out->x = 0;
         p_out->y = 0;
         return;
@@ -285,7 +293,7 @@ void lv_chart_get_point_pos_by_id(lv_obj_t * obj, lv_chart_series_t * ser, uint1
     lv_coord_t h = ((int32_t)lv_obj_get_content_height(obj) * chart->zoom_y) >> 8;
 
     if(chart->type == LV_CHART_TYPE_LINE) {
-        p_out->x = (w * id) / (chart->point_cnt - 1);
+        p_out->x = get_x_from_index(id, w, chart->point_cnt - 1);
     }
     else if(chart->type == LV_CHART_TYPE_SCATTER) {
         p_out->x = lv_map(ser->x_points[id], chart->xmin[ser->x_axis_sec], chart->xmax[ser->x_axis_sec], 0, w);
@@ -299,7 +307,7 @@ void lv_chart_get_point_pos_by_id(lv_obj_t * obj, lv_chart_series_t * ser, uint1
         lv_coord_t block_w = (w - ((chart->point_cnt - 1) * block_gap)) / chart->point_cnt;
         lv_coord_t col_w = block_w / ser_cnt;
 
-        p_out->x = (int32_t)((int32_t)w * id) / chart->point_cnt;
+        p_out->x = get_x_from_index(id, w, chart->point_cnt);
 
         lv_chart_series_t * ser_i = NULL;
         _LV_LL_READ_BACK(&chart->series_ll, ser_i) {
@@ -326,6 +334,7 @@ void lv_chart_refresh(lv_obj_t * obj)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
+    invalidate_env(obj, NULL);
     lv_obj_invalidate(obj);
 }
 
@@ -361,12 +370,14 @@ lv_chart_series_t * lv_chart_add_series(lv_obj_t * obj, lv_color_t color, lv_cha
     }
 
     ser->start_point = 0;
+    ser->env = NULL;
+    ser->env_valid = 0;
     ser->y_ext_buf_assigned = false;
     ser->hidden = 0;
     ser->x_axis_sec = axis & LV_CHART_AXIS_SECONDARY_X ? 1 : 0;
     ser->y_axis_sec = axis & LV_CHART_AXIS_SECONDARY_Y ? 1 : 0;
 
-    uint16_t i;
+    uint32_t i;
     lv_coord_t * p_tmp = ser->y_points;
     for(i = 0; i < chart->point_cnt; i++) {
         *p_tmp = def;
@@ -383,6 +394,7 @@ void lv_chart_remove_series(lv_obj_t * obj, lv_chart_series_t * series)
 
     lv_chart_t * chart    = (lv_chart_t *)obj;
     if(!series->y_ext_buf_assigned && series->y_points) lv_mem_free(series->y_points);
+    if(series->env) lv_mem_free(series->env);
 
     _lv_ll_remove(&chart->series_ll, series);
     lv_mem_free(series);
@@ -409,7 +421,7 @@ void lv_chart_set_series_color(lv_obj_t * chart, lv_chart_series_t * series, lv_
     lv_chart_refresh(chart);
 }
 
-void lv_chart_set_x_start_point(lv_obj_t * obj, lv_chart_series_t * ser, uint16_t id)
+void lv_chart_set_x_start_point(lv_obj_t * obj, lv_chart_series_t * ser, uint32_t id)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
     LV_ASSERT_NULL(ser);
@@ -417,6 +429,7 @@ void lv_chart_set_x_start_point(lv_obj_t * obj, lv_chart_series_t * ser, uint16_
     lv_chart_t * chart  = (lv_chart_t *)obj;
     if(id >= chart->point_cnt) return;
     ser->start_point = id;
+    invalidate_env(obj, ser);
 }
 
 lv_chart_series_t * lv_chart_get_series_next(const lv_obj_t * obj, const lv_chart_series_t * ser)
@@ -450,7 +463,7 @@ lv_chart_cursor_t  * lv_chart_add_cursor(lv_obj_t * obj, lv_color_t color, lv_di
 
     cursor->pos.x = LV_CHART_POINT_NONE;
     cursor->pos.y = LV_CHART_POINT_NONE;
-    cursor->point_id = LV_CHART_POINT_NONE;
+    cursor->point_id = LV_CHART_POINT_ID_NONE;
     cursor->pos_set = 0;
     cursor->color = color;
     cursor->dir = dir;
@@ -484,7 +497,7 @@ void lv_chart_set_cursor_pos(lv_obj_t * chart, lv_chart_cursor_t * cursor, lv_po
  * @param cursor pointer to the cursor.
  * @param pos the new coordinate of cursor relative to the series area
  */
-void lv_chart_set_cursor_point(lv_obj_t * chart, lv_chart_cursor_t * cursor, lv_chart_series_t * ser, uint16_t point_id)
+void lv_chart_set_cursor_point(lv_obj_t * chart, lv_chart_cursor_t * cursor, lv_chart_series_t * ser, uint32_t point_id)
 {
     LV_ASSERT_NULL(cursor);
     LV_UNUSED(chart);
@@ -521,7 +534,7 @@ void lv_chart_set_all_value(lv_obj_t * obj, lv_chart_series_t * ser, lv_coord_t
     LV_ASSERT_NULL(ser);
 
     lv_chart_t * chart  = (lv_chart_t *)obj;
-    uint16_t i;
+    uint32_t i;
     for(i = 0; i < chart->point_cnt; i++) {
         ser->y_points[i] = value;
     }
@@ -536,11 +549,47 @@ void lv_chart_set_next_value(lv_obj_t * obj, lv_chart_series_t * ser, lv_coord_t
 
     lv_chart_t * chart  = (lv_chart_t *)obj;
     ser->y_points[ser->start_point] = value;
+    invalidate_env(obj, ser);
     invalidate_point(obj, ser->start_point);
     ser->start_point = (ser->start_point + 1) % chart->point_cnt;
     invalidate_point(obj, ser->start_point);
 }
 
+void lv_chart_set_next_values(lv_obj_t * obj, lv_chart_series_t * ser, const lv_coord_t values[], uint32_t cnt)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    LV_ASSERT_NULL(ser);
+
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    if(cnt == 0) return;
+
+    /*Only the last `point_cnt` values will be visible*/
+    if(cnt > chart->point_cnt) {
+        ser->start_point = (ser->start_point + cnt - chart->point_cnt) % chart->point_cnt;
+        values += cnt - chart->point_cnt;
+        cnt = chart->point_cnt;
+    }
+
+    uint32_t first = ser->start_point;
+    uint32_t cnt_1 = LV_MIN(cnt, chart->point_cnt - first);  /*Until the end of the array*/
+    lv_memcpy(&ser->y_points[first], values, cnt_1 * sizeof(lv_coord_t));
+    lv_memcpy(ser->y_points, values + cnt_1, (cnt - cnt_1) * sizeof(lv_coord_t));
+    ser->start_point = (first + cnt) % chart->point_cnt;
+    invalidate_env(obj, ser);
+
+    /*Invalidate the new points and the next one*/
+    if(cnt == chart->point_cnt) {
+        invalidate_points(obj, 0, chart->point_cnt - 1);
+    }
+    else if(first + cnt < chart->point_cnt) {
+        invalidate_points(obj, first, first + cnt);
+    }
+    else {
+        invalidate_points(obj, first, chart->point_cnt - 1);
+        invalidate_points(obj, 0, ser->start_point);
+    }
+}
+
 void lv_chart_set_next_value2(lv_obj_t * obj, lv_chart_series_t * ser, lv_coord_t x_value, lv_coord_t y_value)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
@@ -555,11 +604,12 @@ void lv_chart_set_next_value2(lv_obj_t * obj, lv_chart_series_t * ser, lv_coord_
 
     ser->x_points[ser->start_point] = x_value;
     ser->y_points[ser->start_point] = y_value;
+    invalidate_env(obj, ser);
     ser->start_point = (ser->start_point + 1) % chart->point_cnt;
     invalidate_point(obj, ser->start_point);
 }
 
-void lv_chart_set_value_by_id(lv_obj_t * obj, lv_chart_series_t * ser, uint16_t id, lv_coord_t value)
+void lv_chart_set_value_by_id(lv_obj_t * obj, lv_chart_series_t * ser, uint32_t id, lv_coord_t value)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
     LV_ASSERT_NULL(ser);
@@ -567,10 +617,11 @@ void lv_chart_set_value_by_id(lv_obj_t * obj, lv_chart_series_t * ser, uint16_t
 
     if(id >= chart->point_cnt) return;
     ser->y_points[id] = value;
+    invalidate_env(obj, ser);
     invalidate_point(obj, id);
 }
 
-void lv_chart_set_value_by_id2(lv_obj_t * obj, lv_chart_series_t * ser, uint16_t id, lv_coord_t x_value,
+void lv_chart_set_value_by_id2(lv_obj_t * obj, lv_chart_series_t * ser, uint32_t id, lv_coord_t x_value,
                                lv_coord_t y_value)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
@@ -585,6 +636,7 @@ void lv_chart_set_value_by_id2(lv_obj_t * obj, lv_chart_series_t * ser, uint16_t
     if(id >= chart->point_cnt) return;
     ser->x_points[id] = x_value;
     ser->y_points[id] = y_value;
+    invalidate_env(obj, ser);
     invalidate_point(obj, id);
 }
 
@@ -596,6 +648,7 @@ void lv_chart_set_ext_y_array(lv_obj_t * obj, lv_chart_series_t * ser, lv_coord_
     if(!ser->y_ext_buf_assigned && ser->y_points) lv_mem_free(ser->y_points);
     ser->y_ext_buf_assigned = true;
     ser->y_points = array;
+    invalidate_env(obj, ser);
     lv_obj_invalidate(obj);
 }
 
@@ -658,7 +711,7 @@ static void lv_chart_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     chart->hdiv_cnt    = LV_CHART_HDIV_DEF;
     chart->vdiv_cnt    = LV_CHART_VDIV_DEF;
     chart->point_cnt   = LV_CHART_POINT_CNT_DEF;
-    chart->pressed_point_id  = LV_CHART_POINT_NONE;
+    chart->pressed_point_id  = LV_CHART_POINT_ID_NONE;
     chart->type        = LV_CHART_TYPE_LINE;
     chart->update_mode = LV_CHART_UPDATE_MODE_SHIFT;
     chart->zoom_x      = LV_IMG_ZOOM_NONE;
@@ -678,6 +731,7 @@ static void lv_chart_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
         ser = _lv_ll_get_head(&chart->series_ll);
 
         if(!ser->y_ext_buf_assigned) lv_mem_free(ser->y_points);
+        if(ser->env) lv_mem_free(ser->env);
 
         _lv_ll_remove(&chart->series_ll, ser);
         lv_mem_free(ser);
@@ -716,7 +770,7 @@ static void lv_chart_event(const lv_obj_class_t * class_p, lv_event_t * e)
 
         p.x -= obj->coords.x1;
         uint32_t id = get_index_from_x(obj, p.x + lv_obj_get_scroll_left(obj));
-        if(id != (uint32_t)chart->pressed_point_id) {
+        if(id != chart->pressed_point_id) {
             invalidate_point(obj, id);
             invalidate_point(obj, chart->pressed_point_id);
             chart->pressed_point_id = id;
@@ -725,7 +779,7 @@ static void lv_chart_event(const lv_obj_class_t * class_p, lv_event_t * e)
     }
     else if(code == LV_EVENT_RELEASED) {
         invalidate_point(obj, chart->pressed_point_id);
-        chart->pressed_point_id = LV_CHART_POINT_NONE;
+        chart->pressed_point_id = LV_CHART_POINT_ID_NONE;
     }
     else if(code == LV_EVENT_SIZE_CHANGED) {
         lv_obj_refresh_self_size(obj);
@@ -873,7 +927,7 @@ static void draw_series_line(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx)
     lv_chart_t * chart  = (lv_chart_t *)obj;
     if(chart->point_cnt < 2) return;
 
-    uint16_t i;
+    uint32_t i;
     lv_point_t p1;
     lv_point_t p2;
     lv_coord_t border_width = lv_obj_get_style_border_width(obj, LV_PART_MAIN);
@@ -905,7 +959,7 @@ static void draw_series_line(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx)
     if(line_dsc_default.width == 1) line_dsc_default.raw_end = 1;
 
     /*If there are more points than pixels draw only vertical lines*/
-    bool crowded_mode = chart->point_cnt >= w ? true : false;
+    bool crowded_mode = chart->point_cnt >= (uint32_t)w ? true : false;
 
     /*Go through all data lines*/
     _LV_LL_READ_BACK(&chart->series_ll, ser) {
@@ -913,13 +967,18 @@ static void draw_series_line(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx)
         line_dsc_default.color = ser->color;
         point_dsc_default.bg_color = ser->color;
 
-        lv_coord_t start_point = chart->update_mode == LV_CHART_UPDATE_MODE_SHIFT ? ser->start_point : 0;
+        if(crowded_mode) {
+            draw_series_line_crowded(obj, draw_ctx, ser, &line_dsc_default, w, h, x_ofs, y_ofs);
+            continue;
+        }
+
+        uint32_t start_point = chart->update_mode == LV_CHART_UPDATE_MODE_SHIFT ? ser->start_point : 0;
 
         p1.x = x_ofs;
         p2.x = x_ofs;
 
-        lv_coord_t p_act = start_point;
-        lv_coord_t p_prev = start_point;
+        uint32_t p_act = start_point;
+        uint32_t p_prev = start_point;
         int32_t y_tmp = (int32_t)((int32_t)ser->y_points[p_prev] - chart->ymin[ser->y_axis_sec]) * h;
         y_tmp  = y_tmp / (chart->ymax[ser->y_axis_sec] - chart->ymin[ser->y_axis_sec]);
         p2.y   = h - y_tmp + y_ofs;
@@ -933,15 +992,12 @@ static void draw_series_line(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx)
         part_draw_dsc.rect_dsc = &point_dsc_default;
         part_draw_dsc.sub_part_ptr = ser;
 
-        lv_coord_t y_min = p2.y;
-        lv_coord_t y_max = p2.y;
-
         for(i = 0; i < chart->point_cnt; i++) {
             p1.x = p2.x;
             p1.y = p2.y;
 
             if(p1.x > clip_area_ori->x2 + point_w + 1) break;
-            p2.x = ((w * i) / (chart->point_cnt - 1)) + x_ofs;
+            p2.x = (((int32_t)w * i) / (chart->point_cnt - 1)) + x_ofs;
 
             p_act = (start_point + i) % chart->point_cnt;
 
@@ -956,57 +1012,35 @@ static void draw_series_line(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx)
 
             /*Don't draw the first point. A second point is also required to draw the line*/
             if(i != 0) {
-                if(crowded_mode) {
-                    if(ser->y_points[p_prev] != LV_CHART_POINT_NONE && ser->y_points[p_act] != LV_CHART_POINT_NONE) {
-                        /*Draw only one vertical line between the min and max y-values on the same x-value*/
-                        y_max = LV_MAX(y_max, p2.y);
-                        y_min = LV_MIN(y_min, p2.y);
-                        if(p1.x != p2.x) {
-                            lv_coord_t y_cur = p2.y;
-                            p2.x--;         /*It's already on the next x value*/
-                            p1.x = p2.x;
-                            p1.y = y_min;
-                            p2.y = y_max;
-                            if(p1.y == p2.y) p2.y++;    /*If they are the same no line will be drawn*/
-                            lv_draw_line(draw_ctx, &line_dsc_default, &p1, &p2);
-                            p2.x++;         /*Compensate the previous x--*/
-                            y_min = y_cur;  /*Start the line of the next x from the current last y*/
-                            y_max = y_cur;
-                        }
-                    }
-                }
-                else {
-                    lv_area_t point_area;
-                    point_area.x1 = p1.x - point_w;
-                    point_area.x2 = p1.x + point_w;
-                    point_area.y1 = p1.y - point_h;
-                    point_area.y2 = p1.y + point_h;
-
-                    part_draw_dsc.id = i - 1;
-                    part_draw_dsc.p1 = ser->y_points[p_prev] != LV_CHART_POINT_NONE ? &p1 : NULL;
-                    part_draw_dsc.p2 = ser->y_points[p_act] != LV_CHART_POINT_NONE ? &p2 : NULL;
-                    part_draw_dsc.draw_area = &point_area;
-                    part_draw_dsc.value = ser->y_points[p_prev];
-
-                    lv_event_send(obj, LV_EVENT_DRAW_PART_BEGIN, &part_draw_dsc);
-
-                    if(ser->y_points[p_prev] != LV_CHART_POINT_NONE && ser->y_points[p_act] != LV_CHART_POINT_NONE) {
-                        lv_draw_line(draw_ctx, &line_dsc_default, &p1, &p2);
-                    }
+                lv_area_t point_area;
+                point_area.x1 = p1.x - point_w;
+                point_area.x2 = p1.x + point_w;
+                point_area.y1 = p1.y - point_h;
+                point_area.y2 = p1.y + point_h;
 
-                    if(point_w && point_h && ser->y_points[p_prev] != LV_CHART_POINT_NONE) {
-                        lv_draw_rect(draw_ctx, &point_dsc_default, &point_area);
-                    }
+                part_draw_dsc.id = i - 1;
+                part_draw_dsc.p1 = ser->y_points[p_prev] != LV_CHART_POINT_NONE ? &p1 : NULL;
+                part_draw_dsc.p2 = ser->y_points[p_act] != LV_CHART_POINT_NONE ? &p2 : NULL;
+                part_draw_dsc.draw_area = &point_area;
+                part_draw_dsc.value = ser->y_points[p_prev];
+
+                lv_event_send(obj, LV_EVENT_DRAW_PART_BEGIN, &part_draw_dsc);
 
-                    lv_event_send(obj, LV_EVENT_DRAW_PART_END, &part_draw_dsc);
+                if(ser->y_points[p_prev] != LV_CHART_POINT_NONE && ser->y_points[p_act] != LV_CHART_POINT_NONE) {
+                    lv_draw_line(draw_ctx, &line_dsc_default, &p1, &p2);
                 }
 
+                if(point_w && point_h && ser->y_points[p_prev] != LV_CHART_POINT_NONE) {
+                    lv_draw_rect(draw_ctx, &point_dsc_default, &point_area);
+                }
+
+                lv_event_send(obj, LV_EVENT_DRAW_PART_END, &part_draw_dsc);
             }
             p_prev = p_act;
         }
 
         /*Draw the last point*/
-        if(!crowded_mode && i == chart->point_cnt) {
+        if(i == chart->point_cnt) {
 
             if(ser->y_points[p_act] != LV_CHART_POINT_NONE) {
                 lv_area_t point_area;
@@ -1031,6 +1065,36 @@ static void draw_series_line(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx)
     draw_ctx->clip_area = clip_area_ori;
 }
 
+/**
+ * Draw a line series which has more points than pixels. Only one vertical line is drawn on each x coordinate
+ * between the smallest and largest y values of the points there, so the drawing time depends on the
+ * width of the chart and not on the number of points.
+ */
+static void draw_series_line_crowded(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx, lv_chart_series_t * ser,
+                                     const lv_draw_line_dsc_t * line_dsc, lv_coord_t w, lv_coord_t h,
+                                     lv_coord_t x_ofs, lv_coord_t y_ofs)
+{
+    if(refr_env(obj, ser, w, h) == false) return;
+
+    lv_coord_t ext = line_dsc->width / 2 + 1;
+    lv_coord_t x_start = LV_MAX(draw_ctx->clip_area->x1 - x_ofs - ext, 0);
+    lv_coord_t x_end = LV_MIN(draw_ctx->clip_area->x2 - x_ofs + ext, w - 1);
+
+    lv_point_t p1;
+    lv_point_t p2;
+    lv_coord_t x;
+    for(x = x_start; x <= x_end; x++) {
+        lv_coord_t * env = &ser->env[x * 2];
+        if(env[0] == LV_COORD_MIN) continue;
+
+        p1.x = x + x_ofs;
+        p1.y = env[0] + y_ofs;
+        p2.x = p1.x;
+        p2.y = env[1] + y_ofs;
+        lv_draw_line(draw_ctx, line_dsc, &p1, &p2);
+    }
+}
+
 static void draw_series_scatter(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx)
 {
 
@@ -1042,7 +1106,7 @@ static void draw_series_scatter(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx)
 
     lv_chart_t * chart  = (lv_chart_t *)obj;
 
-    uint16_t i;
+    uint32_t i;
     lv_point_t p1;
     lv_point_t p2;
     lv_coord_t border_width = lv_obj_get_style_border_width(obj, LV_PART_MAIN);
@@ -1075,13 +1139,13 @@ static void draw_series_scatter(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx)
         line_dsc_default.color = ser->color;
         point_dsc_default.bg_color = ser->color;
 
-        lv_coord_t start_point = chart->update_mode == LV_CHART_UPDATE_MODE_SHIFT ? ser->start_point : 0;
+        uint32_t start_point = chart->update_mode == LV_CHART_UPDATE_MODE_SHIFT ? ser->start_point : 0;
 
         p1.x = x_ofs;
         p2.x = x_ofs;
 
-        lv_coord_t p_act = start_point;
-        lv_coord_t p_prev = start_point;
+        uint32_t p_act = start_point;
+        uint32_t p_prev = start_point;
         if(ser->y_points[p_act] != LV_CHART_POINT_CNT_DEF) {
             p2.x = lv_map(ser->x_points[p_act], chart->xmin[ser->x_axis_sec], chart->xmax[ser->x_axis_sec], 0, w);
             p2.x += x_ofs;
@@ -1185,7 +1249,7 @@ static void draw_series_bar(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx)
 
     lv_chart_t * chart  = (lv_chart_t *)obj;
 
-    uint16_t i;
+    uint32_t i;
     lv_area_t col_a;
     lv_coord_t pad_left = lv_obj_get_style_pad_left(obj, LV_PART_MAIN);
     lv_coord_t pad_top = lv_obj_get_style_pad_top(obj, LV_PART_MAIN);
@@ -1220,14 +1284,14 @@ static void draw_series_bar(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx)
 
     /*Go through all points*/
     for(i = 0; i < chart->point_cnt; i++) {
-        lv_coord_t x_act = (int32_t)((int32_t)(w + block_gap) * i) / (chart->point_cnt) + obj->coords.x1 + x_ofs;
+        lv_coord_t x_act = get_x_from_index(i, w + block_gap, chart->point_cnt) + obj->coords.x1 + x_ofs;
 
         part_draw_dsc.id = i;
 
         /*Draw the current point of all data line*/
         _LV_LL_READ_BACK(&chart->series_ll, ser) {
             if(ser->hidden) continue;
-            lv_coord_t start_point = chart->update_mode == LV_CHART_UPDATE_MODE_SHIFT ? ser->start_point : 0;
+            uint32_t start_point = chart->update_mode == LV_CHART_UPDATE_MODE_SHIFT ? ser->start_point : 0;
 
             col_a.x1 = x_act;
             col_a.x2 = col_a.x1 + col_w - ser_gap - 1;
@@ -1238,7 +1302,7 @@ static void draw_series_bar(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx)
 
             col_dsc.bg_color = ser->color;
 
-            lv_coord_t p_act = (start_point + i) % chart->point_cnt;
+            uint32_t p_act = (start_point + i) % chart->point_cnt;
             y_tmp            = (int32_t)((int32_t)ser->y_points[p_act] - chart->ymin[ser->y_axis_sec]) * h;
             y_tmp            = y_tmp / (chart->ymax[ser->y_axis_sec] - chart->ymin[ser->y_axis_sec]);
             col_a.y1         = h - y_tmp + obj->coords.y1 + y_ofs;
@@ -1314,7 +1378,7 @@ static void draw_cursors(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx)
             cy = cursor->pos.y;
         }
         else {
-            if(cursor->point_id == LV_CHART_POINT_NONE) continue;
+            if(cursor->point_id == LV_CHART_POINT_ID_NONE) continue;
             lv_point_t p;
             lv_chart_get_point_pos_by_id(obj, cursor->ser, cursor->point_id, &p);
             cx = p.x;
@@ -1656,23 +1720,37 @@ static uint32_t get_index_from_x(lv_obj_t * obj, lv_coord_t x)
 
     if(x < 0) return 0;
     if(x > w) return chart->point_cnt - 1;
-    if(chart->type == LV_CHART_TYPE_LINE) return (x * (chart->point_cnt - 1) + w / 2) / w;
-    if(chart->type == LV_CHART_TYPE_BAR) return (x * chart->point_cnt) / w;
+    if(chart->type == LV_CHART_TYPE_LINE) return ((int64_t)x * (chart->point_cnt - 1) + w / 2) / w;
+    if(chart->type == LV_CHART_TYPE_BAR) return ((int64_t)x * chart->point_cnt) / w;
 
     return 0;
 }
 
-static void invalidate_point(lv_obj_t * obj, uint16_t i)
+static void invalidate_point(lv_obj_t * obj, uint32_t i)
+{
+    invalidate_points(obj, i, i);
+}
+
+/**
+ * Invalidate the area of the points between two indexes (inclusive) and the lines around them
+ * @param obj   pointer to a chart object
+ * @param first index of the first point
+ * @param last  index of the last point, not smaller than `first`
+ */
+static void invalidate_points(lv_obj_t * obj, uint32_t first, uint32_t last)
 {
     lv_chart_t * chart  = (lv_chart_t *)obj;
-    if(i >= chart->point_cnt) return;
+    if(first >= chart->point_cnt) return;
+    if(last >= chart->point_cnt) last = chart->point_cnt - 1;
 
     lv_coord_t w  = ((int32_t)lv_obj_get_content_width(obj) * chart->zoom_x) >> 8;
     lv_coord_t scroll_left = lv_obj_get_scroll_left(obj);
 
-    /*In shift mode the whole chart changes so the whole object*/
+    /*In shift mode the whole series area changes but the ticks and labels outside of it don't*/
     if(chart->update_mode == LV_CHART_UPDATE_MODE_SHIFT) {
-        lv_obj_invalidate(obj);
+        lv_area_t coords;
+        lv_area_copy(&coords, &obj->coords);
+        lv_obj_invalidate_area(obj, &coords);
         return;
     }
 
@@ -1683,22 +1761,17 @@ static void invalidate_point(lv_obj_t * obj, uint16_t i)
         lv_coord_t line_width = lv_obj_get_style_line_width(obj, LV_PART_ITEMS);
         lv_coord_t point_w = lv_obj_get_style_width(obj, LV_PART_INDICATOR);
 
+        /*The lines from the previous point and to the next point change too*/
+        if(first > 0) first--;
+        if(last < chart->point_cnt - 1) last++;
+
         lv_area_t coords;
         lv_area_copy(&coords, &obj->coords);
         coords.y1 -= line_width + point_w;
         coords.y2 += line_width + point_w;
-
-        if(i < chart->point_cnt - 1) {
-            coords.x1 = ((w * i) / (chart->point_cnt - 1)) + x_ofs - line_width - point_w;
-            coords.x2 = ((w * (i + 1)) / (chart->point_cnt - 1)) + x_ofs + line_width + point_w;
-            lv_obj_invalidate_area(obj, &coords);
-        }
-
-        if(i > 0) {
-            coords.x1 = ((w * (i - 1)) / (chart->point_cnt - 1)) + x_ofs - line_width - point_w;
-            coords.x2 = ((w * i) / (chart->point_cnt - 1)) + x_ofs + line_width + point_w;
-            lv_obj_invalidate_area(obj, &coords);
-        }
+        coords.x1 = get_x_from_index(first, w, chart->point_cnt - 1) + x_ofs - line_width - point_w;
+        coords.x2 = get_x_from_index(last, w, chart->point_cnt - 1) + x_ofs + line_width + point_w;
+        lv_obj_invalidate_area(obj, &coords);
     }
     else if(chart->type == LV_CHART_TYPE_BAR) {
         lv_area_t col_a;
@@ -1706,14 +1779,11 @@ static void invalidate_point(lv_obj_t * obj, uint16_t i)
                                                                   LV_PART_MAIN) * chart->zoom_x) >> 8;  /*Gap between the column on ~adjacent X*/
         lv_coord_t block_w = (w + block_gap) / chart->point_cnt;
 
-        lv_coord_t x_act;
-        x_act = (int32_t)((int32_t)(block_w) * i) ;
-        x_act += obj->coords.x1 + lv_obj_get_style_pad_left(obj, LV_PART_MAIN);
+        lv_coord_t x_ofs = obj->coords.x1 + lv_obj_get_style_pad_left(obj, LV_PART_MAIN) - scroll_left;
 
         lv_obj_get_coords(obj, &col_a);
-        col_a.x1 = x_act - scroll_left;
-        col_a.x2 = col_a.x1 + block_w;
-        col_a.x1 -= block_gap;
+        col_a.x1 = (int32_t)block_w * first + x_ofs - block_gap;
+        col_a.x2 = (int32_t)block_w * last + x_ofs + block_w;
 
         lv_obj_invalidate_area(obj, &col_a);
     }
@@ -1722,6 +1792,116 @@ static void invalidate_point(lv_obj_t * obj, uint16_t i)
     }
 }
 
+static void invalidate_env(lv_obj_t * obj, lv_chart_series_t * ser)
+{
+    if(ser) {
+        ser->env_valid = 0;
+        return;
+    }
+
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    _LV_LL_READ_BACK(&chart->series_ll, ser) {
+        ser->env_valid = 0;
+    }
+}
+
+/**
+ * Update the vertical line of each x pixel of a line series with more points than pixels.
+ * The lines are cached until the data, the range or the size of the chart changes.
+ * @param obj   pointer to a chart object
+ * @param ser   pointer to a series
+ * @param w     width of the series area
+ * @param h     height of the series area
+ * @return      true: `ser->env` is ready; false: out of memory
+ */
+static bool refr_env(lv_obj_t * obj, lv_chart_series_t * ser, lv_coord_t w, lv_coord_t h)
+{
+    if(ser->env && ser->env_valid && ser->env_w == w && ser->env_h == h) return true;
+    if(w <= 0) return false;
+
+    if(ser->env == NULL || ser->env_w != w) {
+        lv_coord_t * env = lv_mem_realloc(ser->env, sizeof(lv_coord_t) * 2 * w);
+        LV_ASSERT_MALLOC(env);
+        if(env == NULL) {
+            lv_mem_free(ser->env);
+            ser->env = NULL;
+            return false;
+        }
+        ser->env = env;
+    }
+
+    ser->env_w = w;
+    ser->env_h = h;
+    ser->env_valid = 1;
+
+    lv_coord_t * env = ser->env;
+    lv_coord_t x;
+    for(x = 0; x < w; x++) {
+        env[x * 2] = LV_COORD_MIN;
+    }
+
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    uint32_t cnt = chart->point_cnt;
+    uint32_t start_point = chart->update_mode == LV_CHART_UPDATE_MODE_SHIFT ? ser->start_point : 0;
+    int32_t ymin = chart->ymin[ser->y_axis_sec];
+    int32_t yrange = chart->ymax[ser->y_axis_sec] - ymin;
+
+    lv_coord_t y_act = h - ((ser->y_points[start_point] - ymin) * h) / yrange;
+    lv_coord_t y_min = y_act;
+    lv_coord_t y_max = y_act;
+    bool none_prev = ser->y_points[start_point] == LV_CHART_POINT_NONE;
+
+    /*Step x as `w * i / (cnt - 1)` without multiplication and division*/
+    lv_coord_t x_act = 0;
+    uint32_t x_rem = 0;
+
+    uint32_t i;
+    for(i = 1; i < cnt; i++) {
+        uint32_t p_act = start_point + i;
+        if(p_act >= cnt) p_act -= cnt;
+
+        lv_coord_t x_prev = x_act;
+        x_rem += w;
+        while(x_rem >= cnt - 1) {
+            x_rem -= cnt - 1;
+            x_act++;
+        }
+
+        lv_coord_t v = ser->y_points[p_act];
+        y_act = h - ((v - ymin) * h) / yrange;
+
+        bool none_act = v == LV_CHART_POINT_NONE;
+        if(!none_prev && !none_act) {
+            y_max = LV_MAX(y_max, y_act);
+            y_min = LV_MIN(y_min, y_act);
+
+            /*Reached the next x: save the line of the previous x. It also reaches the first point on this x.*/
+            if(x_prev != x_act) {
+                env[(x_act - 1) * 2] = y_min;
+                env[(x_act - 1) * 2 + 1] = y_min == y_max ? y_max + 1 : y_max;   /*Else no line would be drawn*/
+                y_min = y_act;
+                y_max = y_act;
+            }
+        }
+        none_prev = none_act;
+    }
+
+    return true;
+}
+
+/**
+ * Get the x coordinate of a point from its index without overflow
+ * @param i     index of the point
+ * @param w     width to map to
+ * @param cnt   the index which is mapped to `w`
+ * @return      `w * i / cnt`
+ */
+static lv_coord_t get_x_from_index(uint32_t i, lv_coord_t w, uint32_t cnt)
+{
+    if(cnt == 0) return 0;
+    return ((int64_t)w * i) / cnt;
+}
+
 static void new_points_alloc(lv_obj_t * obj, lv_chart_series_t * ser, uint32_t cnt, lv_coord_t ** a)
 {
     if((*a) == NULL) return;
@@ -29,6 +29,10 @@ extern "C" {
 #endif
 LV_EXPORT_CONST_INT(LV_CHART_POINT_NONE);
 
+/**No point is pressed or the cursor isn't assigned to a point*/
+#define LV_CHART_POINT_ID_NONE (UINT32_MAX)
+LV_EXPORT_CONST_INT(LV_CHART_POINT_ID_NONE);
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -72,7 +76,11 @@ typedef struct {
     lv_coord_t * x_points;
     lv_coord_t * y_points;
     lv_color_t color;
-    uint16_t start_point;
+    uint32_t start_point;
+    lv_coord_t * env;           /**< Cached vertical line (min and max y) of each x pixel if there are more points than pixels*/
+    lv_coord_t env_w;           /**< Width of the chart when `env` was created*/
+    lv_coord_t env_h;           /**< Height of the chart when `env` was created*/
+    uint8_t env_valid : 1;      /**< 0: the data has changed since `env` was created*/
     uint8_t hidden : 1;
     uint8_t x_ext_buf_assigned : 1;
     uint8_t y_ext_buf_assigned : 1;
@@ -82,7 +90,7 @@ typedef struct {
 
 typedef struct {
     lv_point_t pos;
-    lv_coord_t point_id;
+    uint32_t point_id;
     lv_color_t color;
     lv_chart_series_t * ser;
     lv_dir_t dir;
@@ -108,10 +116,10 @@ typedef struct {
     lv_coord_t ymax[2];
     lv_coord_t xmin[2];
     lv_coord_t xmax[2];
-    lv_coord_t pressed_point_id;
+    uint32_t pressed_point_id;
     uint16_t hdiv_cnt;      /**< Number of horizontal division lines*/
     uint16_t vdiv_cnt;      /**< Number of vertical division lines*/
-    uint16_t point_cnt;    /**< Point number in a data line*/
+    uint32_t point_cnt;    /**< Point number in a data line*/
     uint16_t zoom_x;
     uint16_t zoom_y;
     lv_chart_type_t type  : 3; /**< Line or column chart*/
@@ -156,7 +164,7 @@ void lv_chart_set_type(lv_obj_t * obj, lv_chart_type_t type);
  * @param obj       pointer to a chart object
  * @param cnt       new number of points on the data lines
  */
-void lv_chart_set_point_count(lv_obj_t * obj, uint16_t cnt);
+void lv_chart_set_point_count(lv_obj_t * obj, uint32_t cnt);
 
 /**
  * Set the minimal and maximal y values on an axis
@@ -237,7 +245,7 @@ lv_chart_type_t lv_chart_get_type(const lv_obj_t * obj);
  * @param chart     pointer to chart object
  * @return          point number on each data line
  */
-uint16_t lv_chart_get_point_count(const lv_obj_t * obj);
+uint32_t lv_chart_get_point_count(const lv_obj_t * obj);
 
 /**
  * Get the current index of the x-axis start point in the data array
@@ -245,7 +253,7 @@ uint16_t lv_chart_get_point_count(const lv_obj_t * obj);
  * @param ser       pointer to a data series on 'chart'
  * @return          the index of the current x start point in the data array
  */
-uint16_t lv_chart_get_x_start_point(const lv_obj_t * obj, lv_chart_series_t * ser);
+uint32_t lv_chart_get_x_start_point(const lv_obj_t * obj, lv_chart_series_t * ser);
 
 /**
  * Get the position of a point to the chart.
@@ -254,7 +262,7 @@ uint16_t lv_chart_get_x_start_point(const lv_obj_t * obj, lv_chart_series_t * se
  * @param id        the index.
  * @param p_out     store the result position here
  */
-void lv_chart_get_point_pos_by_id(lv_obj_t * obj, lv_chart_series_t * ser, uint16_t id, lv_point_t * p_out);
+void lv_chart_get_point_pos_by_id(lv_obj_t * obj, lv_chart_series_t * ser, uint32_t id, lv_point_t * p_out);
 
 /**
  * Refresh a chart if its data line has changed
@@ -305,7 +313,7 @@ void lv_chart_set_series_color(lv_obj_t * chart, lv_chart_series_t * series, lv_
  * @param ser       pointer to a data series on 'chart'
  * @param id        the index of the x point in the data array
  */
-void lv_chart_set_x_start_point(lv_obj_t * obj, lv_chart_series_t * ser, uint16_t id);
+void lv_chart_set_x_start_point(lv_obj_t * obj, lv_chart_series_t * ser, uint32_t id);
 
 /**
  * Get the next series.
@@ -343,10 +351,10 @@ void lv_chart_set_cursor_pos(lv_obj_t * chart, lv_chart_cursor_t * cursor, lv_po
  * @param obj       pointer to a chart object
  * @param cursor    pointer to the cursor
  * @param ser       pointer to a series
- * @param point_id  the point's index or `LV_CHART_POINT_NONE` to not assign to any points.
+ * @param point_id  the point's index or `LV_CHART_POINT_ID_NONE` to not assign to any points.
  */
 void lv_chart_set_cursor_point(lv_obj_t * chart, lv_chart_cursor_t * cursor, lv_chart_series_t * ser,
-                               uint16_t point_id);
+                               uint32_t point_id);
 
 /**
  * Get the coordinate of the cursor with respect to the paddings
@@ -376,6 +384,17 @@ void lv_chart_set_all_value(lv_obj_t * obj, lv_chart_series_t * ser, lv_coord_t
  */
 void lv_chart_set_next_value(lv_obj_t * obj, lv_chart_series_t * ser, lv_coord_t value);
 
+/**
+ * Set the next points on a data line according to the update mode policy.
+ * It's faster than calling `lv_chart_set_next_value()` for each value, e.g. when streaming data
+ * as only the changed area is invalidated once.
+ * @param obj       pointer to chart object
+ * @param ser       pointer to a data series on 'chart'
+ * @param values    the new values to add
+ * @param cnt       number of values in `values`
+ */
+void lv_chart_set_next_values(lv_obj_t * obj, lv_chart_series_t * ser, const lv_coord_t values[], uint32_t cnt);
+
 /**
  * Set the next point's X and Y value according to the update mode policy.
  * @param obj       pointer to chart object
@@ -392,7 +411,7 @@ void lv_chart_set_next_value2(lv_obj_t * obj, lv_chart_series_t * ser, lv_coord_
  * @param id      the index of the x point in the array
  * @param value   value to assign to array point
  */
-void lv_chart_set_value_by_id(lv_obj_t * obj, lv_chart_series_t * ser, uint16_t id, lv_coord_t value);
+void lv_chart_set_value_by_id(lv_obj_t * obj, lv_chart_series_t * ser, uint32_t id, lv_coord_t value);
 
 /**
  * Set an individual point's x and y value of a chart's series directly based on its index
@@ -403,7 +422,7 @@ void lv_chart_set_value_by_id(lv_obj_t * obj, lv_chart_series_t * ser, uint16_t
  * @param x_value   the new X value of the next data
  * @param y_value   the new Y value of the next data
  */
-void lv_chart_set_value_by_id2(lv_obj_t * obj, lv_chart_series_t * ser, uint16_t id, lv_coord_t x_value,
+void lv_chart_set_value_by_id2(lv_obj_t * obj, lv_chart_series_t * ser, uint32_t id, lv_coord_t x_value,
                                lv_coord_t y_value);
 
 /**
@@ -18,6 +18,7 @@
 #define MY_CLASS &lv_colorwheel_class
 
 #define LV_CPICKER_DEF_QF 3
+#define RING_LINE_CNT   (256 / LV_CPICKER_DEF_QF + 1)
 
 /**
  * The OUTER_MASK_WIDTH define is required to assist with the placing of a mask over the outer ring of the widget as when the
@@ -35,9 +36,15 @@
  *  STATIC PROTOTYPES
  **********************/
 static void lv_colorwheel_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
+static void lv_colorwheel_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void lv_colorwheel_event(const lv_obj_class_t * class_p, lv_event_t * e);
 
-static void draw_disc_grad(lv_event_t * e);
+static void draw_disc_grad(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx);
+static void render_ring_cb(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx, void * user_data);
+static bool draw_ring_img(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx);
+static void free_ring_img(lv_obj_t * obj);
+static void invalidate_ring(lv_obj_t * obj);
+static bool ring_changes(lv_obj_t * obj, lv_color_hsv_t hsv);
 static void draw_knob(lv_event_t * e);
 static void invalidate_knob(lv_obj_t * obj);
 static lv_area_t get_knob_area(lv_obj_t * obj);
@@ -45,7 +52,7 @@ static lv_area_t get_knob_area(lv_obj_t * obj);
 static void next_color_mode(lv_obj_t * obj);
 static lv_res_t double_click_reset(lv_obj_t * obj);
 static void refr_knob_pos(lv_obj_t * obj);
-static lv_color_t angle_to_mode_color_fast(lv_obj_t * obj, uint16_t angle);
+static void get_ring_colors(lv_obj_t * obj, lv_color_t colors[]);
 static uint16_t get_angle(lv_obj_t * obj);
 
 /**********************
@@ -53,6 +60,7 @@ static uint16_t get_angle(lv_obj_t * obj);
  **********************/
 const lv_obj_class_t lv_colorwheel_class = {.instance_size = sizeof(lv_colorwheel_t), .base_class = &lv_obj_class,
                                             .constructor_cb = lv_colorwheel_constructor,
+                                            .destructor_cb = lv_colorwheel_destructor,
                                             .event_cb = lv_colorwheel_event,
                                             .width_def = LV_DPI_DEF * 2,
                                             .height_def = LV_DPI_DEF * 2,
@@ -105,11 +113,12 @@ bool lv_colorwheel_set_hsv(lv_obj_t * obj, lv_color_hsv_t hsv)
 
     if(colorwheel->hsv.h == hsv.h && colorwheel->hsv.s == hsv.s && colorwheel->hsv.v == hsv.v) return false;
 
+    bool ring_changed = ring_changes(obj, hsv);
     colorwheel->hsv = hsv;
 
+    /*The old and new area of the knob is invalidated here. The ring needs to be redrawn only if its colors change*/
     refr_knob_pos(obj);
-
-    lv_obj_invalidate(obj);
+    if(ring_changed) invalidate_ring(obj);
 
     return true;
 }
@@ -140,7 +149,7 @@ void lv_colorwheel_set_mode(lv_obj_t * obj, lv_colorwheel_mode_t mode)
 
     colorwheel->mode = mode;
     refr_knob_pos(obj);
-    lv_obj_invalidate(obj);
+    invalidate_ring(obj);
 }
 
 /**
@@ -156,6 +165,17 @@ void lv_colorwheel_set_mode_fixed(lv_obj_t * obj, bool fixed)
     colorwheel->mode_fixed = fixed;
 }
 
+void lv_colorwheel_set_ring_cache(lv_obj_t * obj, bool en)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_colorwheel_t * colorwheel = (lv_colorwheel_t *)obj;
+
+    if(colorwheel->ring_cache_en == en) return;
+
+    colorwheel->ring_cache_en = en ? 1 : 0;
+    invalidate_ring(obj);
+}
+
 /*=====================
  * Getter functions
  *====================*/
@@ -213,6 +233,14 @@ bool lv_colorwheel_get_color_mode_fixed(lv_obj_t * obj)
     return colorwheel->mode_fixed;
 }
 
+bool lv_colorwheel_get_ring_cache(const lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_colorwheel_t * colorwheel = (lv_colorwheel_t *)obj;
+
+    return colorwheel->ring_cache_en ? true : false;
+}
+
 /*=====================
  * Other functions
  *====================*/
@@ -233,16 +261,23 @@ static void lv_colorwheel_constructor(const lv_obj_class_t * class_p, lv_obj_t *
     colorwheel->last_click_time = 0;
     colorwheel->last_change_time = 0;
     colorwheel->knob.recolor = create_knob_recolor;
+    colorwheel->ring_cache_en = 0;
+    colorwheel->ring_img = NULL;
+    colorwheel->ring_img_style_cnt = 0;
 
     lv_obj_add_flag(obj, LV_OBJ_FLAG_ADV_HITTEST);
     lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLL_CHAIN);
     refr_knob_pos(obj);
 }
 
-static void draw_disc_grad(lv_event_t * e)
+static void lv_colorwheel_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
+{
+    LV_UNUSED(class_p);
+    free_ring_img(obj);
+}
+
+static void draw_disc_grad(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx)
 {
-    lv_obj_t * obj = lv_event_get_target(e);
-    lv_draw_ctx_t * draw_ctx = lv_event_get_draw_ctx(e);
     lv_coord_t w = lv_obj_get_width(obj);
     lv_coord_t h = lv_obj_get_height(obj);
     lv_coord_t cx = obj->coords.x1 + w / 2;
@@ -257,6 +292,8 @@ static void draw_disc_grad(lv_event_t * e)
     line_dsc.width += 2;
     uint16_t i;
     uint32_t a = 0;
+    lv_color_t colors[RING_LINE_CNT];
+    get_ring_colors(obj, colors);
     lv_coord_t cir_w = lv_obj_get_style_arc_width(obj, LV_PART_MAIN);
 
 #if LV_DRAW_COMPLEX
@@ -283,7 +320,7 @@ static void draw_disc_grad(lv_event_t * e)
 #endif
 
     for(i = 0; i <= 256; i += LV_CPICKER_DEF_QF, a += 360 * LV_CPICKER_DEF_QF) {
-        line_dsc.color = angle_to_mode_color_fast(obj, i);
+        line_dsc.color = colors[i / LV_CPICKER_DEF_QF];
         uint16_t angle_trigo = (uint16_t)(a >> 8); /*i * 360 / 256 is the scale to apply, but we can skip multiplication here*/
 
         lv_point_t p[2];
@@ -303,6 +340,106 @@ static void draw_disc_grad(lv_event_t * e)
 #endif
 }
 
+/**
+ * Draw the ring from an image. Render the image first if it's missing or outdated.
+ * @return false if the image couldn't be created, the ring needs to be drawn normally
+ */
+static bool draw_ring_img(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx)
+{
+    lv_colorwheel_t * colorwheel = (lv_colorwheel_t *)obj;
+
+    lv_coord_t w = lv_obj_get_width(obj);
+    lv_coord_t h = lv_obj_get_height(obj);
+    if(colorwheel->ring_img) {
+        if(colorwheel->ring_img->header.w != w || colorwheel->ring_img->header.h != h ||
+           colorwheel->ring_img_style_cnt != _lv_obj_style_get_refr_cnt()) {
+            free_ring_img(obj);
+        }
+    }
+
+    if(colorwheel->ring_img == NULL) {
+        /*The masks of the parents (e.g. rounded corners) would be rendered to the image too*/
+        if(w <= 0 || h <= 0 || lv_draw_mask_is_any(&obj->coords)) return false;
+
+        uint32_t size = (uint32_t)w * h * LV_IMG_PX_SIZE_ALPHA_BYTE;
+        lv_img_dsc_t * img = lv_mem_alloc(sizeof(lv_img_dsc_t) + size);
+        LV_ASSERT_MALLOC(img);
+        if(img == NULL) return false;
+
+        uint8_t * buf = (uint8_t *)(img + 1);
+        lv_memset_00(img, sizeof(lv_img_dsc_t));
+        lv_memset_00(buf, size);
+        img->header.w = w;
+        img->header.h = h;
+        img->header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA;
+        img->data_size = size;
+        img->data = buf;
+
+        /*Render the ring to the buffer instead of the display*/
+        if(_lv_obj_render_to_buf(obj, buf, &obj->coords, LV_IMG_CF_TRUE_COLOR_ALPHA, render_ring_cb,
+                                 NULL) != LV_RES_OK) {
+            lv_mem_free(img);
+            return false;
+        }
+
+        colorwheel->ring_img = img;
+        colorwheel->ring_img_style_cnt = _lv_obj_style_get_refr_cnt();
+    }
+
+    lv_draw_img_dsc_t img_dsc;
+    lv_draw_img_dsc_init(&img_dsc);
+    lv_draw_img(draw_ctx, &img_dsc, &obj->coords, colorwheel->ring_img);
+
+    return true;
+}
+
+/**
+ * Render the ring into the ring image
+ */
+static void render_ring_cb(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx, void * user_data)
+{
+    LV_UNUSED(user_data);
+    draw_disc_grad(obj, draw_ctx);
+}
+
+static void free_ring_img(lv_obj_t * obj)
+{
+    lv_colorwheel_t * colorwheel = (lv_colorwheel_t *)obj;
+    if(colorwheel->ring_img == NULL) return;
+
+    lv_img_cache_invalidate_src(colorwheel->ring_img);
+    lv_mem_free(colorwheel->ring_img);
+    colorwheel->ring_img = NULL;
+    colorwheel->ring_img_style_cnt = 0;
+}
+
+/**
+ * Redraw the whole color wheel and render the ring again
+ */
+static void invalidate_ring(lv_obj_t * obj)
+{
+    free_ring_img(obj);
+    lv_obj_invalidate(obj);
+}
+
+/**
+ * Check if the colors of the ring would be different with a new HSV color.
+ * The ring shows the whole range of the current mode's component so only the other two components matter.
+ */
+static bool ring_changes(lv_obj_t * obj, lv_color_hsv_t hsv)
+{
+    lv_colorwheel_t * colorwheel = (lv_colorwheel_t *)obj;
+    switch(colorwheel->mode) {
+        default:
+        case LV_COLORWHEEL_MODE_HUE:
+            return colorwheel->hsv.s != hsv.s || colorwheel->hsv.v != hsv.v;
+        case LV_COLORWHEEL_MODE_SATURATION:
+            return colorwheel->hsv.h != hsv.h || colorwheel->hsv.v != hsv.v;
+        case LV_COLORWHEEL_MODE_VALUE:
+            return colorwheel->hsv.h != hsv.h || colorwheel->hsv.s != hsv.s;
+    }
+}
+
 static void draw_knob(lv_event_t * e)
 {
     lv_obj_t * obj = lv_event_get_target(e);
@@ -527,7 +664,10 @@ static void lv_colorwheel_event(const lv_obj_class_t * class_p, lv_event_t * e)
         info->res = _lv_area_is_point_on(&obj->coords, info->point, LV_RADIUS_CIRCLE);
     }
     else if(code == LV_EVENT_DRAW_MAIN) {
-        draw_disc_grad(e);
+        lv_draw_ctx_t * draw_ctx = lv_event_get_draw_ctx(e);
+        if(colorwheel->ring_cache_en == 0 || draw_ring_img(obj, draw_ctx) == false) {
+            draw_disc_grad(obj, draw_ctx);
+        }
         draw_knob(e);
     }
     else if(code == LV_EVENT_COVER_CHECK) {
@@ -543,7 +683,7 @@ static void next_color_mode(lv_obj_t * obj)
     lv_colorwheel_t * colorwheel = (lv_colorwheel_t *)obj;
     colorwheel->mode = (colorwheel->mode + 1) % 3;
     refr_knob_pos(obj);
-    lv_obj_invalidate(obj);
+    invalidate_ring(obj);
 }
 
 static void refr_knob_pos(lv_obj_t * obj)
@@ -597,94 +737,33 @@ static lv_res_t double_click_reset(lv_obj_t * obj)
     return LV_RES_OK;
 }
 
-#define SWAPPTR(A, B) do { uint8_t * t = A; A = B; B = t; } while(0)
-#define HSV_PTR_SWAP(sextant,r,g,b)     if((sextant) & 2) { SWAPPTR((r), (b)); } if((sextant) & 4) { SWAPPTR((g), (b)); } if(!((sextant) & 6)) { \
-        if(!((sextant) & 1)) { SWAPPTR((r), (g)); } } else { if((sextant) & 1) { SWAPPTR((r), (g)); } }
-
 /**
- * Based on the idea from https://www.vagrearg.org/content/hsvrgb
- * Here we want to compute an approximate RGB value from a HSV input color space. We don't want to be accurate
- * (for that, there's lv_color_hsv_to_rgb), but we want to be fast.
- *
- * Few tricks are used here: Hue is in range [0; 6 * 256] (so that the sextant is in the high byte and the fractional part is in the low byte)
- * both s and v are in [0; 255] range (very convenient to avoid divisions).
- *
- * We fold all symmetry by swapping the R, G, B pointers so that the code is the same for all sextants.
- * We replace division by 255 by a division by 256, a.k.a a shift right by 8 bits.
- * This is wrong, but since this is only used to compute the pixels on the screen and not the final color, it's ok.
+ * Get the colors of the lines of the ring.
+ * The current mode's component goes around the ring, the other two are taken from the current color.
  */
-static void fast_hsv2rgb(uint16_t h, uint8_t s, uint8_t v, uint8_t * r, uint8_t * g, uint8_t * b);
-static void fast_hsv2rgb(uint16_t h, uint8_t s, uint8_t v, uint8_t * r, uint8_t * g, uint8_t * b)
+static void get_ring_colors(lv_obj_t * obj, lv_color_t colors[])
 {
-    if(!s) {
-        *r = *g = *b = v;
-        return;
-    }
-
-    uint8_t sextant = h >> 8;
-    HSV_PTR_SWAP(sextant, r, g, b); /*Swap pointers so the conversion code is the same*/
-
-    *g = v;
-
-    uint8_t bb = ~s;
-    uint16_t ww = v * bb; /*Don't try to be precise, but instead, be fast*/
-    *b = ww >> 8;
-
-    uint8_t h_frac = h & 0xff;
-
-    if(!(sextant & 1)) {
-        /*Up slope*/
-        ww = !h_frac ? ((uint16_t)s << 8) : (s * (uint8_t)(-h_frac)); /*Skip multiply if not required*/
-    }
-    else {
-        /*Down slope*/
-        ww = s * h_frac;
+    lv_colorwheel_t * colorwheel = (lv_colorwheel_t *)obj;
+    lv_color_hsv_t hsv[RING_LINE_CNT];
+    uint32_t i;
+    for(i = 0; i < RING_LINE_CNT; i++) {
+        uint32_t angle = i * LV_CPICKER_DEF_QF;   /*[0..256) is the full circle*/
+        hsv[i] = colorwheel->hsv;
+        switch(colorwheel->mode) {
+            default:
+            case LV_COLORWHEEL_MODE_HUE:
+                hsv[i].h = (uint16_t)((angle * 360) >> 8);
+                break;
+            case LV_COLORWHEEL_MODE_SATURATION:
+                hsv[i].s = (uint8_t)((angle * 100) >> 8);
+                break;
+            case LV_COLORWHEEL_MODE_VALUE:
+                hsv[i].v = (uint8_t)((angle * 100) >> 8);
+                break;
+        }
     }
-    bb = ww >> 8;
-    bb = ~bb;
-    ww = v * bb;
-    *r = ww >> 8;
-}
 
-static lv_color_t angle_to_mode_color_fast(lv_obj_t * obj, uint16_t angle)
-{
-    lv_colorwheel_t * ext = (lv_colorwheel_t *)obj;
-    uint8_t r = 0, g = 0, b = 0;
-    static uint16_t h = 0;
-    static uint8_t s = 0, v = 0, m = 255;
-
-    switch(ext->mode) {
-        default:
-        case LV_COLORWHEEL_MODE_HUE:
-            /*Don't recompute costly scaling if it does not change*/
-            if(m != ext->mode) {
-                s = (uint8_t)(((uint16_t)ext->hsv.s * 51) / 20);
-                v = (uint8_t)(((uint16_t)ext->hsv.v * 51) / 20);
-                m = ext->mode;
-            }
-            fast_hsv2rgb(angle * 6, s, v, &r, &g,
-                         &b); /*A smart compiler will replace x * 6 by (x << 2) + (x << 1) if it's more efficient*/
-            break;
-        case LV_COLORWHEEL_MODE_SATURATION:
-            /*Don't recompute costly scaling if it does not change*/
-            if(m != ext->mode) {
-                h = (uint16_t)(((uint32_t)ext->hsv.h * 6 * 256) / 360);
-                v = (uint8_t)(((uint16_t)ext->hsv.v * 51) / 20);
-                m = ext->mode;
-            }
-            fast_hsv2rgb(h, angle, v, &r, &g, &b);
-            break;
-        case LV_COLORWHEEL_MODE_VALUE:
-            /*Don't recompute costly scaling if it does not change*/
-            if(m != ext->mode) {
-                h = (uint16_t)(((uint32_t)ext->hsv.h * 6 * 256) / 360);
-                s = (uint8_t)(((uint16_t)ext->hsv.s * 51) / 20);
-                m = ext->mode;
-            }
-            fast_hsv2rgb(h, s, angle, &r, &g, &b);
-            break;
-    }
-    return lv_color_make(r, g, b);
+    lv_color_hsv_to_rgb_array(hsv, colors, RING_LINE_CNT);
 }
 
 static uint16_t get_angle(lv_obj_t * obj)
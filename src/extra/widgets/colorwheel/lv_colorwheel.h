@@ -46,6 +46,9 @@ typedef struct {
     lv_point_t last_press_point;
     lv_colorwheel_mode_t mode  : 2;
     uint8_t mode_fixed            : 1;
+    uint8_t ring_cache_en         : 1;  /*1: render the ring to `ring_img`*/
+    uint32_t ring_img_style_cnt;        /*Style refresh counter when `ring_img` was rendered*/
+    lv_img_dsc_t * ring_img;            /*The ring rendered to an image. NULL if not rendered yet*/
 } lv_colorwheel_t;
 
 extern const lv_obj_class_t lv_colorwheel_class;
@@ -96,6 +99,15 @@ void lv_colorwheel_set_mode(lv_obj_t * obj, lv_colorwheel_mode_t mode);
  */
 void lv_colorwheel_set_mode_fixed(lv_obj_t * obj, bool fixed);
 
+/**
+ * Render the color ring to an image and draw only the image until the ring changes.
+ * It makes redrawing the knob much faster, but the image needs
+ * `width x height x LV_IMG_PX_SIZE_ALPHA_BYTE` bytes of memory.
+ * @param obj pointer to color wheel object
+ * @param en true: enable the cache; false: disable it and free the image
+ */
+void lv_colorwheel_set_ring_cache(lv_obj_t * obj, bool en);
+
 /*=====================
  * Getter functions
  *====================*/
@@ -128,6 +140,13 @@ lv_colorwheel_mode_t lv_colorwheel_get_color_mode(lv_obj_t * obj);
  */
 bool lv_colorwheel_get_color_mode_fixed(lv_obj_t * obj);
 
+/**
+ * Get whether the color ring is rendered to an image
+ * @param obj pointer to color wheel object
+ * @return true: the cache is enabled
+ */
+bool lv_colorwheel_get_ring_cache(const lv_obj_t * obj);
+
 /**********************
  *      MACROS
  **********************/
@@ -17,7 +17,7 @@
 /*********************
  *      DEFINES
  *********************/
-#define MV_CLASS &lv_list
+#define MY_CLASS &lv_list_class
 
 /**********************
  *      TYPEDEFS
@@ -26,11 +26,18 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static void lv_list_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
+static void lv_list_event(const lv_obj_class_t * class_p, lv_event_t * e);
+static void refr_pool(lv_obj_t * obj);
+static lv_coord_t get_item_y(lv_list_t * list_p, uint32_t id);
 
 const lv_obj_class_t lv_list_class = {
+    .destructor_cb = lv_list_destructor,
+    .event_cb = lv_list_event,
     .base_class = &lv_obj_class,
     .width_def = (LV_DPI_DEF * 3) / 2,
-    .height_def = LV_DPI_DEF * 2
+    .height_def = LV_DPI_DEF * 2,
+    .instance_size = sizeof(lv_list_t),
 };
 
 const lv_obj_class_t lv_list_btn_class = {
@@ -113,8 +120,154 @@ const char * lv_list_get_btn_text(lv_obj_t * list, lv_obj_t * btn)
     return "";
 }
 
+void lv_list_set_virtual(lv_obj_t * list, uint32_t item_cnt, lv_coord_t item_h, lv_list_text_cb_t text_cb)
+{
+    LV_ASSERT_OBJ(list, MY_CLASS);
+
+    lv_list_t * list_p = (lv_list_t *)list;
+
+    /*Don't refresh the pool while deleting the old items*/
+    list_p->text_cb = NULL;
+    lv_obj_clean(list);
+    lv_mem_free(list_p->pool_ids);
+    list_p->pool_ids = NULL;
+    list_p->pool_cnt = 0;
+
+    list_p->text_cb = text_cb;
+    list_p->item_cnt = text_cb ? item_cnt : 0;
+    list_p->item_h = item_h;
+
+    /*The buttons of the pool are positioned manually*/
+    if(text_cb) lv_obj_set_layout(list, 0);
+    else lv_obj_set_flex_flow(list, LV_FLEX_FLOW_COLUMN);
+
+    lv_obj_scroll_to_y(list, 0, LV_ANIM_OFF);
+    lv_obj_refresh_self_size(list);
+    refr_pool(list);
+}
+
+uint32_t lv_list_get_virtual_id(lv_obj_t * list, lv_obj_t * btn)
+{
+    LV_ASSERT_OBJ(list, MY_CLASS);
+
+    lv_list_t * list_p = (lv_list_t *)list;
+    if(lv_obj_get_parent(btn) != list) return LV_LIST_ITEM_NONE;
+
+    uint32_t slot = lv_obj_get_index(btn);
+    if(slot >= list_p->pool_cnt) return LV_LIST_ITEM_NONE;
+
+    return list_p->pool_ids[slot];
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
 
+static void lv_list_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
+{
+    LV_UNUSED(class_p);
+    lv_list_t * list_p = (lv_list_t *)obj;
+    lv_mem_free(list_p->pool_ids);
+    list_p->pool_ids = NULL;
+}
+
+static void lv_list_event(const lv_obj_class_t * class_p, lv_event_t * e)
+{
+    LV_UNUSED(class_p);
+
+    /*Call the ancestor's event handler*/
+    lv_res_t res = lv_obj_event_base(MY_CLASS, e);
+    if(res != LV_RES_OK) return;
+
+    lv_event_code_t code = lv_event_get_code(e);
+    lv_obj_t * obj = lv_event_get_current_target(e);
+    lv_list_t * list_p = (lv_list_t *)obj;
+    if(list_p->text_cb == NULL) return;
+
+    /*Ignore the events bubbled up from the buttons*/
+    if(lv_event_get_target(e) != obj) return;
+
+    if(code == LV_EVENT_GET_SELF_SIZE) {
+        lv_point_t * p = lv_event_get_param(e);
+        p->y = LV_MAX(p->y, get_item_y(list_p, list_p->item_cnt));
+    }
+    else if(code == LV_EVENT_SCROLL || code == LV_EVENT_SIZE_CHANGED || code == LV_EVENT_STYLE_CHANGED) {
+        refr_pool(obj);
+    }
+}
+
+/**
+ * Create enough buttons to fill the visible area and bind them to the visible items.
+ * Item `id` is always shown by the `id % pool_cnt`th button so while scrolling
+ * only the buttons of the newly visible items need to be updated.
+ */
+static void refr_pool(lv_obj_t * obj)
+{
+    lv_list_t * list_p = (lv_list_t *)obj;
+    if(list_p->text_cb == NULL || list_p->item_h <= 0) return;
+
+    uint32_t pool_cnt = lv_obj_get_content_height(obj) / list_p->item_h + 2;
+    pool_cnt = LV_MIN(pool_cnt, list_p->item_cnt);
+
+    uint32_t i;
+    if(pool_cnt != list_p->pool_cnt) {
+        uint32_t * pool_ids = lv_mem_realloc(list_p->pool_ids, pool_cnt * sizeof(uint32_t));
+        LV_ASSERT_MALLOC(pool_ids);
+        if(pool_ids == NULL) return;
+        list_p->pool_ids = pool_ids;
+
+        while(list_p->pool_cnt > pool_cnt) {
+            list_p->pool_cnt--;
+            lv_obj_del(lv_obj_get_child(obj, list_p->pool_cnt));
+        }
+
+        while(list_p->pool_cnt < pool_cnt) {
+            lv_obj_t * btn = lv_list_add_btn(obj, NULL, "");
+            lv_obj_set_height(btn, list_p->item_h);
+            lv_obj_add_flag(btn, LV_OBJ_FLAG_EVENT_BUBBLE);
+            lv_obj_move_to_index(btn, list_p->pool_cnt);
+            list_p->pool_cnt++;
+        }
+
+        /*The slot of the items has changed*/
+        for(i = 0; i < pool_cnt; i++) list_p->pool_ids[i] = LV_LIST_ITEM_NONE;
+    }
+
+    if(pool_cnt == 0) return;
+
+    lv_coord_t scroll_y = lv_obj_get_scroll_y(obj);
+    uint32_t first = scroll_y > 0 ? scroll_y / list_p->item_h : 0;
+    for(i = 0; i < pool_cnt; i++) {
+        uint32_t id = first + i;
+        uint32_t slot = id % pool_cnt;
+        if(list_p->pool_ids[slot] == id) continue;
+
+        lv_obj_t * btn = lv_obj_get_child(obj, slot);
+        if(id >= list_p->item_cnt) {
+            list_p->pool_ids[slot] = LV_LIST_ITEM_NONE;
+            lv_obj_add_flag(btn, LV_OBJ_FLAG_HIDDEN);
+            continue;
+        }
+
+        list_p->pool_ids[slot] = id;
+        lv_obj_clear_flag(btn, LV_OBJ_FLAG_HIDDEN);
+        lv_obj_set_y(btn, get_item_y(list_p, id));
+        const char * txt = list_p->text_cb(obj, id);
+        lv_label_set_text(lv_obj_get_child(btn, 0), txt ? txt : "");
+    }
+}
+
+/**
+ * Get the y coordinate of an item, i.e. the height of the items before it.
+ * Clamped to LV_COORD_MAX as the items can be taller than the range of `lv_coord_t`.
+ */
+static lv_coord_t get_item_y(lv_list_t * list_p, uint32_t id)
+{
+    if(list_p->item_h <= 0) return 0;
+
+    /*Check the limit before multiplying so that `int32_t` can't overflow either*/
+    if(id > (uint32_t)(LV_COORD_MAX / list_p->item_h)) return LV_COORD_MAX;
+    return (lv_coord_t)((int32_t)id * list_p->item_h);
+}
+
 #endif /*LV_USE_LIST*/
@@ -21,11 +21,28 @@ extern "C" {
 /*********************
  *      DEFINES
  *********************/
+#define LV_LIST_ITEM_NONE 0xFFFFFFFF
+LV_EXPORT_CONST_INT(LV_LIST_ITEM_NONE);
 
 /**********************
  *      TYPEDEFS
  **********************/
 
+/**
+ * Get the text of an item of a virtual list.
+ * The text is copied so it needs to be valid only until the next call.
+ */
+typedef const char * (*lv_list_text_cb_t)(lv_obj_t * list, uint32_t id);
+
+typedef struct {
+    lv_obj_t obj;
+    lv_list_text_cb_t text_cb;  /**< Provides the texts of the items in virtual mode*/
+    uint32_t item_cnt;          /**< Number of items in virtual mode*/
+    uint32_t * pool_ids;        /**< The item shown by each button of the pool. The buttons are the first children.*/
+    uint32_t pool_cnt;
+    lv_coord_t item_h;
+} lv_list_t;
+
 extern const lv_obj_class_t lv_list_class;
 extern const lv_obj_class_t lv_list_text_class;
 extern const lv_obj_class_t lv_list_btn_class;
@@ -41,6 +58,28 @@ lv_obj_t * lv_list_add_btn(lv_obj_t * list, const void * icon, const char * txt)
 
 const char * lv_list_get_btn_text(lv_obj_t * list, lv_obj_t * btn);
 
+/**
+ * Make the list virtual: instead of creating a button for each item only a few buttons are created to fill
+ * the visible area and they are reused while scrolling. `text_cb` is called to get the text of the items
+ * which become visible. This way the memory usage doesn't depend on the number of items.
+ * The buttons bubble their events to the list, use `lv_list_get_virtual_id()` to get
+ * which item was clicked.
+ * @param list      pointer to a list object
+ * @param item_cnt  number of items
+ * @param item_h    height of the items
+ * @param text_cb   callback to get the text of an item. `NULL` to go back to a normal (empty) list.
+ * @note            the existing items of the list are deleted.
+ */
+void lv_list_set_virtual(lv_obj_t * list, uint32_t item_cnt, lv_coord_t item_h, lv_list_text_cb_t text_cb);
+
+/**
+ * Get which item is shown by a button of a virtual list.
+ * @param list      pointer to a list object
+ * @param btn       pointer to a button of the list, e.g. `lv_event_get_target(e)`
+ * @return          index of the item or `LV_LIST_ITEM_NONE` if `btn` is not a button of the list
+ */
+uint32_t lv_list_get_virtual_id(lv_obj_t * list, lv_obj_t * btn);
+
 /**********************
  *      MACROS
  **********************/
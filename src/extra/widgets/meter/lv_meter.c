@@ -29,6 +29,10 @@ static void lv_meter_event(const lv_obj_class_t * class_p, lv_event_t * e);
 static void draw_arcs(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx, const lv_area_t * scale_area);
 static void draw_ticks_and_labels(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx, const lv_area_t * scale_area);
 static void draw_needles(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx, const lv_area_t * scale_area);
+static bool draw_scale_img(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx, const lv_area_t * scale_area);
+static void render_scale_cb(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx, void * user_data);
+static void free_scale_img(lv_obj_t * obj);
+static void invalidate_scale(lv_obj_t * obj);
 static void inv_arc(lv_obj_t * obj, lv_meter_indicator_t * indic, int32_t old_value, int32_t new_value);
 static void inv_line(lv_obj_t * obj, lv_meter_indicator_t * indic, int32_t value);
 
@@ -81,6 +85,7 @@ lv_meter_scale_t * lv_meter_add_scale(lv_obj_t * obj)
     scale->tick_width = 2;
     scale->label_gap = 2;
 
+    invalidate_scale(obj);
     return scale;
 }
 
@@ -91,7 +96,7 @@ void lv_meter_set_scale_ticks(lv_obj_t * obj, lv_meter_scale_t * scale, uint16_t
     scale->tick_width = width;
     scale->tick_length = len;
     scale->tick_color = color;
-    lv_obj_invalidate(obj);
+    invalidate_scale(obj);
 }
 
 void lv_meter_set_scale_major_ticks(lv_obj_t * obj, lv_meter_scale_t * scale, uint16_t nth, uint16_t width,
@@ -102,7 +107,7 @@ void lv_meter_set_scale_major_ticks(lv_obj_t * obj, lv_meter_scale_t * scale, ui
     scale->tick_major_length = len;
     scale->tick_major_color = color;
     scale->label_gap = label_gap;
-    lv_obj_invalidate(obj);
+    invalidate_scale(obj);
 }
 
 void lv_meter_set_scale_range(lv_obj_t * obj, lv_meter_scale_t * scale, int32_t min, int32_t max, uint32_t angle_range,
@@ -112,9 +117,29 @@ void lv_meter_set_scale_range(lv_obj_t * obj, lv_meter_scale_t * scale, int32_t
     scale->max = max;
     scale->angle_range = angle_range;
     scale->rotation = rotation;
+    invalidate_scale(obj);
+}
+
+void lv_meter_set_scale_cache(lv_obj_t * obj, bool en)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_meter_t * meter = (lv_meter_t *)obj;
+
+    if(meter->scale_cache_en == en) return;
+
+    meter->scale_cache_en = en ? 1 : 0;
+    free_scale_img(obj);
     lv_obj_invalidate(obj);
 }
 
+bool lv_meter_get_scale_cache(const lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_meter_t * meter = (lv_meter_t *)obj;
+
+    return meter->scale_cache_en ? true : false;
+}
+
 /*=====================
  * Add indicator
  *====================*/
@@ -196,7 +221,7 @@ lv_meter_indicator_t * lv_meter_add_scale_lines(lv_obj_t * obj, lv_meter_scale_t
     indic->type_data.scale_lines.local_grad = local;
     indic->type_data.scale_lines.width_mod = width_mod;
 
-    lv_obj_invalidate(obj);
+    invalidate_scale(obj);
     return indic;
 }
 
@@ -221,7 +246,7 @@ void lv_meter_set_indicator_value(lv_obj_t * obj, lv_meter_indicator_t * indic,
         inv_line(obj, indic, value);
     }
     else {
-        lv_obj_invalidate(obj);
+        invalidate_scale(obj);
     }
 }
 
@@ -238,7 +263,7 @@ void lv_meter_set_indicator_start_value(lv_obj_t * obj, lv_meter_indicator_t * i
         inv_line(obj, indic, value);
     }
     else {
-        lv_obj_invalidate(obj);
+        invalidate_scale(obj);
     }
 }
 
@@ -255,7 +280,7 @@ void lv_meter_set_indicator_end_value(lv_obj_t * obj, lv_meter_indicator_t * ind
         inv_line(obj, indic, value);
     }
     else {
-        lv_obj_invalidate(obj);
+        invalidate_scale(obj);
     }
 }
 
@@ -272,6 +297,9 @@ static void lv_meter_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
 
     _lv_ll_init(&meter->scale_ll, sizeof(lv_meter_scale_t));
     _lv_ll_init(&meter->indicator_ll, sizeof(lv_meter_indicator_t));
+    meter->scale_img = NULL;
+    meter->scale_img_style_cnt = 0;
+    meter->scale_cache_en = 0;
 
     LV_TRACE_OBJ_CREATE("finished");
 }
@@ -283,7 +311,7 @@ static void lv_meter_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     lv_meter_t * meter = (lv_meter_t *)obj;
     _lv_ll_clear(&meter->indicator_ll);
     _lv_ll_clear(&meter->scale_ll);
-
+    free_scale_img(obj);
 }
 
 static void lv_meter_event(const lv_obj_class_t * class_p, lv_event_t * e)
@@ -301,7 +329,11 @@ static void lv_meter_event(const lv_obj_class_t * class_p, lv_event_t * e)
         lv_obj_get_content_coords(obj, &scale_area);
 
         draw_arcs(obj, draw_ctx, &scale_area);
-        draw_ticks_and_labels(obj, draw_ctx, &scale_area);
+
+        lv_meter_t * meter = (lv_meter_t *)obj;
+        if(meter->scale_cache_en == 0 || draw_scale_img(obj, draw_ctx, &scale_area) == false) {
+            draw_ticks_and_labels(obj, draw_ctx, &scale_area);
+        }
         draw_needles(obj, draw_ctx, &scale_area);
 
         lv_coord_t r_edge = lv_area_get_width(&scale_area) / 2;
@@ -544,7 +576,7 @@ static void draw_ticks_and_labels(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx, cons
             inner_act_mask_id = lv_draw_mask_add(major ? &inner_major_mask : &inner_minor_mask, NULL);
             lv_draw_line(draw_ctx, &line_dsc, &p_outer, &p_center);
             lv_draw_mask_remove_id(inner_act_mask_id);
-            lv_event_send(obj, LV_EVENT_DRAW_MAIN_END, &part_draw_dsc);
+            lv_event_send(obj, LV_EVENT_DRAW_PART_END, &part_draw_dsc);
 
             line_dsc.color = line_color_ori;
             line_dsc.width = line_width_ori;
@@ -632,6 +664,86 @@ static void draw_needles(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx, const lv_area
     }
 }
 
+/**
+ * Draw the ticks and labels from an image. Render the image first if it's missing or outdated.
+ * @return false if the image couldn't be created, the ticks and labels need to be drawn normally
+ */
+static bool draw_scale_img(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx, const lv_area_t * scale_area)
+{
+    lv_meter_t * meter = (lv_meter_t *)obj;
+
+    lv_coord_t w = lv_obj_get_width(obj);
+    lv_coord_t h = lv_obj_get_height(obj);
+    if(meter->scale_img) {
+        if(meter->scale_img->header.w != w || meter->scale_img->header.h != h ||
+           meter->scale_img_style_cnt != _lv_obj_style_get_refr_cnt()) {
+            free_scale_img(obj);
+        }
+    }
+
+    if(meter->scale_img == NULL) {
+        /*The masks of the parents (e.g. rounded corners) would be rendered to the image too*/
+        if(w <= 0 || h <= 0 || lv_draw_mask_is_any(&obj->coords)) return false;
+
+        uint32_t size = (uint32_t)w * h * LV_IMG_PX_SIZE_ALPHA_BYTE;
+        lv_img_dsc_t * img = lv_mem_alloc(sizeof(lv_img_dsc_t) + size);
+        LV_ASSERT_MALLOC(img);
+        if(img == NULL) return false;
+
+        uint8_t * buf = (uint8_t *)(img + 1);
+        lv_memset_00(img, sizeof(lv_img_dsc_t));
+        lv_memset_00(buf, size);
+        img->header.w = w;
+        img->header.h = h;
+        img->header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA;
+        img->data_size = size;
+        img->data = buf;
+
+        /*Render the ticks and labels to the buffer instead of the display*/
+        if(_lv_obj_render_to_buf(obj, buf, &obj->coords, LV_IMG_CF_TRUE_COLOR_ALPHA, render_scale_cb,
+                                 (void *)scale_area) != LV_RES_OK) {
+            lv_mem_free(img);
+            return false;
+        }
+
+        meter->scale_img = img;
+        meter->scale_img_style_cnt = _lv_obj_style_get_refr_cnt();
+    }
+
+    lv_draw_img_dsc_t img_dsc;
+    lv_draw_img_dsc_init(&img_dsc);
+    lv_draw_img(draw_ctx, &img_dsc, &obj->coords, meter->scale_img);
+
+    return true;
+}
+
+/**
+ * Render the ticks and labels into the scale image, `user_data` is the scale area
+ */
+static void render_scale_cb(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx, void * user_data)
+{
+    draw_ticks_and_labels(obj, draw_ctx, user_data);
+}
+
+static void free_scale_img(lv_obj_t * obj)
+{
+    lv_meter_t * meter = (lv_meter_t *)obj;
+    if(meter->scale_img == NULL) return;
+
+    lv_img_cache_invalidate_src(meter->scale_img);
+    lv_mem_free(meter->scale_img);
+    meter->scale_img = NULL;
+}
+
+/**
+ * Redraw the whole meter and render the ticks and labels again
+ */
+static void invalidate_scale(lv_obj_t * obj)
+{
+    free_scale_img(obj);
+    lv_obj_invalidate(obj);
+}
+
 static void inv_arc(lv_obj_t * obj, lv_meter_indicator_t * indic, int32_t old_value, int32_t new_value)
 {
     bool rounded = lv_obj_get_style_arc_rounded(obj, LV_PART_ITEMS);
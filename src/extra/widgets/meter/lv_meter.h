@@ -95,6 +95,9 @@ typedef struct {
     lv_obj_t obj;
     lv_ll_t scale_ll;
     lv_ll_t indicator_ll;
+    lv_img_dsc_t * scale_img;       /*The ticks and labels rendered to an image. NULL if not rendered yet*/
+    uint32_t scale_img_style_cnt;   /*Style refresh counter when `scale_img` was rendered*/
+    uint8_t scale_cache_en : 1;     /*1: render the ticks and labels to `scale_img`*/
 } lv_meter_t;
 
 extern const lv_obj_class_t lv_meter_class;
@@ -171,6 +174,22 @@ void lv_meter_set_scale_major_ticks(lv_obj_t * obj, lv_meter_scale_t * scale, ui
 void lv_meter_set_scale_range(lv_obj_t * obj, lv_meter_scale_t * scale, int32_t min, int32_t max, uint32_t angle_range,
                               uint32_t rotation);
 
+/**
+ * Render the ticks and labels of the scales to an image and draw only the image until they change.
+ * It makes redrawing the needles and arcs much faster, but the image needs
+ * `width x height x LV_IMG_PX_SIZE_ALPHA_BYTE` bytes of memory.
+ * @param obj           pointer to a meter object
+ * @param en            true: enable the cache; false: disable it and free the image
+ */
+void lv_meter_set_scale_cache(lv_obj_t * obj, bool en);
+
+/**
+ * Get whether the ticks and labels are rendered to an image
+ * @param obj           pointer to a meter object
+ * @return              true: the cache is enabled
+ */
+bool lv_meter_get_scale_cache(const lv_obj_t * obj);
+
 /*=====================
  * Add indicator
  *====================*/
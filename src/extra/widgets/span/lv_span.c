@@ -20,20 +20,6 @@
 /**********************
  *      TYPEDEFS
  **********************/
-typedef struct {
-    lv_span_t * span;
-    const char * txt;
-    const lv_font_t * font;
-    uint16_t   bytes;
-    lv_coord_t txt_w;
-    lv_coord_t line_h;
-    lv_coord_t letter_space;
-} lv_snippet_t;
-
-struct _snippet_stack {
-    lv_snippet_t    stack[LV_SPAN_SNIPPET_STACK_SIZE];
-    uint16_t        index;
-};
 
 /**********************
  *  STATIC PROTOTYPES
@@ -57,16 +43,14 @@ static bool lv_txt_get_snippet(const char * txt, const lv_font_t * font, lv_coor
                                lv_coord_t max_width, lv_text_flag_t flag, lv_coord_t * use_width,
                                uint32_t * end_ofs);
 
-static void lv_snippet_clear(void);
-static uint16_t lv_get_snippet_cnt(void);
-static void lv_snippet_push(lv_snippet_t * item);
-static lv_snippet_t * lv_get_snippet(uint16_t index);
+static void layout_update(lv_obj_t * obj, lv_coord_t width);
+static bool layout_is_outdated(lv_obj_t * obj);
+static void layout_free(lv_obj_t * obj);
 static lv_coord_t convert_indent_pct(lv_obj_t * spans, lv_coord_t width);
 
 /**********************
  *  STATIC VARIABLES
  **********************/
-static struct _snippet_stack snippet_stack;
 
 const lv_obj_class_t lv_spangroup_class  = {
     .base_class = &lv_obj_class,
@@ -396,102 +380,14 @@ lv_coord_t lv_spangroup_get_expand_height(lv_obj_t * obj, lv_coord_t width)
         return 0;
     }
 
-    /* init draw variable */
-    lv_text_flag_t txt_flag = LV_TEXT_FLAG_NONE;
-    lv_coord_t line_space = lv_obj_get_style_text_line_space(obj, LV_PART_MAIN);
-    lv_coord_t max_width = width;
-    lv_coord_t indent = convert_indent_pct(obj, max_width);
-    lv_coord_t max_w  = max_width - indent; /* first line need minus indent */
-
-    /* coords of draw span-txt */
-    lv_point_t txt_pos;
-    txt_pos.y = 0;
-    txt_pos.x = 0 + indent; /* first line need add indent */
-
-    lv_span_t * cur_span = _lv_ll_get_head(&spans->child_ll);
-    const char * cur_txt = cur_span->txt;
-    span_text_check(&cur_txt);
-    uint32_t cur_txt_ofs = 0;
-    lv_snippet_t snippet;   /* use to save cur_span info and push it to stack */
-    memset(&snippet, 0, sizeof(snippet));
-
-    int32_t line_cnt = 0;
-    int32_t lines = spans->lines < 0 ? INT32_MAX : spans->lines;
-    /* the loop control how many lines need to draw */
-    while(cur_span) {
-        int snippet_cnt = 0;
-        lv_coord_t max_line_h = 0;  /* the max height of span-font when a line have a lot of span */
+    layout_update(obj, width);
 
-        /* the loop control to find a line and push the relevant span info into stack  */
-        while(1) {
-            /* switch to the next span when current is end */
-            if(cur_txt[cur_txt_ofs] == '\0') {
-                cur_span = _lv_ll_get_next(&spans->child_ll, cur_span);
-                if(cur_span == NULL) break;
-                cur_txt = cur_span->txt;
-                span_text_check(&cur_txt);
-                cur_txt_ofs = 0;
-                /* maybe also cur_txt[cur_txt_ofs] == '\0' */
-                continue;
-            }
-
-            /* init span info to snippet. */
-            if(cur_txt_ofs == 0) {
-                snippet.span = cur_span;
-                snippet.font = lv_span_get_style_text_font(obj, cur_span);
-                snippet.letter_space = lv_span_get_style_text_letter_space(obj, cur_span);
-                snippet.line_h = lv_font_get_line_height(snippet.font) + line_space;
-            }
-
-            /* get current span text line info */
-            uint32_t next_ofs = 0;
-            lv_coord_t use_width = 0;
-            bool isfill = lv_txt_get_snippet(&cur_txt[cur_txt_ofs], snippet.font, snippet.letter_space,
-                                             max_w, txt_flag, &use_width, &next_ofs);
-
-            /* break word deal width */
-            if(isfill && next_ofs > 0 && snippet_cnt > 0) {
-                if(max_w < use_width) {
-                    break;
-                }
-
-                uint32_t tmp_ofs = next_ofs;
-                uint32_t letter = _lv_txt_encoded_prev(&cur_txt[cur_txt_ofs], &tmp_ofs);
-                if(!(letter == '\0' || letter == '\n' || letter == '\r' || _lv_txt_is_break_char(letter))) {
-                    tmp_ofs = 0;
-                    letter = _lv_txt_encoded_next(&cur_txt[cur_txt_ofs + next_ofs], &tmp_ofs);
-                    if(!(letter == '\0' || letter == '\n'  || letter == '\r' || _lv_txt_is_break_char(letter))) {
-                        break;
-                    }
-                }
-            }
-
-            snippet.txt = &cur_txt[cur_txt_ofs];
-            snippet.bytes = next_ofs;
-            snippet.txt_w = use_width;
-            cur_txt_ofs += next_ofs;
-            if(max_line_h < snippet.line_h) {
-                max_line_h = snippet.line_h;
-            }
-            snippet_cnt ++;
-            max_w = max_w - use_width - snippet.letter_space;
-            if(isfill  || max_w <= 0) {
-                break;
-            }
-        }
-
-        /* next line init */
-        txt_pos.x = 0;
-        txt_pos.y += max_line_h;
-        max_w = max_width;
-        line_cnt += 1;
-        if(line_cnt >= lines) {
-            break;
-        }
-    }
-    txt_pos.y -= line_space;
+    lv_coord_t line_space = lv_obj_get_style_text_line_space(obj, LV_PART_MAIN);
+    uint32_t lines = spans->lines < 0 ? UINT32_MAX : LV_MAX((uint32_t)spans->lines, 1); /* at least one line is measured */
+    uint32_t line_cnt = LV_MIN(spans->layout_line_cnt, lines);
+    lv_coord_t height = line_cnt > 0 ? spans->layout_lines[line_cnt - 1].y + spans->layout_lines[line_cnt - 1].max_line_h : 0;
 
-    return txt_pos.y;
+    return height - line_space;
 }
 
 /**********************
@@ -510,6 +406,12 @@ static void lv_spangroup_constructor(const lv_obj_class_t * class_p, lv_obj_t *
     spans->cache_w = 0;
     spans->cache_h = 0;
     spans->refresh = 1;
+    spans->layout_snippets = NULL;
+    spans->layout_lines = NULL;
+    spans->layout_snippet_cnt = 0;
+    spans->layout_line_cnt = 0;
+    spans->layout_w = 0;
+    spans->layout_valid = 0;
 }
 
 static void lv_spangroup_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
@@ -526,6 +428,8 @@ static void lv_spangroup_destructor(const lv_obj_class_t * class_p, lv_obj_t * o
         lv_mem_free(cur_span);
         cur_span = _lv_ll_get_head(&spans->child_ll);
     }
+
+    layout_free(obj);
 }
 
 static void lv_spangroup_event(const lv_obj_class_t * class_p, lv_event_t * e)
@@ -617,32 +521,6 @@ static bool lv_txt_get_snippet(const char * txt, const lv_font_t * font,
     }
 }
 
-static void lv_snippet_push(lv_snippet_t * item)
-{
-    if(snippet_stack.index < LV_SPAN_SNIPPET_STACK_SIZE) {
-        memcpy(&snippet_stack.stack[snippet_stack.index], item, sizeof(lv_snippet_t));
-        snippet_stack.index++;
-    }
-    else {
-        LV_LOG_ERROR("span draw stack overflow, please set LV_SPAN_SNIPPET_STACK_SIZE too larger");
-    }
-}
-
-static uint16_t lv_get_snippet_cnt(void)
-{
-    return snippet_stack.index;
-}
-
-static lv_snippet_t * lv_get_snippet(uint16_t index)
-{
-    return &snippet_stack.stack[index];
-}
-
-static void lv_snippet_clear(void)
-{
-    snippet_stack.index = 0;
-}
-
 static const lv_font_t * lv_span_get_style_text_font(lv_obj_t * par, lv_span_t * span)
 {
     const lv_font_t * font;
@@ -778,127 +656,54 @@ static void lv_draw_span(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx)
     lv_coord_t line_space = lv_obj_get_style_text_line_space(obj, LV_PART_MAIN);;
     lv_coord_t max_width = lv_area_get_width(&coords);
     lv_coord_t indent = convert_indent_pct(obj, max_width);
-    lv_coord_t max_w  = max_width - indent; /* first line need minus indent */
     lv_opa_t obj_opa = lv_obj_get_style_opa(obj, LV_PART_MAIN);
 
+    /* the spans are measured only when they, their style or the width changed */
+    if(spans->layout_valid && layout_is_outdated(obj)) spans->layout_valid = 0;
+    layout_update(obj, max_width);
+
     /* coords of draw span-txt */
     lv_point_t txt_pos;
-    txt_pos.y = coords.y1;
-    txt_pos.x = coords.x1 + indent; /* first line need add indent */
-
-    lv_span_t * cur_span = _lv_ll_get_head(&spans->child_ll);
-    const char * cur_txt = cur_span->txt;
-    span_text_check(&cur_txt);
-    uint32_t cur_txt_ofs = 0;
-    lv_snippet_t snippet;   /* use to save cur_span info and push it to stack */
-    lv_memset_00(&snippet, sizeof(snippet));
 
     lv_draw_label_dsc_t label_draw_dsc;
     lv_draw_label_dsc_init(&label_draw_dsc);
 
-    bool is_first_line = true;
+    uint32_t line_id;
     /* the loop control how many lines need to draw */
-    while(cur_span) {
+    for(line_id = 0; line_id < spans->layout_line_cnt; line_id++) {
+        const lv_span_line_t * line = &spans->layout_lines[line_id];
+        lv_snippet_t * snippets = &spans->layout_snippets[line->snippet_start];
+        uint32_t item_cnt = line->snippet_cnt;
+        lv_coord_t max_line_h = line->max_line_h;
+        lv_coord_t max_baseline = line->max_baseline;
+        bool is_first_line = line_id == 0;
         bool is_end_line = false;
         bool ellipsis_valid = false;
-        lv_coord_t max_line_h = 0;  /* the max height of span-font when a line have a lot of span */
-        lv_coord_t max_baseline = 0; /*baseline of the highest span*/
-        lv_snippet_clear();
-
-        /* the loop control to find a line and push the relevant span info into stack  */
-        while(1) {
-            /* switch to the next span when current is end */
-            if(cur_txt[cur_txt_ofs] == '\0') {
-                cur_span = _lv_ll_get_next(&spans->child_ll, cur_span);
-                if(cur_span == NULL) break;
-                cur_txt = cur_span->txt;
-                span_text_check(&cur_txt);
-                cur_txt_ofs = 0;
-                /* maybe also cur_txt[cur_txt_ofs] == '\0' */
-                continue;
-            }
-
-            /* init span info to snippet. */
-            if(cur_txt_ofs == 0) {
-                snippet.span = cur_span;
-                snippet.font = lv_span_get_style_text_font(obj, cur_span);
-                snippet.letter_space = lv_span_get_style_text_letter_space(obj, cur_span);
-                snippet.line_h = lv_font_get_line_height(snippet.font) + line_space;
-            }
-
-            /* get current span text line info */
-            uint32_t next_ofs = 0;
-            lv_coord_t use_width = 0;
-            bool isfill = lv_txt_get_snippet(&cur_txt[cur_txt_ofs], snippet.font, snippet.letter_space,
-                                             max_w, txt_flag, &use_width, &next_ofs);
-
-            if(isfill) {
-                if(next_ofs > 0 && lv_get_snippet_cnt() > 0) {
-                    /* To prevent infinite loops, the _lv_txt_get_next_line() may return incomplete words, */
-                    /* This phenomenon should be avoided when lv_get_snippet_cnt() > 0 */
-                    if(max_w < use_width) {
-                        break;
-                    }
-                    uint32_t tmp_ofs = next_ofs;
-                    uint32_t letter = _lv_txt_encoded_prev(&cur_txt[cur_txt_ofs], &tmp_ofs);
-                    if(!(letter == '\0' || letter == '\n' || letter == '\r' || _lv_txt_is_break_char(letter))) {
-                        tmp_ofs = 0;
-                        letter = _lv_txt_encoded_next(&cur_txt[cur_txt_ofs + next_ofs], &tmp_ofs);
-                        if(!(letter == '\0' || letter == '\n'  || letter == '\r' || _lv_txt_is_break_char(letter))) {
-                            break;
-                        }
-                    }
-                }
-            }
-
-            snippet.txt = &cur_txt[cur_txt_ofs];
-            snippet.bytes = next_ofs;
-            snippet.txt_w = use_width;
-            cur_txt_ofs += next_ofs;
-            if(max_line_h < snippet.line_h) {
-                max_line_h = snippet.line_h;
-                max_baseline = snippet.font->base_line;
-            }
-
-            lv_snippet_push(&snippet);
-            max_w = max_w - use_width - snippet.letter_space;
-            if(isfill || max_w <= 0) {
-                break;
-            }
-        }
+        lv_snippet_t end_snippet;   /* the last snippet of the end line might be extended, keep the cache intact */
 
-        /* start current line deal with */
-
-        uint16_t item_cnt = lv_get_snippet_cnt();
-        if(item_cnt == 0) {     /* break if stack is empty */
-            break;
-        }
+        txt_pos.y = coords.y1 + line->y;
+        txt_pos.x = coords.x1 + (is_first_line ? indent : 0); /* first line need add indent */
 
         /* Whether the current line is the end line and does overflow processing */
-        {
-            lv_snippet_t * last_snippet = lv_get_snippet(item_cnt - 1);
-            lv_coord_t next_line_h = last_snippet->line_h;
-            if(last_snippet->txt[last_snippet->bytes] == '\0') {
-                next_line_h = 0;
-                lv_span_t * next_span = _lv_ll_get_next(&spans->child_ll, last_snippet->span);
-                if(next_span) { /* have the next line */
-                    next_line_h = lv_font_get_line_height(lv_span_get_style_text_font(obj, next_span)) + line_space;
-                }
+        if(txt_pos.y + max_line_h + line->next_line_h - line_space > coords.y2 + 1) { /* for overflow if is end line. */
+            lv_snippet_t * last_snippet = &snippets[item_cnt - 1];
+            if(last_snippet->txt[last_snippet->bytes] != '\0') {
+                end_snippet = *last_snippet;
+                end_snippet.bytes = strlen(end_snippet.txt);
+                end_snippet.txt_w = lv_txt_get_width(end_snippet.txt, end_snippet.bytes, end_snippet.font,
+                                                     end_snippet.letter_space, txt_flag);
             }
-            if(txt_pos.y + max_line_h + next_line_h - line_space > coords.y2 + 1) { /* for overflow if is end line. */
-                if(last_snippet->txt[last_snippet->bytes] != '\0') {
-                    last_snippet->bytes = strlen(last_snippet->txt);
-                    last_snippet->txt_w = lv_txt_get_width(last_snippet->txt, last_snippet->bytes, last_snippet->font,
-                                                           last_snippet->letter_space, txt_flag);
-                }
-                ellipsis_valid = spans->overflow == LV_SPAN_OVERFLOW_ELLIPSIS ? true : false;
-                is_end_line = true;
+            else {
+                end_snippet = *last_snippet;
             }
+            ellipsis_valid = spans->overflow == LV_SPAN_OVERFLOW_ELLIPSIS ? true : false;
+            is_end_line = true;
         }
 
         /*Go the first visible line*/
         if(txt_pos.y + max_line_h < clip_area.y1) {
-            goto Next_line_init;
+            if(is_end_line) break;
+            continue;
         }
 
         /* align deal with */
@@ -906,11 +711,12 @@ static void lv_draw_span(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx)
         if(align == LV_TEXT_ALIGN_CENTER || align == LV_TEXT_ALIGN_RIGHT) {
             lv_coord_t align_ofs = 0;
             lv_coord_t txts_w = is_first_line ? indent : 0;
-            for(int i = 0; i < item_cnt; i++) {
-                lv_snippet_t * pinfo = lv_get_snippet(i);
+            uint32_t i;
+            for(i = 0; i < item_cnt; i++) {
+                lv_snippet_t * pinfo = (is_end_line && i == item_cnt - 1) ? &end_snippet : &snippets[i];
                 txts_w = txts_w + pinfo->txt_w + pinfo->letter_space;
             }
-            txts_w -= lv_get_snippet(item_cnt - 1)->letter_space;
+            txts_w -= snippets[item_cnt - 1].letter_space;
             align_ofs = max_width > txts_w ? max_width - txts_w : 0;
             if(align == LV_TEXT_ALIGN_CENTER) {
                 align_ofs = align_ofs >> 1;
@@ -919,9 +725,9 @@ static void lv_draw_span(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx)
         }
 
         /* draw line letters */
-        int i;
+        uint32_t i;
         for(i = 0; i < item_cnt; i++) {
-            lv_snippet_t * pinfo = lv_get_snippet(i);
+            lv_snippet_t * pinfo = (is_end_line && i == item_cnt - 1) ? &end_snippet : &snippets[i];
 
             /* bidi deal with:todo */
             const char * bidi_txt = pinfo->txt;
@@ -931,7 +737,7 @@ static void lv_draw_span(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx)
             pos.y = txt_pos.y + max_line_h - pinfo->line_h - (max_baseline - pinfo->font->base_line);
             label_draw_dsc.color = lv_span_get_style_text_color(obj, pinfo->span);
             label_draw_dsc.opa = lv_span_get_style_text_opa(obj, pinfo->span);
-            label_draw_dsc.font = lv_span_get_style_text_font(obj, pinfo->span);
+            label_draw_dsc.font = pinfo->font;
             label_draw_dsc.blend_mode = lv_span_get_style_text_blend_mode(obj, pinfo->span);
             if(obj_opa < LV_OPA_MAX) {
                 label_draw_dsc.opa = (uint16_t)((uint16_t)label_draw_dsc.opa * obj_opa) >> 8;
@@ -1016,24 +822,202 @@ static void lv_draw_span(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx)
             txt_pos.x = pos.x;
         }
 
-Next_line_init:
-        /* next line init */
-        is_first_line = false;
-        txt_pos.x = coords.x1;
-        txt_pos.y += max_line_h;
-        if(is_end_line || txt_pos.y > clip_area.y2 + 1) {
-            draw_ctx->clip_area = clip_area_ori;
-            return;
+        if(is_end_line || txt_pos.y + max_line_h > clip_area.y2 + 1) {
+            break;
         }
-        max_w = max_width;
     }
     draw_ctx->clip_area = clip_area_ori;
 }
 
+/**
+ * Break the spans into lines and snippets for a given width and save the result in the spangroup.
+ * Nothing happens if the layout is already created for this width.
+ * @param obj pointer to a spangroup
+ * @param width the width of the content area
+ */
+static void layout_update(lv_obj_t * obj, lv_coord_t width)
+{
+    lv_spangroup_t * spans = (lv_spangroup_t *)obj;
+    if(spans->layout_valid && spans->layout_w == width) return;
+
+    layout_free(obj);
+    spans->layout_w = width;
+    spans->layout_valid = 1;
+
+    lv_span_t * cur_span = _lv_ll_get_head(&spans->child_ll);
+    if(cur_span == NULL) return;
+
+    uint32_t snippet_cap = 0;
+    uint32_t line_cap = 0;
+
+    /* init draw variable */
+    lv_text_flag_t txt_flag = LV_TEXT_FLAG_NONE;
+    lv_coord_t line_space = lv_obj_get_style_text_line_space(obj, LV_PART_MAIN);
+    lv_coord_t max_width = width;
+    lv_coord_t indent = convert_indent_pct(obj, max_width);
+    lv_coord_t max_w  = max_width - indent; /* first line need minus indent */
+    lv_coord_t line_y = 0;
+
+    const char * cur_txt = cur_span->txt;
+    span_text_check(&cur_txt);
+    uint32_t cur_txt_ofs = 0;
+    lv_snippet_t snippet;   /* use to save cur_span info and push it to the layout */
+    lv_memset_00(&snippet, sizeof(snippet));
+
+    /* the loop control how many lines need to be created */
+    while(cur_span) {
+        lv_span_line_t line;
+        line.snippet_start = spans->layout_snippet_cnt;
+        line.snippet_cnt = 0;
+        line.y = line_y;
+        line.max_line_h = 0;
+        line.max_baseline = 0;
+
+        /* the loop control to find a line and push the relevant span info into the layout */
+        while(1) {
+            /* switch to the next span when current is end */
+            if(cur_txt[cur_txt_ofs] == '\0') {
+                cur_span = _lv_ll_get_next(&spans->child_ll, cur_span);
+                if(cur_span == NULL) break;
+                cur_txt = cur_span->txt;
+                span_text_check(&cur_txt);
+                cur_txt_ofs = 0;
+                /* maybe also cur_txt[cur_txt_ofs] == '\0' */
+                continue;
+            }
+
+            /* init span info to snippet. */
+            if(cur_txt_ofs == 0) {
+                snippet.span = cur_span;
+                snippet.font = lv_span_get_style_text_font(obj, cur_span);
+                snippet.letter_space = lv_span_get_style_text_letter_space(obj, cur_span);
+                snippet.line_h = lv_font_get_line_height(snippet.font) + line_space;
+            }
+
+            /* get current span text line info */
+            uint32_t next_ofs = 0;
+            lv_coord_t use_width = 0;
+            bool isfill = lv_txt_get_snippet(&cur_txt[cur_txt_ofs], snippet.font, snippet.letter_space,
+                                             max_w, txt_flag, &use_width, &next_ofs);
+
+            if(isfill) {
+                if(next_ofs > 0 && line.snippet_cnt > 0) {
+                    /* To prevent infinite loops, the _lv_txt_get_next_line() may return incomplete words, */
+                    /* This phenomenon should be avoided when the line already has snippets */
+                    if(max_w < use_width) {
+                        break;
+                    }
+                    uint32_t tmp_ofs = next_ofs;
+                    uint32_t letter = _lv_txt_encoded_prev(&cur_txt[cur_txt_ofs], &tmp_ofs);
+                    if(!(letter == '\0' || letter == '\n' || letter == '\r' || _lv_txt_is_break_char(letter))) {
+                        tmp_ofs = 0;
+                        letter = _lv_txt_encoded_next(&cur_txt[cur_txt_ofs + next_ofs], &tmp_ofs);
+                        if(!(letter == '\0' || letter == '\n'  || letter == '\r' || _lv_txt_is_break_char(letter))) {
+                            break;
+                        }
+                    }
+                }
+            }
+
+            snippet.txt = &cur_txt[cur_txt_ofs];
+            snippet.bytes = next_ofs;
+            snippet.txt_w = use_width;
+            cur_txt_ofs += next_ofs;
+            if(line.max_line_h < snippet.line_h) {
+                line.max_line_h = snippet.line_h;
+                line.max_baseline = snippet.font->base_line;
+            }
+
+            if(spans->layout_snippet_cnt >= snippet_cap) {
+                snippet_cap = snippet_cap ? snippet_cap * 2 : 16;
+                spans->layout_snippets = lv_mem_realloc(spans->layout_snippets, snippet_cap * sizeof(lv_snippet_t));
+                LV_ASSERT_MALLOC(spans->layout_snippets);
+                if(spans->layout_snippets == NULL) {
+                    layout_free(obj);
+                    return;
+                }
+            }
+            spans->layout_snippets[spans->layout_snippet_cnt] = snippet;
+            spans->layout_snippet_cnt++;
+            line.snippet_cnt++;
+
+            max_w = max_w - use_width - snippet.letter_space;
+            if(isfill || max_w <= 0) {
+                break;
+            }
+        }
+
+        if(line.snippet_cnt == 0) {     /* break if the line is empty */
+            break;
+        }
+
+        /* the height of the next line is required to decide if this line is the last visible one */
+        lv_snippet_t * last_snippet = &spans->layout_snippets[spans->layout_snippet_cnt - 1];
+        line.next_line_h = last_snippet->line_h;
+        if(last_snippet->txt[last_snippet->bytes] == '\0') {
+            line.next_line_h = 0;
+            lv_span_t * next_span = _lv_ll_get_next(&spans->child_ll, last_snippet->span);
+            if(next_span) { /* have the next line */
+                line.next_line_h = lv_font_get_line_height(lv_span_get_style_text_font(obj, next_span)) + line_space;
+            }
+        }
+
+        if(spans->layout_line_cnt >= line_cap) {
+            line_cap = line_cap ? line_cap * 2 : 8;
+            spans->layout_lines = lv_mem_realloc(spans->layout_lines, line_cap * sizeof(lv_span_line_t));
+            LV_ASSERT_MALLOC(spans->layout_lines);
+            if(spans->layout_lines == NULL) {
+                layout_free(obj);
+                return;
+            }
+        }
+        spans->layout_lines[spans->layout_line_cnt] = line;
+        spans->layout_line_cnt++;
+
+        /* next line init */
+        line_y += line.max_line_h;
+        max_w = max_width;
+    }
+}
+
+/**
+ * Check if the font or letter space of a span was changed without notifying the spangroup.
+ * @param obj pointer to a spangroup
+ * @return true: the layout needs to be created again
+ */
+static bool layout_is_outdated(lv_obj_t * obj)
+{
+    lv_spangroup_t * spans = (lv_spangroup_t *)obj;
+    uint32_t i;
+    for(i = 0; i < spans->layout_snippet_cnt; i++) {
+        lv_snippet_t * snippet = &spans->layout_snippets[i];
+        /* check only the first snippet of the spans */
+        if(snippet->txt != snippet->span->txt) continue;
+        if(snippet->font != lv_span_get_style_text_font(obj, snippet->span)) return true;
+        if(snippet->letter_space != lv_span_get_style_text_letter_space(obj, snippet->span)) return true;
+    }
+
+    return false;
+}
+
+static void layout_free(lv_obj_t * obj)
+{
+    lv_spangroup_t * spans = (lv_spangroup_t *)obj;
+    lv_mem_free(spans->layout_snippets);
+    lv_mem_free(spans->layout_lines);
+    spans->layout_snippets = NULL;
+    spans->layout_lines = NULL;
+    spans->layout_snippet_cnt = 0;
+    spans->layout_line_cnt = 0;
+    spans->layout_valid = 0;
+}
+
+
 static void refresh_self_size(lv_obj_t * obj)
 {
     lv_spangroup_t * spans = (lv_spangroup_t *)obj;
     spans->refresh = 1;
+    spans->layout_valid = 0;
     lv_obj_invalidate(obj);
     lv_obj_refresh_self_size(obj);
 }
@@ -20,9 +20,6 @@ extern "C" {
 /*********************
  *      DEFINES
  *********************/
-#ifndef LV_SPAN_SNIPPET_STACK_SIZE
-#define LV_SPAN_SNIPPET_STACK_SIZE 64
-#endif
 
 /**********************
  *      TYPEDEFS
@@ -47,6 +44,27 @@ typedef struct {
     uint8_t static_flag : 1;/* the text is static flag */
 } lv_span_t;
 
+/** The part of a span's text which is on one line*/
+typedef struct {
+    lv_span_t * span;
+    const char * txt;
+    const lv_font_t * font;
+    uint16_t   bytes;
+    lv_coord_t txt_w;
+    lv_coord_t line_h;
+    lv_coord_t letter_space;
+} lv_snippet_t;
+
+/** A line of the laid out spans*/
+typedef struct {
+    uint32_t snippet_start;     /* index of the first snippet of the line */
+    uint32_t snippet_cnt;
+    lv_coord_t y;               /* distance from the top of the content area */
+    lv_coord_t max_line_h;      /* the max height of span-font on the line, including the line space */
+    lv_coord_t max_baseline;    /* baseline of the highest span */
+    lv_coord_t next_line_h;     /* height of the line after this line */
+} lv_span_line_t;
+
 /** Data of label*/
 typedef struct {
     lv_obj_t obj;
@@ -55,9 +73,15 @@ typedef struct {
     lv_coord_t cache_w;     /* the cache automatically calculates the width */
     lv_coord_t cache_h;     /* similar cache_w */
     lv_ll_t  child_ll;
+    lv_snippet_t * layout_snippets; /* the snippets of all lines, cached until the spans, styles or width change */
+    lv_span_line_t * layout_lines;
+    uint32_t layout_snippet_cnt;
+    uint32_t layout_line_cnt;
+    lv_coord_t layout_w;    /* the width the layout was created for */
     uint8_t mode : 2;       /* details see lv_span_mode_t */
     uint8_t overflow : 1;   /* details see lv_span_overflow_t */
     uint8_t refresh : 1;    /* the spangroup need refresh cache_w and cache_h */
+    uint8_t layout_valid : 1;   /* the layout_snippets and layout_lines are up to date */
 } lv_spangroup_t;
 
 extern const lv_obj_class_t lv_spangroup_class;
@@ -228,6 +252,7 @@ lv_coord_t lv_spangroup_get_expand_height(lv_obj_t * obj, lv_coord_t width);
 
 /**
  * update the mode of the spangroup.
+ * Also drops the cached layout so it should be called after the style of a span was changed.
  * @param obj pointer to a spangroup object.
  */
 void lv_spangroup_refr_mode(lv_obj_t * obj);
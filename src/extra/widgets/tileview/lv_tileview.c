@@ -9,9 +9,13 @@
 #include "lv_tileview.h"
 #if LV_USE_TILEVIEW
 
+#include "../../../core/lv_refr.h"
+#include "../../../draw/lv_img_cache.h"
+
 /*********************
  *      DEFINES
  *********************/
+#define MY_TILE_CLASS &lv_tileview_tile_class
 
 /**********************
  *      TYPEDEFS
@@ -22,7 +26,13 @@
  **********************/
 static void lv_tileview_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void lv_tileview_tile_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
+static void lv_tileview_tile_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
+static void lv_tileview_tile_event(const lv_obj_class_t * class_p, lv_event_t * e);
 static void tileview_event_cb(lv_event_t * e);
+static void prerender_tiles(lv_obj_t * obj);
+static void prerender_tile(lv_obj_t * tile_obj);
+static void restore_tiles(lv_obj_t * obj);
+static void restore_tile(lv_obj_t * tile_obj);
 
 /**********************
  *  STATIC VARIABLES
@@ -34,6 +44,8 @@ const lv_obj_class_t lv_tileview_class = {.constructor_cb = lv_tileview_construc
                                          };
 
 const lv_obj_class_t lv_tileview_tile_class = {.constructor_cb = lv_tileview_tile_constructor,
+                                               .destructor_cb = lv_tileview_tile_destructor,
+                                               .event_cb = lv_tileview_tile_event,
                                                .base_class = &lv_obj_class,
                                                .instance_size = sizeof(lv_tileview_tile_t)
                                               };
@@ -111,12 +123,27 @@ void lv_obj_set_tile_id(lv_obj_t * tv, uint32_t col_id, uint32_t row_id, lv_anim
     LV_LOG_WARN("No tile found with at (%d,%d) index", (int)col_id, (int)row_id);
 }
 
+void lv_tileview_set_prerender(lv_obj_t * obj, bool en)
+{
+    lv_tileview_t * tv = (lv_tileview_t *) obj;
+    if(tv->prerender == en) return;
+
+    tv->prerender = en;
+    if(!en) restore_tiles(obj);
+}
+
 lv_obj_t * lv_tileview_get_tile_act(lv_obj_t * obj)
 {
     lv_tileview_t * tv = (lv_tileview_t *) obj;
     return tv->tile_act;
 }
 
+bool lv_tileview_get_prerender(const lv_obj_t * obj)
+{
+    lv_tileview_t * tv = (lv_tileview_t *) obj;
+    return tv->prerender;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -150,13 +177,53 @@ static void lv_tileview_tile_constructor(const lv_obj_class_t * class_p, lv_obj_
     }
 }
 
+static void lv_tileview_tile_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
+{
+    LV_UNUSED(class_p);
+    restore_tile(obj);
+}
+
+static void lv_tileview_tile_event(const lv_obj_class_t * class_p, lv_event_t * e)
+{
+    LV_UNUSED(class_p);
+
+    lv_event_code_t code = lv_event_get_code(e);
+    lv_obj_t * obj = lv_event_get_current_target(e);
+    lv_tileview_tile_t * tile = (lv_tileview_tile_t *)obj;
+
+    /*The image contains everything the tile would draw (background, children, scrollbars)*/
+    if(tile->img && (code == LV_EVENT_DRAW_MAIN || code == LV_EVENT_DRAW_POST)) {
+        if(code == LV_EVENT_DRAW_MAIN) {
+            lv_draw_ctx_t * draw_ctx = lv_event_get_draw_ctx(e);
+            lv_coord_t ext_size = _lv_obj_get_ext_draw_size(obj);
+            lv_area_t img_area;
+            lv_area_copy(&img_area, &obj->coords);
+            lv_area_increase(&img_area, ext_size, ext_size);
+
+            lv_draw_img_dsc_t img_dsc;
+            lv_draw_img_dsc_init(&img_dsc);
+            lv_draw_img(draw_ctx, &img_dsc, &img_area, tile->img);
+        }
+        return;
+    }
+
+    /*Call the ancestor's event handler*/
+    lv_obj_event_base(MY_TILE_CLASS, e);
+}
+
 static void tileview_event_cb(lv_event_t * e)
 {
     lv_event_code_t code = lv_event_get_code(e);
     lv_obj_t * obj = lv_event_get_target(e);
     lv_tileview_t * tv = (lv_tileview_t *) obj;
 
-    if(code == LV_EVENT_SCROLL_END) {
+    if(code == LV_EVENT_SCROLL_BEGIN) {
+        /*Prerender only for animations and dragging as other scrolls end immediately*/
+        if(tv->prerender && (lv_event_get_param(e) || lv_obj_is_scrolling(obj))) {
+            prerender_tiles(obj);
+        }
+    }
+    else if(code == LV_EVENT_SCROLL_END) {
         lv_coord_t w = lv_obj_get_content_width(obj);
         lv_coord_t h = lv_obj_get_content_height(obj);
 
@@ -183,6 +250,131 @@ static void tileview_event_cb(lv_event_t * e)
             }
         }
         lv_obj_set_scroll_dir(obj, dir);
+
+        /*Keep the images if the scroll position was only adjusted while dragging or
+         *a snap animation still moves the tiles when the dragging ends*/
+        bool dragged = lv_event_get_param(e) == NULL && lv_obj_is_scrolling(obj);
+        if(!dragged && lv_anim_get(obj, NULL) == NULL) {
+            restore_tiles(obj);
+        }
     }
 }
+
+/**
+ * Prerender the tile in the middle of the tileview and the tiles where it can be scrolled from there.
+ * @param obj pointer to a tileview
+ */
+static void prerender_tiles(lv_obj_t * obj)
+{
+    lv_obj_update_layout(obj);
+
+    lv_coord_t w = lv_obj_get_content_width(obj);
+    lv_coord_t h = lv_obj_get_content_height(obj);
+    if(w <= 0 || h <= 0) return;
+
+    lv_coord_t sx = lv_obj_get_scroll_x(obj);
+    lv_coord_t sy = lv_obj_get_scroll_y(obj);
+    lv_coord_t tx = ((sx + (w / 2)) / w) * w;
+    lv_coord_t ty = ((sy + (h / 2)) / h) * h;
+    lv_dir_t dir = lv_obj_get_scroll_dir(obj);
+
+    uint32_t i;
+    for(i = 0; i < lv_obj_get_child_cnt(obj); i++) {
+        lv_obj_t * tile_obj = lv_obj_get_child(obj, i);
+        if(!lv_obj_check_type(tile_obj, &lv_tileview_tile_class)) continue;
+
+        lv_coord_t x = lv_obj_get_x(tile_obj);
+        lv_coord_t y = lv_obj_get_y(tile_obj);
+        bool neighbour = false;
+        if(x == tx && y == ty) neighbour = true;
+        else if(y == ty && x == tx - w && (dir & LV_DIR_LEFT)) neighbour = true;
+        else if(y == ty && x == tx + w && (dir & LV_DIR_RIGHT)) neighbour = true;
+        else if(x == tx && y == ty - h && (dir & LV_DIR_TOP)) neighbour = true;
+        else if(x == tx && y == ty + h && (dir & LV_DIR_BOTTOM)) neighbour = true;
+
+        if(neighbour) prerender_tile(tile_obj);
+    }
+}
+
+/**
+ * Render a tile with its children to an image and draw only the image until the tile is restored.
+ * If the image can't be allocated the tile is simply drawn as normally.
+ * @param tile_obj pointer to a tile
+ */
+static void prerender_tile(lv_obj_t * tile_obj)
+{
+    lv_tileview_tile_t * tile = (lv_tileview_tile_t *)tile_obj;
+    if(tile->img) return;
+    if(lv_obj_has_flag(tile_obj, LV_OBJ_FLAG_HIDDEN)) return;
+
+    lv_coord_t ext_size = _lv_obj_get_ext_draw_size(tile_obj);
+    lv_area_t img_area;
+    lv_area_copy(&img_area, &tile_obj->coords);
+    lv_area_increase(&img_area, ext_size, ext_size);
+    lv_coord_t w = lv_area_get_width(&img_area);
+    lv_coord_t h = lv_area_get_height(&img_area);
+    if(w <= 0 || h <= 0) return;
+
+    /*Without alpha channel the tile is rendered and drawn much faster*/
+    lv_img_cf_t cf = LV_IMG_CF_TRUE_COLOR_ALPHA;
+    if(ext_size == 0) {
+        lv_cover_check_info_t info;
+        info.res = LV_COVER_RES_COVER;
+        info.area = &img_area;
+        lv_event_send(tile_obj, LV_EVENT_COVER_CHECK, &info);
+        if(info.res == LV_COVER_RES_COVER) cf = LV_IMG_CF_TRUE_COLOR;
+    }
+
+    uint32_t size = lv_img_buf_get_img_size(w, h, cf);
+    lv_img_dsc_t * img = lv_mem_alloc(sizeof(lv_img_dsc_t) + size);
+    if(img == NULL) {
+        LV_LOG_WARN("couldn't allocate the image of a tile");
+        return;
+    }
+
+    uint8_t * buf = (uint8_t *)(img + 1);
+    lv_memset_00(img, sizeof(lv_img_dsc_t));
+    lv_memset_00(buf, size);
+    img->header.w = w;
+    img->header.h = h;
+    img->header.cf = cf;
+    img->data_size = size;
+    img->data = buf;
+
+    if(_lv_obj_render_to_buf(tile_obj, buf, &img_area, cf, NULL, NULL) != LV_RES_OK) {
+        lv_mem_free(img);
+        return;
+    }
+
+    /*Draw only the image while scrolling. The children are not drawn again and again but they are kept visible*/
+    tile_obj->skip_children = 1;
+    tile->img = img;
+}
+
+static void restore_tiles(lv_obj_t * obj)
+{
+    uint32_t i;
+    for(i = 0; i < lv_obj_get_child_cnt(obj); i++) {
+        lv_obj_t * tile_obj = lv_obj_get_child(obj, i);
+        if(lv_obj_check_type(tile_obj, &lv_tileview_tile_class)) restore_tile(tile_obj);
+    }
+}
+
+/**
+ * Draw the children of a prerendered tile again and free its image
+ * @param tile_obj pointer to a tile
+ */
+static void restore_tile(lv_obj_t * tile_obj)
+{
+    lv_tileview_tile_t * tile = (lv_tileview_tile_t *)tile_obj;
+    if(tile->img == NULL) return;
+
+    lv_img_cache_invalidate_src(tile->img);
+    lv_mem_free(tile->img);
+    tile->img = NULL;
+    tile_obj->skip_children = 0;
+
+    /*The content might have changed while the image was shown*/
+    lv_obj_invalidate(tile_obj);
+}
 #endif /*LV_USE_TILEVIEW*/
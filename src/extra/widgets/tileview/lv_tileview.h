@@ -27,11 +27,13 @@ extern "C" {
 typedef struct {
     lv_obj_t obj;
     lv_obj_t * tile_act;
+    uint8_t prerender : 1;          /*1: draw the tiles from images while scrolling*/
 } lv_tileview_t;
 
 typedef struct {
     lv_obj_t obj;
     lv_dir_t dir;
+    lv_img_dsc_t * img;             /*The tile rendered while scrolling or NULL*/
 } lv_tileview_tile_t;
 
 extern const lv_obj_class_t lv_tileview_class;
@@ -53,8 +55,27 @@ lv_obj_t * lv_tileview_add_tile(lv_obj_t * tv, uint8_t col_id, uint8_t row_id, l
 void lv_obj_set_tile(lv_obj_t * tv, lv_obj_t * tile_obj, lv_anim_enable_t anim_en);
 void lv_obj_set_tile_id(lv_obj_t * tv, uint32_t col_id, uint32_t row_id, lv_anim_enable_t anim_en);
 
+/**
+ * Render the active tile and its neighbours to images when scrolling starts and draw them
+ * instead of the tiles' children until the scrolling ends.
+ * It makes swiping fast regardless of the complexity of the tiles, but needs
+ * `tile width x tile height x LV_IMG_PX_SIZE_ALPHA_BYTE` bytes for each prerendered tile.
+ * Tiles with opaque background need only `LV_COLOR_SIZE / 8` bytes per pixel and are drawn faster.
+ * Changes of the tiles' content are shown only when the scrolling ends.
+ * @param obj       pointer to a tileview object
+ * @param en        true: enable prerendering; false: disable it
+ */
+void lv_tileview_set_prerender(lv_obj_t * obj, bool en);
+
 lv_obj_t * lv_tileview_get_tile_act(lv_obj_t * obj);
 
+/**
+ * Get whether the tiles are prerendered while scrolling
+ * @param obj       pointer to a tileview object
+ * @return          true: prerendering is enabled
+ */
+bool lv_tileview_get_prerender(const lv_obj_t * obj);
+
 /*=====================
  * Other functions
  *====================*/
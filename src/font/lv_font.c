@@ -15,18 +15,38 @@
 /*********************
  *      DEFINES
  *********************/
+#if LV_FONT_WIDTH_CACHE_SIZE
+    /*Number of entries a letter pair can be stored in. Less conflicts than a direct mapped table.*/
+    #define WIDTH_CACHE_WAYS    (LV_FONT_WIDTH_CACHE_SIZE < 4 ? LV_FONT_WIDTH_CACHE_SIZE : 4)
+    #define WIDTH_CACHE_SETS    (LV_FONT_WIDTH_CACHE_SIZE / WIDTH_CACHE_WAYS)
+#endif
 
 /**********************
  *      TYPEDEFS
  **********************/
 
+#if LV_FONT_WIDTH_CACHE_SIZE
+typedef struct {
+    const lv_font_t * font;     /*NULL: the entry is unused*/
+    uint32_t letter;
+    uint32_t letter_next;
+    uint16_t adv_w;
+} width_cache_entry_t;
+#endif
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+#if LV_FONT_WIDTH_CACHE_SIZE
+    static uint32_t width_cache_get_set(const lv_font_t * font, uint32_t letter, uint32_t letter_next);
+#endif
 
 /**********************
  *  STATIC VARIABLES
  **********************/
+#if LV_FONT_WIDTH_CACHE_SIZE
+    static width_cache_entry_t width_cache[WIDTH_CACHE_SETS][WIDTH_CACHE_WAYS];
+#endif
 
 /**********************
  * GLOBAL PROTOTYPES
@@ -125,11 +145,72 @@ bool lv_font_get_glyph_dsc(const lv_font_t * font_p, lv_font_glyph_dsc_t * dsc_o
 uint16_t lv_font_get_glyph_width(const lv_font_t * font, uint32_t letter, uint32_t letter_next)
 {
     LV_ASSERT_NULL(font);
+
+#if LV_FONT_WIDTH_CACHE_SIZE
+    /*The width depends on the next letter too because of kerning so the pair is the key.
+     *The entries of a set are ordered from the most recently used.*/
+    width_cache_entry_t * set = width_cache[width_cache_get_set(font, letter, letter_next)];
+    width_cache_entry_t e;
+    uint32_t i;
+    for(i = 0; i < WIDTH_CACHE_WAYS; i++) {
+        if(set[i].font == font && set[i].letter == letter && set[i].letter_next == letter_next) break;
+    }
+
+    if(i < WIDTH_CACHE_WAYS) {
+        e = set[i];
+    }
+    else {
+        lv_font_glyph_dsc_t g;
+        lv_font_get_glyph_dsc(font, &g, letter, letter_next);
+        e.font = font;
+        e.letter = letter;
+        e.letter_next = letter_next;
+        e.adv_w = g.adv_w;
+        i = WIDTH_CACHE_WAYS - 1;   /*Drop the least recently used*/
+    }
+
+    for(; i > 0; i--) set[i] = set[i - 1];
+    set[0] = e;
+
+    return e.adv_w;
+#else
     lv_font_glyph_dsc_t g;
     lv_font_get_glyph_dsc(font, &g, letter, letter_next);
     return g.adv_w;
+#endif
+}
+
+/**
+ * Forget the cached glyph widths of a font.
+ * Should be called when a font is deleted or its glyphs or fallback font are changed.
+ * @param font pointer to a font or NULL to forget the widths of all fonts
+ */
+void lv_font_width_cache_invalidate(const lv_font_t * font)
+{
+#if LV_FONT_WIDTH_CACHE_SIZE
+    uint32_t i;
+    uint32_t j;
+    for(i = 0; i < WIDTH_CACHE_SETS; i++) {
+        for(j = 0; j < WIDTH_CACHE_WAYS; j++) {
+            if(font == NULL || width_cache[i][j].font == font) width_cache[i][j].font = NULL;
+        }
+    }
+#else
+    LV_UNUSED(font);
+#endif
 }
 
 /**********************
  *   STATIC FUNCTIONS
  **********************/
+
+#if LV_FONT_WIDTH_CACHE_SIZE
+static uint32_t width_cache_get_set(const lv_font_t * font, uint32_t letter, uint32_t letter_next)
+{
+    uint32_t h = (uint32_t)((lv_uintptr_t)font >> 3);
+    h = h * 31 + letter;
+    h = h * 31 + letter_next;
+    h ^= h >> 16;
+    return h % WIDTH_CACHE_SETS;
+}
+#endif
@@ -116,6 +116,13 @@ bool lv_font_get_glyph_dsc(const lv_font_t * font_p, lv_font_glyph_dsc_t * dsc_o
  */
 uint16_t lv_font_get_glyph_width(const lv_font_t * font, uint32_t letter, uint32_t letter_next);
 
+/**
+ * Forget the cached glyph widths of a font.
+ * Should be called when a font is deleted or its glyphs or fallback font are changed.
+ * @param font pointer to a font or NULL to forget the widths of all fonts
+ */
+void lv_font_width_cache_invalidate(const lv_font_t * font);
+
 /**
  * Get the line height of a font. All characters fit into this height
  * @param font_p pointer to a font
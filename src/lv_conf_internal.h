@@ -313,6 +313,27 @@
     #endif
 #endif
 
+/*Default memory budget of the image cache in bytes. The least recently used images are closed to stay in the budget.
+ *Only the memory allocated by the decoders for the decoded images is counted.
+ *0: no limit, only the number of images is limited by LV_IMG_CACHE_DEF_SIZE*/
+#ifndef LV_IMG_CACHE_DEF_MEM_SIZE
+    #ifdef CONFIG_LV_IMG_CACHE_DEF_MEM_SIZE
+        #define LV_IMG_CACHE_DEF_MEM_SIZE CONFIG_LV_IMG_CACHE_DEF_MEM_SIZE
+    #else
+        #define LV_IMG_CACHE_DEF_MEM_SIZE   0
+    #endif
+#endif
+
+/*1: Allow decoding the images in the background while a placeholder is drawn. Requires LV_IMG_CACHE_DEF_SIZE > 0.
+ *See lv_img_cache_set_async_worker()*/
+#ifndef LV_IMG_CACHE_ASYNC
+    #ifdef CONFIG_LV_IMG_CACHE_ASYNC
+        #define LV_IMG_CACHE_ASYNC CONFIG_LV_IMG_CACHE_ASYNC
+    #else
+        #define LV_IMG_CACHE_ASYNC  0
+    #endif
+#endif
+
 /*Number of stops allowed per gradient. Increase this to allow more stops.
  *This adds (sizeof(lv_color_t) + 1) bytes per additional stop*/
 #ifndef LV_GRADIENT_MAX_STOPS
@@ -1167,6 +1188,18 @@
     #endif
 #endif
 
+/*Number of glyph widths (letter pairs to consider kerning) to remember per all fonts.
+ *Text measurement (label sizing, line wrapping, spans) asks the width of the same letters again and again.
+ *Use a power of 2. Each entry needs 16 bytes (24 on 64 bit systems).
+ *0: to disable caching*/
+#ifndef LV_FONT_WIDTH_CACHE_SIZE
+    #ifdef CONFIG_LV_FONT_WIDTH_CACHE_SIZE
+        #define LV_FONT_WIDTH_CACHE_SIZE CONFIG_LV_FONT_WIDTH_CACHE_SIZE
+    #else
+        #define LV_FONT_WIDTH_CACHE_SIZE 0
+    #endif
+#endif
+
 /*=================
  *  TEXT SETTINGS
  *=================*/
@@ -1415,6 +1448,13 @@
             #define LV_LABEL_LONG_TXT_HINT 1  /*Store some extra info in labels to speed up drawing of very long texts*/
         #endif
     #endif
+    #ifndef LV_LABEL_IMG_CACHE_SIZE
+        #ifdef CONFIG_LV_LABEL_IMG_CACHE_SIZE
+            #define LV_LABEL_IMG_CACHE_SIZE CONFIG_LV_LABEL_IMG_CACHE_SIZE
+        #else
+            #define LV_LABEL_IMG_CACHE_SIZE 0 /*Memory for the texts of labels rendered to images [bytes]. See lv_label_set_img_cache(). 0: disable*/
+        #endif
+    #endif
 #endif
 
 #ifndef LV_USE_LINE
@@ -1761,16 +1801,6 @@
         #define LV_USE_SPAN       1
     #endif
 #endif
-#if LV_USE_SPAN
-    /*A line text can contain maximum num of span descriptor */
-    #ifndef LV_SPAN_SNIPPET_STACK_SIZE
-        #ifdef CONFIG_LV_SPAN_SNIPPET_STACK_SIZE
-            #define LV_SPAN_SNIPPET_STACK_SIZE CONFIG_LV_SPAN_SNIPPET_STACK_SIZE
-        #else
-            #define LV_SPAN_SNIPPET_STACK_SIZE 64
-        #endif
-    #endif
-#endif
 
 /*-----------
  * Themes
@@ -2023,6 +2053,15 @@
     #endif
 #endif
 
+/*Decoder for the images converted to the layout of the display by `scripts/img_to_nimg.py`*/
+#ifndef LV_USE_NIMG
+    #ifdef CONFIG_LV_USE_NIMG
+        #define LV_USE_NIMG CONFIG_LV_USE_NIMG
+    #else
+        #define LV_USE_NIMG 0
+    #endif
+#endif
+
 /* JPG + split JPG decoder library.
  * Split JPG is a custom format optimized for embedded systems. */
 #ifndef LV_USE_SJPG
@@ -2032,6 +2071,29 @@
         #define LV_USE_SJPG 0
     #endif
 #endif
+#if LV_USE_SJPG
+    /*Number of decoded fragments (16 rows by default) to keep. Scrolling back over them doesn't decode them again*/
+    #ifndef LV_SJPG_FRAME_CACHE_CNT
+        #ifdef CONFIG_LV_SJPG_FRAME_CACHE_CNT
+            #define LV_SJPG_FRAME_CACHE_CNT CONFIG_LV_SJPG_FRAME_CACHE_CNT
+        #else
+            #define LV_SJPG_FRAME_CACHE_CNT 4
+        #endif
+    #endif
+
+    /*1: Decode the next fragment in the scroll direction in advance, after the image is drawn*/
+    #ifndef LV_SJPG_PREFETCH
+        #ifdef _LV_KCONFIG_PRESENT
+            #ifdef CONFIG_LV_SJPG_PREFETCH
+                #define LV_SJPG_PREFETCH CONFIG_LV_SJPG_PREFETCH
+            #else
+                #define LV_SJPG_PREFETCH 0
+            #endif
+        #else
+            #define LV_SJPG_PREFETCH 1
+        #endif
+    #endif
+#endif
 
 /*GIF decoder library*/
 #ifndef LV_USE_GIF
@@ -2096,6 +2158,15 @@
             #endif
         #endif
     #endif
+    /*Memory used by LVGL to keep the rendered glyphs of any face, size and style [bytes] (0: disable)
+     *The glyphs remain cached when a font is destroyed and created again. See `lv_ft_glyph_cache_set_size()`*/
+    #ifndef LV_FREETYPE_GLYPH_CACHE_SIZE
+        #ifdef CONFIG_LV_FREETYPE_GLYPH_CACHE_SIZE
+            #define LV_FREETYPE_GLYPH_CACHE_SIZE CONFIG_LV_FREETYPE_GLYPH_CACHE_SIZE
+        #else
+            #define LV_FREETYPE_GLYPH_CACHE_SIZE 0
+        #endif
+    #endif
 #endif
 
 /*Rlottie library*/
@@ -2106,6 +2177,26 @@
         #define LV_USE_RLOTTIE 0
     #endif
 #endif
+#if LV_USE_RLOTTIE
+    /*1: Render the next frame in the background while the current one is shown (`lottie_animation_render_async()`)*/
+    #ifndef LV_RLOTTIE_ASYNC
+        #ifdef CONFIG_LV_RLOTTIE_ASYNC
+            #define LV_RLOTTIE_ASYNC CONFIG_LV_RLOTTIE_ASYNC
+        #else
+            #define LV_RLOTTIE_ASYNC 0
+        #endif
+    #endif
+
+    /*Keep every rendered frame of an animation if all of them fit into this many bytes (0: disable)
+     *A frame needs `width x height x LV_IMG_PX_SIZE_ALPHA_BYTE` bytes. Once a loop is played the frames are only copied*/
+    #ifndef LV_RLOTTIE_CACHE_SIZE
+        #ifdef CONFIG_LV_RLOTTIE_CACHE_SIZE
+            #define LV_RLOTTIE_CACHE_SIZE CONFIG_LV_RLOTTIE_CACHE_SIZE
+        #else
+            #define LV_RLOTTIE_CACHE_SIZE 0
+        #endif
+    #endif
+#endif
 
 /*FFmpeg library for image decoding and playing videos
  *Supports all major image formats so do not enable other image decoder with it*/
@@ -2125,6 +2216,26 @@
             #define LV_FFMPEG_DUMP_FORMAT 0
         #endif
     #endif
+
+    /*Number of frame buffers of a video player. One is shown, the others are decoded in advance.
+     *Each needs `width x height x pixel size` bytes. At least 2.*/
+    #ifndef LV_FFMPEG_FRAME_QUEUE_SIZE
+        #ifdef CONFIG_LV_FFMPEG_FRAME_QUEUE_SIZE
+            #define LV_FFMPEG_FRAME_QUEUE_SIZE CONFIG_LV_FFMPEG_FRAME_QUEUE_SIZE
+        #else
+            #define LV_FFMPEG_FRAME_QUEUE_SIZE 3
+        #endif
+    #endif
+
+    /*1: Decode the frames of the video players in a thread (requires POSIX threads)
+     *0: Decode them in the players' timers*/
+    #ifndef LV_FFMPEG_USE_THREAD
+        #ifdef CONFIG_LV_FFMPEG_USE_THREAD
+            #define LV_FFMPEG_USE_THREAD CONFIG_LV_FFMPEG_USE_THREAD
+        #else
+            #define LV_FFMPEG_USE_THREAD 0
+        #endif
+    #endif
 #endif
 
 /*-----------
@@ -10,6 +10,8 @@
 #include "lv_bidi.h"
 #include "lv_txt.h"
 #include "../misc/lv_mem.h"
+#include "../misc/lv_assert.h"
+#include "../misc/lv_math.h"
 
 #if LV_USE_BIDI
 
@@ -31,6 +33,16 @@ typedef struct {
     lv_base_dir_t dir;
 } bracket_stack_t;
 
+typedef struct _lv_bidi_cache_line_t {
+    uint32_t start;         /*Byte index of the line in the text*/
+    uint32_t len;           /*Length of the line in bytes*/
+    lv_base_dir_t base_dir;
+    char * txt;             /*The line in visual order*/
+    uint16_t * vis_to_log;  /*Logical position of the visual characters, with the RTL flag*/
+    uint16_t * log_to_vis;  /*Visual position of the logical characters, with the RTL flag*/
+    uint16_t char_cnt;
+} lv_bidi_cache_line_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -50,6 +62,8 @@ static lv_base_dir_t bracket_process(const char * txt, uint32_t next_pos, uint32
                                      lv_base_dir_t base_dir);
 static void fill_pos_conv(uint16_t * out, uint16_t len, uint16_t index);
 static uint32_t get_txt_len(const char * txt, uint32_t max_len);
+static lv_bidi_cache_line_t * cache_get_line(lv_bidi_cache_t * cache, const char * txt, uint32_t line_start,
+                                             uint32_t len, lv_base_dir_t base_dir);
 
 /**********************
  *  STATIC VARIABLES
@@ -315,10 +329,121 @@ void lv_bidi_calculate_align(lv_text_align_t * align, lv_base_dir_t * base_dir,
     }
 }
 
+void _lv_bidi_cache_init(lv_bidi_cache_t * cache)
+{
+    lv_memset_00(cache, sizeof(lv_bidi_cache_t));
+}
+
+void _lv_bidi_cache_clear(lv_bidi_cache_t * cache)
+{
+    uint32_t i;
+    for(i = 0; i < cache->line_cnt; i++) {
+        lv_mem_free(cache->lines[i].txt);
+        lv_mem_free(cache->lines[i].vis_to_log);
+    }
+    lv_mem_free(cache->lines);
+    _lv_bidi_cache_init(cache);
+}
+
+const char * _lv_bidi_cache_get_line(lv_bidi_cache_t * cache, const char * txt, uint32_t line_start, uint32_t len,
+                                     lv_base_dir_t base_dir)
+{
+    lv_bidi_cache_line_t * line = cache_get_line(cache, txt, line_start, len, base_dir);
+    return line ? line->txt : NULL;
+}
+
+uint16_t _lv_bidi_cache_get_logical_pos(lv_bidi_cache_t * cache, const char * txt, uint32_t line_start, uint32_t len,
+                                        lv_base_dir_t base_dir, uint32_t visual_pos, bool * is_rtl)
+{
+    lv_bidi_cache_line_t * line = cache_get_line(cache, txt, line_start, len, base_dir);
+    if(line == NULL) return _lv_bidi_get_logical_pos(&txt[line_start], NULL, len, base_dir, visual_pos, is_rtl);
+    if(visual_pos >= line->char_cnt) return (uint16_t) -1;
+
+    if(is_rtl) *is_rtl = IS_RTL_POS(line->vis_to_log[visual_pos]);
+    return GET_POS(line->vis_to_log[visual_pos]);
+}
+
+uint16_t _lv_bidi_cache_get_visual_pos(lv_bidi_cache_t * cache, const char * txt, uint32_t line_start, uint32_t len,
+                                       lv_base_dir_t base_dir, uint32_t logical_pos, bool * is_rtl)
+{
+    lv_bidi_cache_line_t * line = cache_get_line(cache, txt, line_start, len, base_dir);
+    if(line == NULL) return _lv_bidi_get_visual_pos(&txt[line_start], NULL, len, base_dir, logical_pos, is_rtl);
+    if(logical_pos >= line->char_cnt) return (uint16_t) -1;
+
+    if(is_rtl) *is_rtl = IS_RTL_POS(line->log_to_vis[logical_pos]);
+    return GET_POS(line->log_to_vis[logical_pos]);
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
 
+/**
+ * Find a line in the cache or process and add it.
+ * @return the cached line or `NULL` if there was not enough memory
+ */
+static lv_bidi_cache_line_t * cache_get_line(lv_bidi_cache_t * cache, const char * txt, uint32_t line_start,
+                                             uint32_t len, lv_base_dir_t base_dir)
+{
+    /*Find the first line starting at `line_start` or after it*/
+    uint32_t first = 0;
+    uint32_t end = cache->line_cnt;
+    while(first < end) {
+        uint32_t mid = first + (end - first) / 2;
+        if(cache->lines[mid].start < line_start) first = mid + 1;
+        else end = mid;
+    }
+
+    uint32_t i;
+    for(i = first; i < cache->line_cnt && cache->lines[i].start == line_start; i++) {
+        lv_bidi_cache_line_t * line = &cache->lines[i];
+        if(line->len == len && line->base_dir == base_dir) return line;
+    }
+
+    if(cache->line_cnt == cache->line_alloc) {
+        uint32_t new_alloc = cache->line_alloc ? cache->line_alloc * 2 : 8;
+        lv_bidi_cache_line_t * lines = lv_mem_realloc(cache->lines, new_alloc * sizeof(lv_bidi_cache_line_t));
+        LV_ASSERT_MALLOC(lines);
+        if(lines == NULL) return NULL;
+        cache->lines = lines;
+        cache->line_alloc = new_alloc;
+    }
+
+    uint32_t char_cnt = get_txt_len(&txt[line_start], len);
+    char * buf = lv_mem_alloc(len + 1);
+    uint16_t * maps = lv_mem_alloc(LV_MAX(char_cnt, 1) * 2 * sizeof(uint16_t));
+    if(buf == NULL || maps == NULL) {
+        lv_mem_free(buf);
+        lv_mem_free(maps);
+        return NULL;
+    }
+
+    _lv_bidi_process_paragraph(&txt[line_start], buf, len, base_dir, maps, char_cnt);
+
+    /*Insert the line to keep the order. The lines are usually added from top to bottom so nothing is moved.*/
+    for(i = cache->line_cnt; i > first; i--) {
+        cache->lines[i] = cache->lines[i - 1];
+    }
+    lv_bidi_cache_line_t * line = &cache->lines[first];
+    line->start = line_start;
+    line->len = len;
+    line->base_dir = base_dir;
+    line->txt = buf;
+    line->vis_to_log = maps;
+    line->log_to_vis = maps + char_cnt;
+    line->char_cnt = char_cnt;
+
+    lv_memset_00(line->log_to_vis, char_cnt * sizeof(uint16_t));
+    for(i = 0; i < char_cnt; i++) {
+        uint16_t logical = GET_POS(maps[i]);
+        if(logical < char_cnt) line->log_to_vis[logical] = SET_RTL_POS(i, IS_RTL_POS(maps[i]));
+    }
+
+    cache->line_cnt++;
+    return line;
+}
+
+
 /**
  * Get the next paragraph from a text
  * @param txt the text to process
@@ -41,6 +41,16 @@ enum {
 
 typedef uint8_t lv_base_dir_t;
 
+struct _lv_bidi_cache_line_t;
+
+/** Keep the BiDi processed lines of a text to avoid processing them on every draw.
+ * The owner of the text needs to clear it when the text or its line breaks change.*/
+typedef struct {
+    struct _lv_bidi_cache_line_t * lines;  /*Ordered by the start of the lines*/
+    uint32_t line_cnt;
+    uint32_t line_alloc;
+} lv_bidi_cache_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -113,6 +123,60 @@ void _lv_bidi_process_paragraph(const char * str_in, char * str_out, uint32_t le
  */
 void lv_bidi_calculate_align(lv_text_align_t * align, lv_base_dir_t * base_dir, const char * txt);
 
+/**
+ * Initialize a BiDi cache
+ * @param cache pointer to a cache
+ */
+void _lv_bidi_cache_init(lv_bidi_cache_t * cache);
+
+/**
+ * Free the lines stored in a BiDi cache
+ * @param cache pointer to a cache
+ */
+void _lv_bidi_cache_clear(lv_bidi_cache_t * cache);
+
+/**
+ * Get a line of a text in visual order. The line is processed only if it's not in the cache yet.
+ * @param cache pointer to a cache
+ * @param txt the whole text
+ * @param line_start byte index of the line in `txt`
+ * @param len length of the line in bytes
+ * @param base_dir base direction of the text
+ * @return the processed line (`len` bytes) or `NULL` if there was not enough memory
+ */
+const char * _lv_bidi_cache_get_line(lv_bidi_cache_t * cache, const char * txt, uint32_t line_start, uint32_t len,
+                                     lv_base_dir_t base_dir);
+
+/**
+ * Get the logical position of a character in a line using the cached maps.
+ * The parameters work like with `_lv_bidi_get_logical_pos()`
+ * @param cache pointer to a cache
+ * @param txt the whole text
+ * @param line_start byte index of the line in `txt`
+ * @param len length of the line in bytes
+ * @param base_dir base direction of the text
+ * @param visual_pos the visual character position which logical position should be get
+ * @param is_rtl tell the char at `visual_pos` is RTL or LTR context
+ * @return the logical character position
+ */
+uint16_t _lv_bidi_cache_get_logical_pos(lv_bidi_cache_t * cache, const char * txt, uint32_t line_start, uint32_t len,
+                                        lv_base_dir_t base_dir, uint32_t visual_pos, bool * is_rtl);
+
+/**
+ * Get the visual position of a character in a line using the cached maps.
+ * The parameters work like with `_lv_bidi_get_visual_pos()`
+ * @param cache pointer to a cache
+ * @param txt the whole text
+ * @param line_start byte index of the line in `txt`
+ * @param len length of the line in bytes
+ * @param base_dir base direction of the text
+ * @param logical_pos the logical character position which visual position should be get
+ * @param is_rtl tell the char at `logical_pos` is RTL or LTR context
+ * @return the visual character position
+ */
+uint16_t _lv_bidi_cache_get_visual_pos(lv_bidi_cache_t * cache, const char * txt, uint32_t line_start, uint32_t len,
+                                       lv_base_dir_t base_dir, uint32_t logical_pos, bool * is_rtl);
+
 
 /**********************
  *      MACROS
@@ -20,6 +20,7 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static inline lv_color_t hsv8_to_rgb(uint8_t h, uint8_t s, uint8_t v);
 
 /**********************
  *  STATIC VARIABLES
@@ -154,56 +155,52 @@ lv_color_t lv_color_hsv_to_rgb(uint16_t h, uint8_t s, uint8_t v)
     s = (uint16_t)((uint16_t)s * 255) / 100;
     v = (uint16_t)((uint16_t)v * 255) / 100;
 
-    uint8_t r, g, b;
-
-    uint8_t region, remainder, p, q, t;
-
-    if(s == 0) {
-        return lv_color_make(v, v, v);
-    }
-
-    region    = h / 43;
-    remainder = (h - (region * 43)) * 6;
-
-    p = (v * (255 - s)) >> 8;
-    q = (v * (255 - ((s * remainder) >> 8))) >> 8;
-    t = (v * (255 - ((s * (255 - remainder)) >> 8))) >> 8;
+    return hsv8_to_rgb((uint8_t)h, s, v);
+}
 
-    switch(region) {
-        case 0:
-            r = v;
-            g = t;
-            b = p;
-            break;
-        case 1:
-            r = q;
-            g = v;
-            b = p;
-            break;
-        case 2:
-            r = p;
-            g = v;
-            b = t;
-            break;
-        case 3:
-            r = p;
-            g = q;
-            b = v;
-            break;
-        case 4:
-            r = t;
-            g = p;
-            b = v;
-            break;
-        default:
-            r = v;
-            g = p;
-            b = q;
-            break;
+/**
+ * Convert an array of HSV colors to RGB.
+ * Gives the same colors as `lv_color_hsv_to_rgb()` but the divisions are replaced by multiplications
+ * and the region of the hue is selected with masks instead of branches, so the loop can be vectorized.
+ * @param hsv   the HSV colors to convert
+ * @param rgb   store the RGB colors here (with LV_COLOR_DEPTH depth)
+ * @param cnt   number of colors in the arrays
+ */
+LV_ATTRIBUTE_FAST_MEM void lv_color_hsv_to_rgb_array(const lv_color_hsv_t * hsv, lv_color_t * rgb, uint32_t cnt)
+{
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        /*x * 255 / 360 = x * 17 / 24 and x * 255 / 100 = x * 51 / 20.
+         *The reciprocals of 24 and 20 in 16 bit fixed point are exact in the used ranges.*/
+        uint32_t h = (((uint32_t)hsv[i].h * 17) * 2731) >> 16;
+        uint32_t s = (((uint32_t)hsv[i].s * 51) * 3277) >> 16;
+        uint32_t v = (((uint32_t)hsv[i].v * 51) * 3277) >> 16;
+
+        /*The same as in `hsv8_to_rgb()`. h / 43 = h * 191 / 8192 for 0..255*/
+        uint32_t region = (h * 191) >> 13;
+        uint32_t remainder = (h - region * 43) * 6;
+        uint32_t p = (v * (255 - s)) >> 8;
+        uint32_t q = (v * (255 - ((s * remainder) >> 8))) >> 8;
+        uint32_t t = (v * (255 - ((s * (255 - remainder)) >> 8))) >> 8;
+
+        /*Gray if there is no saturation*/
+        uint32_t gray = 0 - (uint32_t)(s == 0);
+        p = (p & ~gray) | (v & gray);
+        q = (q & ~gray) | (v & gray);
+        t = (t & ~gray) | (v & gray);
+
+        uint32_t m0 = 0 - (uint32_t)(region == 0);
+        uint32_t m1 = 0 - (uint32_t)(region == 1);
+        uint32_t m2 = 0 - (uint32_t)(region == 2);
+        uint32_t m3 = 0 - (uint32_t)(region == 3);
+        uint32_t m4 = 0 - (uint32_t)(region == 4);
+        uint32_t m5 = 0 - (uint32_t)(region == 5);
+        uint32_t r = (v & (m0 | m5)) | (q & m1) | (p & (m2 | m3)) | (t & m4);
+        uint32_t g = (t & m0) | (v & (m1 | m2)) | (q & m3) | (p & (m4 | m5));
+        uint32_t b = (p & (m0 | m1)) | (t & m2) | (v & (m3 | m4)) | (q & m5);
+
+        rgb[i] = lv_color_make(r, g, b);
     }
-
-    lv_color_t result = lv_color_make(r, g, b);
-    return result;
 }
 
 /**
@@ -367,3 +364,61 @@ lv_color_t lv_palette_darken(lv_palette_t p, uint8_t lvl)
 
     return colors[p][lvl];
 }
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static inline lv_color_t hsv8_to_rgb(uint8_t h, uint8_t s, uint8_t v)
+{
+    uint8_t r, g, b;
+
+    uint8_t region, remainder, p, q, t;
+
+    if(s == 0) {
+        return lv_color_make(v, v, v);
+    }
+
+    region    = h / 43;
+    remainder = (h - (region * 43)) * 6;
+
+    p = (v * (255 - s)) >> 8;
+    q = (v * (255 - ((s * remainder) >> 8))) >> 8;
+    t = (v * (255 - ((s * (255 - remainder)) >> 8))) >> 8;
+
+    switch(region) {
+        case 0:
+            r = v;
+            g = t;
+            b = p;
+            break;
+        case 1:
+            r = q;
+            g = v;
+            b = p;
+            break;
+        case 2:
+            r = p;
+            g = v;
+            b = t;
+            break;
+        case 3:
+            r = p;
+            g = q;
+            b = v;
+            break;
+        case 4:
+            r = t;
+            g = p;
+            b = v;
+            break;
+        default:
+            r = v;
+            g = p;
+            b = q;
+            break;
+    }
+
+    lv_color_t result = lv_color_make(r, g, b);
+    return result;
+}
@@ -659,6 +659,15 @@ lv_color_t lv_color_change_lightness(lv_color_t c, lv_opa_t lvl);
  */
 lv_color_t lv_color_hsv_to_rgb(uint16_t h, uint8_t s, uint8_t v);
 
+/**
+ * Convert an array of HSV colors to RGB.
+ * Gives the same colors as `lv_color_hsv_to_rgb()` but the divisions are replaced by multiplications.
+ * @param hsv   the HSV colors to convert
+ * @param rgb   store the RGB colors here (with LV_COLOR_DEPTH depth)
+ * @param cnt   number of colors in the arrays
+ */
+void lv_color_hsv_to_rgb_array(const lv_color_hsv_t * hsv, lv_color_t * rgb, uint32_t cnt);
+
 /**
  * Convert a 32-bit RGB color to HSV
  * @param r8 8-bit red
@@ -0,0 +1,255 @@
+/**
+ * @file lv_color_conv.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_color_conv.h"
+#include "lv_mem.h"
+#include "lv_math.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+/*The same as `LV_IMG_PX_SIZE_ALPHA_BYTE`*/
+#if LV_COLOR_DEPTH == 32
+    #define PX_SIZE_ALPHA   4
+#else
+    #define PX_SIZE_ALPHA   (LV_COLOR_SIZE / 8 + 1)
+#endif
+
+#define NO_ALPHA            0xFF
+
+/*The fast conversions assume that the bytes of an `uint32_t` are stored from the lowest*/
+#define FAST_CONV           (LV_BIG_ENDIAN_SYSTEM == 0 && (LV_COLOR_DEPTH == 32 || LV_COLOR_DEPTH == 16))
+
+#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP
+    #define RGB565_SWAP(c)  ((((c) >> 8) | ((c) << 8)) & 0xFFFF)
+#else
+    #define RGB565_SWAP(c)  (c)
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void conv_px(uint8_t * dst, const uint8_t * src, uint32_t px_cnt, lv_color_conv_fmt_t src_fmt,
+                    uint32_t dst_px_size, bool alpha);
+#if FAST_CONV
+    static bool conv_fast(void * dst, const void * src, uint32_t px_cnt, lv_color_conv_fmt_t src_fmt, bool alpha);
+    static inline void conv_words(void * dst, const uint32_t * src, uint32_t px_cnt, bool bgra, bool alpha);
+    static inline void conv_bytes(void * dst, const uint8_t * src, uint32_t px_cnt, uint32_t r_ofs, uint32_t b_ofs,
+                                  bool alpha);
+#endif
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+/*Offset of the red, green, blue and alpha bytes and the size of a pixel*/
+static const uint8_t fmt_layout[][5] = {
+    [LV_COLOR_CONV_RGBA8888] = {0, 1, 2, 3, 4},
+    [LV_COLOR_CONV_BGRA8888] = {2, 1, 0, 3, 4},
+    [LV_COLOR_CONV_RGB888] = {0, 1, 2, NO_ALPHA, 3},
+    [LV_COLOR_CONV_BGR888] = {2, 1, 0, NO_ALPHA, 3},
+};
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_color_conv_to_native(void * dst, const void * src, uint32_t px_cnt, lv_color_conv_fmt_t src_fmt)
+{
+#if FAST_CONV
+    if(conv_fast(dst, src, px_cnt, src_fmt, false)) return;
+#endif
+    conv_px(dst, src, px_cnt, src_fmt, sizeof(lv_color_t), false);
+}
+
+void lv_color_conv_to_native_alpha(void * dst, const void * src, uint32_t px_cnt, lv_color_conv_fmt_t src_fmt)
+{
+#if FAST_CONV
+    if(conv_fast(dst, src, px_cnt, src_fmt, true)) return;
+#endif
+    conv_px(dst, src, px_cnt, src_fmt, PX_SIZE_ALPHA, true);
+}
+
+void lv_color_conv_yuv420(lv_color_t * dst, const uint8_t * y, const uint8_t * u, const uint8_t * v,
+                          uint32_t y_stride, uint32_t uv_stride, uint32_t w, uint32_t h)
+{
+    uint32_t row;
+    for(row = 0; row < h; row++) {
+        const uint8_t * y_row = y + row * y_stride;
+        const uint8_t * u_row = u + (row / 2) * uv_stride;
+        const uint8_t * v_row = v + (row / 2) * uv_stride;
+        uint32_t x;
+        for(x = 0; x < w; x++) {
+            /*Integer BT.601: R = 1.164(Y - 16) + 1.596(V - 128) etc. scaled by 256*/
+            int32_t c = ((int32_t)y_row[x] - 16) * 298 + 128;
+            int32_t d = (int32_t)u_row[x / 2] - 128;
+            int32_t e = (int32_t)v_row[x / 2] - 128;
+            int32_t r = (c + 409 * e) / 256;
+            int32_t g = (c - 100 * d - 208 * e) / 256;
+            int32_t b = (c + 516 * d) / 256;
+            r = LV_CLAMP(0, r, 255);
+            g = LV_CLAMP(0, g, 255);
+            b = LV_CLAMP(0, b, 255);
+            dst[x] = lv_color_make(r, g, b);
+        }
+        dst += w;
+    }
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Convert the pixels one by one with `lv_color_make()`. Works with any color depth and alignment.
+ */
+static void conv_px(uint8_t * dst, const uint8_t * src, uint32_t px_cnt, lv_color_conv_fmt_t src_fmt,
+                    uint32_t dst_px_size, bool alpha)
+{
+    const uint8_t * l = fmt_layout[src_fmt];
+    uint32_t src_px_size = l[4];
+
+    /*The pixels grow: go backward to not overwrite the not converted pixels in place*/
+    bool backward = dst_px_size > src_px_size;
+
+    uint32_t n;
+    for(n = 0; n < px_cnt; n++) {
+        uint32_t i = backward ? px_cnt - 1 - n : n;
+        const uint8_t * s = &src[i * src_px_size];
+        uint8_t * d = &dst[i * dst_px_size];
+        uint8_t a = l[3] == NO_ALPHA ? 0xFF : s[l[3]];
+        lv_color_t c = lv_color_make(s[l[0]], s[l[1]], s[l[2]]);
+        lv_memcpy_small(d, &c, sizeof(c));
+        if(alpha) d[PX_SIZE_ALPHA - 1] = a;
+    }
+}
+
+#if FAST_CONV
+
+/**
+ * Convert the pixels with loops specialized for the format.
+ * These loops have no branches so compilers can vectorize them.
+ * @return false if the formats or the alignment is not supported
+ */
+static bool conv_fast(void * dst, const void * src, uint32_t px_cnt, lv_color_conv_fmt_t src_fmt, bool alpha)
+{
+    /*`lv_color_t` is written as a word*/
+    uintptr_t align_mask = alpha && LV_COLOR_DEPTH == 16 ? 0 : sizeof(lv_color_t) - 1;
+    if(((uintptr_t)dst & align_mask) != 0) return false;
+
+    if(src_fmt == LV_COLOR_CONV_RGBA8888 || src_fmt == LV_COLOR_CONV_BGRA8888) {
+        if(((uintptr_t)src & 0x3) != 0) return false;
+        conv_words(dst, src, px_cnt, src_fmt == LV_COLOR_CONV_BGRA8888, alpha);
+        return true;
+    }
+
+    /*The 3 byte pixels would grow or stay in place. Let `conv_px` go backward.*/
+    if(dst == src) return false;
+    if(src_fmt == LV_COLOR_CONV_RGB888) conv_bytes(dst, src, px_cnt, 0, 2, alpha);
+    else conv_bytes(dst, src, px_cnt, 2, 0, alpha);
+    return true;
+}
+
+/**
+ * Convert 4 byte pixels read as words
+ */
+static inline void conv_words(void * dst, const uint32_t * src, uint32_t px_cnt, bool bgra, bool alpha)
+{
+    uint32_t i;
+#if LV_COLOR_DEPTH == 32
+    uint32_t * d = dst;
+    uint32_t a_mask = alpha ? 0 : 0xFF000000;
+
+    if(bgra) {
+        if(alpha) {
+            if(dst != src) lv_memcpy(dst, src, px_cnt * sizeof(uint32_t));
+        }
+        else {
+            for(i = 0; i < px_cnt; i++) d[i] = src[i] | a_mask;
+        }
+    }
+    else {
+        /*Swap red and blue*/
+        for(i = 0; i < px_cnt; i++) {
+            uint32_t w = src[i];
+            d[i] = (w & 0xFF00FF00) | ((w >> 16) & 0xFF) | ((w & 0xFF) << 16) | a_mask;
+        }
+    }
+#else
+    /*Red and blue are in the lowest bits of the words*/
+    uint32_t r_shift = bgra ? 8 : 0;
+    uint32_t r_back = bgra ? 0 : 8;
+    uint32_t b_shift = bgra ? 3 : 19;
+
+    if(alpha) {
+        uint8_t * d = dst;
+        for(i = 0; i < px_cnt; i++) {
+            uint32_t w = src[i];
+            uint32_t c = (((w >> r_shift) << r_back) & 0xF800) | ((w >> 5) & 0x07E0) | ((w >> b_shift) & 0x001F);
+            c = RGB565_SWAP(c);
+            d[i * 3 + 0] = c & 0xFF;
+            d[i * 3 + 1] = c >> 8;
+            d[i * 3 + 2] = w >> 24;
+        }
+    }
+    else {
+        uint16_t * d = dst;
+        for(i = 0; i < px_cnt; i++) {
+            uint32_t w = src[i];
+            uint32_t c = (((w >> r_shift) << r_back) & 0xF800) | ((w >> 5) & 0x07E0) | ((w >> b_shift) & 0x001F);
+            d[i] = RGB565_SWAP(c);
+        }
+    }
+#endif
+}
+
+/**
+ * Convert 3 byte pixels to a different buffer
+ */
+static inline void conv_bytes(void * dst, const uint8_t * src, uint32_t px_cnt, uint32_t r_ofs, uint32_t b_ofs,
+                              bool alpha)
+{
+    uint32_t i;
+#if LV_COLOR_DEPTH == 32
+    LV_UNUSED(alpha);
+    uint32_t * d = dst;
+    for(i = 0; i < px_cnt; i++) {
+        const uint8_t * s = &src[i * 3];
+        d[i] = 0xFF000000 | ((uint32_t)s[r_ofs] << 16) | ((uint32_t)s[1] << 8) | s[b_ofs];
+    }
+#else
+    if(alpha) {
+        uint8_t * d = dst;
+        for(i = 0; i < px_cnt; i++) {
+            const uint8_t * s = &src[i * 3];
+            uint32_t c = ((s[r_ofs] & 0xF8) << 8) | ((s[1] & 0xFC) << 3) | (s[b_ofs] >> 3);
+            c = RGB565_SWAP(c);
+            d[i * 3 + 0] = c & 0xFF;
+            d[i * 3 + 1] = c >> 8;
+            d[i * 3 + 2] = 0xFF;
+        }
+    }
+    else {
+        uint16_t * d = dst;
+        for(i = 0; i < px_cnt; i++) {
+            const uint8_t * s = &src[i * 3];
+            uint32_t c = ((s[r_ofs] & 0xF8) << 8) | ((s[1] & 0xFC) << 3) | (s[b_ofs] >> 3);
+            d[i] = RGB565_SWAP(c);
+        }
+    }
+#endif
+}
+
+#endif /*FAST_CONV*/
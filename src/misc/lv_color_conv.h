@@ -0,0 +1,87 @@
+/**
+ * @file lv_color_conv.h
+ * Convert the pixels of decoded images to LVGL's color format
+ */
+
+#ifndef LV_COLOR_CONV_H
+#define LV_COLOR_CONV_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lv_conf_internal.h"
+#include "lv_color.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * Byte order of the source pixels
+ */
+enum {
+    LV_COLOR_CONV_RGBA8888,     /*R, G, B, A bytes (e.g. PNG)*/
+    LV_COLOR_CONV_BGRA8888,     /*B, G, R, A bytes, i.e. ARGB8888 words on little endian systems (e.g. BMP, rlottie)*/
+    LV_COLOR_CONV_RGB888,       /*R, G, B bytes (e.g. JPEG)*/
+    LV_COLOR_CONV_BGR888,       /*B, G, R bytes (e.g. BMP)*/
+};
+
+typedef uint8_t lv_color_conv_fmt_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Convert pixels to `lv_color_t` (`LV_IMG_CF_TRUE_COLOR`). The alpha channel is ignored.
+ * @param dst       buffer for `px_cnt` colors. Can be the same as `src` to convert in place.
+ * @param src       the pixels to convert
+ * @param px_cnt    number of pixels
+ * @param src_fmt   byte order of the source pixels, `LV_COLOR_CONV_...`
+ */
+void lv_color_conv_to_native(void * dst, const void * src, uint32_t px_cnt, lv_color_conv_fmt_t src_fmt);
+
+/**
+ * Convert pixels to `lv_color_t` + alpha byte (`LV_IMG_CF_TRUE_COLOR_ALPHA`).
+ * The alpha of pixels without alpha channel will be 255.
+ * @param dst       buffer for `px_cnt x LV_IMG_PX_SIZE_ALPHA_BYTE` bytes. Can be the same as `src` to convert in place.
+ * @param src       the pixels to convert
+ * @param px_cnt    number of pixels
+ * @param src_fmt   byte order of the source pixels, `LV_COLOR_CONV_...`
+ */
+void lv_color_conv_to_native_alpha(void * dst, const void * src, uint32_t px_cnt, lv_color_conv_fmt_t src_fmt);
+
+/**
+ * Convert a planar YUV 4:2:0 image (BT.601, limited range) to `lv_color_t`
+ * @param dst       buffer for `w x h` colors
+ * @param y         the luma plane
+ * @param u         the blue chroma plane with half resolution
+ * @param v         the red chroma plane with half resolution
+ * @param y_stride  bytes in a line of the luma plane
+ * @param uv_stride bytes in a line of the chroma planes
+ * @param w         width of the image
+ * @param h         height of the image
+ */
+void lv_color_conv_yuv420(lv_color_t * dst, const uint8_t * y, const uint8_t * u, const uint8_t * v,
+                          uint32_t y_stride, uint32_t uv_stride, uint32_t w, uint32_t h);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_COLOR_CONV_H*/
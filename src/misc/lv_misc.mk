@@ -4,6 +4,7 @@ CSRCS += lv_area.c
 CSRCS += lv_async.c
 CSRCS += lv_bidi.c
 CSRCS += lv_color.c
+CSRCS += lv_color_conv.c
 CSRCS += lv_fs.c
 CSRCS += lv_gc.c
 CSRCS += lv_ll.c
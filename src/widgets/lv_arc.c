@@ -91,8 +91,7 @@ void lv_arc_set_start_angle(lv_obj_t * obj, uint16_t start)
     if(old_delta < 0) old_delta = 360 + old_delta;
     if(new_delta < 0) new_delta = 360 + new_delta;
 
-    if(LV_ABS(new_delta - old_delta) > 180)  lv_obj_invalidate(obj);
-    else if(new_delta < old_delta) inv_arc_area(obj, arc->indic_angle_start, start, LV_PART_INDICATOR);
+    if(new_delta < old_delta) inv_arc_area(obj, arc->indic_angle_start, start, LV_PART_INDICATOR);
     else if(old_delta < new_delta) inv_arc_area(obj, start, arc->indic_angle_start, LV_PART_INDICATOR);
 
     inv_knob_area(obj);
@@ -114,8 +113,7 @@ void lv_arc_set_end_angle(lv_obj_t * obj, uint16_t end)
     if(old_delta < 0) old_delta = 360 + old_delta;
     if(new_delta < 0) new_delta = 360 + new_delta;
 
-    if(LV_ABS(new_delta - old_delta) > 180)  lv_obj_invalidate(obj);
-    else if(new_delta < old_delta) inv_arc_area(obj, end, arc->indic_angle_end, LV_PART_INDICATOR);
+    if(new_delta < old_delta) inv_arc_area(obj, end, arc->indic_angle_end, LV_PART_INDICATOR);
     else if(old_delta < new_delta) inv_arc_area(obj, arc->indic_angle_end, end, LV_PART_INDICATOR);
 
     inv_knob_area(obj);
@@ -144,8 +142,7 @@ void lv_arc_set_bg_start_angle(lv_obj_t * obj, uint16_t start)
     if(old_delta < 0) old_delta = 360 + old_delta;
     if(new_delta < 0) new_delta = 360 + new_delta;
 
-    if(LV_ABS(new_delta - old_delta) > 180)  lv_obj_invalidate(obj);
-    else if(new_delta < old_delta) inv_arc_area(obj, arc->bg_angle_start, start, LV_PART_MAIN);
+    if(new_delta < old_delta) inv_arc_area(obj, arc->bg_angle_start, start, LV_PART_MAIN);
     else if(old_delta < new_delta) inv_arc_area(obj, start, arc->bg_angle_start, LV_PART_MAIN);
 
     arc->bg_angle_start = start;
@@ -166,8 +163,7 @@ void lv_arc_set_bg_end_angle(lv_obj_t * obj, uint16_t end)
     if(old_delta < 0) old_delta = 360 + old_delta;
     if(new_delta < 0) new_delta = 360 + new_delta;
 
-    if(LV_ABS(new_delta - old_delta) > 180)  lv_obj_invalidate(obj);
-    else if(new_delta < old_delta) inv_arc_area(obj, end, arc->bg_angle_end, LV_PART_MAIN);
+    if(new_delta < old_delta) inv_arc_area(obj, end, arc->bg_angle_end, LV_PART_MAIN);
     else if(old_delta < new_delta) inv_arc_area(obj, arc->bg_angle_end, end, LV_PART_MAIN);
 
     arc->bg_angle_end = end;
@@ -632,6 +628,14 @@ static void lv_arc_draw(lv_event_t * e)
     lv_event_send(obj, LV_EVENT_DRAW_PART_END, &part_draw_dsc);
 }
 
+/**
+ * Invalidate the sector of an arc between two angles (clockwise from `start_angle` to `end_angle`).
+ * The sector is split at the quarters of the circle so that only the bounding box of each piece is invalidated.
+ * @param obj           pointer to an arc object
+ * @param start_angle   start angle of the sector without the rotation
+ * @param end_angle     end angle of the sector without the rotation
+ * @param part          LV_PART_MAIN or LV_PART_INDICATOR
+ */
 static void inv_arc_area(lv_obj_t * obj, uint16_t start_angle, uint16_t end_angle, lv_part_t part)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
@@ -643,25 +647,38 @@ static void inv_arc_area(lv_obj_t * obj, uint16_t start_angle, uint16_t end_angl
 
     if(start_angle == end_angle) return;
 
-    if(start_angle > 360) start_angle -= 360;
-    if(end_angle > 360) end_angle -= 360;
-
-    start_angle += arc->rotation;
-    end_angle += arc->rotation;
-
-    if(start_angle > 360) start_angle -= 360;
-    if(end_angle > 360) end_angle -= 360;
+    int32_t span = (int32_t)end_angle - start_angle;
+    if(span <= 0) span += 360;
 
     lv_coord_t r;
     lv_point_t c;
     get_center(obj, &c, &r);
 
+    /*The indicator is smaller with its greatest padding*/
+    if(part == LV_PART_INDICATOR) {
+        lv_coord_t left = lv_obj_get_style_pad_left(obj, LV_PART_INDICATOR);
+        lv_coord_t right = lv_obj_get_style_pad_right(obj, LV_PART_INDICATOR);
+        lv_coord_t top = lv_obj_get_style_pad_top(obj, LV_PART_INDICATOR);
+        lv_coord_t bottom = lv_obj_get_style_pad_bottom(obj, LV_PART_INDICATOR);
+        r -= LV_MAX4(left, right, top, bottom);
+    }
+    if(r <= 0) return;
+
     lv_coord_t w = lv_obj_get_style_arc_width(obj, part);
     lv_coord_t rounded = lv_obj_get_style_arc_rounded(obj, part);
 
-    lv_area_t inv_area;
-    lv_draw_arc_get_area(c.x, c.y, r, start_angle, end_angle, w, rounded, &inv_area);
-    lv_obj_invalidate_area(obj, &inv_area);
+    int32_t angle = (start_angle + arc->rotation) % 360;
+    while(span > 0) {
+        int32_t quarter_end = (angle / 90 + 1) * 90;
+        int32_t piece = LV_MIN(span, quarter_end - angle);
+
+        lv_area_t inv_area;
+        lv_draw_arc_get_area(c.x, c.y, r, angle, angle + piece, w, rounded, &inv_area);
+        lv_obj_invalidate_area(obj, &inv_area);
+
+        span -= piece;
+        angle = (angle + piece) % 360;
+    }
 }
 
 static void inv_knob_area(lv_obj_t * obj)
@@ -48,6 +48,8 @@ static void lv_bar_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void lv_bar_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void lv_bar_event(const lv_obj_class_t * class_p, lv_event_t * e);
 static void draw_indic(lv_event_t * e);
+static void get_indic_area(lv_obj_t * obj, lv_area_t * indic_area);
+static void inv_indic_change(lv_obj_t * obj, const lv_area_t * indic_area_ori);
 static void lv_bar_set_value_with_anim(lv_obj_t * obj, int32_t new_value, int32_t * value_ptr,
                                        _lv_bar_anim_t * anim_info, lv_anim_enable_t en);
 static void lv_bar_init_anim(lv_obj_t * bar, _lv_bar_anim_t * bar_anim);
@@ -258,135 +260,41 @@ static void draw_indic(lv_event_t * e)
     bar_coords.y2 += transf_h;
     lv_coord_t barw = lv_area_get_width(&bar_coords);
     lv_coord_t barh = lv_area_get_height(&bar_coords);
-    int32_t range = bar->max_value - bar->min_value;
     bool hor = barw >= barh ? true : false;
     bool sym = false;
     if(bar->mode == LV_BAR_MODE_SYMMETRICAL && bar->min_value < 0 && bar->max_value > 0 &&
        bar->start_value == bar->min_value) sym = true;
 
-    /*Calculate the indicator area*/
     lv_coord_t bg_left = lv_obj_get_style_pad_left(obj,     LV_PART_MAIN);
     lv_coord_t bg_right = lv_obj_get_style_pad_right(obj,   LV_PART_MAIN);
     lv_coord_t bg_top = lv_obj_get_style_pad_top(obj,       LV_PART_MAIN);
     lv_coord_t bg_bottom = lv_obj_get_style_pad_bottom(obj, LV_PART_MAIN);
-    /*Respect padding and minimum width/height too*/
-    lv_area_copy(&bar->indic_area, &bar_coords);
-    bar->indic_area.x1 += bg_left;
-    bar->indic_area.x2 -= bg_right;
-    bar->indic_area.y1 += bg_top;
-    bar->indic_area.y2 -= bg_bottom;
-
-    if(hor && lv_area_get_height(&bar->indic_area) < LV_BAR_SIZE_MIN) {
-        bar->indic_area.y1 = obj->coords.y1 + (barh / 2) - (LV_BAR_SIZE_MIN / 2);
-        bar->indic_area.y2 = bar->indic_area.y1 + LV_BAR_SIZE_MIN;
-    }
-    else if(!hor && lv_area_get_width(&bar->indic_area) < LV_BAR_SIZE_MIN) {
-        bar->indic_area.x1 = obj->coords.x1 + (barw / 2) - (LV_BAR_SIZE_MIN / 2);
-        bar->indic_area.x2 = bar->indic_area.x1 + LV_BAR_SIZE_MIN;
-    }
-
-    lv_coord_t indicw = lv_area_get_width(&bar->indic_area);
-    lv_coord_t indich = lv_area_get_height(&bar->indic_area);
-
-    /*Calculate the indicator length*/
-    lv_coord_t anim_length = hor ? indicw : indich;
-
-    lv_coord_t anim_cur_value_x, anim_start_value_x;
-
-    lv_coord_t * axis1, * axis2;
-    lv_coord_t (*indic_length_calc)(const lv_area_t * area);
-
-    if(hor) {
-        axis1 = &bar->indic_area.x1;
-        axis2 = &bar->indic_area.x2;
-        indic_length_calc = lv_area_get_width;
-    }
-    else {
-        axis1 = &bar->indic_area.y1;
-        axis2 = &bar->indic_area.y2;
-        indic_length_calc = lv_area_get_height;
-    }
 
-    if(LV_BAR_IS_ANIMATING(bar->start_value_anim)) {
-        lv_coord_t anim_start_value_start_x =
-            (int32_t)((int32_t)anim_length * (bar->start_value_anim.anim_start - bar->min_value)) / range;
-        lv_coord_t anim_start_value_end_x =
-            (int32_t)((int32_t)anim_length * (bar->start_value_anim.anim_end - bar->min_value)) / range;
-
-        anim_start_value_x = (((anim_start_value_end_x - anim_start_value_start_x) * bar->start_value_anim.anim_state) /
-                              LV_BAR_ANIM_STATE_END);
-
-        anim_start_value_x += anim_start_value_start_x;
-    }
-    else {
-        anim_start_value_x = (int32_t)((int32_t)anim_length * (bar->start_value - bar->min_value)) / range;
-    }
-
-    if(LV_BAR_IS_ANIMATING(bar->cur_value_anim)) {
-        lv_coord_t anim_cur_value_start_x =
-            (int32_t)((int32_t)anim_length * (bar->cur_value_anim.anim_start - bar->min_value)) / range;
-        lv_coord_t anim_cur_value_end_x =
-            (int32_t)((int32_t)anim_length * (bar->cur_value_anim.anim_end - bar->min_value)) / range;
+    /*Calculate the indicator area*/
+    get_indic_area(obj, &bar->indic_area);
 
-        anim_cur_value_x = anim_cur_value_start_x + (((anim_cur_value_end_x - anim_cur_value_start_x) *
-                                                      bar->cur_value_anim.anim_state) /
-                                                     LV_BAR_ANIM_STATE_END);
+    /*Get the max possible indicator area. The gradient should be applied on this*/
+    lv_area_t mask_indic_max_area;
+    lv_area_copy(&mask_indic_max_area, &bar_coords);
+    mask_indic_max_area.x1 += bg_left;
+    mask_indic_max_area.y1 += bg_top;
+    mask_indic_max_area.x2 -= bg_right;
+    mask_indic_max_area.y2 -= bg_bottom;
+    if(hor && lv_area_get_height(&mask_indic_max_area) < LV_BAR_SIZE_MIN) {
+        mask_indic_max_area.y1 = obj->coords.y1 + (barh / 2) - (LV_BAR_SIZE_MIN / 2);
+        mask_indic_max_area.y2 = mask_indic_max_area.y1 + LV_BAR_SIZE_MIN;
     }
-    else {
-        anim_cur_value_x = (int32_t)((int32_t)anim_length * (bar->cur_value - bar->min_value)) / range;
+    else if(!hor && lv_area_get_width(&mask_indic_max_area) < LV_BAR_SIZE_MIN) {
+        mask_indic_max_area.x1 = obj->coords.x1 + (barw / 2) - (LV_BAR_SIZE_MIN / 2);
+        mask_indic_max_area.x2 = mask_indic_max_area.x1 + LV_BAR_SIZE_MIN;
     }
 
-    lv_base_dir_t base_dir = lv_obj_get_style_base_dir(obj, LV_PART_MAIN);
-    if(hor && base_dir == LV_BASE_DIR_RTL) {
-        /*Swap axes*/
-        lv_coord_t * tmp;
-        tmp = axis1;
-        axis1 = axis2;
-        axis2 = tmp;
-        anim_cur_value_x = -anim_cur_value_x;
-        anim_start_value_x = -anim_start_value_x;
-    }
-
-    /*Set the indicator length*/
-    if(hor) {
-        *axis2 = *axis1 + anim_cur_value_x;
-        *axis1 += anim_start_value_x;
-    }
-    else {
-        *axis1 = *axis2 - anim_cur_value_x + 1;
-        *axis2 -= anim_start_value_x;
-    }
-    if(sym) {
-        lv_coord_t zero, shift;
-        shift = (-bar->min_value * anim_length) / range;
-        if(hor) {
-            zero = *axis1 + shift;
-            if(*axis2 > zero)
-                *axis1 = zero;
-            else {
-                *axis1 = *axis2;
-                *axis2 = zero;
-            }
-        }
-        else {
-            zero = *axis2 - shift + 1;
-            if(*axis1 > zero)
-                *axis2 = zero;
-            else {
-                *axis2 = *axis1;
-                *axis1 = zero;
-            }
-            if(*axis2 < *axis1) {
-                /*swap*/
-                zero = *axis1;
-                *axis1 = *axis2;
-                *axis2 = zero;
-            }
-        }
-    }
+    lv_coord_t indicw = lv_area_get_width(&mask_indic_max_area);
+    lv_coord_t indich = lv_area_get_height(&mask_indic_max_area);
+    lv_coord_t indic_length = hor ? lv_area_get_width(&bar->indic_area) : lv_area_get_height(&bar->indic_area);
 
     /*Do not draw a zero length indicator but at least call the draw part events*/
-    if(!sym && indic_length_calc(&bar->indic_area) <= 1) {
+    if(!sym && indic_length <= 1) {
 
         lv_obj_draw_part_dsc_t part_draw_dsc;
         lv_obj_draw_dsc_init(&part_draw_dsc, draw_ctx);
@@ -462,22 +370,6 @@ static void draw_indic(lv_event_t * e)
     draw_rect_dsc.border_opa = LV_OPA_TRANSP;
     draw_rect_dsc.shadow_opa = LV_OPA_TRANSP;
 
-    /*Get the max possible indicator area. The gradient should be applied on this*/
-    lv_area_t mask_indic_max_area;
-    lv_area_copy(&mask_indic_max_area, &bar_coords);
-    mask_indic_max_area.x1 += bg_left;
-    mask_indic_max_area.y1 += bg_top;
-    mask_indic_max_area.x2 -= bg_right;
-    mask_indic_max_area.y2 -= bg_bottom;
-    if(hor && lv_area_get_height(&mask_indic_max_area) < LV_BAR_SIZE_MIN) {
-        mask_indic_max_area.y1 = obj->coords.y1 + (barh / 2) - (LV_BAR_SIZE_MIN / 2);
-        mask_indic_max_area.y2 = mask_indic_max_area.y1 + LV_BAR_SIZE_MIN;
-    }
-    else if(!hor && lv_area_get_width(&mask_indic_max_area) < LV_BAR_SIZE_MIN) {
-        mask_indic_max_area.x1 = obj->coords.x1 + (barw / 2) - (LV_BAR_SIZE_MIN / 2);
-        mask_indic_max_area.x2 = mask_indic_max_area.x1 + LV_BAR_SIZE_MIN;
-    }
-
 #if LV_DRAW_COMPLEX
     /*Create a mask to the current indicator area to see only this part from the whole gradient.*/
     lv_draw_mask_radius_param_t mask_indic_param;
@@ -505,6 +397,220 @@ static void draw_indic(lv_event_t * e)
     lv_event_send(obj, LV_EVENT_DRAW_PART_END, &part_draw_dsc);
 }
 
+/**
+ * Get the area of the indicator according to the current value and animation state
+ * @param obj           pointer to a bar object
+ * @param indic_area    store the area of the indicator here
+ */
+static void get_indic_area(lv_obj_t * obj, lv_area_t * indic_area)
+{
+    lv_bar_t * bar = (lv_bar_t *)obj;
+
+    lv_area_t bar_coords;
+    lv_obj_get_coords(obj, &bar_coords);
+
+    lv_coord_t transf_w = lv_obj_get_style_transform_width(obj, LV_PART_MAIN);
+    lv_coord_t transf_h = lv_obj_get_style_transform_height(obj, LV_PART_MAIN);
+    bar_coords.x1 -= transf_w;
+    bar_coords.x2 += transf_w;
+    bar_coords.y1 -= transf_h;
+    bar_coords.y2 += transf_h;
+    lv_coord_t barw = lv_area_get_width(&bar_coords);
+    lv_coord_t barh = lv_area_get_height(&bar_coords);
+    int32_t range = bar->max_value - bar->min_value;
+    bool hor = barw >= barh ? true : false;
+    bool sym = false;
+    if(bar->mode == LV_BAR_MODE_SYMMETRICAL && bar->min_value < 0 && bar->max_value > 0 &&
+       bar->start_value == bar->min_value) sym = true;
+
+    lv_coord_t bg_left = lv_obj_get_style_pad_left(obj,     LV_PART_MAIN);
+    lv_coord_t bg_right = lv_obj_get_style_pad_right(obj,   LV_PART_MAIN);
+    lv_coord_t bg_top = lv_obj_get_style_pad_top(obj,       LV_PART_MAIN);
+    lv_coord_t bg_bottom = lv_obj_get_style_pad_bottom(obj, LV_PART_MAIN);
+    /*Respect padding and minimum width/height too*/
+    lv_area_copy(indic_area, &bar_coords);
+    indic_area->x1 += bg_left;
+    indic_area->x2 -= bg_right;
+    indic_area->y1 += bg_top;
+    indic_area->y2 -= bg_bottom;
+
+    if(hor && lv_area_get_height(indic_area) < LV_BAR_SIZE_MIN) {
+        indic_area->y1 = obj->coords.y1 + (barh / 2) - (LV_BAR_SIZE_MIN / 2);
+        indic_area->y2 = indic_area->y1 + LV_BAR_SIZE_MIN;
+    }
+    else if(!hor && lv_area_get_width(indic_area) < LV_BAR_SIZE_MIN) {
+        indic_area->x1 = obj->coords.x1 + (barw / 2) - (LV_BAR_SIZE_MIN / 2);
+        indic_area->x2 = indic_area->x1 + LV_BAR_SIZE_MIN;
+    }
+
+    lv_coord_t indicw = lv_area_get_width(indic_area);
+    lv_coord_t indich = lv_area_get_height(indic_area);
+
+    /*Calculate the indicator length*/
+    lv_coord_t anim_length = hor ? indicw : indich;
+
+    lv_coord_t anim_cur_value_x, anim_start_value_x;
+
+    lv_coord_t * axis1, * axis2;
+
+    if(hor) {
+        axis1 = &indic_area->x1;
+        axis2 = &indic_area->x2;
+    }
+    else {
+        axis1 = &indic_area->y1;
+        axis2 = &indic_area->y2;
+    }
+
+    if(LV_BAR_IS_ANIMATING(bar->start_value_anim)) {
+        lv_coord_t anim_start_value_start_x =
+            (int32_t)((int32_t)anim_length * (bar->start_value_anim.anim_start - bar->min_value)) / range;
+        lv_coord_t anim_start_value_end_x =
+            (int32_t)((int32_t)anim_length * (bar->start_value_anim.anim_end - bar->min_value)) / range;
+
+        anim_start_value_x = (((anim_start_value_end_x - anim_start_value_start_x) * bar->start_value_anim.anim_state) /
+                              LV_BAR_ANIM_STATE_END);
+
+        anim_start_value_x += anim_start_value_start_x;
+    }
+    else {
+        anim_start_value_x = (int32_t)((int32_t)anim_length * (bar->start_value - bar->min_value)) / range;
+    }
+
+    if(LV_BAR_IS_ANIMATING(bar->cur_value_anim)) {
+        lv_coord_t anim_cur_value_start_x =
+            (int32_t)((int32_t)anim_length * (bar->cur_value_anim.anim_start - bar->min_value)) / range;
+        lv_coord_t anim_cur_value_end_x =
+            (int32_t)((int32_t)anim_length * (bar->cur_value_anim.anim_end - bar->min_value)) / range;
+
+        anim_cur_value_x = anim_cur_value_start_x + (((anim_cur_value_end_x - anim_cur_value_start_x) *
+                                                      bar->cur_value_anim.anim_state) /
+                                                     LV_BAR_ANIM_STATE_END);
+    }
+    else {
+        anim_cur_value_x = (int32_t)((int32_t)anim_length * (bar->cur_value - bar->min_value)) / range;
+    }
+
+    lv_base_dir_t base_dir = lv_obj_get_style_base_dir(obj, LV_PART_MAIN);
+    if(hor && base_dir == LV_BASE_DIR_RTL) {
+        /*Swap axes*/
+        lv_coord_t * tmp;
+        tmp = axis1;
+        axis1 = axis2;
+        axis2 = tmp;
+        anim_cur_value_x = -anim_cur_value_x;
+        anim_start_value_x = -anim_start_value_x;
+    }
+
+    /*Set the indicator length*/
+    if(hor) {
+        *axis2 = *axis1 + anim_cur_value_x;
+        *axis1 += anim_start_value_x;
+    }
+    else {
+        *axis1 = *axis2 - anim_cur_value_x + 1;
+        *axis2 -= anim_start_value_x;
+    }
+    if(sym) {
+        lv_coord_t zero, shift;
+        shift = (-bar->min_value * anim_length) / range;
+        if(hor) {
+            zero = *axis1 + shift;
+            if(*axis2 > zero)
+                *axis1 = zero;
+            else {
+                *axis1 = *axis2;
+                *axis2 = zero;
+            }
+        }
+        else {
+            zero = *axis2 - shift + 1;
+            if(*axis1 > zero)
+                *axis2 = zero;
+            else {
+                *axis2 = *axis1;
+                *axis1 = zero;
+            }
+            if(*axis2 < *axis1) {
+                /*swap*/
+                zero = *axis1;
+                *axis1 = *axis2;
+                *axis2 = zero;
+            }
+        }
+    }
+}
+
+/**
+ * Invalidate only the moving edges of the indicator
+ * @param obj               pointer to a bar object
+ * @param indic_area_ori    the indicator area before the change
+ */
+static void inv_indic_change(lv_obj_t * obj, const lv_area_t * indic_area_ori)
+{
+    if(lv_obj_is_visible(obj) == false) return;
+
+    lv_area_t indic_area;
+    get_indic_area(obj, &indic_area);
+    if(_lv_area_is_equal(&indic_area, indic_area_ori)) return;
+
+    /*The user can draw anything anywhere in the draw part events (e.g. the value), so redraw the whole bar*/
+    if(_lv_obj_has_event_cb(obj, LV_EVENT_DRAW_PART_BEGIN) || _lv_obj_has_event_cb(obj, LV_EVENT_DRAW_PART_END)) {
+        lv_obj_invalidate(obj);
+        return;
+    }
+
+    /*A shadow is drawn for the whole indicator only if it's long enough so redraw all of it*/
+    lv_coord_t ext = _lv_obj_get_ext_draw_size(obj);
+    if(lv_obj_get_style_shadow_width(obj, LV_PART_INDICATOR) > 0) {
+        lv_area_t a;
+        _lv_area_join(&a, &indic_area, indic_area_ori);
+        lv_area_increase(&a, ext, ext);
+        lv_obj_invalidate_area(obj, &a);
+        return;
+    }
+
+    /*Around the edges the radius of the indicator, the transformation and e.g. the knob of a slider
+     *can be affected. Cover them with half of the bar's thickness and the extra draw size.*/
+    lv_coord_t transf_w = lv_obj_get_style_transform_width(obj, LV_PART_MAIN);
+    lv_coord_t transf_h = lv_obj_get_style_transform_height(obj, LV_PART_MAIN);
+    lv_area_t bar_coords;
+    lv_obj_get_coords(obj, &bar_coords);
+    lv_area_increase(&bar_coords, LV_MAX(transf_w, 0) + ext, LV_MAX(transf_h, 0) + ext);
+
+    lv_area_t a;
+    if(lv_obj_get_width(obj) >= lv_obj_get_height(obj)) {
+        lv_coord_t pad = lv_area_get_height(&bar_coords) / 2;
+        a.y1 = bar_coords.y1;
+        a.y2 = bar_coords.y2;
+        if(indic_area.x1 != indic_area_ori->x1) {
+            a.x1 = LV_MIN(indic_area.x1, indic_area_ori->x1) - pad;
+            a.x2 = LV_MAX(indic_area.x1, indic_area_ori->x1) + pad;
+            lv_obj_invalidate_area(obj, &a);
+        }
+        if(indic_area.x2 != indic_area_ori->x2) {
+            a.x1 = LV_MIN(indic_area.x2, indic_area_ori->x2) - pad;
+            a.x2 = LV_MAX(indic_area.x2, indic_area_ori->x2) + pad;
+            lv_obj_invalidate_area(obj, &a);
+        }
+    }
+    else {
+        lv_coord_t pad = lv_area_get_width(&bar_coords) / 2;
+        a.x1 = bar_coords.x1;
+        a.x2 = bar_coords.x2;
+        if(indic_area.y1 != indic_area_ori->y1) {
+            a.y1 = LV_MIN(indic_area.y1, indic_area_ori->y1) - pad;
+            a.y2 = LV_MAX(indic_area.y1, indic_area_ori->y1) + pad;
+            lv_obj_invalidate_area(obj, &a);
+        }
+        if(indic_area.y2 != indic_area_ori->y2) {
+            a.y1 = LV_MIN(indic_area.y2, indic_area_ori->y2) - pad;
+            a.y2 = LV_MAX(indic_area.y2, indic_area_ori->y2) + pad;
+            lv_obj_invalidate_area(obj, &a);
+        }
+    }
+}
+
 static void lv_bar_event(const lv_obj_class_t * class_p, lv_event_t * e)
 {
     LV_UNUSED(class_p);
@@ -549,8 +655,10 @@ static void lv_bar_event(const lv_obj_class_t * class_p, lv_event_t * e)
 static void lv_bar_anim(void * var, int32_t value)
 {
     _lv_bar_anim_t * bar_anim = var;
+    lv_area_t indic_area_ori;
+    get_indic_area(bar_anim->bar, &indic_area_ori);
     bar_anim->anim_state    = value;
-    lv_obj_invalidate(bar_anim->bar);
+    inv_indic_change(bar_anim->bar, &indic_area_ori);
 }
 
 static void lv_bar_anim_ready(lv_anim_t * a)
@@ -559,20 +667,25 @@ static void lv_bar_anim_ready(lv_anim_t * a)
     lv_obj_t * obj = (lv_obj_t *)var->bar;
     lv_bar_t * bar = (lv_bar_t *)obj;
 
+    lv_area_t indic_area_ori;
+    get_indic_area(obj, &indic_area_ori);
     var->anim_state = LV_BAR_ANIM_STATE_INV;
     if(var == &bar->cur_value_anim)
         bar->cur_value = var->anim_end;
     else if(var == &bar->start_value_anim)
         bar->start_value = var->anim_end;
-    lv_obj_invalidate(var->bar);
+    inv_indic_change(obj, &indic_area_ori);
 }
 
 static void lv_bar_set_value_with_anim(lv_obj_t * obj, int32_t new_value, int32_t * value_ptr,
                                        _lv_bar_anim_t * anim_info, lv_anim_enable_t en)
 {
+    lv_area_t indic_area_ori;
+    get_indic_area(obj, &indic_area_ori);
+
     if(en == LV_ANIM_OFF) {
         *value_ptr = new_value;
-        lv_obj_invalidate((lv_obj_t *)obj);
+        inv_indic_change(obj, &indic_area_ori);
     }
     else {
         /*No animation in progress -> simply set the values*/
@@ -589,6 +702,10 @@ static void lv_bar_set_value_with_anim(lv_obj_t * obj, int32_t new_value, int32_
         /*Stop the previous animation if it exists*/
         lv_anim_del(anim_info, NULL);
 
+        /*Continue from the start of the new animation and redraw only what differs from the current state*/
+        anim_info->anim_state = LV_BAR_ANIM_STATE_START;
+        inv_indic_change(obj, &indic_area_ori);
+
         lv_anim_t a;
         lv_anim_init(&a);
         lv_anim_set_var(&a, anim_info);
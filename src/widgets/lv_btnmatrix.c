@@ -25,6 +25,9 @@
 #define BTN_EXTRA_CLICK_AREA_MAX (LV_DPI_DEF / 10)
 #define LV_BTNMATRIX_WIDTH_MASK 0x0007
 
+/*Number of cached draw descriptors: default, checked, and e.g. pressed*/
+#define DSC_CACHE_CNT   3
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -36,6 +39,10 @@ static void lv_btnmatrix_constructor(const lv_obj_class_t * class_p, lv_obj_t *
 static void lv_btnmatrix_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void lv_btnmatrix_event(const lv_obj_class_t * class_p, lv_event_t * e);
 static void draw_main(lv_event_t * e);
+static void get_btn_draw_dsc(lv_obj_t * obj, lv_state_t state, lv_draw_rect_dsc_t * rect_dsc,
+                             lv_draw_label_dsc_t * label_dsc);
+static lv_coord_t get_btn_ext_draw_size(const lv_draw_rect_dsc_t * rect_dsc);
+static void reset_caches(lv_obj_t * obj);
 
 static uint8_t get_button_width(lv_btnmatrix_ctrl_t ctrl_bits);
 static bool button_is_hidden(lv_btnmatrix_ctrl_t ctrl_bits);
@@ -67,6 +74,7 @@ const lv_obj_class_t lv_btnmatrix_class = {
     .instance_size = sizeof(lv_btnmatrix_t),
     .editable = LV_OBJ_CLASS_EDITABLE_TRUE,
     .group_def = LV_OBJ_CLASS_GROUP_DEF_TRUE,
+    .items_state_self = 1,
     .base_class = &lv_obj_class
 };
 
@@ -100,6 +108,7 @@ void lv_btnmatrix_set_map(lv_obj_t * obj, const char * map[])
     /*Analyze the map and create the required number of buttons*/
     allocate_btn_areas_and_controls(obj, map);
     btnm->map_p = map;
+    reset_caches(obj);
 
     lv_base_dir_t base_dir = lv_obj_get_style_base_dir(obj, LV_PART_MAIN);
 
@@ -216,7 +225,12 @@ void lv_btnmatrix_set_btn_ctrl(lv_obj_t * obj, uint16_t btn_id, lv_btnmatrix_ctr
         lv_btnmatrix_clear_btn_ctrl_all(obj, LV_BTNMATRIX_CTRL_CHECKED);
     }
 
+    /*Redraw only if something has changed*/
+    lv_btnmatrix_ctrl_t ctrl_ori = btnm->ctrl_bits[btn_id];
     btnm->ctrl_bits[btn_id] |= ctrl;
+    if(btnm->ctrl_bits[btn_id] == ctrl_ori) return;
+
+    if(ctrl & LV_BTNMATRIX_CTRL_RECOLOR) btnm->txt_sizes[btn_id].x = -1;
     invalidate_button_area(obj, btn_id);
 
     if(ctrl & LV_BTNMATRIX_CTRL_POPOVER) {
@@ -232,7 +246,12 @@ void lv_btnmatrix_clear_btn_ctrl(lv_obj_t * obj, uint16_t btn_id, lv_btnmatrix_c
 
     if(btn_id >= btnm->btn_cnt) return;
 
+    /*Redraw only if something has changed*/
+    lv_btnmatrix_ctrl_t ctrl_ori = btnm->ctrl_bits[btn_id];
     btnm->ctrl_bits[btn_id] &= (~ctrl);
+    if(btnm->ctrl_bits[btn_id] == ctrl_ori) return;
+
+    if(ctrl & LV_BTNMATRIX_CTRL_RECOLOR) btnm->txt_sizes[btn_id].x = -1;
     invalidate_button_area(obj, btn_id);
 
     if(ctrl & LV_BTNMATRIX_CTRL_POPOVER) {
@@ -363,9 +382,14 @@ static void lv_btnmatrix_constructor(const lv_obj_class_t * class_p, lv_obj_t *
     btnm->btn_id_sel     = LV_BTNMATRIX_BTN_NONE;
     btnm->button_areas   = NULL;
     btnm->ctrl_bits      = NULL;
+    btnm->txt_sizes      = NULL;
     btnm->map_p          = NULL;
     btnm->one_check      = 0;
 
+    btnm->dsc_cache = lv_mem_alloc(sizeof(lv_btnmatrix_dsc_cache_t) * DSC_CACHE_CNT);
+    LV_ASSERT_MALLOC(btnm->dsc_cache);
+    if(btnm->dsc_cache) lv_memset_00(btnm->dsc_cache, sizeof(lv_btnmatrix_dsc_cache_t) * DSC_CACHE_CNT);
+
     lv_btnmatrix_set_map(obj, lv_btnmatrix_def_map);
 
     LV_TRACE_OBJ_CREATE("finished");
@@ -378,8 +402,12 @@ static void lv_btnmatrix_destructor(const lv_obj_class_t * class_p, lv_obj_t * o
     lv_btnmatrix_t * btnm = (lv_btnmatrix_t *)obj;
     lv_mem_free(btnm->button_areas);
     lv_mem_free(btnm->ctrl_bits);
+    lv_mem_free(btnm->txt_sizes);
+    lv_mem_free(btnm->dsc_cache);
     btnm->button_areas = NULL;
     btnm->ctrl_bits = NULL;
+    btnm->txt_sizes = NULL;
+    btnm->dsc_cache = NULL;
     LV_TRACE_OBJ_CREATE("finished");
 }
 
@@ -551,6 +579,9 @@ static void lv_btnmatrix_event(const lv_obj_class_t * class_p, lv_event_t * e)
                 btnm->btn_id_sel = LV_BTNMATRIX_BTN_NONE;
             }
         }
+
+        /*The focused state is shown only on the selected button*/
+        invalidate_button_area(obj, btnm->btn_id_sel);
     }
     else if(code == LV_EVENT_DEFOCUSED || code == LV_EVENT_LEAVE) {
         if(btnm->btn_id_sel != LV_BTNMATRIX_BTN_NONE) invalidate_button_area(obj, btnm->btn_id_sel);
@@ -653,7 +684,9 @@ static void draw_main(lv_event_t * e)
     if(btnm->btn_cnt == 0) return;
 
     lv_draw_ctx_t * draw_ctx = lv_event_get_draw_ctx(e);
-    obj->skip_trans = 1;
+
+    /*The cached descriptors and text sizes might be outdated if any style has changed*/
+    if(btnm->cache_style_cnt != _lv_obj_style_get_refr_cnt()) reset_caches(obj);
 
     lv_area_t area_obj;
     lv_obj_get_coords(obj, &area_obj);
@@ -668,16 +701,9 @@ static void draw_main(lv_event_t * e)
 
     lv_draw_rect_dsc_t draw_rect_dsc_def;
     lv_draw_label_dsc_t draw_label_dsc_def;
+    get_btn_draw_dsc(obj, LV_STATE_DEFAULT, &draw_rect_dsc_def, &draw_label_dsc_def);
 
     lv_state_t state_ori = obj->state;
-    obj->state = LV_STATE_DEFAULT;
-    obj->skip_trans = 1;
-    lv_draw_rect_dsc_init(&draw_rect_dsc_def);
-    lv_draw_label_dsc_init(&draw_label_dsc_def);
-    lv_obj_init_draw_rect_dsc(obj, LV_PART_ITEMS, &draw_rect_dsc_def);
-    lv_obj_init_draw_label_dsc(obj, LV_PART_ITEMS, &draw_label_dsc_def);
-    obj->skip_trans = 0;
-    obj->state = state_ori;
 
     lv_coord_t ptop = lv_obj_get_style_pad_top(obj, LV_PART_MAIN);
     lv_coord_t pbottom = lv_obj_get_style_pad_bottom(obj, LV_PART_MAIN);
@@ -730,18 +756,21 @@ static void draw_main(lv_event_t * e)
             lv_memcpy(&draw_rect_dsc_act, &draw_rect_dsc_def, sizeof(lv_draw_rect_dsc_t));
             lv_memcpy(&draw_label_dsc_act, &draw_label_dsc_def, sizeof(lv_draw_label_dsc_t));
         }
-        /*In other cases get the styles directly without caching them*/
         else {
-            obj->state = btn_state;
-            obj->skip_trans = 1;
-            lv_draw_rect_dsc_init(&draw_rect_dsc_act);
-            lv_draw_label_dsc_init(&draw_label_dsc_act);
-            lv_obj_init_draw_rect_dsc(obj, LV_PART_ITEMS, &draw_rect_dsc_act);
-            lv_obj_init_draw_label_dsc(obj, LV_PART_ITEMS, &draw_label_dsc_act);
-            obj->state = state_ori;
-            obj->skip_trans = 0;
+            get_btn_draw_dsc(obj, btn_state, &draw_rect_dsc_act, &draw_label_dsc_act);
         }
 
+        lv_coord_t btn_height = lv_area_get_height(&btn_area);
+        bool popover = (btn_state & LV_STATE_PRESSED) && (btnm->ctrl_bits[btn_i] & LV_BTNMATRIX_CTRL_POPOVER);
+
+        /*Skip the buttons which are out of the clip area*/
+        lv_area_t draw_area;
+        lv_area_copy(&draw_area, &btn_area);
+        if(popover) draw_area.y1 -= btn_height;
+        lv_coord_t ext_size = get_btn_ext_draw_size(&draw_rect_dsc_act);
+        lv_area_increase(&draw_area, ext_size, ext_size);
+        if(_lv_area_is_on(&draw_area, draw_ctx->clip_area) == false) continue;
+
         bool recolor = button_is_recolor(btnm->ctrl_bits[btn_i]);
         if(recolor) draw_label_dsc_act.flag |= LV_TEXT_FLAG_RECOLOR;
         else draw_label_dsc_act.flag &= ~LV_TEXT_FLAG_RECOLOR;
@@ -760,9 +789,7 @@ static void draw_main(lv_event_t * e)
             if(btn_area.y2 == obj->coords.y2 - pbottom) draw_rect_dsc_act.border_side &= ~LV_BORDER_SIDE_BOTTOM;
         }
 
-        lv_coord_t btn_height = lv_area_get_height(&btn_area);
-
-        if((btn_state & LV_STATE_PRESSED) && (btnm->ctrl_bits[btn_i] & LV_BTNMATRIX_CTRL_POPOVER)) {
+        if(popover) {
             /*Push up the upper boundary of the btn area to create the popover*/
             btn_area.y1 -= btn_height;
         }
@@ -784,16 +811,25 @@ static void draw_main(lv_event_t * e)
             txt = txt_ap;
         }
 #endif
+        /*The cached size is valid only with the default text properties*/
         lv_point_t txt_size;
-        lv_txt_get_size(&txt_size, txt, font, letter_space,
-                        line_space, lv_area_get_width(&area_obj), draw_label_dsc_act.flag);
+        bool def_txt = font == draw_label_dsc_def.font && letter_space == draw_label_dsc_def.letter_space &&
+                       line_space == draw_label_dsc_def.line_space;
+        if(def_txt && btnm->txt_sizes[btn_i].x >= 0) {
+            txt_size = btnm->txt_sizes[btn_i];
+        }
+        else {
+            lv_txt_get_size(&txt_size, txt, font, letter_space,
+                            line_space, lv_area_get_width(&area_obj), draw_label_dsc_act.flag);
+            if(def_txt) btnm->txt_sizes[btn_i] = txt_size;
+        }
 
         btn_area.x1 += (lv_area_get_width(&btn_area) - txt_size.x) / 2;
         btn_area.y1 += (lv_area_get_height(&btn_area) - txt_size.y) / 2;
         btn_area.x2 = btn_area.x1 + txt_size.x;
         btn_area.y2 = btn_area.y1 + txt_size.y;
 
-        if((btn_state & LV_STATE_PRESSED) && (btnm->ctrl_bits[btn_i] & LV_BTNMATRIX_CTRL_POPOVER)) {
+        if(popover) {
             /*Push up the button text into the popover*/
             btn_area.y1 -= btn_height / 2;
             btn_area.y2 -= btn_height / 2;
@@ -805,11 +841,103 @@ static void draw_main(lv_event_t * e)
         lv_event_send(obj, LV_EVENT_DRAW_PART_END, &part_draw_dsc);
     }
 
-    obj->skip_trans = 0;
 #if LV_USE_ARABIC_PERSIAN_CHARS
     lv_mem_buf_release(txt_ap);
 #endif
 }
+
+/**
+ * Get the draw descriptors of the buttons in a given state.
+ * The descriptors are cached until any style changes.
+ * @param obj       pointer to a button matrix object
+ * @param state     state of the button
+ * @param rect_dsc  store the rectangle descriptor here
+ * @param label_dsc store the label descriptor here
+ */
+static void get_btn_draw_dsc(lv_obj_t * obj, lv_state_t state, lv_draw_rect_dsc_t * rect_dsc,
+                             lv_draw_label_dsc_t * label_dsc)
+{
+    lv_btnmatrix_t * btnm = (lv_btnmatrix_t *)obj;
+
+    /*The default state always has the first slot, the other states use the first free
+     *or the last slot*/
+    lv_btnmatrix_dsc_cache_t * cache = NULL;
+    if(btnm->dsc_cache) {
+        if(state == LV_STATE_DEFAULT) {
+            cache = &btnm->dsc_cache[0];
+        }
+        else {
+            uint32_t i;
+            for(i = 1; i < DSC_CACHE_CNT; i++) {
+                cache = &btnm->dsc_cache[i];
+                if(cache->valid == 0 || cache->state == state) break;
+            }
+        }
+
+        if(cache->valid && cache->state == state) {
+            lv_memcpy(rect_dsc, &cache->rect_dsc, sizeof(lv_draw_rect_dsc_t));
+            lv_memcpy(label_dsc, &cache->label_dsc, sizeof(lv_draw_label_dsc_t));
+            return;
+        }
+    }
+
+    lv_state_t state_ori = obj->state;
+    obj->state = state;
+    obj->skip_trans = 1;
+    lv_draw_rect_dsc_init(rect_dsc);
+    lv_draw_label_dsc_init(label_dsc);
+    lv_obj_init_draw_rect_dsc(obj, LV_PART_ITEMS, rect_dsc);
+    lv_obj_init_draw_label_dsc(obj, LV_PART_ITEMS, label_dsc);
+    obj->state = state_ori;
+    obj->skip_trans = 0;
+
+    if(cache) {
+        lv_memcpy(&cache->rect_dsc, rect_dsc, sizeof(lv_draw_rect_dsc_t));
+        lv_memcpy(&cache->label_dsc, label_dsc, sizeof(lv_draw_label_dsc_t));
+        cache->state = state;
+        cache->valid = 1;
+    }
+}
+
+/**
+ * Get how much a button's drawing can be larger than its area due to shadow and outline
+ * @param rect_dsc  the rectangle descriptor of the button
+ * @return          the extra size on each side
+ */
+static lv_coord_t get_btn_ext_draw_size(const lv_draw_rect_dsc_t * rect_dsc)
+{
+    lv_coord_t s = 0;
+    if(rect_dsc->outline_width && rect_dsc->outline_opa > LV_OPA_MIN) {
+        s = LV_MAX(s, rect_dsc->outline_width + rect_dsc->outline_pad);
+    }
+
+    if(rect_dsc->shadow_width && rect_dsc->shadow_opa > LV_OPA_MIN) {
+        lv_coord_t sh = rect_dsc->shadow_width / 2 + 1 + rect_dsc->shadow_spread;
+        sh += LV_MAX(LV_ABS(rect_dsc->shadow_ofs_x), LV_ABS(rect_dsc->shadow_ofs_y));
+        s = LV_MAX(s, sh);
+    }
+
+    return s;
+}
+
+/**
+ * Mark the cached text sizes and draw descriptors as outdated
+ * @param obj       pointer to a button matrix object
+ */
+static void reset_caches(lv_obj_t * obj)
+{
+    lv_btnmatrix_t * btnm = (lv_btnmatrix_t *)obj;
+
+    uint32_t i;
+    for(i = 0; i < btnm->btn_cnt; i++) btnm->txt_sizes[i].x = -1;
+
+    if(btnm->dsc_cache) {
+        for(i = 0; i < DSC_CACHE_CNT; i++) btnm->dsc_cache[i].valid = 0;
+    }
+
+    btnm->cache_style_cnt = _lv_obj_style_get_refr_cnt();
+}
+
 /**
  * Create the required number of buttons and control bytes according to a map
  * @param obj pointer to button matrix object
@@ -843,12 +971,18 @@ static void allocate_btn_areas_and_controls(const lv_obj_t * obj, const char **
         lv_mem_free(btnm->ctrl_bits);
         btnm->ctrl_bits = NULL;
     }
+    if(btnm->txt_sizes != NULL) {
+        lv_mem_free(btnm->txt_sizes);
+        btnm->txt_sizes = NULL;
+    }
 
     btnm->button_areas = lv_mem_alloc(sizeof(lv_area_t) * btn_cnt);
     LV_ASSERT_MALLOC(btnm->button_areas);
     btnm->ctrl_bits = lv_mem_alloc(sizeof(lv_btnmatrix_ctrl_t) * btn_cnt);
     LV_ASSERT_MALLOC(btnm->ctrl_bits);
-    if(btnm->button_areas == NULL || btnm->ctrl_bits == NULL) btn_cnt = 0;
+    btnm->txt_sizes = lv_mem_alloc(sizeof(lv_point_t) * btn_cnt);
+    LV_ASSERT_MALLOC(btnm->txt_sizes);
+    if(btnm->button_areas == NULL || btnm->ctrl_bits == NULL || btnm->txt_sizes == NULL) btn_cnt = 0;
 
     lv_memset_00(btnm->ctrl_bits, sizeof(lv_btnmatrix_ctrl_t) * btn_cnt);
 
@@ -51,12 +51,23 @@ typedef uint16_t lv_btnmatrix_ctrl_t;
 typedef bool (*lv_btnmatrix_btn_draw_cb_t)(lv_obj_t * btnm, uint32_t btn_id, const lv_area_t * draw_area,
                                            const lv_area_t * clip_area);
 
+/*Draw descriptors of the buttons in a given state, cached between the redraws*/
+typedef struct {
+    lv_draw_rect_dsc_t rect_dsc;
+    lv_draw_label_dsc_t label_dsc;
+    lv_state_t state;
+    uint8_t valid : 1;
+} lv_btnmatrix_dsc_cache_t;
+
 /*Data of button matrix*/
 typedef struct {
     lv_obj_t obj;
     const char ** map_p;                              /*Pointer to the current map*/
     lv_area_t * button_areas;                         /*Array of areas of buttons*/
     lv_btnmatrix_ctrl_t * ctrl_bits;                       /*Array of control bytes*/
+    lv_point_t * txt_sizes;                           /*Cached size of the button texts (x < 0: not calculated yet)*/
+    lv_btnmatrix_dsc_cache_t * dsc_cache;             /*Cached draw descriptors. The first is for the default state*/
+    uint32_t cache_style_cnt;                         /*Style refresh count when the caches were filled*/
     uint16_t btn_cnt;                                 /*Number of button in 'map_p'(Handled by the library)*/
     uint16_t row_cnt;                                 /*Number of rows in 'map_p'(Handled by the library)*/
     uint16_t btn_id_sel;    /*Index of the active button (being pressed/released etc) or LV_BTNMATRIX_BTN_NONE*/
@@ -92,6 +103,8 @@ lv_obj_t * lv_btnmatrix_create(lv_obj_t * parent);
  * Set a new map. Buttons will be created/deleted according to the map. The
  * button matrix keeps a reference to the map and so the string array must not
  * be deallocated during the life of the matrix.
+ * The size of the texts is cached, so if the texts of the map are modified in place
+ * this function needs to be called again with the same map.
  * @param obj       pointer to a button matrix object
  * @param map       pointer a string array. The last string has to be: "". Use "\n" to make a line break.
  */
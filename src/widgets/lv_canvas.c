@@ -24,14 +24,27 @@
 /**********************
  *      TYPEDEFS
  **********************/
+typedef struct _lv_canvas_session_t {
+    lv_draw_sw_ctx_t draw_ctx;  /*First to get the session from the draw context*/
+    lv_disp_t disp;             /*A dummy display to fool the lv_draw functions*/
+    lv_disp_drv_t drv;
+    lv_area_t clip_area;
+    lv_area_t inv_area;         /*The area changed in the session*/
+    lv_disp_t * refr_ori;
+    uint8_t inv : 1;            /*1: `inv_area` is valid*/
+    uint8_t single : 1;         /*1: the session was started for a single drawing*/
+} lv_canvas_session_t;
 
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static void lv_canvas_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void lv_canvas_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
-static void init_fake_disp(lv_obj_t * canvas, lv_disp_t * disp, lv_disp_drv_t * drv, lv_area_t * clip_area);
-static void deinit_fake_disp(lv_obj_t * canvas, lv_disp_t * disp);
+static lv_draw_ctx_t * draw_start(lv_obj_t * canvas);
+static void draw_finish(lv_obj_t * canvas);
+static void session_blend(lv_draw_ctx_t * draw_ctx, const lv_draw_sw_blend_dsc_t * dsc);
+static void invalidate_area(lv_obj_t * canvas, const lv_area_t * area);
+static void invalidate_session_area(lv_obj_t * canvas, const lv_area_t * area);
 
 /**********************
  *  STATIC VARIABLES
@@ -86,7 +99,9 @@ void lv_canvas_set_px_color(lv_obj_t * obj, lv_coord_t x, lv_coord_t y, lv_color
     lv_canvas_t * canvas = (lv_canvas_t *)obj;
 
     lv_img_buf_set_px_color(&canvas->dsc, x, y, c);
-    lv_obj_invalidate(obj);
+
+    lv_area_t a = {x, y, x, y};
+    invalidate_area(obj, &a);
 }
 
 void lv_canvas_set_px_opa(lv_obj_t * obj, lv_coord_t x, lv_coord_t y, lv_opa_t opa)
@@ -96,7 +111,9 @@ void lv_canvas_set_px_opa(lv_obj_t * obj, lv_coord_t x, lv_coord_t y, lv_opa_t o
     lv_canvas_t * canvas = (lv_canvas_t *)obj;
 
     lv_img_buf_set_px_alpha(&canvas->dsc, x, y, opa);
-    lv_obj_invalidate(obj);
+
+    lv_area_t a = {x, y, x, y};
+    invalidate_area(obj, &a);
 }
 
 void lv_canvas_set_palette(lv_obj_t * obj, uint8_t id, lv_color_t c)
@@ -106,7 +123,7 @@ void lv_canvas_set_palette(lv_obj_t * obj, uint8_t id, lv_color_t c)
     lv_canvas_t * canvas = (lv_canvas_t *)obj;
 
     lv_img_buf_set_palette(&canvas->dsc, id, c);
-    lv_obj_invalidate(obj);
+    invalidate_area(obj, NULL);
 }
 
 /*=====================
@@ -246,7 +263,7 @@ void lv_canvas_transform(lv_obj_t * obj, lv_img_dsc_t * img, int16_t angle, uint
         }
     }
 
-    lv_obj_invalidate(obj);
+    invalidate_area(obj, NULL);
 #else
     LV_UNUSED(obj);
     LV_UNUSED(img);
@@ -384,7 +401,7 @@ void lv_canvas_blur_hor(lv_obj_t * obj, const lv_area_t * area, uint16_t r)
             if(has_alpha) asum += opa;
         }
     }
-    lv_obj_invalidate(obj);
+    invalidate_area(obj, NULL);
 
     lv_mem_buf_release(line_buf);
 }
@@ -517,11 +534,54 @@ void lv_canvas_blur_ver(lv_obj_t * obj, const lv_area_t * area, uint16_t r)
         }
     }
 
-    lv_obj_invalidate(obj);
+    invalidate_area(obj, NULL);
 
     lv_mem_buf_release(col_buf);
 }
 
+void lv_canvas_draw_begin(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_canvas_t * canvas = (lv_canvas_t *)obj;
+    if(canvas->session) {
+        LV_LOG_WARN("lv_canvas_draw_begin: the drawing session is already started");
+        return;
+    }
+
+    lv_canvas_session_t * session = lv_mem_alloc(sizeof(lv_canvas_session_t));
+    LV_ASSERT_MALLOC(session);
+    if(session == NULL) return;
+    lv_memset_00(session, sizeof(lv_canvas_session_t));
+
+    session->disp.driver = &session->drv;
+    lv_disp_drv_init(&session->drv);
+    lv_draw_sw_init_ctx(&session->drv, &session->draw_ctx.base_draw);
+    session->draw_ctx.blend = session_blend;
+    session->drv.draw_ctx = &session->draw_ctx.base_draw;
+
+    canvas->session = session;
+}
+
+void lv_canvas_draw_end(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_canvas_t * canvas = (lv_canvas_t *)obj;
+    lv_canvas_session_t * session = canvas->session;
+    if(session == NULL) return;
+
+    canvas->session = NULL;
+    if(session->inv) {
+        /*Single calls invalidate the whole canvas to not fill the invalidation buffer of the display in loops*/
+        if(session->single) lv_obj_invalidate(obj);
+        else invalidate_session_area(obj, &session->inv_area);
+    }
+
+    lv_draw_sw_deinit_ctx(&session->drv, &session->draw_ctx.base_draw);
+    lv_mem_free(session);
+}
+
 void lv_canvas_fill_bg(lv_obj_t * canvas, lv_color_t color, lv_opa_t opa)
 {
     LV_ASSERT_OBJ(canvas, MY_CLASS);
@@ -548,7 +608,7 @@ void lv_canvas_fill_bg(lv_obj_t * canvas, lv_color_t color, lv_opa_t opa)
         }
     }
 
-    lv_obj_invalidate(canvas);
+    invalidate_area(canvas, NULL);
 }
 
 void lv_canvas_draw_rect(lv_obj_t * canvas, lv_coord_t x, lv_coord_t y, lv_coord_t w, lv_coord_t h,
@@ -563,21 +623,14 @@ void lv_canvas_draw_rect(lv_obj_t * canvas, lv_coord_t x, lv_coord_t y, lv_coord
         return;
     }
 
-    /*Create a dummy display to fool the lv_draw function.
-     *It will think it draws to real screen.*/
-    lv_disp_t fake_disp;
-    lv_disp_drv_t driver;
-    lv_area_t clip_area;
-    init_fake_disp(canvas, &fake_disp, &driver, &clip_area);
-
-    lv_disp_t * refr_ori = _lv_refr_get_disp_refreshing();
-    _lv_refr_set_disp_refreshing(&fake_disp);
+    lv_draw_ctx_t * draw_ctx = draw_start(canvas);
+    if(draw_ctx == NULL) return;
 
     /*Disable anti-aliasing if drawing with transparent color to chroma keyed canvas*/
     lv_color_t ctransp = LV_COLOR_CHROMA_KEY;
     if(dsc->header.cf == LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED &&
        draw_dsc->bg_color.full == ctransp.full) {
-        fake_disp.driver->antialiasing = 0;
+        ((lv_canvas_t *)canvas)->session->drv.antialiasing = 0;
     }
 
     lv_area_t coords;
@@ -586,13 +639,9 @@ void lv_canvas_draw_rect(lv_obj_t * canvas, lv_coord_t x, lv_coord_t y, lv_coord
     coords.x2 = x + w - 1;
     coords.y2 = y + h - 1;
 
-    lv_draw_rect(driver.draw_ctx, draw_dsc, &coords);
-
-    _lv_refr_set_disp_refreshing(refr_ori);
-
-    deinit_fake_disp(canvas, &fake_disp);
+    lv_draw_rect(draw_ctx, draw_dsc, &coords);
 
-    lv_obj_invalidate(canvas);
+    draw_finish(canvas);
 }
 
 void lv_canvas_draw_text(lv_obj_t * canvas, lv_coord_t x, lv_coord_t y, lv_coord_t max_w,
@@ -607,28 +656,17 @@ void lv_canvas_draw_text(lv_obj_t * canvas, lv_coord_t x, lv_coord_t y, lv_coord
         return;
     }
 
-    /*Create a dummy display to fool the lv_draw function.
-     *It will think it draws to real screen.*/
-    lv_disp_t fake_disp;
-    lv_disp_drv_t driver;
-    lv_area_t clip_area;
-    init_fake_disp(canvas, &fake_disp, &driver, &clip_area);
-
-    lv_disp_t * refr_ori = _lv_refr_get_disp_refreshing();
-    _lv_refr_set_disp_refreshing(&fake_disp);
+    lv_draw_ctx_t * draw_ctx = draw_start(canvas);
+    if(draw_ctx == NULL) return;
 
     lv_area_t coords;
     coords.x1 = x;
     coords.y1 = y;
     coords.x2 = x + max_w - 1;
     coords.y2 = dsc->header.h - 1;
-    lv_draw_label(driver.draw_ctx, draw_dsc, &coords, txt, NULL);
-
-    _lv_refr_set_disp_refreshing(refr_ori);
+    lv_draw_label(draw_ctx, draw_dsc, &coords, txt, NULL);
 
-    deinit_fake_disp(canvas, &fake_disp);
-
-    lv_obj_invalidate(canvas);
+    draw_finish(canvas);
 }
 
 void lv_canvas_draw_img(lv_obj_t * canvas, lv_coord_t x, lv_coord_t y, const void * src,
@@ -649,15 +687,8 @@ void lv_canvas_draw_img(lv_obj_t * canvas, lv_coord_t x, lv_coord_t y, const voi
         LV_LOG_WARN("lv_canvas_draw_img: Couldn't get the image data.");
         return;
     }
-    /*Create a dummy display to fool the lv_draw function.
-     *It will think it draws to real screen.*/
-    lv_disp_t fake_disp;
-    lv_disp_drv_t driver;
-    lv_area_t clip_area;
-    init_fake_disp(canvas, &fake_disp, &driver, &clip_area);
-
-    lv_disp_t * refr_ori = _lv_refr_get_disp_refreshing();
-    _lv_refr_set_disp_refreshing(&fake_disp);
+    lv_draw_ctx_t * draw_ctx = draw_start(canvas);
+    if(draw_ctx == NULL) return;
 
     lv_area_t coords;
     coords.x1 = x;
@@ -665,13 +696,9 @@ void lv_canvas_draw_img(lv_obj_t * canvas, lv_coord_t x, lv_coord_t y, const voi
     coords.x2 = x + header.w - 1;
     coords.y2 = y + header.h - 1;
 
-    lv_draw_img(driver.draw_ctx, draw_dsc, &coords, src);
-
-    _lv_refr_set_disp_refreshing(refr_ori);
-
-    deinit_fake_disp(canvas, &fake_disp);
+    lv_draw_img(draw_ctx, draw_dsc, &coords, src);
 
-    lv_obj_invalidate(canvas);
+    draw_finish(canvas);
 }
 
 void lv_canvas_draw_line(lv_obj_t * canvas, const lv_point_t points[], uint32_t point_cnt,
@@ -686,34 +713,22 @@ void lv_canvas_draw_line(lv_obj_t * canvas, const lv_point_t points[], uint32_t
         return;
     }
 
-    /*Create a dummy display to fool the lv_draw function.
-     *It will think it draws to real screen.*/
-    lv_disp_t fake_disp;
-    lv_disp_drv_t driver;
-    lv_area_t clip_area;
-    init_fake_disp(canvas, &fake_disp, &driver, &clip_area);
-
-    lv_disp_t * refr_ori = _lv_refr_get_disp_refreshing();
-    _lv_refr_set_disp_refreshing(&fake_disp);
-
+    lv_draw_ctx_t * draw_ctx = draw_start(canvas);
+    if(draw_ctx == NULL) return;
 
     /*Disable anti-aliasing if drawing with transparent color to chroma keyed canvas*/
     lv_color_t ctransp = LV_COLOR_CHROMA_KEY;
     if(dsc->header.cf == LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED &&
        draw_dsc->color.full == ctransp.full) {
-        fake_disp.driver->antialiasing = 0;
+        ((lv_canvas_t *)canvas)->session->drv.antialiasing = 0;
     }
 
     uint32_t i;
     for(i = 0; i < point_cnt - 1; i++) {
-        lv_draw_line(driver.draw_ctx, draw_dsc, &points[i], &points[i + 1]);
+        lv_draw_line(draw_ctx, draw_dsc, &points[i], &points[i + 1]);
     }
 
-    _lv_refr_set_disp_refreshing(refr_ori);
-
-    deinit_fake_disp(canvas, &fake_disp);
-
-    lv_obj_invalidate(canvas);
+    draw_finish(canvas);
 }
 
 void lv_canvas_draw_polygon(lv_obj_t * canvas, const lv_point_t points[], uint32_t point_cnt,
@@ -728,30 +743,19 @@ void lv_canvas_draw_polygon(lv_obj_t * canvas, const lv_point_t points[], uint32
         return;
     }
 
-    /*Create a dummy display to fool the lv_draw function.
-     *It will think it draws to real screen.*/
-    lv_disp_t fake_disp;
-    lv_disp_drv_t driver;
-    lv_area_t clip_area;
-    init_fake_disp(canvas, &fake_disp, &driver, &clip_area);
-
-    lv_disp_t * refr_ori = _lv_refr_get_disp_refreshing();
-    _lv_refr_set_disp_refreshing(&fake_disp);
+    lv_draw_ctx_t * draw_ctx = draw_start(canvas);
+    if(draw_ctx == NULL) return;
 
     /*Disable anti-aliasing if drawing with transparent color to chroma keyed canvas*/
     lv_color_t ctransp = LV_COLOR_CHROMA_KEY;
     if(dsc->header.cf == LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED &&
        draw_dsc->bg_color.full == ctransp.full) {
-        fake_disp.driver->antialiasing = 0;
+        ((lv_canvas_t *)canvas)->session->drv.antialiasing = 0;
     }
 
-    lv_draw_polygon(driver.draw_ctx, draw_dsc, points, point_cnt);
+    lv_draw_polygon(draw_ctx, draw_dsc, points, point_cnt);
 
-    _lv_refr_set_disp_refreshing(refr_ori);
-
-    deinit_fake_disp(canvas, &fake_disp);
-
-    lv_obj_invalidate(canvas);
+    draw_finish(canvas);
 }
 
 void lv_canvas_draw_arc(lv_obj_t * canvas, lv_coord_t x, lv_coord_t y, lv_coord_t r, int32_t start_angle,
@@ -767,24 +771,13 @@ void lv_canvas_draw_arc(lv_obj_t * canvas, lv_coord_t x, lv_coord_t y, lv_coord_
         return;
     }
 
-    /*Create a dummy display to fool the lv_draw function.
-     *It will think it draws to real screen.*/
-    lv_disp_t fake_disp;
-    lv_disp_drv_t driver;
-    lv_area_t clip_area;
-    init_fake_disp(canvas, &fake_disp, &driver, &clip_area);
-
-    lv_disp_t * refr_ori = _lv_refr_get_disp_refreshing();
-    _lv_refr_set_disp_refreshing(&fake_disp);
+    lv_draw_ctx_t * draw_ctx = draw_start(canvas);
+    if(draw_ctx == NULL) return;
 
     lv_point_t p = {x, y};
-    lv_draw_arc(driver.draw_ctx, draw_dsc, &p, r,  start_angle, end_angle);
-
-    _lv_refr_set_disp_refreshing(refr_ori);
+    lv_draw_arc(draw_ctx, draw_dsc, &p, r,  start_angle, end_angle);
 
-    deinit_fake_disp(canvas, &fake_disp);
-
-    lv_obj_invalidate(canvas);
+    draw_finish(canvas);
 #else
     LV_UNUSED(canvas);
     LV_UNUSED(x);
@@ -827,45 +820,127 @@ static void lv_canvas_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
 
     lv_canvas_t * canvas = (lv_canvas_t *)obj;
     lv_img_cache_invalidate_src(&canvas->dsc);
+
+    if(canvas->session) {
+        lv_draw_sw_deinit_ctx(&canvas->session->drv, &canvas->session->draw_ctx.base_draw);
+        lv_mem_free(canvas->session);
+        canvas->session = NULL;
+    }
 }
 
 
-static void init_fake_disp(lv_obj_t * canvas, lv_disp_t * disp, lv_disp_drv_t * drv, lv_area_t * clip_area)
+/**
+ * Get the draw context of the drawing session. Start a session for this call if there is none.
+ * @param canvas    pointer to a canvas object
+ * @return          the draw context or NULL on error
+ */
+static lv_draw_ctx_t * draw_start(lv_obj_t * canvas)
 {
-    lv_img_dsc_t * dsc = lv_canvas_get_img(canvas);
+    lv_canvas_t * c = (lv_canvas_t *)canvas;
+    if(c->session == NULL) {
+        lv_canvas_draw_begin(canvas);
+        if(c->session == NULL) return NULL;
+        c->session->single = 1;
+    }
 
-    clip_area->x1 = 0;
-    clip_area->x2 = dsc->header.w - 1;
-    clip_area->y1 = 0;
-    clip_area->y2 = dsc->header.h - 1;
-
-    /*Allocate the fake driver on the stack as the entire display doesn't outlive this function*/
-    lv_memset_00(disp, sizeof(lv_disp_t));
-    disp->driver = drv;
-
-    lv_disp_drv_init(disp->driver);
-    disp->driver->hor_res = dsc->header.w;
-    disp->driver->ver_res = dsc->header.h;
-
-    lv_draw_ctx_t * draw_ctx = lv_mem_alloc(sizeof(lv_draw_sw_ctx_t));
-    LV_ASSERT_MALLOC(draw_ctx);
-    if(draw_ctx == NULL)  return;
-    lv_draw_sw_init_ctx(drv, draw_ctx);
-    disp->driver->draw_ctx = draw_ctx;
-    draw_ctx->clip_area = clip_area;
-    draw_ctx->buf_area = clip_area;
+    /*The buffer might be changed since the last call*/
+    lv_canvas_session_t * session = c->session;
+    lv_img_dsc_t * dsc = &c->dsc;
+    session->clip_area.x1 = 0;
+    session->clip_area.y1 = 0;
+    session->clip_area.x2 = dsc->header.w - 1;
+    session->clip_area.y2 = dsc->header.h - 1;
+    session->drv.hor_res = dsc->header.w;
+    session->drv.ver_res = dsc->header.h;
+    session->drv.antialiasing = LV_COLOR_DEPTH > 8 ? 1 : 0;
+    lv_disp_drv_use_generic_set_px_cb(&session->drv, dsc->header.cf);
+
+    lv_draw_ctx_t * draw_ctx = &session->draw_ctx.base_draw;
+    draw_ctx->clip_area = &session->clip_area;
+    draw_ctx->buf_area = &session->clip_area;
     draw_ctx->buf = (void *)dsc->data;
 
-    lv_disp_drv_use_generic_set_px_cb(disp->driver, dsc->header.cf);
+    /*Make the draw functions think they draw to a real screen*/
+    session->refr_ori = _lv_refr_get_disp_refreshing();
+    _lv_refr_set_disp_refreshing(&session->disp);
+
+    return draw_ctx;
 }
 
-static void deinit_fake_disp(lv_obj_t * canvas, lv_disp_t * disp)
+static void draw_finish(lv_obj_t * canvas)
 {
-    LV_UNUSED(canvas);
-    lv_draw_sw_deinit_ctx(disp->driver, disp->driver->draw_ctx);
-    lv_mem_free(disp->driver->draw_ctx);
+    lv_canvas_session_t * session = ((lv_canvas_t *)canvas)->session;
+    _lv_refr_set_disp_refreshing(session->refr_ori);
+
+    if(session->single) lv_canvas_draw_end(canvas);
+}
+
+/**
+ * Collect the changed areas while blending
+ */
+static void session_blend(lv_draw_ctx_t * draw_ctx, const lv_draw_sw_blend_dsc_t * dsc)
+{
+    lv_canvas_session_t * session = (lv_canvas_session_t *)draw_ctx;
+
+    lv_area_t blend_area;
+    if(_lv_area_intersect(&blend_area, dsc->blend_area, draw_ctx->clip_area)) {
+        if(session->inv) _lv_area_join(&session->inv_area, &session->inv_area, &blend_area);
+        else lv_area_copy(&session->inv_area, &blend_area);
+        session->inv = 1;
+    }
+
+    lv_draw_sw_blend_basic(draw_ctx, dsc);
+}
+
+/**
+ * Collect the changed area if a drawing session is active, else invalidate the whole canvas.
+ * The areas of the calls out of a session are not invalidated one by one because many small areas
+ * (e.g. setting pixels in a loop) would fill the invalidation buffer of the display and redraw the whole screen.
+ * @param canvas    pointer to a canvas object
+ * @param area      area on the canvas' buffer. NULL to invalidate the whole canvas.
+ */
+static void invalidate_area(lv_obj_t * canvas, const lv_area_t * area)
+{
+    lv_canvas_t * c = (lv_canvas_t *)canvas;
+    if(c->session == NULL) {
+        lv_obj_invalidate(canvas);
+        return;
+    }
+
+    lv_area_t full = {0, 0, c->dsc.header.w - 1, c->dsc.header.h - 1};
+    if(area == NULL) area = &full;
+
+    if(c->session->inv) _lv_area_join(&c->session->inv_area, &c->session->inv_area, area);
+    else lv_area_copy(&c->session->inv_area, area);
+    c->session->inv = 1;
 }
 
+/**
+ * Invalidate the area changed in a drawing session
+ * @param canvas    pointer to a canvas object
+ * @param area      area on the canvas' buffer
+ */
+static void invalidate_session_area(lv_obj_t * canvas, const lv_area_t * area)
+{
+    lv_canvas_t * c = (lv_canvas_t *)canvas;
+
+    /*Only the plain case is mapped. Transformed, shifted or tiled images are invalidated entirely.*/
+    lv_img_t * img = &c->img;
+    if(img->angle != 0 || img->zoom != LV_IMG_ZOOM_NONE || img->offset.x != 0 || img->offset.y != 0 ||
+       lv_obj_get_style_transform_angle(canvas, LV_PART_MAIN) != 0 ||
+       lv_obj_get_style_transform_zoom(canvas, LV_PART_MAIN) != LV_IMG_ZOOM_NONE ||
+       lv_obj_get_content_width(canvas) != img->w || lv_obj_get_content_height(canvas) != img->h) {
+        lv_obj_invalidate(canvas);
+        return;
+    }
+
+    lv_area_t content;
+    lv_obj_get_content_coords(canvas, &content);
 
+    lv_area_t a;
+    lv_area_copy(&a, area);
+    lv_area_move(&a, content.x1, content.y1);
+    lv_obj_invalidate_area(canvas, &a);
+}
 
 #endif
@@ -30,10 +30,13 @@ extern "C" {
  **********************/
 extern const lv_obj_class_t lv_canvas_class;
 
+struct _lv_canvas_session_t;
+
 /*Data of canvas*/
 typedef struct {
     lv_img_t img;
     lv_img_dsc_t dsc;
+    struct _lv_canvas_session_t * session;  /*Not NULL between `lv_canvas_draw_begin/end()`*/
 } lv_canvas_t;
 
 /**********************
@@ -176,6 +179,19 @@ void lv_canvas_blur_hor(lv_obj_t * canvas, const lv_area_t * area, uint16_t r);
  */
 void lv_canvas_blur_ver(lv_obj_t * canvas, const lv_area_t * area, uint16_t r);
 
+/**
+ * Start a drawing session. Until `lv_canvas_draw_end()` the drawing functions use the same
+ * draw context and the canvas is not invalidated. Use it to draw many things at once.
+ * @param canvas pointer to a canvas object
+ */
+void lv_canvas_draw_begin(lv_obj_t * canvas);
+
+/**
+ * End the drawing session and invalidate the area changed since `lv_canvas_draw_begin()`
+ * @param canvas pointer to a canvas object
+ */
+void lv_canvas_draw_end(lv_obj_t * canvas);
+
 /**
  * Fill the canvas with color
  * @param canvas pointer to a canvas
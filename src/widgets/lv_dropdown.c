@@ -53,6 +53,7 @@ static lv_res_t btn_release_handler(lv_obj_t * obj);
 static lv_res_t list_release_handler(lv_obj_t * list_obj);
 static void list_press_handler(lv_obj_t * page);
 static uint16_t get_id_on_point(lv_obj_t * dropdown_obj, lv_coord_t y);
+static void index_options(lv_obj_t * obj);
 static void position_to_selected(lv_obj_t * obj);
 static lv_obj_t * get_label(const lv_obj_t * obj);
 
@@ -118,13 +119,6 @@ void lv_dropdown_set_options(lv_obj_t * obj, const char * options)
 
     lv_dropdown_t * dropdown = (lv_dropdown_t *)obj;
 
-    /*Count the '\n'-s to determine the number of options*/
-    dropdown->option_cnt = 0;
-    uint32_t i;
-    for(i = 0; options[i] != '\0'; i++) {
-        if(options[i] == '\n') dropdown->option_cnt++;
-    }
-    dropdown->option_cnt++;   /*Last option has no `\n`*/
     dropdown->sel_opt_id      = 0;
     dropdown->sel_opt_id_orig = 0;
 
@@ -150,6 +144,7 @@ void lv_dropdown_set_options(lv_obj_t * obj, const char * options)
 #else
     _lv_txt_ap_proc(options, dropdown->options);
 #endif
+    index_options(obj);
 
     /*Now the text is dynamically allocated*/
     dropdown->static_txt = 0;
@@ -165,13 +160,6 @@ void lv_dropdown_set_options_static(lv_obj_t * obj, const char * options)
 
     lv_dropdown_t * dropdown = (lv_dropdown_t *)obj;
 
-    /*Count the '\n'-s to determine the number of options*/
-    dropdown->option_cnt = 0;
-    uint32_t i;
-    for(i = 0; options[i] != '\0'; i++) {
-        if(options[i] == '\n') dropdown->option_cnt++;
-    }
-    dropdown->option_cnt++;   /*Last option has no `\n`*/
     dropdown->sel_opt_id      = 0;
     dropdown->sel_opt_id_orig = 0;
 
@@ -182,6 +170,7 @@ void lv_dropdown_set_options_static(lv_obj_t * obj, const char * options)
 
     dropdown->static_txt = 1;
     dropdown->options = (char *)options;
+    index_options(obj);
 
     lv_obj_invalidate(obj);
     if(dropdown->list) lv_obj_invalidate(dropdown->list);
@@ -252,7 +241,7 @@ void lv_dropdown_add_option(lv_obj_t * obj, const char * option, uint32_t pos)
     _lv_txt_ins(dropdown->options, _lv_txt_encoded_get_char_id(dropdown->options, insert_pos), ins_buf);
     lv_mem_buf_release(ins_buf);
 
-    dropdown->option_cnt++;
+    index_options(obj);
 
     lv_obj_invalidate(obj);
     if(dropdown->list) lv_obj_invalidate(dropdown->list);
@@ -270,6 +259,8 @@ void lv_dropdown_clear_options(lv_obj_t * obj)
     dropdown->options = NULL;
     dropdown->static_txt = 0;
     dropdown->option_cnt = 0;
+    lv_mem_free(dropdown->opt_ofs);
+    dropdown->opt_ofs = NULL;
 
     lv_obj_invalidate(obj);
     if(dropdown->list) lv_obj_invalidate(dropdown->list);
@@ -370,29 +361,20 @@ void lv_dropdown_get_selected_str(const lv_obj_t * obj, char * buf, uint32_t buf
 
     lv_dropdown_t * dropdown = (lv_dropdown_t *)obj;
 
-    uint32_t i;
-    uint32_t line        = 0;
-    size_t txt_len;
-
-    if(dropdown->options)  {
-        txt_len     = strlen(dropdown->options);
-    }
-    else {
+    if(dropdown->options == NULL || dropdown->sel_opt_id_orig >= dropdown->option_cnt) {
         buf[0] = '\0';
         return;
     }
 
-    for(i = 0; i < txt_len && line != dropdown->sel_opt_id_orig; i++) {
-        if(dropdown->options[i] == '\n') line++;
-    }
+    const char * opt_txt = &dropdown->options[dropdown->opt_ofs[dropdown->sel_opt_id_orig]];
 
     uint32_t c;
-    for(c = 0; i < txt_len && dropdown->options[i] != '\n'; c++, i++) {
+    for(c = 0; opt_txt[c] != '\0' && opt_txt[c] != '\n'; c++) {
         if(buf_size && c >= buf_size - 1) {
             LV_LOG_WARN("lv_dropdown_get_selected_str: the buffer was too small");
             break;
         }
-        buf[c] = dropdown->options[i];
+        buf[c] = opt_txt[c];
     }
 
     buf[c] = '\0';
@@ -592,6 +574,7 @@ static void lv_dropdown_constructor(const lv_obj_class_t * class_p, lv_obj_t * o
     dropdown->sel_opt_id_orig = 0;
     dropdown->pr_opt_id = LV_DROPDOWN_PR_NONE;
     dropdown->option_cnt      = 0;
+    dropdown->opt_ofs = NULL;
     dropdown->dir = LV_DIR_BOTTOM;
 
     lv_obj_add_flag(obj, LV_OBJ_FLAG_SCROLL_ON_FOCUS);
@@ -618,6 +601,9 @@ static void lv_dropdown_destructor(const lv_obj_class_t * class_p, lv_obj_t * ob
         lv_mem_free(dropdown->options);
         dropdown->options = NULL;
     }
+
+    lv_mem_free(dropdown->opt_ofs);
+    dropdown->opt_ofs = NULL;
 }
 
 static void lv_dropdownlist_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
@@ -979,7 +965,7 @@ static void draw_box_label(lv_obj_t * dropdown_obj, lv_draw_ctx_t * draw_ctx, ui
                                                             LV_PART_SELECTED);  /*Line space should come from the list*/
 
     lv_obj_t * label = get_label(dropdown_obj);
-    if(label == NULL) return;
+    if(label == NULL || id >= dropdown->option_cnt) return;
 
     lv_coord_t font_h        = lv_font_get_line_height(label_dsc.font);
 
@@ -995,9 +981,16 @@ static void draw_box_label(lv_obj_t * dropdown_obj, lv_draw_ctx_t * draw_ctx, ui
     bool area_ok;
     area_ok = _lv_area_intersect(&mask_sel, draw_ctx->clip_area, &area_sel);
     if(area_ok) {
+        /*Draw only the text of this option from its own line*/
+        lv_area_t opt_area;
+        opt_area.x1 = label->coords.x1;
+        opt_area.x2 = label->coords.x2;
+        opt_area.y1 = area_sel.y1 + label_dsc.line_space / 2;
+        opt_area.y2 = label->coords.y2;
+
         const lv_area_t * clip_area_ori = draw_ctx->clip_area;
         draw_ctx->clip_area = &mask_sel;
-        lv_draw_label(draw_ctx, &label_dsc, &label->coords, lv_label_get_text(label), NULL);
+        lv_draw_label(draw_ctx, &label_dsc, &opt_area, &dropdown->options[dropdown->opt_ofs[id]], NULL);
         draw_ctx->clip_area = clip_area_ori;
     }
     list_obj->state = state_orig;
@@ -1112,6 +1105,38 @@ static uint16_t get_id_on_point(lv_obj_t * dropdown_obj, lv_coord_t y)
     return opt;
 }
 
+/**
+ * Count the options and save where they start in `options`
+ * @param obj pointer to a drop-down list object
+ */
+static void index_options(lv_obj_t * obj)
+{
+    lv_dropdown_t * dropdown = (lv_dropdown_t *)obj;
+
+    /*Count the '\n'-s to determine the number of options*/
+    const char * opts = dropdown->options;
+    uint32_t cnt = 1;   /*Last option has no `\n`*/
+    uint32_t i;
+    for(i = 0; opts[i] != '\0'; i++) {
+        if(opts[i] == '\n') cnt++;
+    }
+
+    lv_mem_free(dropdown->opt_ofs);
+    dropdown->opt_ofs = lv_mem_alloc(cnt * sizeof(uint32_t));
+    LV_ASSERT_MALLOC(dropdown->opt_ofs);
+    if(dropdown->opt_ofs == NULL) {
+        dropdown->option_cnt = 0;
+        return;
+    }
+
+    dropdown->option_cnt = cnt;
+    dropdown->opt_ofs[0] = 0;
+    cnt = 1;
+    for(i = 0; opts[i] != '\0'; i++) {
+        if(opts[i] == '\n') dropdown->opt_ofs[cnt++] = i + 1;
+    }
+}
+
 /**
  * Set the position of list when it is closed to show the selected item
  * @param ddlist pointer to a drop down list
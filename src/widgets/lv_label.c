@@ -17,6 +17,7 @@
 #include "../misc/lv_bidi.h"
 #include "../misc/lv_txt_ap.h"
 #include "../misc/lv_printf.h"
+#include "../core/lv_refr.h"
 
 /*********************
  *      DEFINES
@@ -31,6 +32,20 @@
 /**********************
  *      TYPEDEFS
  **********************/
+#if LV_LABEL_IMG_CACHE_SIZE
+/*The text of a label rendered to an image*/
+typedef struct _lv_label_img_cache_t {
+    lv_obj_t * obj;
+    lv_img_dsc_t img;
+    lv_area_t txt_area;             /*Area of the text on the image*/
+    lv_draw_label_dsc_t label_dsc;  /*The text was rendered with these parameters*/
+} lv_label_img_cache_t;
+
+typedef struct {
+    const lv_draw_label_dsc_t * label_dsc;
+    const lv_area_t * txt_coords;
+} img_cache_render_param_t;
+#endif
 
 /**********************
  *  STATIC PROTOTYPES
@@ -48,6 +63,13 @@ static char * lv_label_get_dot_tmp(lv_obj_t * label);
 static void lv_label_dot_tmp_free(lv_obj_t * label);
 static void set_ofs_x_anim(void * obj, int32_t v);
 static void set_ofs_y_anim(void * obj, int32_t v);
+#if LV_LABEL_IMG_CACHE_SIZE
+    static bool img_cache_draw(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * label_dsc,
+                               const lv_area_t * txt_coords);
+    static void img_cache_render_cb(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx, void * user_data);
+    static bool img_cache_dsc_eq(const lv_draw_label_dsc_t * a, const lv_draw_label_dsc_t * b);
+    static void img_cache_free(lv_label_img_cache_t * cache);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -62,6 +84,11 @@ const lv_obj_class_t lv_label_class = {
     .base_class = &lv_obj_class
 };
 
+#if LV_LABEL_IMG_CACHE_SIZE
+    static lv_ll_t img_cache_ll;        /*Head is the most recently drawn label*/
+    static uint32_t img_cache_used;     /*Size of the cached images in bytes*/
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -229,6 +256,20 @@ void lv_label_set_recolor(lv_obj_t * obj, bool en)
     lv_label_refr_text(obj);
 }
 
+void lv_label_set_img_cache(lv_obj_t * obj, bool en)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_label_t * label = (lv_label_t *)obj;
+    if(label->img_cache_en == en) return;
+
+#if LV_LABEL_IMG_CACHE_SIZE
+    if(label->img_cache_en) img_cache_free(label->img_cache);
+#endif
+    label->img_cache_en = en == false ? 0 : 1;
+    lv_obj_invalidate(obj);
+}
+
 void lv_label_set_text_sel_start(lv_obj_t * obj, uint32_t index)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
@@ -283,6 +324,26 @@ bool lv_label_get_recolor(const lv_obj_t * obj)
     return label->recolor == 0 ? false : true;
 }
 
+bool lv_label_get_img_cache(const lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_label_t * label = (lv_label_t *)obj;
+    return label->img_cache_en == 0 ? false : true;
+}
+
+#if LV_LABEL_IMG_CACHE_SIZE
+const lv_img_dsc_t * _lv_label_get_cached_img(const lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_label_t * label = (lv_label_t *)obj;
+    if(label->img_cache_en == 0) return NULL;
+
+    return label->img_cache ? &label->img_cache->img : NULL;
+}
+#endif
+
 void lv_label_get_letter_pos(const lv_obj_t * obj, uint32_t char_id, lv_point_t * pos)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
@@ -361,9 +422,17 @@ void lv_label_get_letter_pos(const lv_obj_t * obj, uint32_t char_id, lv_point_t
         uint32_t line_char_id = _lv_txt_encoded_get_char_id(&txt[line_start], byte_id - line_start);
 
         bool is_rtl;
-        uint32_t visual_char_pos = _lv_bidi_get_visual_pos(&txt[line_start], &mutable_bidi_txt, new_line_start - line_start,
-                                                           base_dir, line_char_id, &is_rtl);
-        bidi_txt = mutable_bidi_txt;
+        uint32_t visual_char_pos;
+        bidi_txt = _lv_bidi_cache_get_line(&label->bidi_cache, txt, line_start, new_line_start - line_start, base_dir);
+        if(bidi_txt) {
+            visual_char_pos = _lv_bidi_cache_get_visual_pos(&label->bidi_cache, txt, line_start, new_line_start - line_start,
+                                                            base_dir, line_char_id, &is_rtl);
+        }
+        else {
+            visual_char_pos = _lv_bidi_get_visual_pos(&txt[line_start], &mutable_bidi_txt, new_line_start - line_start,
+                                                      base_dir, line_char_id, &is_rtl);
+            bidi_txt = mutable_bidi_txt;
+        }
         if(is_rtl) visual_char_pos++;
 
         visual_byte_pos = _lv_txt_encoded_get_byte_id(bidi_txt, visual_char_pos);
@@ -420,7 +489,7 @@ uint32_t lv_label_get_letter_on(const lv_obj_t * obj, lv_point_t * pos_in)
     lv_coord_t y             = 0;
     lv_text_flag_t flag       = LV_TEXT_FLAG_NONE;
     uint32_t logical_pos;
-    char * bidi_txt;
+    const char * bidi_txt;
 
     if(label->recolor != 0) flag |= LV_TEXT_FLAG_RECOLOR;
     if(label->expand != 0) flag |= LV_TEXT_FLAG_EXPAND;
@@ -447,10 +516,16 @@ uint32_t lv_label_get_letter_on(const lv_obj_t * obj, lv_point_t * pos_in)
     }
 
 #if LV_USE_BIDI
-    bidi_txt = lv_mem_buf_get(new_line_start - line_start + 1);
+    lv_base_dir_t base_dir = lv_obj_get_style_base_dir(obj, LV_PART_MAIN);
     uint32_t txt_len = new_line_start - line_start;
     if(new_line_start > 0 && txt[new_line_start - 1] == '\0' && txt_len > 0) txt_len--;
-    _lv_bidi_process_paragraph(txt + line_start, bidi_txt, txt_len, lv_obj_get_style_base_dir(obj, LV_PART_MAIN), NULL, 0);
+    char * bidi_buf = NULL;
+    bidi_txt = _lv_bidi_cache_get_line(&label->bidi_cache, txt, line_start, txt_len, base_dir);
+    if(bidi_txt == NULL) {
+        bidi_buf = lv_mem_buf_get(new_line_start - line_start + 1);
+        _lv_bidi_process_paragraph(txt + line_start, bidi_buf, txt_len, base_dir, NULL, 0);
+        bidi_txt = bidi_buf;
+    }
 #else
     bidi_txt = (char *)txt + line_start;
 #endif
@@ -509,11 +584,10 @@ uint32_t lv_label_get_letter_on(const lv_obj_t * obj, lv_point_t * pos_in)
     }
     else {
         bool is_rtl;
-        logical_pos = _lv_bidi_get_logical_pos(&txt[line_start], NULL,
-                                               txt_len, lv_obj_get_style_base_dir(obj, LV_PART_MAIN), cid, &is_rtl);
+        logical_pos = _lv_bidi_cache_get_logical_pos(&label->bidi_cache, txt, line_start, txt_len, base_dir, cid, &is_rtl);
         if(is_rtl) logical_pos++;
     }
-    lv_mem_buf_release(bidi_txt);
+    if(bidi_buf) lv_mem_buf_release(bidi_buf);
 #else
     logical_pos = _lv_txt_encoded_get_char_id(bidi_txt, i);
 #endif
@@ -710,8 +784,16 @@ static void lv_label_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     label->sel_start = LV_DRAW_LABEL_NO_TXT_SEL;
     label->sel_end   = LV_DRAW_LABEL_NO_TXT_SEL;
 #endif
+
+#if LV_USE_BIDI
+    _lv_bidi_cache_init(&label->bidi_cache);
+#endif
     label->dot.tmp_ptr   = NULL;
     label->dot_tmp_alloc = 0;
+    label->img_cache_en = 0;
+#if LV_LABEL_IMG_CACHE_SIZE
+    label->img_cache = NULL;
+#endif
 
     lv_obj_clear_flag(obj, LV_OBJ_FLAG_CLICKABLE);
     lv_label_set_long_mode(obj, LV_LABEL_LONG_WRAP);
@@ -729,6 +811,14 @@ static void lv_label_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     lv_label_dot_tmp_free(obj);
     if(!label->static_txt) lv_mem_free(label->text);
     label->text = NULL;
+
+#if LV_USE_BIDI
+    _lv_bidi_cache_clear(&label->bidi_cache);
+#endif
+
+#if LV_LABEL_IMG_CACHE_SIZE
+    if(label->img_cache_en) img_cache_free(label->img_cache);
+#endif
 }
 
 static void lv_label_event(const lv_obj_class_t * class_p, lv_event_t * e)
@@ -811,6 +901,9 @@ static void draw_main(lv_event_t * e)
     label_draw_dsc.flag = flag;
     lv_obj_init_draw_label_dsc(obj, LV_PART_MAIN, &label_draw_dsc);
     lv_bidi_calculate_align(&label_draw_dsc.align, &label_draw_dsc.bidi_dir, label->text);
+#if LV_USE_BIDI
+    label_draw_dsc.bidi_cache = &label->bidi_cache;
+#endif
 
     label_draw_dsc.sel_start = lv_label_get_text_selection_start(obj);
     label_draw_dsc.sel_end = lv_label_get_text_selection_end(obj);
@@ -855,6 +948,11 @@ static void draw_main(lv_event_t * e)
         lv_draw_label(draw_ctx, &label_draw_dsc, &txt_coords, label->text, hint);
         draw_ctx->clip_area = clip_area_ori;
     }
+#if LV_LABEL_IMG_CACHE_SIZE
+    else if(label->img_cache_en && img_cache_draw(obj, draw_ctx, &label_draw_dsc, &txt_coords)) {
+        /*Drawn from the image*/
+    }
+#endif
     else {
         lv_draw_label(draw_ctx, &label_draw_dsc, &txt_coords, label->text, hint);
     }
@@ -900,6 +998,14 @@ static void lv_label_refr_text(lv_obj_t * obj)
     label->hint.line_start = -1; /*The hint is invalid if the text changes*/
 #endif
 
+#if LV_USE_BIDI
+    _lv_bidi_cache_clear(&label->bidi_cache); /*The text or the line breaks might have changed*/
+#endif
+
+#if LV_LABEL_IMG_CACHE_SIZE
+    if(label->img_cache_en) img_cache_free(label->img_cache);
+#endif
+
     lv_area_t txt_coords;
     lv_obj_get_content_coords(obj, &txt_coords);
     lv_coord_t max_w         = lv_area_get_width(&txt_coords);
@@ -1271,4 +1377,138 @@ static void set_ofs_y_anim(void * obj, int32_t v)
 }
 
 
+#if LV_LABEL_IMG_CACHE_SIZE
+
+/**
+ * Draw the text of a label from its image. Render the image first if it's missing or outdated.
+ * @return false if the image couldn't be created, the text needs to be drawn normally
+ */
+static bool img_cache_draw(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * label_dsc,
+                           const lv_area_t * txt_coords)
+{
+    lv_label_t * label = (lv_label_t *)obj;
+
+    /*Render with full opacity, the opacity is applied when the image is drawn*/
+    lv_draw_label_dsc_t dsc_cover = *label_dsc;
+    dsc_cover.opa = LV_OPA_COVER;
+
+    /*The glyphs can be drawn out of the text area up to the draw area of the label, so render that area.
+     *Keep the text's position relative to the image to not depend on the scroll position.*/
+    lv_area_t content;
+    lv_obj_get_content_coords(obj, &content);
+    lv_coord_t ext = _lv_obj_get_ext_draw_size(obj);
+    lv_area_t img_area;
+    img_area.x1 = txt_coords->x1 - LV_MAX(content.x1 - obj->coords.x1, 0) - ext;
+    img_area.y1 = txt_coords->y1 - LV_MAX(content.y1 - obj->coords.y1, 0) - ext;
+    img_area.x2 = txt_coords->x2 + LV_MAX(obj->coords.x2 - content.x2, 0) + ext;
+    img_area.y2 = txt_coords->y2 + LV_MAX(obj->coords.y2 - content.y2, 0) + ext;
+
+    lv_area_t txt_area;
+    lv_area_copy(&txt_area, txt_coords);
+    lv_area_move(&txt_area, -img_area.x1, -img_area.y1);
+
+    lv_coord_t w = lv_area_get_width(&img_area);
+    lv_coord_t h = lv_area_get_height(&img_area);
+    lv_label_img_cache_t * cache = label->img_cache;
+    if(cache) {
+        if(cache->img.header.w != w || cache->img.header.h != h || !_lv_area_is_equal(&cache->txt_area, &txt_area) ||
+           !img_cache_dsc_eq(&cache->label_dsc, &dsc_cover)) {
+            img_cache_free(cache);
+            cache = NULL;
+        }
+    }
+
+    if(cache == NULL) {
+        uint32_t size = (uint32_t)w * h * LV_IMG_PX_SIZE_ALPHA_BYTE;
+        if(w <= 0 || h <= 0 || size > LV_LABEL_IMG_CACHE_SIZE) return false;
+
+        if(img_cache_ll.n_size == 0) _lv_ll_init(&img_cache_ll, sizeof(lv_label_img_cache_t));
+
+        /*Free the images of the least recently drawn labels*/
+        while(img_cache_used + size > LV_LABEL_IMG_CACHE_SIZE) {
+            lv_label_img_cache_t * tail = _lv_ll_get_tail(&img_cache_ll);
+            if(tail == NULL) break;
+            img_cache_free(tail);
+        }
+
+        uint8_t * buf = lv_mem_alloc(size);
+        if(buf == NULL) return false;
+
+        cache = _lv_ll_ins_head(&img_cache_ll);
+        if(cache == NULL) {
+            lv_mem_free(buf);
+            return false;
+        }
+        lv_memset_00(buf, size);
+        lv_memset_00(&cache->img, sizeof(lv_img_dsc_t));
+        cache->obj = obj;
+        cache->txt_area = txt_area;
+        cache->label_dsc = dsc_cover;
+        cache->img.header.w = w;
+        cache->img.header.h = h;
+        cache->img.header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA;
+        cache->img.data_size = size;
+        cache->img.data = buf;
+        img_cache_used += size;
+        label->img_cache = cache;
+
+        /*Render the text to the buffer instead of the display*/
+        img_cache_render_param_t param;
+        param.label_dsc = &dsc_cover;
+        param.txt_coords = txt_coords;
+        if(_lv_obj_render_to_buf(obj, buf, &img_area, LV_IMG_CF_TRUE_COLOR_ALPHA, img_cache_render_cb,
+                                 &param) != LV_RES_OK) {
+            img_cache_free(cache);
+            return false;
+        }
+    }
+    else {
+        _lv_ll_move_before(&img_cache_ll, cache, _lv_ll_get_head(&img_cache_ll));
+    }
+
+    lv_draw_img_dsc_t img_dsc;
+    lv_draw_img_dsc_init(&img_dsc);
+    img_dsc.opa = label_dsc->opa;
+    img_dsc.blend_mode = label_dsc->blend_mode;
+    lv_draw_img(draw_ctx, &img_dsc, &img_area, &cache->img);
+
+    return true;
+}
+
+/**
+ * Render the text into the image, `user_data` is an `img_cache_render_param_t`
+ */
+static void img_cache_render_cb(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx, void * user_data)
+{
+    lv_label_t * label = (lv_label_t *)obj;
+    img_cache_render_param_t * param = user_data;
+    lv_draw_label(draw_ctx, param->label_dsc, param->txt_coords, label->text, NULL);
+}
+
+/**
+ * Compare the parameters that affect the rendered text. (`memcmp` would compare the padding bytes too.)
+ */
+static bool img_cache_dsc_eq(const lv_draw_label_dsc_t * a, const lv_draw_label_dsc_t * b)
+{
+    return a->font == b->font && a->sel_start == b->sel_start && a->sel_end == b->sel_end &&
+           a->color.full == b->color.full && a->sel_color.full == b->sel_color.full &&
+           a->sel_bg_color.full == b->sel_bg_color.full && a->line_space == b->line_space &&
+           a->letter_space == b->letter_space && a->ofs_x == b->ofs_x && a->ofs_y == b->ofs_y &&
+           a->bidi_dir == b->bidi_dir && a->align == b->align && a->flag == b->flag && a->decor == b->decor;
+}
+
+static void img_cache_free(lv_label_img_cache_t * cache)
+{
+    if(cache == NULL) return;
+
+    ((lv_label_t *)cache->obj)->img_cache = NULL;
+    lv_img_cache_invalidate_src(&cache->img);
+    img_cache_used -= cache->img.data_size;
+    lv_mem_free((void *)cache->img.data);
+    _lv_ll_remove(&img_cache_ll, cache);
+    lv_mem_free(cache);
+}
+
+#endif /*LV_LABEL_IMG_CACHE_SIZE*/
+
 #endif
@@ -68,12 +68,21 @@ typedef struct {
     uint32_t sel_end;
 #endif
 
+#if LV_USE_BIDI
+    lv_bidi_cache_t bidi_cache; /*The lines of the text in visual order, cleared when the text is refreshed*/
+#endif
+
+#if LV_LABEL_IMG_CACHE_SIZE
+    struct _lv_label_img_cache_t * img_cache;   /*The text rendered to an image or `NULL`*/
+#endif
+
     lv_point_t offset; /*Text draw position offset*/
     lv_label_long_mode_t long_mode : 3; /*Determine what to do with the long texts*/
     uint8_t static_txt : 1;             /*Flag to indicate the text is static*/
     uint8_t recolor : 1;                /*Enable in-line letter re-coloring*/
     uint8_t expand : 1;                 /*Ignore real width (used by the library with LV_LABEL_LONG_SCROLL)*/
     uint8_t dot_tmp_alloc : 1;         /*1: dot is allocated, 0: dot directly holds up to 4 chars*/
+    uint8_t img_cache_en : 1;          /*1: render the text to an image once and draw the image*/
 } lv_label_t;
 
 extern const lv_obj_class_t lv_label_class;
@@ -132,6 +141,17 @@ void lv_label_set_long_mode(lv_obj_t * obj, lv_label_long_mode_t long_mode);
  */
 void lv_label_set_recolor(lv_obj_t * obj, bool en);
 
+/**
+ * Render the text to an image once and draw only the image later. Useful for texts which rarely change.
+ * The image is rendered again if the text, the style or the size of the label changes.
+ * The memory of the images is limited by `LV_LABEL_IMG_CACHE_SIZE`,
+ * the images of the least recently drawn labels are freed if required.
+ * Not used in LV_LABEL_LONG_SCROLL/SCROLL_CIRCULAR modes.
+ * @param obj           pointer to a label object
+ * @param en            true: enable the image cache, false: disable
+ */
+void lv_label_set_img_cache(lv_obj_t * obj, bool en);
+
 /**
  * Set where text selection should start
  * @param obj       pointer to a label object
@@ -171,6 +191,22 @@ lv_label_long_mode_t lv_label_get_long_mode(const lv_obj_t * obj);
  */
 bool lv_label_get_recolor(const lv_obj_t * obj);
 
+/**
+ * Get whether the text is drawn from an image
+ * @param obj       pointer to a label object
+ * @return          true: the image cache is enabled, false: disabled
+ */
+bool lv_label_get_img_cache(const lv_obj_t * obj);
+
+#if LV_LABEL_IMG_CACHE_SIZE
+/**
+ * Get the image the text of a label is rendered to
+ * @param obj       pointer to a label object
+ * @return          the image or NULL if the text is not rendered to an image (yet)
+ */
+const lv_img_dsc_t * _lv_label_get_cached_img(const lv_obj_t * obj);
+#endif
+
 /**
  * Get the relative x and y coordinates of a letter
  * @param obj       pointer to a label object
@@ -29,10 +29,14 @@
  *  STATIC PROTOTYPES
  **********************/
 static void lv_roller_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
+static void lv_roller_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void lv_roller_event(const lv_obj_class_t * class_p, lv_event_t * e);
 static void lv_roller_label_event(const lv_obj_class_t * class_p, lv_event_t * e);
 static void draw_main(lv_event_t * e);
 static void draw_label(lv_event_t * e);
+static void draw_options(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc,
+                         const lv_area_t * coords, lv_coord_t unit_h);
+static void set_selected(lv_obj_t * obj, uint32_t sel_opt, lv_anim_enable_t anim);
 static void get_sel_area(lv_obj_t * obj, lv_area_t * sel_area);
 static void refr_position(lv_obj_t * obj, lv_anim_enable_t animen);
 static lv_res_t release_handler(lv_obj_t * obj);
@@ -47,6 +51,7 @@ static void set_y_anim(void * obj, int32_t v);
  **********************/
 const lv_obj_class_t lv_roller_class = {
     .constructor_cb = lv_roller_constructor,
+    .destructor_cb = lv_roller_destructor,
     .event_cb = lv_roller_event,
     .width_def = LV_SIZE_CONTENT,
     .height_def = LV_DPI_DEF,
@@ -105,34 +110,39 @@ void lv_roller_set_options(lv_obj_t * obj, const char * options, lv_roller_mode_
     roller->sel_opt_id_ori = 0;
 
     /*Count the '\n'-s to determine the number of options*/
-    roller->option_cnt = 0;
-    uint32_t cnt;
-    for(cnt = 0; options[cnt] != '\0'; cnt++) {
-        if(options[cnt] == '\n') roller->option_cnt++;
+    uint32_t real_cnt = 1; /*Last option has no `\n`*/
+    uint32_t i;
+    for(i = 0; options[i] != '\0'; i++) {
+        if(options[i] == '\n') real_cnt++;
     }
-    roller->option_cnt++; /*Last option has no `\n`*/
 
-    if(mode == LV_ROLLER_MODE_NORMAL) {
-        roller->mode = LV_ROLLER_MODE_NORMAL;
-        lv_label_set_text(label, options);
+    /*In infinite mode the options are stored only once but drawn on LV_ROLLER_INF_PAGES pages.
+     *The size of the label is set accordingly in its LV_EVENT_GET_SELF_SIZE*/
+    roller->mode = mode == LV_ROLLER_MODE_NORMAL ? LV_ROLLER_MODE_NORMAL : LV_ROLLER_MODE_INFINITE;
+    roller->option_cnt = roller->mode == LV_ROLLER_MODE_NORMAL ? real_cnt : real_cnt * LV_ROLLER_INF_PAGES;
+    lv_label_set_text(label, options);
+
+    /*Save where the options start to find them without walking the text*/
+    lv_mem_free(roller->opt_ofs);
+    roller->opt_ofs = lv_mem_alloc(real_cnt * sizeof(uint32_t));
+    LV_ASSERT_MALLOC(roller->opt_ofs);
+    if(roller->opt_ofs == NULL) {
+        roller->option_cnt = 0;
+        return;
     }
-    else {
-        roller->mode = LV_ROLLER_MODE_INFINITE;
-
-        size_t opt_len = strlen(options) + 1; /*+1 to add '\n' after option lists*/
-        char * opt_extra = lv_mem_buf_get(opt_len * LV_ROLLER_INF_PAGES);
-        uint8_t i;
-        for(i = 0; i < LV_ROLLER_INF_PAGES; i++) {
-            strcpy(&opt_extra[opt_len * i], options);
-            opt_extra[opt_len * (i + 1) - 1] = '\n';
-        }
-        opt_extra[opt_len * LV_ROLLER_INF_PAGES - 1] = '\0';
-        lv_label_set_text(label, opt_extra);
-        lv_mem_buf_release(opt_extra);
 
-        roller->sel_opt_id     = ((LV_ROLLER_INF_PAGES / 2) + 0) * roller->option_cnt;
+    const char * txt = lv_label_get_text(label);
+    uint32_t opt_i = 0;
+    roller->opt_ofs[0] = 0;
+    for(i = 0; txt[i] != '\0' && opt_i < real_cnt - 1; i++) {
+        if(txt[i] == '\n') {
+            opt_i++;
+            roller->opt_ofs[opt_i] = i + 1;
+        }
+    }
 
-        roller->option_cnt = roller->option_cnt * LV_ROLLER_INF_PAGES;
+    if(roller->mode == LV_ROLLER_MODE_INFINITE) {
+        roller->sel_opt_id = (LV_ROLLER_INF_PAGES / 2) * real_cnt;
         inf_normalize(obj);
     }
 
@@ -153,34 +163,7 @@ void lv_roller_set_selected(lv_obj_t * obj, uint16_t sel_opt, lv_anim_enable_t a
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
-    /*Set the value even if it's the same as the current value because
-     *if moving to the next option with an animation which was just deleted in the PRESS Call the ancestor's event handler
-     *nothing will continue the animation.*/
-
-    lv_roller_t * roller = (lv_roller_t *)obj;
-
-    /*In infinite mode interpret the new ID relative to the currently visible "page"*/
-    if(roller->mode == LV_ROLLER_MODE_INFINITE) {
-        uint32_t real_option_cnt = roller->option_cnt / LV_ROLLER_INF_PAGES;
-        uint16_t current_page = roller->sel_opt_id / real_option_cnt;
-        /*Set by the user to e.g. 0, 1, 2, 3...
-         *Upscale the value to the current page*/
-        if(sel_opt < real_option_cnt) {
-            uint16_t act_opt = roller->sel_opt_id - current_page * real_option_cnt;
-            int32_t sel_opt_signed = sel_opt;
-            /*Huge jump? Probably from last to first or first to last option.*/
-            if(LV_ABS((int16_t)act_opt - sel_opt) > real_option_cnt / 2) {
-                if(act_opt > sel_opt) sel_opt_signed += real_option_cnt;
-                else sel_opt_signed -= real_option_cnt;
-            }
-            sel_opt = sel_opt_signed + real_option_cnt * current_page;
-        }
-    }
-
-    roller->sel_opt_id     = sel_opt < roller->option_cnt ? sel_opt : roller->option_cnt - 1;
-    roller->sel_opt_id_ori = roller->sel_opt_id;
-
-    refr_position(obj, anim);
+    set_selected(obj, sel_opt, anim);
 }
 
 /**
@@ -213,7 +196,8 @@ uint16_t lv_roller_get_selected(const lv_obj_t * obj)
 
     lv_roller_t * roller = (lv_roller_t *)obj;
     if(roller->mode == LV_ROLLER_MODE_INFINITE) {
-        uint16_t real_id_cnt = roller->option_cnt / LV_ROLLER_INF_PAGES;
+        uint32_t real_id_cnt = roller->option_cnt / LV_ROLLER_INF_PAGES;
+        if(real_id_cnt == 0) return 0;
         return roller->sel_opt_id % real_id_cnt;
     }
     else {
@@ -232,23 +216,21 @@ void lv_roller_get_selected_str(const lv_obj_t * obj, char * buf, uint32_t buf_s
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
     lv_roller_t * roller = (lv_roller_t *)obj;
-    lv_obj_t * label = get_label(obj);
-    uint32_t i;
-    uint16_t line        = 0;
-    const char * opt_txt = lv_label_get_text(label);
-    size_t txt_len     = strlen(opt_txt);
-
-    for(i = 0; i < txt_len && line != roller->sel_opt_id; i++) {
-        if(opt_txt[i] == '\n') line++;
+    if(roller->option_cnt == 0) {
+        buf[0] = '\0';
+        return;
     }
 
+    lv_obj_t * label = get_label(obj);
+    const char * opt_txt = lv_label_get_text(label) + roller->opt_ofs[lv_roller_get_selected(obj)];
+
     uint32_t c;
-    for(c = 0; i < txt_len && opt_txt[i] != '\n'; c++, i++) {
+    for(c = 0; opt_txt[c] != '\0' && opt_txt[c] != '\n'; c++) {
         if(buf_size && c >= buf_size - 1) {
-            LV_LOG_WARN("lv_dropdown_get_selected_str: the buffer was too small");
+            LV_LOG_WARN("lv_roller_get_selected_str: the buffer was too small");
             break;
         }
-        buf[c] = opt_txt[i];
+        buf[c] = opt_txt[c];
     }
 
     buf[c] = '\0';
@@ -297,6 +279,7 @@ static void lv_roller_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj
     lv_roller_t * roller = (lv_roller_t *)obj;
 
     roller->mode = LV_ROLLER_MODE_NORMAL;
+    roller->opt_ofs = NULL;
     roller->option_cnt = 0;
     roller->sel_opt_id = 0;
     roller->sel_opt_id_ori = 0;
@@ -312,6 +295,15 @@ static void lv_roller_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj
     LV_LOG_TRACE("finshed");
 }
 
+static void lv_roller_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
+{
+    LV_UNUSED(class_p);
+    lv_roller_t * roller = (lv_roller_t *)obj;
+
+    lv_mem_free(roller->opt_ofs);
+    roller->opt_ofs = NULL;
+}
+
 static void lv_roller_event(const lv_obj_class_t * class_p, lv_event_t * e)
 {
     LV_UNUSED(class_p);
@@ -392,16 +384,16 @@ static void lv_roller_event(const lv_obj_class_t * class_p, lv_event_t * e)
         char c = *((char *)lv_event_get_param(e));
         if(c == LV_KEY_RIGHT || c == LV_KEY_DOWN) {
             if(roller->sel_opt_id + 1 < roller->option_cnt) {
-                uint16_t ori_id = roller->sel_opt_id_ori; /*lv_roller_set_selected will overwrite this*/
-                lv_roller_set_selected(obj, roller->sel_opt_id + 1, LV_ANIM_ON);
+                uint32_t ori_id = roller->sel_opt_id_ori; /*set_selected will overwrite this*/
+                set_selected(obj, roller->sel_opt_id + 1, LV_ANIM_ON);
                 roller->sel_opt_id_ori = ori_id;
             }
         }
         else if(c == LV_KEY_LEFT || c == LV_KEY_UP) {
             if(roller->sel_opt_id > 0) {
-                uint16_t ori_id = roller->sel_opt_id_ori; /*lv_roller_set_selected will overwrite this*/
+                uint32_t ori_id = roller->sel_opt_id_ori; /*set_selected will overwrite this*/
 
-                lv_roller_set_selected(obj, roller->sel_opt_id - 1, LV_ANIM_ON);
+                set_selected(obj, roller->sel_opt_id - 1, LV_ANIM_ON);
                 roller->sel_opt_id_ori = ori_id;
             }
         }
@@ -438,6 +430,18 @@ static void lv_roller_label_event(const lv_obj_class_t * class_p, lv_event_t * e
         lv_coord_t label_w = lv_obj_get_width(label);
         *s = LV_MAX(*s, sel_w - label_w);
     }
+    else if(code == LV_EVENT_GET_SELF_SIZE) {
+        /*In infinite mode the options are stored once but drawn on every page*/
+        lv_obj_t * obj = lv_obj_get_parent(label);
+        lv_roller_t * roller = (lv_roller_t *)obj;
+        if(roller->mode == LV_ROLLER_MODE_INFINITE) {
+            const lv_font_t * font = lv_obj_get_style_text_font(obj, LV_PART_MAIN);
+            lv_coord_t line_space = lv_obj_get_style_text_line_space(obj, LV_PART_MAIN);
+            lv_coord_t unit_h = lv_font_get_line_height(font) + line_space;
+            lv_point_t * p = lv_event_get_param(e);
+            p->y = LV_MAX(p->y, (lv_coord_t)roller->option_cnt * unit_h - line_space);
+        }
+    }
     else if(code == LV_EVENT_SIZE_CHANGED) {
         refr_position(lv_obj_get_parent(label), LV_ANIM_OFF);
     }
@@ -478,27 +482,17 @@ static void draw_main(lv_event_t * e)
         if(area_ok) {
             lv_obj_t * label = get_label(obj);
 
-            /*Get the size of the "selected text"*/
-            lv_point_t res_p;
-            lv_txt_get_size(&res_p, lv_label_get_text(label), label_dsc.font, label_dsc.letter_space, label_dsc.line_space,
-                            lv_obj_get_width(obj), LV_TEXT_FLAG_EXPAND);
-
-            /*Move the selected label proportionally with the background label*/
-            lv_coord_t roller_h = lv_obj_get_height(obj);
-            int32_t label_y_prop = label->coords.y1 - (roller_h / 2 +
-                                                       obj->coords.y1); /*label offset from the middle line of the roller*/
-            label_y_prop = (label_y_prop * 16384) / lv_obj_get_height(
-                               label); /*Proportional position from the middle line (upscaled by << 14)*/
+            /*Move the selected options proportionally with the background label.
+             *The middle of the selected option is in the middle of the roller when it's not moving.*/
+            const lv_font_t * main_font = lv_obj_get_style_text_font(obj, LV_PART_MAIN);
+            lv_coord_t main_font_h = lv_font_get_line_height(main_font);
+            lv_coord_t main_unit_h = main_font_h + lv_obj_get_style_text_line_space(obj, LV_PART_MAIN);
+            lv_coord_t sel_font_h = lv_font_get_line_height(label_dsc.font);
+            lv_coord_t sel_unit_h = sel_font_h + label_dsc.line_space;
 
-            /*Apply a correction with different line heights*/
-            const lv_font_t * normal_label_font = lv_obj_get_style_text_font(obj, LV_PART_MAIN);
-            lv_coord_t corr = (label_dsc.font->line_height - normal_label_font->line_height) / 2;
-
-            /*Apply the proportional position to the selected text*/
-            res_p.y -= corr;
-            int32_t label_sel_y = roller_h / 2 + obj->coords.y1;
-            label_sel_y += (label_y_prop * res_p.y) >> 14;
-            label_sel_y -= corr;
+            int32_t mid_y = obj->coords.y1 + lv_obj_get_height(obj) / 2;
+            int32_t label_ofs = label->coords.y1 - mid_y + main_font_h / 2;
+            int32_t label_sel_y = mid_y + (label_ofs * sel_unit_h) / main_unit_h - sel_font_h / 2;
 
             lv_coord_t bwidth = lv_obj_get_style_border_width(obj, LV_PART_MAIN);
             lv_coord_t pleft = lv_obj_get_style_pad_left(obj, LV_PART_MAIN);
@@ -509,12 +503,12 @@ static void draw_main(lv_event_t * e)
             label_sel_area.x1 = obj->coords.x1 + pleft + bwidth;
             label_sel_area.y1 = label_sel_y;
             label_sel_area.x2 = obj->coords.x2 - pright - bwidth;
-            label_sel_area.y2 = label_sel_area.y1 + res_p.y;
+            label_sel_area.y2 = label_sel_area.y1 + sel_unit_h - 1;
 
             label_dsc.flag |= LV_TEXT_FLAG_EXPAND;
             const lv_area_t * clip_area_ori = draw_ctx->clip_area;
             draw_ctx->clip_area = &mask_sel;
-            lv_draw_label(draw_ctx, &label_dsc, &label_sel_area, lv_label_get_text(label), NULL);
+            draw_options(obj, draw_ctx, &label_dsc, &label_sel_area, sel_unit_h);
             draw_ctx->clip_area = clip_area_ori;
         }
     }
@@ -542,6 +536,9 @@ static void draw_label(lv_event_t * e)
     lv_area_t sel_area;
     get_sel_area(roller, &sel_area);
 
+    const lv_font_t * font = lv_obj_get_style_text_font(roller, LV_PART_MAIN);
+    lv_coord_t unit_h = lv_font_get_line_height(font) + label_draw_dsc.line_space;
+
     lv_area_t clip2;
     clip2.x1 = label_obj->coords.x1;
     clip2.y1 = label_obj->coords.y1;
@@ -550,7 +547,7 @@ static void draw_label(lv_event_t * e)
     if(_lv_area_intersect(&clip2, draw_ctx->clip_area, &clip2)) {
         const lv_area_t * clip_area_ori2 = draw_ctx->clip_area;
         draw_ctx->clip_area = &clip2;
-        lv_draw_label(draw_ctx, &label_draw_dsc, &label_obj->coords, lv_label_get_text(label_obj), NULL);
+        draw_options(roller, draw_ctx, &label_draw_dsc, &label_obj->coords, unit_h);
         draw_ctx->clip_area = clip_area_ori2;
     }
 
@@ -561,13 +558,50 @@ static void draw_label(lv_event_t * e)
     if(_lv_area_intersect(&clip2, draw_ctx->clip_area, &clip2)) {
         const lv_area_t * clip_area_ori2 = draw_ctx->clip_area;
         draw_ctx->clip_area = &clip2;
-        lv_draw_label(draw_ctx, &label_draw_dsc, &label_obj->coords, lv_label_get_text(label_obj), NULL);
+        draw_options(roller, draw_ctx, &label_draw_dsc, &label_obj->coords, unit_h);
         draw_ctx->clip_area = clip_area_ori2;
     }
 
     draw_ctx->clip_area = clip_area_ori;
 }
 
+/**
+ * Draw only the options which are in the clip area
+ * @param obj       pointer to a roller object
+ * @param draw_ctx  pointer to the draw context
+ * @param dsc       the label draw descriptor
+ * @param coords    `x1` and `x2` are the horizontal boundaries of the text, `y1` is the top of the first option
+ * @param unit_h    the height of an option with the line space
+ */
+static void draw_options(lv_obj_t * obj, lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc,
+                         const lv_area_t * coords, lv_coord_t unit_h)
+{
+    lv_roller_t * roller = (lv_roller_t *)obj;
+    uint32_t real_cnt = lv_roller_get_option_cnt(obj);
+    if(real_cnt == 0 || unit_h <= 0) return;
+
+    int32_t first = (draw_ctx->clip_area->y1 - coords->y1) / unit_h;
+    int32_t last = (draw_ctx->clip_area->y2 - coords->y1) / unit_h;
+    if(last < 0 || first >= (int32_t)roller->option_cnt) return;
+    if(first < 0) first = 0;
+    if(last >= (int32_t)roller->option_cnt) last = roller->option_cnt - 1;
+
+    /*Draw the visible options from their first line until the end of the page*/
+    const char * txt = lv_label_get_text(get_label(obj));
+    lv_area_t a;
+    a.x1 = coords->x1;
+    a.x2 = coords->x2;
+    int32_t id = first;
+    while(id <= last) {
+        uint32_t real_id = id % real_cnt;
+        int32_t page_end = id + (real_cnt - real_id);
+        a.y1 = coords->y1 + id * unit_h;
+        a.y2 = coords->y1 + page_end * unit_h - 1;
+        lv_draw_label(draw_ctx, dsc, &a, &txt[roller->opt_ofs[real_id]], NULL);
+        id = page_end;
+    }
+}
+
 static void get_sel_area(lv_obj_t * obj, lv_area_t * sel_area)
 {
 
@@ -670,49 +704,29 @@ static lv_res_t release_handler(lv_obj_t * obj)
 
     if(lv_indev_get_type(indev) == LV_INDEV_TYPE_POINTER || lv_indev_get_type(indev) == LV_INDEV_TYPE_BUTTON) {
         /*Search the clicked option (For KEYPAD and ENCODER the new value should be already set)*/
-        int16_t new_opt  = -1;
+        const lv_font_t * font = lv_obj_get_style_text_font(obj, LV_PART_MAIN);
+        lv_coord_t line_space = lv_obj_get_style_text_line_space(obj, LV_PART_MAIN);
+        lv_coord_t font_h              = lv_font_get_line_height(font);
+        lv_coord_t label_unit = font_h + line_space;
+
+        int32_t id;
         if(roller->moved == 0) {
-            new_opt = 0;
+            /*Find the clicked option from its position*/
             lv_point_t p;
             lv_indev_get_point(indev, &p);
-            p.y -= label->coords.y1;
-            p.x -= label->coords.x1;
-            uint32_t letter_i;
-            letter_i = lv_label_get_letter_on(label, &p);
-
-            const char * txt  = lv_label_get_text(label);
-            uint32_t i        = 0;
-            uint32_t i_prev   = 0;
-
-            uint32_t letter_cnt = 0;
-            for(letter_cnt = 0; letter_cnt < letter_i; letter_cnt++) {
-                uint32_t letter = _lv_txt_encoded_next(txt, &i);
-                /*Count he lines to reach the clicked letter. But ignore the last '\n' because it
-                 * still belongs to the clicked line*/
-                if(letter == '\n' && i_prev != letter_i) new_opt++;
-                i_prev = i;
-            }
+            id = (p.y - label->coords.y1 + line_space / 2) / label_unit;
         }
         else {
             /*If dragged then align the list to have an element in the middle*/
-            const lv_font_t * font = lv_obj_get_style_text_font(obj, LV_PART_MAIN);
-            lv_coord_t line_space = lv_obj_get_style_text_line_space(obj, LV_PART_MAIN);
-            lv_coord_t font_h              = lv_font_get_line_height(font);
-
-            lv_coord_t label_unit = font_h + line_space;
             lv_coord_t mid        = obj->coords.y1 + (obj->coords.y2 - obj->coords.y1) / 2;
             lv_coord_t label_y1 = label->coords.y1 + lv_indev_scroll_throw_predict(indev, LV_DIR_VER);
-            int32_t id = (mid - label_y1) / label_unit;
-
-            if(id < 0) id = 0;
-            if(id >= roller->option_cnt) id = roller->option_cnt - 1;
-
-            new_opt = id;
+            id = (mid - label_y1) / label_unit;
         }
 
-        if(new_opt >= 0) {
-            lv_roller_set_selected(obj, new_opt, LV_ANIM_ON);
-        }
+        if(id < 0) id = 0;
+        if(id >= (int32_t)roller->option_cnt) id = roller->option_cnt - 1;
+
+        set_selected(obj, id, LV_ANIM_ON);
     }
 
     uint32_t id  = roller->sel_opt_id; /*Just to use uint32_t in event data*/
@@ -729,7 +743,8 @@ static void inf_normalize(lv_obj_t * obj)
     lv_roller_t * roller = (lv_roller_t *)obj;
 
     if(roller->mode == LV_ROLLER_MODE_INFINITE) {
-        uint16_t real_id_cnt = roller->option_cnt / LV_ROLLER_INF_PAGES;
+        uint32_t real_id_cnt = roller->option_cnt / LV_ROLLER_INF_PAGES;
+        if(real_id_cnt == 0) return;
         roller->sel_opt_id = roller->sel_opt_id % real_id_cnt;
         roller->sel_opt_id += (LV_ROLLER_INF_PAGES / 2) * real_id_cnt; /*Select the middle page*/
 
@@ -771,6 +786,45 @@ static lv_coord_t get_selected_label_width(const lv_obj_t * obj)
     return size.x;
 }
 
+/**
+ * Set the selected option. In infinite mode `sel_opt` can be the index of an option on any page.
+ * @param obj       pointer to a roller object
+ * @param sel_opt   index of the option to select
+ * @param anim      LV_ANIM_ON: set with animation; LV_ANIM_OFF set immediately
+ */
+static void set_selected(lv_obj_t * obj, uint32_t sel_opt, lv_anim_enable_t anim)
+{
+    /*Set the value even if it's the same as the current value because
+     *if moving to the next option with an animation which was just deleted in the PRESS Call the ancestor's event handler
+     *nothing will continue the animation.*/
+
+    lv_roller_t * roller = (lv_roller_t *)obj;
+    if(roller->option_cnt == 0) return;
+
+    /*In infinite mode interpret the new ID relative to the currently visible "page"*/
+    if(roller->mode == LV_ROLLER_MODE_INFINITE) {
+        uint32_t real_option_cnt = roller->option_cnt / LV_ROLLER_INF_PAGES;
+        uint32_t current_page = roller->sel_opt_id / real_option_cnt;
+        /*Set by the user to e.g. 0, 1, 2, 3...
+         *Upscale the value to the current page*/
+        if(sel_opt < real_option_cnt) {
+            int32_t act_opt = roller->sel_opt_id - current_page * real_option_cnt;
+            int32_t sel_opt_signed = sel_opt;
+            /*Huge jump? Probably from last to first or first to last option.*/
+            if((uint32_t)LV_ABS(act_opt - sel_opt_signed) > real_option_cnt / 2) {
+                if(act_opt > sel_opt_signed) sel_opt_signed += real_option_cnt;
+                else sel_opt_signed -= real_option_cnt;
+            }
+            sel_opt = sel_opt_signed + real_option_cnt * current_page;
+        }
+    }
+
+    roller->sel_opt_id     = sel_opt < roller->option_cnt ? sel_opt : roller->option_cnt - 1;
+    roller->sel_opt_id_ori = roller->sel_opt_id;
+
+    refr_position(obj, anim);
+}
+
 static void scroll_anim_ready_cb(lv_anim_t * a)
 {
     lv_obj_t * obj = lv_obj_get_parent(a->var); /*The label is animated*/
@@ -43,9 +43,10 @@ typedef uint8_t lv_roller_mode_t;
 
 typedef struct {
     lv_obj_t obj;
-    uint16_t option_cnt;          /**< Number of options*/
-    uint16_t sel_opt_id;          /**< Index of the current option*/
-    uint16_t sel_opt_id_ori;      /**< Store the original index on focus*/
+    uint32_t * opt_ofs;           /**< Byte index of each option in the text of the label*/
+    uint32_t option_cnt;          /**< Number of options (on all pages in infinite mode)*/
+    uint32_t sel_opt_id;          /**< Index of the current option*/
+    uint32_t sel_opt_id_ori;      /**< Store the original index on focus*/
     lv_roller_mode_t mode : 1;
     uint32_t moved : 1;
 } lv_roller_t;
@@ -33,15 +33,22 @@ static void lv_table_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
 static void lv_table_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void lv_table_event(const lv_obj_class_t * class_p, lv_event_t * e);
 static void draw_main(lv_event_t * e);
-static lv_coord_t get_row_height(lv_obj_t * obj, uint16_t row_id, const lv_font_t * font,
+static lv_coord_t get_row_height(lv_obj_t * obj, uint32_t row_id, const lv_font_t * font,
                                  lv_coord_t letter_space, lv_coord_t line_space,
                                  lv_coord_t cell_left, lv_coord_t cell_right, lv_coord_t cell_top, lv_coord_t cell_bottom);
 static void refr_size_form_row(lv_obj_t * obj, uint32_t start_row);
 static void refr_cell_size(lv_obj_t * obj, uint32_t row, uint32_t col);
-static lv_res_t get_pressed_cell(lv_obj_t * obj, uint16_t * row, uint16_t * col);
+static void refr_offsets(lv_obj_t * obj, uint32_t start_row);
+static uint32_t find_offset(const int32_t * ofs, uint32_t cnt, int32_t v);
+static int32_t get_row_y(lv_table_t * table, uint32_t row);
+static lv_coord_t get_row_h(lv_table_t * table, uint32_t row);
+static uint32_t find_row(lv_table_t * table, int32_t y);
+static lv_res_t get_pressed_cell(lv_obj_t * obj, uint32_t * row, uint16_t * col);
 static size_t get_cell_txt_len(const char * txt);
 static void copy_cell_txt(char * dst, const char * txt);
-static void get_cell_area(lv_obj_t * obj, uint16_t row, uint16_t col, lv_area_t * area);
+static void get_cell_area(lv_obj_t * obj, uint32_t row, uint16_t col, lv_area_t * area);
+
+static void free_cells(lv_obj_t * obj);
 
 static inline bool is_cell_empty(void * cell)
 {
@@ -82,12 +89,16 @@ lv_obj_t * lv_table_create(lv_obj_t * parent)
  * Setter functions
  *====================*/
 
-void lv_table_set_cell_value(lv_obj_t * obj, uint16_t row, uint16_t col, const char * txt)
+void lv_table_set_cell_value(lv_obj_t * obj, uint32_t row, uint16_t col, const char * txt)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
     LV_ASSERT_NULL(txt);
 
     lv_table_t * table = (lv_table_t *)obj;
+    if(table->cell_cb) {
+        LV_LOG_WARN("lv_table_set_cell_value: not possible in virtual mode");
+        return;
+    }
 
     /*Auto expand*/
     if(col >= table->col_cnt) lv_table_set_col_cnt(obj, col + 1);
@@ -111,12 +122,16 @@ void lv_table_set_cell_value(lv_obj_t * obj, uint16_t row, uint16_t col, const c
     refr_cell_size(obj, row, col);
 }
 
-void lv_table_set_cell_value_fmt(lv_obj_t * obj, uint16_t row, uint16_t col, const char * fmt, ...)
+void lv_table_set_cell_value_fmt(lv_obj_t * obj, uint32_t row, uint16_t col, const char * fmt, ...)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
     LV_ASSERT_NULL(fmt);
 
     lv_table_t * table = (lv_table_t *)obj;
+    if(table->cell_cb) {
+        LV_LOG_WARN("lv_table_set_cell_value_fmt: not possible in virtual mode");
+        return;
+    }
     if(col >= table->col_cnt) {
         lv_table_set_col_cnt(obj, col + 1);
     }
@@ -182,7 +197,7 @@ void lv_table_set_cell_value_fmt(lv_obj_t * obj, uint16_t row, uint16_t col, con
     refr_cell_size(obj, row, col);
 }
 
-void lv_table_set_row_cnt(lv_obj_t * obj, uint16_t row_cnt)
+void lv_table_set_row_cnt(lv_obj_t * obj, uint32_t row_cnt)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
@@ -190,16 +205,28 @@ void lv_table_set_row_cnt(lv_obj_t * obj, uint16_t row_cnt)
 
     if(table->row_cnt == row_cnt) return;
 
-    uint16_t old_row_cnt = table->row_cnt;
+    if(table->cell_cb) {
+        table->row_cnt = row_cnt;
+        if(table->row_act != LV_TABLE_ROW_NONE && table->row_act >= row_cnt) table->row_act = LV_TABLE_ROW_NONE;
+        refr_size_form_row(obj, 0);
+        return;
+    }
+
+    uint32_t old_row_cnt = table->row_cnt;
     table->row_cnt         = row_cnt;
 
     table->row_h = lv_mem_realloc(table->row_h, table->row_cnt * sizeof(table->row_h[0]));
     LV_ASSERT_MALLOC(table->row_h);
     if(table->row_h == NULL) return;
 
+    table->row_y = lv_mem_realloc(table->row_y, (table->row_cnt + 1) * sizeof(table->row_y[0]));
+    LV_ASSERT_MALLOC(table->row_y);
+    if(table->row_y == NULL) return;
+    table->row_y[0] = 0;
+
     /*Free the unused cells*/
     if(old_row_cnt > row_cnt) {
-        uint16_t old_cell_cnt = old_row_cnt * table->col_cnt;
+        uint32_t old_cell_cnt = old_row_cnt * table->col_cnt;
         uint32_t new_cell_cnt = table->col_cnt * table->row_cnt;
         uint32_t i;
         for(i = new_cell_cnt; i < old_cell_cnt; i++) {
@@ -218,7 +245,8 @@ void lv_table_set_row_cnt(lv_obj_t * obj, uint16_t row_cnt)
         lv_memset_00(&table->cell_data[old_cell_cnt], (new_cell_cnt - old_cell_cnt) * sizeof(table->cell_data[0]));
     }
 
-    refr_size_form_row(obj, 0);
+    /*The height of the existing rows hasn't changed*/
+    refr_size_form_row(obj, LV_MIN(old_row_cnt, row_cnt));
 }
 
 void lv_table_set_col_cnt(lv_obj_t * obj, uint16_t col_cnt)
@@ -232,42 +260,49 @@ void lv_table_set_col_cnt(lv_obj_t * obj, uint16_t col_cnt)
     uint16_t old_col_cnt = table->col_cnt;
     table->col_cnt         = col_cnt;
 
-    char ** new_cell_data = lv_mem_alloc(table->row_cnt * table->col_cnt * sizeof(char *));
-    LV_ASSERT_MALLOC(new_cell_data);
-    if(new_cell_data == NULL) return;
-    uint32_t new_cell_cnt = table->col_cnt * table->row_cnt;
-
-    lv_memset_00(new_cell_data, new_cell_cnt * sizeof(table->cell_data[0]));
+    /*Virtual tables have no cells to move*/
+    if(table->cell_cb == NULL) {
+        char ** new_cell_data = lv_mem_alloc(table->row_cnt * table->col_cnt * sizeof(char *));
+        LV_ASSERT_MALLOC(new_cell_data);
+        if(new_cell_data == NULL) return;
+        uint32_t new_cell_cnt = table->col_cnt * table->row_cnt;
 
-    /*The new column(s) messes up the mapping of `cell_data`*/
-    uint32_t old_col_start;
-    uint32_t new_col_start;
-    uint32_t min_col_cnt = LV_MIN(old_col_cnt, col_cnt);
-    uint32_t row;
-    for(row = 0; row < table->row_cnt; row++) {
-        old_col_start = row * old_col_cnt;
-        new_col_start = row * col_cnt;
-
-        lv_memcpy_small(&new_cell_data[new_col_start], &table->cell_data[old_col_start],
-                        sizeof(new_cell_data[0]) * min_col_cnt);
-
-        /*Free the old cells (only if the table becomes smaller)*/
-        int32_t i;
-        for(i = 0; i < (int32_t)old_col_cnt - col_cnt; i++) {
-            uint32_t idx = old_col_start + min_col_cnt + i;
-            lv_mem_free(table->cell_data[idx]);
-            table->cell_data[idx] = NULL;
+        lv_memset_00(new_cell_data, new_cell_cnt * sizeof(table->cell_data[0]));
+
+        /*The new column(s) messes up the mapping of `cell_data`*/
+        uint32_t old_col_start;
+        uint32_t new_col_start;
+        uint32_t min_col_cnt = LV_MIN(old_col_cnt, col_cnt);
+        uint32_t row;
+        for(row = 0; row < table->row_cnt; row++) {
+            old_col_start = row * old_col_cnt;
+            new_col_start = row * col_cnt;
+
+            lv_memcpy_small(&new_cell_data[new_col_start], &table->cell_data[old_col_start],
+                            sizeof(new_cell_data[0]) * min_col_cnt);
+
+            /*Free the old cells (only if the table becomes smaller)*/
+            int32_t i;
+            for(i = 0; i < (int32_t)old_col_cnt - col_cnt; i++) {
+                uint32_t idx = old_col_start + min_col_cnt + i;
+                lv_mem_free(table->cell_data[idx]);
+                table->cell_data[idx] = NULL;
+            }
         }
-    }
 
-    lv_mem_free(table->cell_data);
-    table->cell_data = new_cell_data;
+        lv_mem_free(table->cell_data);
+        table->cell_data = new_cell_data;
+    }
 
     /*Initialize the new column widths if any*/
     table->col_w = lv_mem_realloc(table->col_w, col_cnt * sizeof(table->col_w[0]));
     LV_ASSERT_MALLOC(table->col_w);
     if(table->col_w == NULL) return;
 
+    table->col_x = lv_mem_realloc(table->col_x, (col_cnt + 1) * sizeof(table->col_x[0]));
+    LV_ASSERT_MALLOC(table->col_x);
+    if(table->col_x == NULL) return;
+
     uint32_t col;
     for(col = old_col_cnt; col < col_cnt; col++) {
         table->col_w[col] = LV_DPI_DEF;
@@ -277,6 +312,43 @@ void lv_table_set_col_cnt(lv_obj_t * obj, uint16_t col_cnt)
     refr_size_form_row(obj, 0) ;
 }
 
+void lv_table_set_virtual(lv_obj_t * obj, uint32_t row_cnt, lv_table_cell_cb_t cell_cb)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_table_t * table = (lv_table_t *)obj;
+
+    table->row_act = LV_TABLE_ROW_NONE;
+    table->col_act = LV_TABLE_CELL_NONE;
+
+    if(cell_cb) {
+        /*Free the stored cells as they won't be used anymore*/
+        if(table->cell_cb == NULL) {
+            free_cells(obj);
+            lv_mem_free(table->row_h);
+            lv_mem_free(table->row_y);
+            table->row_h = NULL;
+            table->row_y = NULL;
+        }
+
+        table->cell_cb = cell_cb;
+        table->row_cnt = row_cnt;
+        refr_size_form_row(obj, 0);
+    }
+    else if(table->cell_cb) {
+        /*Start again with an empty table*/
+        table->cell_cb = NULL;
+        table->row_cnt = 0;
+        table->row_y = lv_mem_alloc(sizeof(table->row_y[0]));
+        LV_ASSERT_MALLOC(table->row_y);
+        if(table->row_y == NULL) return;
+        table->row_y[0] = 0;
+
+        if(row_cnt == 0) refr_size_form_row(obj, 0);
+        else lv_table_set_row_cnt(obj, row_cnt);
+    }
+}
+
 void lv_table_set_col_width(lv_obj_t * obj, uint16_t col_id, lv_coord_t w)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
@@ -290,11 +362,15 @@ void lv_table_set_col_width(lv_obj_t * obj, uint16_t col_id, lv_coord_t w)
     refr_size_form_row(obj, 0);
 }
 
-void lv_table_add_cell_ctrl(lv_obj_t * obj, uint16_t row, uint16_t col, lv_table_cell_ctrl_t ctrl)
+void lv_table_add_cell_ctrl(lv_obj_t * obj, uint32_t row, uint16_t col, lv_table_cell_ctrl_t ctrl)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
     lv_table_t * table = (lv_table_t *)obj;
+    if(table->cell_cb) {
+        LV_LOG_WARN("lv_table_add_cell_ctrl: not possible in virtual mode");
+        return;
+    }
 
     /*Auto expand*/
     if(col >= table->col_cnt) lv_table_set_col_cnt(obj, col + 1);
@@ -314,11 +390,15 @@ void lv_table_add_cell_ctrl(lv_obj_t * obj, uint16_t row, uint16_t col, lv_table
     table->cell_data[cell][0] |= ctrl;
 }
 
-void lv_table_clear_cell_ctrl(lv_obj_t * obj, uint16_t row, uint16_t col, lv_table_cell_ctrl_t ctrl)
+void lv_table_clear_cell_ctrl(lv_obj_t * obj, uint32_t row, uint16_t col, lv_table_cell_ctrl_t ctrl)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
     lv_table_t * table = (lv_table_t *)obj;
+    if(table->cell_cb) {
+        LV_LOG_WARN("lv_table_clear_cell_ctrl: not possible in virtual mode");
+        return;
+    }
 
     /*Auto expand*/
     if(col >= table->col_cnt) lv_table_set_col_cnt(obj, col + 1);
@@ -342,7 +422,7 @@ void lv_table_clear_cell_ctrl(lv_obj_t * obj, uint16_t row, uint16_t col, lv_tab
  * Getter functions
  *====================*/
 
-const char * lv_table_get_cell_value(lv_obj_t * obj, uint16_t row, uint16_t col)
+const char * lv_table_get_cell_value(lv_obj_t * obj, uint32_t row, uint16_t col)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
@@ -351,6 +431,12 @@ const char * lv_table_get_cell_value(lv_obj_t * obj, uint16_t row, uint16_t col)
         LV_LOG_WARN("invalid row or column");
         return "";
     }
+
+    if(table->cell_cb) {
+        const char * txt = table->cell_cb(obj, row, col);
+        return txt ? txt : "";
+    }
+
     uint32_t cell = row * table->col_cnt + col;
 
     if(is_cell_empty(table->cell_data[cell])) return "";
@@ -358,7 +444,7 @@ const char * lv_table_get_cell_value(lv_obj_t * obj, uint16_t row, uint16_t col)
     return &table->cell_data[cell][1]; /*Skip the format byte*/
 }
 
-uint16_t lv_table_get_row_cnt(lv_obj_t * obj)
+uint32_t lv_table_get_row_cnt(lv_obj_t * obj)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
@@ -388,7 +474,7 @@ lv_coord_t lv_table_get_col_width(lv_obj_t * obj, uint16_t col)
     return table->col_w[col];
 }
 
-bool lv_table_has_cell_ctrl(lv_obj_t * obj, uint16_t row, uint16_t col, lv_table_cell_ctrl_t ctrl)
+bool lv_table_has_cell_ctrl(lv_obj_t * obj, uint32_t row, uint16_t col, lv_table_cell_ctrl_t ctrl)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
@@ -397,6 +483,10 @@ bool lv_table_has_cell_ctrl(lv_obj_t * obj, uint16_t row, uint16_t col, lv_table
         LV_LOG_WARN("lv_table_get_cell_crop: invalid row or column");
         return false;
     }
+
+    /*The texts of virtual tables are always cropped*/
+    if(table->cell_cb) return (ctrl & LV_TABLE_CELL_CTRL_TEXT_CROP) == ctrl;
+
     uint32_t cell = row * table->col_cnt + col;
 
     if(is_cell_empty(table->cell_data[cell])) return false;
@@ -406,10 +496,25 @@ bool lv_table_has_cell_ctrl(lv_obj_t * obj, uint16_t row, uint16_t col, lv_table
 void lv_table_get_selected_cell(lv_obj_t * obj, uint16_t * row, uint16_t * col)
 {
     lv_table_t * table = (lv_table_t *)obj;
-    *row = table->row_act;
+    if(table->row_act == LV_TABLE_ROW_NONE) {
+        *row = LV_TABLE_CELL_NONE;
+        *col = LV_TABLE_CELL_NONE;
+        return;
+    }
+
+    /*Keep LV_TABLE_CELL_NONE for "no cell"*/
+    *row = (uint16_t)LV_MIN(table->row_act, LV_TABLE_CELL_NONE - 1);
     *col = table->col_act;
 }
 
+uint32_t lv_table_get_selected_row(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_table_t * table = (lv_table_t *)obj;
+    return table->row_act;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -425,8 +530,14 @@ static void lv_table_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     table->row_cnt = 1;
     table->col_w = lv_mem_alloc(table->col_cnt * sizeof(table->col_w[0]));
     table->row_h = lv_mem_alloc(table->row_cnt * sizeof(table->row_h[0]));
+    table->row_y = lv_mem_alloc((table->row_cnt + 1) * sizeof(table->row_y[0]));
+    table->col_x = lv_mem_alloc((table->col_cnt + 1) * sizeof(table->col_x[0]));
     table->col_w[0] = LV_DPI_DEF;
     table->row_h[0] = LV_DPI_DEF;
+    table->row_y[0] = 0;
+    table->row_y[1] = LV_DPI_DEF;
+    table->col_x[0] = 0;
+    table->col_x[1] = LV_DPI_DEF;
     table->cell_data = lv_mem_realloc(table->cell_data, table->row_cnt * table->col_cnt * sizeof(char *));
     table->cell_data[0] = NULL;
 
@@ -437,18 +548,11 @@ static void lv_table_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
 {
     LV_UNUSED(class_p);
     lv_table_t * table = (lv_table_t *)obj;
-    /*Free the cell texts*/
-    uint16_t i;
-    for(i = 0; i < table->col_cnt * table->row_cnt; i++) {
-        if(table->cell_data[i]) {
-            lv_mem_free(table->cell_data[i]);
-            table->cell_data[i] = NULL;
-        }
-    }
-
-    if(table->cell_data) lv_mem_free(table->cell_data);
+    free_cells(obj);
     if(table->row_h) lv_mem_free(table->row_h);
     if(table->col_w) lv_mem_free(table->col_w);
+    if(table->row_y) lv_mem_free(table->row_y);
+    if(table->col_x) lv_mem_free(table->col_x);
 }
 
 static void lv_table_event(const lv_obj_class_t * class_p, lv_event_t * e)
@@ -470,19 +574,12 @@ static void lv_table_event(const lv_obj_class_t * class_p, lv_event_t * e)
     }
     else if(code == LV_EVENT_GET_SELF_SIZE) {
         lv_point_t * p = lv_event_get_param(e);
-        uint32_t i;
-        lv_coord_t w = 0;
-        for(i = 0; i < table->col_cnt; i++) w += table->col_w[i];
-
-        lv_coord_t h = 0;
-        for(i = 0; i < table->row_cnt; i++) h += table->row_h[i];
-
-        p->x = w - 1;
-        p->y = h - 1;
+        p->x = table->col_x[table->col_cnt] - 1;
+        p->y = get_row_y(table, table->row_cnt) - 1;
     }
     else if(code == LV_EVENT_PRESSED || code == LV_EVENT_PRESSING) {
         uint16_t col;
-        uint16_t row;
+        uint32_t row;
         lv_res_t pr_res = get_pressed_cell(obj, &row, &col);
 
         if(pr_res == LV_RES_OK && (table->col_act != col || table->row_act != row)) {
@@ -495,7 +592,7 @@ static void lv_table_event(const lv_obj_class_t * class_p, lv_event_t * e)
         lv_obj_invalidate(obj);
         lv_indev_t * indev = lv_indev_get_act();
         lv_obj_t * scroll_obj = lv_indev_get_scroll_obj(indev);
-        if(table->col_act != LV_TABLE_CELL_NONE && table->row_act != LV_TABLE_CELL_NONE && scroll_obj == NULL) {
+        if(table->col_act != LV_TABLE_CELL_NONE && table->row_act != LV_TABLE_ROW_NONE && scroll_obj == NULL) {
             res = lv_event_send(obj, LV_EVENT_VALUE_CHANGED, NULL);
             if(res != LV_RES_OK) return;
         }
@@ -503,7 +600,7 @@ static void lv_table_event(const lv_obj_class_t * class_p, lv_event_t * e)
         lv_indev_type_t indev_type = lv_indev_get_type(lv_indev_get_act());
         if(indev_type == LV_INDEV_TYPE_POINTER || indev_type == LV_INDEV_TYPE_BUTTON) {
             table->col_act = LV_TABLE_CELL_NONE;
-            table->row_act = LV_TABLE_CELL_NONE;
+            table->row_act = LV_TABLE_ROW_NONE;
         }
     }
     else if(code == LV_EVENT_FOCUSED) {
@@ -511,17 +608,17 @@ static void lv_table_event(const lv_obj_class_t * class_p, lv_event_t * e)
     }
     else if(code == LV_EVENT_KEY) {
         int32_t c = *((int32_t *)lv_event_get_param(e));
-        int32_t col = table->col_act;
-        int32_t row = table->row_act;
-        if(col == LV_TABLE_CELL_NONE || row == LV_TABLE_CELL_NONE) {
+        if(table->col_act == LV_TABLE_CELL_NONE || table->row_act == LV_TABLE_ROW_NONE) {
             table->col_act = 0;
             table->row_act = 0;
             lv_obj_invalidate(obj);
             return;
         }
 
+        int32_t col = table->col_act;
+        int32_t row = table->row_act;
         if(col >= table->col_cnt) col = 0;
-        if(row >= table->row_cnt) row = 0;
+        if(row >= (int32_t)table->row_cnt) row = 0;
 
         if(c == LV_KEY_LEFT) col--;
         else if(c == LV_KEY_RIGHT) col++;
@@ -530,7 +627,7 @@ static void lv_table_event(const lv_obj_class_t * class_p, lv_event_t * e)
         else return;
 
         if(col >= table->col_cnt) {
-            if(row < table->row_cnt - 1) {
+            if(row < (int32_t)table->row_cnt - 1) {
                 col = 0;
                 row++;
             }
@@ -548,14 +645,14 @@ static void lv_table_event(const lv_obj_class_t * class_p, lv_event_t * e)
             }
         }
 
-        if(row >= table->row_cnt) {
+        if(row >= (int32_t)table->row_cnt) {
             row = table->row_cnt - 1;
         }
         else if(row < 0) {
             row = 0;
         }
 
-        if(table->col_act != col || table->row_act != row) {
+        if(table->col_act != col || table->row_act != (uint32_t)row) {
             table->col_act = col;
             table->row_act = row;
             lv_obj_invalidate(obj);
@@ -606,10 +703,14 @@ static void draw_main(lv_event_t * e)
     obj->skip_trans = 0;
 
     uint16_t col;
-    uint16_t row;
-    uint16_t cell = 0;
+    uint32_t row;
+    uint32_t cell;
 
-    cell_area.y2 = obj->coords.y1 + bg_top - 1 - lv_obj_get_scroll_y(obj) + border_width;
+    /*Skip the rows above the clip area*/
+    lv_coord_t y_ofs = obj->coords.y1 + bg_top - lv_obj_get_scroll_y(obj) + border_width;
+    uint32_t row_start = find_row(table, clip_area.y1 - y_ofs);
+    cell = row_start * table->col_cnt;
+    cell_area.y2 = y_ofs + get_row_y(table, row_start) - 1;
     lv_coord_t scroll_x = lv_obj_get_scroll_x(obj) ;
     bool rtl = lv_obj_get_style_base_dir(obj, LV_PART_MAIN) == LV_BASE_DIR_RTL;
 
@@ -622,8 +723,8 @@ static void draw_main(lv_event_t * e)
     part_draw_dsc.rect_dsc = &rect_dsc_act;
     part_draw_dsc.label_dsc = &label_dsc_act;
 
-    for(row = 0; row < table->row_cnt; row++) {
-        lv_coord_t h_row = table->row_h[row];
+    for(row = row_start; row < table->row_cnt; row++) {
+        lv_coord_t h_row = get_row_h(table, row);
 
         cell_area.y1 = cell_area.y2 + 1;
         cell_area.y2 = cell_area.y1 + h_row - 1;
@@ -635,7 +736,8 @@ static void draw_main(lv_event_t * e)
 
         for(col = 0; col < table->col_cnt; col++) {
             lv_table_cell_ctrl_t ctrl = 0;
-            if(table->cell_data[cell]) ctrl = table->cell_data[cell][0];
+            if(table->cell_cb) ctrl = LV_TABLE_CELL_CTRL_TEXT_CROP;
+            else if(table->cell_data[cell]) ctrl = table->cell_data[cell][0];
 
             if(rtl) {
                 cell_area.x2 = cell_area.x1 - 1;
@@ -646,8 +748,9 @@ static void draw_main(lv_event_t * e)
                 cell_area.x2 = cell_area.x1 + table->col_w[col] - 1;
             }
 
+            /*The cells of virtual tables are never merged*/
             uint16_t col_merge = 0;
-            for(col_merge = 0; col_merge + col < table->col_cnt - 1; col_merge++) {
+            for(col_merge = 0; table->cell_cb == NULL && col_merge + col < table->col_cnt - 1; col_merge++) {
                 char * next_cell_data = table->cell_data[cell + col_merge];
 
                 if(is_cell_empty(next_cell_data)) break;
@@ -718,7 +821,12 @@ static void draw_main(lv_event_t * e)
 
             lv_draw_rect(draw_ctx, &rect_dsc_act, &cell_area_border);
 
-            if(table->cell_data[cell]) {
+            /*Ask only the visible cells from virtual tables*/
+            const char * txt = NULL;
+            if(table->cell_cb) txt = table->cell_cb(obj, row, col);
+            else if(table->cell_data[cell]) txt = table->cell_data[cell] + 1;
+
+            if(txt) {
                 const lv_coord_t cell_left = lv_obj_get_style_pad_left(obj, LV_PART_ITEMS);
                 const lv_coord_t cell_right = lv_obj_get_style_pad_right(obj, LV_PART_ITEMS);
                 const lv_coord_t cell_top = lv_obj_get_style_pad_top(obj, LV_PART_ITEMS);
@@ -735,7 +843,7 @@ static void draw_main(lv_event_t * e)
                 bool crop = ctrl & LV_TABLE_CELL_CTRL_TEXT_CROP ? true : false;
                 if(crop) txt_flags = LV_TEXT_FLAG_EXPAND;
 
-                lv_txt_get_size(&txt_size, table->cell_data[cell] + 1, label_dsc_def.font,
+                lv_txt_get_size(&txt_size, txt, label_dsc_def.font,
                                 label_dsc_act.letter_space, label_dsc_act.line_space,
                                 lv_area_get_width(&txt_area), txt_flags);
 
@@ -750,7 +858,7 @@ static void draw_main(lv_event_t * e)
                 label_mask_ok = _lv_area_intersect(&label_clip_area, &clip_area, &cell_area);
                 if(label_mask_ok) {
                     draw_ctx->clip_area = &label_clip_area;
-                    lv_draw_label(draw_ctx, &label_dsc_act, &txt_area, table->cell_data[cell] + 1, NULL);
+                    lv_draw_label(draw_ctx, &label_dsc_act, &txt_area, txt, NULL);
                     draw_ctx->clip_area = &clip_area;
                 }
             }
@@ -781,13 +889,21 @@ static void refr_size_form_row(lv_obj_t * obj, uint32_t start_row)
     const lv_coord_t maxh = lv_obj_get_style_max_height(obj, LV_PART_ITEMS);
 
     lv_table_t * table = (lv_table_t *)obj;
-    uint32_t i;
-    for(i = start_row; i < table->row_cnt; i++) {
-        lv_coord_t calculated_height = get_row_height(obj, i, font, letter_space, line_space,
-                                                      cell_pad_left, cell_pad_right, cell_pad_top, cell_pad_bottom);
-        table->row_h[i] = LV_CLAMP(minh, calculated_height, maxh);
+    if(table->cell_cb) {
+        lv_coord_t calculated_height = lv_font_get_line_height(font) + cell_pad_top + cell_pad_bottom;
+        table->virt_row_h = LV_CLAMP(minh, calculated_height, maxh);
+    }
+    else {
+        uint32_t i;
+        for(i = start_row; i < table->row_cnt; i++) {
+            lv_coord_t calculated_height = get_row_height(obj, i, font, letter_space, line_space,
+                                                          cell_pad_left, cell_pad_right, cell_pad_top, cell_pad_bottom);
+            table->row_h[i] = LV_CLAMP(minh, calculated_height, maxh);
+        }
     }
 
+    refr_offsets(obj, start_row);
+
     lv_obj_refresh_self_size(obj);
     lv_obj_invalidate(obj);
 }
@@ -822,12 +938,80 @@ static void refr_cell_size(lv_obj_t * obj, uint32_t row, uint32_t col)
         lv_obj_invalidate_area(obj, &cell_area);
     }
     else {
+        refr_offsets(obj, row);
         lv_obj_refresh_self_size(obj);
         lv_obj_invalidate(obj);
     }
 }
 
-static lv_coord_t get_row_height(lv_obj_t * obj, uint16_t row_id, const lv_font_t * font,
+/**
+ * Update the offset of the rows from `start_row` and the offset of all columns
+ */
+static void refr_offsets(lv_obj_t * obj, uint32_t start_row)
+{
+    lv_table_t * table = (lv_table_t *)obj;
+
+    uint32_t i;
+    if(table->cell_cb == NULL) {
+        for(i = start_row; i < table->row_cnt; i++) {
+            table->row_y[i + 1] = table->row_y[i] + table->row_h[i];
+        }
+    }
+
+    for(i = 0; i < table->col_cnt; i++) {
+        table->col_x[i + 1] = table->col_x[i] + table->col_w[i];
+    }
+}
+
+/**
+ * Find the first item which is greater than a value with binary search
+ * @param ofs   increasing array of offsets
+ * @param cnt   number of items in `ofs`
+ * @param v     the value to search
+ * @return      index of the first item greater than `v` or `cnt` if there is no such item
+ */
+static uint32_t find_offset(const int32_t * ofs, uint32_t cnt, int32_t v)
+{
+    uint32_t min = 0;
+    uint32_t max = cnt;
+    while(min < max) {
+        uint32_t mid = (min + max) / 2;
+        if(ofs[mid] > v) max = mid;
+        else min = mid + 1;
+    }
+
+    return min;
+}
+
+static int32_t get_row_y(lv_table_t * table, uint32_t row)
+{
+    if(table->cell_cb) return (int32_t)row * table->virt_row_h;
+    else return table->row_y[row];
+}
+
+static lv_coord_t get_row_h(lv_table_t * table, uint32_t row)
+{
+    if(table->cell_cb) return table->virt_row_h;
+    else return table->row_h[row];
+}
+
+/**
+ * Find the row at a given y coordinate
+ * @param table     pointer to a table
+ * @param y         y coordinate relative to the first row
+ * @return          index of the row or `row_cnt` if `y` is below the last row
+ */
+static uint32_t find_row(lv_table_t * table, int32_t y)
+{
+    if(table->cell_cb) {
+        if(y < 0 || table->virt_row_h <= 0) return 0;
+        return LV_MIN((uint32_t)(y / table->virt_row_h), table->row_cnt);
+    }
+
+    return find_offset(&table->row_y[1], table->row_cnt, y);
+}
+
+static lv_coord_t get_row_height(lv_obj_t * obj, uint32_t row_id, const lv_font_t * font,
                                  lv_coord_t letter_space, lv_coord_t line_space,
                                  lv_coord_t cell_left, lv_coord_t cell_right, lv_coord_t cell_top, lv_coord_t cell_bottom)
 {
@@ -835,10 +1019,10 @@ static lv_coord_t get_row_height(lv_obj_t * obj, uint16_t row_id, const lv_font_
 
     lv_coord_t h_max = lv_font_get_line_height(font) + cell_top + cell_bottom;
     /* Calculate the cell_data index where to start */
-    uint16_t row_start = row_id * table->col_cnt;
+    uint32_t row_start = row_id * table->col_cnt;
 
     /* Traverse the cells in the row_id row */
-    uint16_t cell;
+    uint32_t cell;
     uint16_t col;
     for(cell = row_start, col = 0; cell < row_start + table->col_cnt; cell++, col++) {
         char * cell_data = table->cell_data[cell];
@@ -892,21 +1076,20 @@ static lv_coord_t get_row_height(lv_obj_t * obj, uint16_t row_id, const lv_font_
     return h_max;
 }
 
-static lv_res_t get_pressed_cell(lv_obj_t * obj, uint16_t * row, uint16_t * col)
+static lv_res_t get_pressed_cell(lv_obj_t * obj, uint32_t * row, uint16_t * col)
 {
     lv_table_t * table = (lv_table_t *)obj;
 
     lv_indev_type_t type = lv_indev_get_type(lv_indev_get_act());
     if(type != LV_INDEV_TYPE_POINTER && type != LV_INDEV_TYPE_BUTTON) {
         if(col) *col = LV_TABLE_CELL_NONE;
-        if(row) *row = LV_TABLE_CELL_NONE;
+        if(row) *row = LV_TABLE_ROW_NONE;
         return LV_RES_INV;
     }
 
     lv_point_t p;
     lv_indev_get_point(lv_indev_get_act(), &p);
 
-    lv_coord_t tmp;
     if(col) {
         lv_coord_t x = p.x + lv_obj_get_scroll_x(obj);
 
@@ -918,12 +1101,7 @@ static lv_res_t get_pressed_cell(lv_obj_t * obj, uint16_t * row, uint16_t * col)
             x -= lv_obj_get_style_pad_left(obj, LV_PART_MAIN);
         }
 
-        *col = 0;
-        tmp = 0;
-        for(*col = 0; *col < table->col_cnt; (*col)++) {
-            tmp += table->col_w[*col];
-            if(x < tmp) break;
-        }
+        *col = find_offset(&table->col_x[1], table->col_cnt, x);
     }
 
     if(row) {
@@ -931,18 +1109,26 @@ static lv_res_t get_pressed_cell(lv_obj_t * obj, uint16_t * row, uint16_t * col)
         y -= obj->coords.y1;
         y -= lv_obj_get_style_pad_top(obj, LV_PART_MAIN);
 
-        *row = 0;
-        tmp = 0;
-
-        for(*row = 0; *row < table->row_cnt; (*row)++) {
-            tmp += table->row_h[*row];
-            if(y < tmp) break;
-        }
+        *row = find_row(table, y);
     }
 
     return LV_RES_OK;
 }
 
+static void free_cells(lv_obj_t * obj)
+{
+    lv_table_t * table = (lv_table_t *)obj;
+    if(table->cell_data == NULL) return;
+
+    uint32_t i;
+    for(i = 0; i < table->col_cnt * table->row_cnt; i++) {
+        if(table->cell_data[i]) lv_mem_free(table->cell_data[i]);
+    }
+
+    lv_mem_free(table->cell_data);
+    table->cell_data = NULL;
+}
+
 /* Returns number of bytes to allocate based on chars configuration */
 static size_t get_cell_txt_len(const char * txt)
 {
@@ -969,15 +1155,11 @@ static void copy_cell_txt(char * dst, const char * txt)
 #endif
 }
 
-static void get_cell_area(lv_obj_t * obj, uint16_t row, uint16_t col, lv_area_t * area)
+static void get_cell_area(lv_obj_t * obj, uint32_t row, uint16_t col, lv_area_t * area)
 {
     lv_table_t * table = (lv_table_t *)obj;
 
-    uint32_t c;
-    area->x1 = 0;
-    for(c = 0; c < col; c++) {
-        area->x1 += table->col_w[c];
-    }
+    area->x1 = table->col_x[col];
 
     bool rtl = lv_obj_get_style_base_dir(obj, LV_PART_MAIN) == LV_BASE_DIR_RTL;
     if(rtl) {
@@ -992,15 +1174,11 @@ static void get_cell_area(lv_obj_t * obj, uint16_t row, uint16_t col, lv_area_t
         area->x2 = area->x1 + table->col_w[col] - 1;
     }
 
-    uint32_t r;
-    area->y1 = 0;
-    for(r = 0; r < row; r++) {
-        area->y1 += table->row_h[r];
-    }
+    area->y1 = get_row_y(table, row);
 
     area->y1 += lv_obj_get_style_pad_top(obj, 0);
     area->y1 -= lv_obj_get_scroll_y(obj);
-    area->y2 = area->y1 + table->row_h[row] - 1;
+    area->y2 = area->y1 + get_row_h(table, row) - 1;
 
 }
 
@@ -31,6 +31,9 @@ extern "C" {
 #define LV_TABLE_CELL_NONE 0XFFFF
 LV_EXPORT_CONST_INT(LV_TABLE_CELL_NONE);
 
+#define LV_TABLE_ROW_NONE 0XFFFFFFFF    /*No row is selected, returned by `lv_table_get_selected_row`*/
+LV_EXPORT_CONST_INT(LV_TABLE_ROW_NONE);
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -46,16 +49,27 @@ enum {
 
 typedef uint8_t  lv_table_cell_ctrl_t;
 
+/**
+ * Get the text of a cell of a virtual table.
+ * The returned text needs to be valid only until the next call.
+ * `NULL` means an empty cell.
+ */
+typedef const char * (*lv_table_cell_cb_t)(lv_obj_t * table, uint32_t row, uint16_t col);
+
 /*Data of table*/
 typedef struct {
     lv_obj_t obj;
     uint16_t col_cnt;
-    uint16_t row_cnt;
+    uint32_t row_cnt;
     char ** cell_data;
     lv_coord_t * row_h;
     lv_coord_t * col_w;
+    int32_t * row_y;    /**< Top of each row relative to the first one. `row_y[row_cnt]` is the total height.*/
+    int32_t * col_x;    /**< Left of each column relative to the first one. `col_x[col_cnt]` is the total width.*/
+    lv_table_cell_cb_t cell_cb; /**< Provides the cell texts in virtual mode. `cell_data`, `row_h` and `row_y` are `NULL` then.*/
+    lv_coord_t virt_row_h;      /**< Height of the rows in virtual mode*/
     uint16_t col_act;
-    uint16_t row_act;
+    uint32_t row_act;
 } lv_table_t;
 
 extern const lv_obj_class_t lv_table_class;
@@ -91,7 +105,7 @@ lv_obj_t * lv_table_create(lv_obj_t * parent);
  * @param txt           text to display in the cell. It will be copied and saved so this variable is not required after this function call.
  * @note                New roes/columns are added automatically if required
  */
-void lv_table_set_cell_value(lv_obj_t * obj, uint16_t row, uint16_t col, const char * txt);
+void lv_table_set_cell_value(lv_obj_t * obj, uint32_t row, uint16_t col, const char * txt);
 
 /**
  * Set the value of a cell.  Memory will be allocated to store the text by the table.
@@ -101,14 +115,14 @@ void lv_table_set_cell_value(lv_obj_t * obj, uint16_t row, uint16_t col, const c
  * @param fmt           `printf`-like format
  * @note                New roes/columns are added automatically if required
  */
-void lv_table_set_cell_value_fmt(lv_obj_t * obj, uint16_t row, uint16_t col, const char * fmt, ...);
+void lv_table_set_cell_value_fmt(lv_obj_t * obj, uint32_t row, uint16_t col, const char * fmt, ...);
 
 /**
  * Set the number of rows
  * @param obj           table pointer to a Table object
  * @param row_cnt       number of rows
  */
-void lv_table_set_row_cnt(lv_obj_t * obj, uint16_t row_cnt);
+void lv_table_set_row_cnt(lv_obj_t * obj, uint32_t row_cnt);
 
 /**
  * Set the number of columns
@@ -117,6 +131,20 @@ void lv_table_set_row_cnt(lv_obj_t * obj, uint16_t row_cnt);
  */
 void lv_table_set_col_cnt(lv_obj_t * obj, uint16_t col_cnt);
 
+/**
+ * Make the table virtual: the cells are not stored but `cell_cb` is called
+ * to get the texts of the visible cells when the table is drawn.
+ * This way the memory usage doesn't depend on the number of rows.
+ * All rows have the same height: the line height of the font plus the top and bottom padding of
+ * `LV_PART_ITEMS`, limited by its `min_height` and `max_height`. The texts are not wrapped.
+ * @param obj       pointer to a Table object
+ * @param row_cnt   number of rows
+ * @param cell_cb   callback to get the text of a cell or `NULL` to go back to normal (empty) table
+ * @note            the cell values and control bits can't be set in virtual mode.
+ *                  Call `lv_obj_invalidate(table)` if the data changes.
+ */
+void lv_table_set_virtual(lv_obj_t * obj, uint32_t row_cnt, lv_table_cell_cb_t cell_cb);
+
 /**
  * Set the width of a column
  * @param obj       table pointer to a Table object
@@ -132,7 +160,7 @@ void lv_table_set_col_width(lv_obj_t * obj, uint16_t col_id, lv_coord_t w);
  * @param col       id of the column [0 .. col_cnt -1]
  * @param ctrl      OR-ed values from ::lv_table_cell_ctrl_t
  */
-void lv_table_add_cell_ctrl(lv_obj_t * obj, uint16_t row, uint16_t col, lv_table_cell_ctrl_t ctrl);
+void lv_table_add_cell_ctrl(lv_obj_t * obj, uint32_t row, uint16_t col, lv_table_cell_ctrl_t ctrl);
 
 
 /**
@@ -142,7 +170,7 @@ void lv_table_add_cell_ctrl(lv_obj_t * obj, uint16_t row, uint16_t col, lv_table
  * @param col       id of the column [0 .. col_cnt -1]
  * @param ctrl      OR-ed values from ::lv_table_cell_ctrl_t
  */
-void lv_table_clear_cell_ctrl(lv_obj_t * obj, uint16_t row, uint16_t col, lv_table_cell_ctrl_t ctrl);
+void lv_table_clear_cell_ctrl(lv_obj_t * obj, uint32_t row, uint16_t col, lv_table_cell_ctrl_t ctrl);
 
 /*=====================
  * Getter functions
@@ -155,14 +183,14 @@ void lv_table_clear_cell_ctrl(lv_obj_t * obj, uint16_t row, uint16_t col, lv_tab
  * @param col       id of the column [0 .. col_cnt -1]
  * @return          text in the cell
  */
-const char * lv_table_get_cell_value(lv_obj_t * obj, uint16_t row, uint16_t col);
+const char * lv_table_get_cell_value(lv_obj_t * obj, uint32_t row, uint16_t col);
 
 /**
  * Get the number of rows.
  * @param obj       table pointer to a Table object
  * @return          number of rows.
  */
-uint16_t lv_table_get_row_cnt(lv_obj_t * obj);
+uint32_t lv_table_get_row_cnt(lv_obj_t * obj);
 
 /**
  * Get the number of columns.
@@ -187,16 +215,24 @@ lv_coord_t lv_table_get_col_width(lv_obj_t * obj, uint16_t col);
  * @param ctrl      OR-ed values from ::lv_table_cell_ctrl_t
  * @return          true: all control bits are set; false: not all control bits are set
  */
-bool lv_table_has_cell_ctrl(lv_obj_t * obj, uint16_t row, uint16_t col, lv_table_cell_ctrl_t ctrl);
+bool lv_table_has_cell_ctrl(lv_obj_t * obj, uint32_t row, uint16_t col, lv_table_cell_ctrl_t ctrl);
 
 /**
  * Get the selected cell (pressed and or focused)
  * @param obj       pointer to a table object
- * @param row       pointer to variable to store the selected row (LV_TABLE_CELL_NONE: if no cell selected)
+ * @param row       pointer to variable to store the selected row (LV_TABLE_CELL_NONE: if no cell selected).
+ *                  Rows above 65534 are reported as 65534, use `lv_table_get_selected_row` with more rows.
  * @param col       pointer to variable to store the selected column  (LV_TABLE_CELL_NONE: if no cell selected)
  */
 void lv_table_get_selected_cell(lv_obj_t * obj, uint16_t * row, uint16_t * col);
 
+/**
+ * Get the row of the selected cell (pressed and or focused). Works with any number of rows, e.g. in virtual tables.
+ * @param obj       pointer to a table object
+ * @return          the selected row or LV_TABLE_ROW_NONE if no cell is selected
+ */
+uint32_t lv_table_get_selected_row(lv_obj_t * obj);
+
 /**********************
  *      MACROS
  **********************/
@@ -17,6 +17,58 @@ static inline uint32_t lv_test_get_free_mem(void)
 }
 #endif /* LVGL_CI_USING_SYS_HEAP */
 
+#define HOR_RES 800
+#define VER_RES 480
+#define FB_SIZE (HOR_RES * VER_RES)
+
+/*The last flushed area*/
+extern lv_color_t test_fb[];
+
+/*A frame to compare with, e.g. saved by `lv_test_save_ref_screen`*/
+extern lv_color_t test_ref_fb[];
+
+/*Redraw the whole screen to have the full frame in `test_fb`*/
+static inline void lv_test_refr_screen(void)
+{
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+}
+
+/*Redraw the whole screen and save it into `test_ref_fb`*/
+static inline void lv_test_save_ref_screen(void)
+{
+    lv_test_refr_screen();
+    lv_memcpy(test_ref_fb, test_fb, FB_SIZE * sizeof(lv_color_t));
+}
+
+/*The largest difference of the color channels of `test_ref_fb` and `test_fb`*/
+static inline lv_coord_t lv_test_ref_screen_diff(void)
+{
+    lv_coord_t max_diff = 0;
+    uint32_t i;
+    for(i = 0; i < FB_SIZE; i++) {
+        lv_color_t c1 = test_ref_fb[i];
+        lv_color_t c2 = test_fb[i];
+        lv_coord_t r = LV_ABS((lv_coord_t)LV_COLOR_GET_R(c1) - LV_COLOR_GET_R(c2));
+        lv_coord_t g = LV_ABS((lv_coord_t)LV_COLOR_GET_G(c1) - LV_COLOR_GET_G(c2));
+        lv_coord_t b = LV_ABS((lv_coord_t)LV_COLOR_GET_B(c1) - LV_COLOR_GET_B(c2));
+        max_diff = LV_MAX(max_diff, LV_MAX(LV_MAX(r, g), b));
+    }
+    return max_diff;
+}
+
+/*Refresh the invalidated areas and tell if the result is the same as redrawing everything.
+ *Needs direct mode to keep the whole frame in the draw buffer between the refreshes.*/
+static inline bool lv_test_partial_redraw_matches(void)
+{
+    lv_color_t * buf = lv_disp_get_default()->driver->draw_buf->buf1;
+
+    lv_refr_now(NULL);
+    lv_memcpy(test_ref_fb, buf, FB_SIZE * sizeof(lv_color_t));
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+    return memcmp(test_ref_fb, buf, FB_SIZE * sizeof(lv_color_t)) == 0;
+}
 
 #endif /*LV_TEST_HELPERS_H*/
 
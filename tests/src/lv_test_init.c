@@ -2,13 +2,11 @@
 #if LV_BUILD_TEST
 #include "lv_test_init.h"
 #include "lv_test_indev.h"
+#include "lv_test_helpers.h"
 #include <sys/time.h>
 #include <stdio.h>
 #include <stdlib.h>
 
-#define HOR_RES 800
-#define VER_RES 480
-
 static void hal_init(void);
 static void dummy_flush_cb(lv_disp_drv_t * disp_drv, const lv_area_t * area, lv_color_t * color_p);
 
@@ -16,7 +14,8 @@ lv_indev_t * lv_test_mouse_indev;
 lv_indev_t * lv_test_keypad_indev;
 lv_indev_t * lv_test_encoder_indev;
 
-lv_color_t test_fb[HOR_RES * VER_RES];
+lv_color_t test_fb[FB_SIZE];
+lv_color_t test_ref_fb[FB_SIZE];
 static lv_color_t disp_buf1[HOR_RES * VER_RES];
 
 void lv_test_init(void)
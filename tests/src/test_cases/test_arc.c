@@ -2,6 +2,7 @@
 #include "../lvgl.h"
 
 #include "unity/unity.h"
+#include "lv_test_helpers.h"
 #include "lv_test_indev.h"
 
 /* This function runs before each test */
@@ -20,6 +21,7 @@ static lv_obj_t * arc = NULL;
 static uint32_t event_cnt;
 
 static void dummy_event_cb(lv_event_t * e);
+static uint32_t inv_pixel_cnt(void);
 
 void setUp(void)
 {
@@ -164,4 +166,54 @@ static void dummy_event_cb(lv_event_t * e)
     event_cnt++;
 }
 
+/*Sum the size of the areas which will be redrawn*/
+static uint32_t inv_pixel_cnt(void)
+{
+    lv_disp_t * disp = lv_disp_get_default();
+    uint32_t cnt = 0;
+    uint32_t i;
+    for(i = 0; i < disp->inv_p; i++) {
+        if(disp->inv_area_joined[i] == 0) cnt += lv_area_get_size(&disp->inv_areas[i]);
+    }
+    return cnt;
+}
+
+void test_arc_value_change_should_invalidate_only_the_changed_sector(void)
+{
+    arc = lv_arc_create(active_screen);
+    lv_obj_set_size(arc, 200, 200);
+    lv_obj_center(arc);
+    lv_arc_set_value(arc, 10);
+    lv_disp_get_default()->driver->direct_mode = 1;
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+
+    uint32_t arc_size = lv_area_get_size(&arc->coords);
+    lv_arc_set_value(arc, 12);
+    TEST_ASSERT_GREATER_THAN(0, inv_pixel_cnt());
+    TEST_ASSERT_LESS_THAN(arc_size / 8, inv_pixel_cnt());
+    TEST_ASSERT_TRUE(lv_test_partial_redraw_matches());
+
+    /*Long changes over several quarters are invalidated piece by piece*/
+    lv_arc_set_value(arc, 90);
+    TEST_ASSERT_LESS_THAN(arc_size, inv_pixel_cnt());
+    TEST_ASSERT_TRUE(lv_test_partial_redraw_matches());
+
+    lv_arc_set_value(arc, 0);
+    TEST_ASSERT_TRUE(lv_test_partial_redraw_matches());
+
+    lv_arc_set_rotation(arc, 30);
+    lv_obj_set_style_pad_all(arc, 10, LV_PART_INDICATOR);
+    lv_refr_now(NULL);
+    uint32_t i;
+    for(i = 0; i <= 100; i += 5) {
+        lv_arc_set_value(arc, i);
+        TEST_ASSERT_LESS_THAN(arc_size / 4, inv_pixel_cnt());
+        TEST_ASSERT_TRUE(lv_test_partial_redraw_matches());
+    }
+
+    lv_disp_get_default()->driver->direct_mode = 0;
+    lv_obj_del(arc);
+}
+
 #endif
@@ -2,6 +2,7 @@
 #include "../lvgl.h"
 
 #include "unity/unity.h"
+#include "lv_test_helpers.h"
 
 #include "lv_test_indev.h"
 
@@ -18,6 +19,18 @@ void tearDown(void)
 {
 }
 
+/*Sum the size of the areas which will be redrawn*/
+static uint32_t inv_pixel_cnt(void)
+{
+    lv_disp_t * disp = lv_disp_get_default();
+    uint32_t cnt = 0;
+    uint32_t i;
+    for(i = 0; i < disp->inv_p; i++) {
+        if(disp->inv_area_joined[i] == 0) cnt += lv_area_get_size(&disp->inv_areas[i]);
+    }
+    return cnt;
+}
+
 void test_bar_should_have_valid_default_attributes(void)
 {
     TEST_ASSERT_EQUAL(0, lv_bar_get_min_value(bar));
@@ -250,4 +263,96 @@ void test_bar_indicator_should_be_drawn_towards_the_min_range_side_after_setting
     TEST_ASSERT_LESS_THAN(original_pos, final_pos);
 }
 
+void test_bar_value_change_should_invalidate_only_the_moving_edge(void)
+{
+    lv_obj_set_size(bar, 400, 20);
+    lv_obj_center(bar);
+    lv_bar_set_value(bar, 30, LV_ANIM_OFF);
+    lv_disp_get_default()->driver->direct_mode = 1;
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+
+    uint32_t bar_size = lv_area_get_size(&bar->coords);
+    lv_bar_set_value(bar, 32, LV_ANIM_OFF);
+    TEST_ASSERT_GREATER_THAN(0, inv_pixel_cnt());
+    TEST_ASSERT_LESS_THAN(bar_size / 4, inv_pixel_cnt());
+    TEST_ASSERT_TRUE(lv_test_partial_redraw_matches());
+
+    /*Only the steps of the animation are invalidated*/
+    lv_obj_set_style_anim_time(bar, 100, LV_PART_MAIN);
+    lv_refr_now(NULL);
+    lv_bar_set_value(bar, 70, LV_ANIM_ON);
+    TEST_ASSERT_EQUAL(0, inv_pixel_cnt());
+    uint32_t i;
+    for(i = 0; i < 10; i++) {
+        lv_tick_inc(10);
+        lv_anim_refr_now();
+        TEST_ASSERT_LESS_THAN(bar_size / 4, inv_pixel_cnt());
+        TEST_ASSERT_TRUE(lv_test_partial_redraw_matches());
+    }
+
+    /*Both edges of a symmetrical bar and radius on the indicator*/
+    lv_bar_set_mode(bar, LV_BAR_MODE_SYMMETRICAL);
+    lv_bar_set_range(bar, -100, 100);
+    lv_obj_set_style_radius(bar, 10, LV_PART_INDICATOR);
+    lv_obj_set_style_pad_all(bar, 3, LV_PART_MAIN);
+    lv_bar_set_value(bar, 20, LV_ANIM_OFF);
+    TEST_ASSERT_TRUE(lv_test_partial_redraw_matches());
+    lv_bar_set_value(bar, -20, LV_ANIM_OFF);
+    TEST_ASSERT_LESS_THAN(bar_size / 2, inv_pixel_cnt());
+    TEST_ASSERT_TRUE(lv_test_partial_redraw_matches());
+
+    /*Vertical bar*/
+    lv_obj_set_size(bar, 20, 400);
+    lv_refr_now(NULL);
+    lv_bar_set_value(bar, 25, LV_ANIM_OFF);
+    TEST_ASSERT_LESS_THAN(bar_size / 2, inv_pixel_cnt());
+    TEST_ASSERT_TRUE(lv_test_partial_redraw_matches());
+
+    lv_disp_get_default()->driver->direct_mode = 0;
+}
+
+/*Draw the value next to the end of the indicator like `lv_example_bar_6`*/
+static void draw_value_event_cb(lv_event_t * e)
+{
+    lv_obj_draw_part_dsc_t * dsc = lv_event_get_draw_part_dsc(e);
+    if(dsc->part != LV_PART_INDICATOR) return;
+
+    lv_obj_t * obj = lv_event_get_target(e);
+    lv_draw_label_dsc_t label_dsc;
+    lv_draw_label_dsc_init(&label_dsc);
+
+    char buf[8];
+    lv_snprintf(buf, sizeof(buf), "%d", (int)lv_bar_get_value(obj));
+
+    lv_area_t txt_area;
+    txt_area.x1 = dsc->draw_area->x2 - 30;
+    txt_area.x2 = dsc->draw_area->x2 + 30;
+    txt_area.y1 = dsc->draw_area->y1;
+    txt_area.y2 = dsc->draw_area->y2;
+    lv_draw_label(dsc->draw_ctx, &label_dsc, &txt_area, buf, NULL);
+}
+
+void test_bar_value_change_should_redraw_what_the_draw_part_events_draw(void)
+{
+    lv_obj_set_size(bar, 400, 20);
+    lv_obj_center(bar);
+    lv_obj_add_event_cb(bar, draw_value_event_cb, LV_EVENT_DRAW_PART_END, NULL);
+    lv_bar_set_value(bar, 30, LV_ANIM_OFF);
+    lv_disp_get_default()->driver->direct_mode = 1;
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+
+    lv_obj_set_style_anim_time(bar, 100, LV_PART_MAIN);
+    lv_bar_set_value(bar, 70, LV_ANIM_ON);
+    uint32_t i;
+    for(i = 0; i < 10; i++) {
+        lv_tick_inc(10);
+        lv_anim_refr_now();
+        TEST_ASSERT_TRUE(lv_test_partial_redraw_matches());
+    }
+
+    lv_disp_get_default()->driver->direct_mode = 0;
+}
+
 #endif
@@ -0,0 +1,159 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include "lv_test_indev.h"
+
+static lv_obj_t * kb;
+
+void setUp(void)
+{
+    kb = lv_keyboard_create(lv_scr_act());
+    lv_refr_now(NULL);
+}
+
+void tearDown(void)
+{
+    lv_obj_del(kb);
+}
+
+/*Read the mouse without refreshing the display to see what was invalidated*/
+static void mouse_read(void)
+{
+    lv_indev_t * indev = lv_indev_get_next(NULL);
+    while(indev && lv_indev_get_type(indev) != LV_INDEV_TYPE_POINTER) indev = lv_indev_get_next(indev);
+    lv_indev_read_timer_cb(indev->driver->read_timer);
+}
+
+static void press_btn(uint16_t btn_id)
+{
+    lv_btnmatrix_t * btnm = (lv_btnmatrix_t *)kb;
+    lv_area_t a;
+    lv_area_copy(&a, &btnm->button_areas[btn_id]);
+    lv_area_move(&a, kb->coords.x1, kb->coords.y1);
+
+    lv_test_mouse_move_to(a.x1 + lv_area_get_width(&a) / 2, a.y1 + lv_area_get_height(&a) / 2);
+    lv_test_mouse_press();
+    mouse_read();
+}
+
+static lv_btnmatrix_dsc_cache_t * find_cache(lv_state_t state)
+{
+    lv_btnmatrix_t * btnm = (lv_btnmatrix_t *)kb;
+    uint32_t i;
+    for(i = 0; i < 3; i++) {
+        if(btnm->dsc_cache[i].valid && btnm->dsc_cache[i].state == state) return &btnm->dsc_cache[i];
+    }
+    return NULL;
+}
+
+void test_btnmatrix_press_should_invalidate_only_the_button(void)
+{
+    lv_disp_t * disp = lv_disp_get_default();
+    lv_coord_t kb_w = lv_obj_get_width(kb);
+
+    press_btn(3);
+    TEST_ASSERT_EQUAL_UINT16(3, lv_btnmatrix_get_selected_btn(kb));
+    TEST_ASSERT_GREATER_THAN(0, disp->inv_p);
+
+    uint32_t i;
+    for(i = 0; i < disp->inv_p; i++) {
+        if(disp->inv_area_joined[i]) continue;
+        TEST_ASSERT_LESS_THAN(kb_w / 4, lv_area_get_width(&disp->inv_areas[i]));
+    }
+    lv_refr_now(NULL);
+
+    lv_test_mouse_release();
+    mouse_read();
+    for(i = 0; i < disp->inv_p; i++) {
+        if(disp->inv_area_joined[i]) continue;
+        TEST_ASSERT_LESS_THAN(kb_w / 4, lv_area_get_width(&disp->inv_areas[i]));
+    }
+    lv_refr_now(NULL);
+}
+
+void test_btnmatrix_should_cache_the_text_sizes(void)
+{
+    lv_btnmatrix_t * btnm = (lv_btnmatrix_t *)kb;
+    TEST_ASSERT_GREATER_OR_EQUAL(0, btnm->txt_sizes[0].x);
+    TEST_ASSERT_GREATER_THAN(0, btnm->txt_sizes[0].y);
+
+    /*Changing the font makes the cache outdated*/
+    lv_point_t size_ori = btnm->txt_sizes[0];
+    lv_obj_set_style_text_font(kb, &lv_font_unscii_8, LV_PART_ITEMS);
+    lv_refr_now(NULL);
+    TEST_ASSERT_LESS_THAN(size_ori.y, btnm->txt_sizes[0].y);
+
+    /*A new map is measured again*/
+    static const char * map[] = {"A", "BBBBBBBB", ""};
+    lv_btnmatrix_set_map(kb, map);
+    TEST_ASSERT_LESS_THAN(0, btnm->txt_sizes[0].x);
+    lv_refr_now(NULL);
+    TEST_ASSERT_GREATER_THAN(btnm->txt_sizes[0].x, btnm->txt_sizes[1].x);
+}
+
+void test_btnmatrix_should_update_the_cached_styles(void)
+{
+    lv_btnmatrix_t * btnm = (lv_btnmatrix_t *)kb;
+    TEST_ASSERT_NOT_NULL(btnm->dsc_cache);
+    TEST_ASSERT_TRUE(btnm->dsc_cache[0].valid);
+
+    lv_obj_set_style_bg_color(kb, lv_color_hex(0x123456), LV_PART_ITEMS);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_HEX32(lv_color_to32(lv_color_hex(0x123456)),
+                            lv_color_to32(btnm->dsc_cache[0].rect_dsc.bg_color));
+
+    /*Changing a shared style is also noticed*/
+    static lv_style_t style;
+    lv_style_init(&style);
+    lv_obj_add_style(kb, &style, LV_PART_ITEMS | LV_STATE_PRESSED);
+    lv_style_set_radius(&style, 7);
+    lv_obj_report_style_change(&style);
+
+    press_btn(3);
+    lv_refr_now(NULL);
+    lv_btnmatrix_dsc_cache_t * cache = find_cache(LV_STATE_PRESSED);
+    TEST_ASSERT_NOT_NULL(cache);
+    TEST_ASSERT_EQUAL(7, cache->rect_dsc.radius);
+
+    lv_style_set_radius(&style, 9);
+    lv_obj_report_style_change(&style);
+    lv_refr_now(NULL);
+    cache = find_cache(LV_STATE_PRESSED);
+    TEST_ASSERT_NOT_NULL(cache);
+    TEST_ASSERT_EQUAL(9, cache->rect_dsc.radius);
+
+    lv_test_mouse_release();
+    mouse_read();
+    lv_obj_remove_style(kb, &style, LV_PART_ITEMS | LV_STATE_PRESSED);
+    lv_style_reset(&style);
+}
+
+void test_btnmatrix_keyboard_should_type_with_the_cached_descriptors(void)
+{
+    lv_btnmatrix_t * btnm = (lv_btnmatrix_t *)kb;
+    lv_obj_t * ta = lv_textarea_create(lv_scr_act());
+    lv_obj_set_height(ta, 60);
+    lv_textarea_set_text(ta, "");
+    lv_keyboard_set_textarea(kb, ta);
+    lv_refr_now(NULL);
+
+    char ref[32] = "";
+    uint16_t i;
+    for(i = 1; i < 10; i++) {
+        press_btn(i);
+        lv_refr_now(NULL);
+        lv_test_mouse_release();
+        mouse_read();
+        lv_refr_now(NULL);
+        strcat(ref, lv_btnmatrix_get_btn_text(kb, i));
+    }
+
+    TEST_ASSERT_EQUAL_STRING(ref, lv_textarea_get_text(ta));
+    TEST_ASSERT_TRUE(btnm->dsc_cache[0].valid);
+    TEST_ASSERT_NOT_NULL(find_cache(LV_STATE_PRESSED));
+
+    lv_obj_del(ta);
+}
+
+#endif
@@ -0,0 +1,93 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include "lv_test_helpers.h"
+
+#define CTRL_TODAY      LV_BTNMATRIX_CTRL_CUSTOM_1
+#define CTRL_HIGHLIGHT  LV_BTNMATRIX_CTRL_CUSTOM_2
+
+static lv_obj_t * calendar;
+static lv_obj_t * btnm;
+
+void setUp(void)
+{
+    calendar = lv_calendar_create(lv_scr_act());
+    lv_obj_set_size(calendar, 300, 300);
+    btnm = lv_calendar_get_btnmatrix(calendar);
+}
+
+void tearDown(void)
+{
+    lv_obj_del(calendar);
+}
+
+void test_calendar_month_change_should_update_the_days(void)
+{
+    static lv_calendar_date_t highlighted[] = {{2022, 2, 14}, {2022, 3, 1}, {2022, 2, 31}};
+    lv_calendar_set_today_date(calendar, 2022, 2, 22);
+    lv_calendar_set_highlighted_dates(calendar, highlighted, 3);
+    lv_calendar_set_showed_date(calendar, 2022, 2);
+
+    /*1 February 2022 is Tuesday, the 3rd day of the week*/
+    uint32_t first = 7 + 2;
+    uint32_t i;
+    for(i = 0; i < 7 * 7; i++) {
+        bool in_month = i >= first && i < first + 28;
+        TEST_ASSERT_EQUAL(!in_month, lv_btnmatrix_has_btn_ctrl(btnm, i, LV_BTNMATRIX_CTRL_DISABLED));
+        TEST_ASSERT_EQUAL(i == first + 13, lv_btnmatrix_has_btn_ctrl(btnm, i, CTRL_HIGHLIGHT));
+        TEST_ASSERT_EQUAL(i == first + 21, lv_btnmatrix_has_btn_ctrl(btnm, i, CTRL_TODAY));
+
+        /*The flags not managed by the calendar are kept*/
+        TEST_ASSERT_TRUE(lv_btnmatrix_has_btn_ctrl(btnm, i, LV_BTNMATRIX_CTRL_CLICK_TRIG));
+    }
+    TEST_ASSERT_EQUAL_STRING("30", lv_btnmatrix_get_btn_text(btnm, 7));
+    TEST_ASSERT_EQUAL_STRING("1", lv_btnmatrix_get_btn_text(btnm, first));
+    TEST_ASSERT_EQUAL_STRING("28", lv_btnmatrix_get_btn_text(btnm, first + 27));
+    TEST_ASSERT_EQUAL_STRING("1", lv_btnmatrix_get_btn_text(btnm, first + 28));
+
+    /*1 March 2022 is Tuesday too*/
+    lv_calendar_set_showed_date(calendar, 2022, 3);
+    for(i = 0; i < 7 * 7; i++) {
+        TEST_ASSERT_EQUAL(i == first, lv_btnmatrix_has_btn_ctrl(btnm, i, CTRL_HIGHLIGHT));
+        TEST_ASSERT_FALSE(lv_btnmatrix_has_btn_ctrl(btnm, i, CTRL_TODAY));
+    }
+}
+
+void test_calendar_month_change_should_measure_the_new_texts(void)
+{
+    lv_btnmatrix_t * btnm_p = (lv_btnmatrix_t *)btnm;
+    lv_calendar_set_showed_date(calendar, 2022, 2);
+    lv_refr_now(NULL);
+
+    /*The text of the days are changed in place so the sizes have to be measured again*/
+    lv_calendar_set_showed_date(calendar, 2022, 3);
+    uint32_t i;
+    for(i = 7; i < 7 * 7; i++) {
+        TEST_ASSERT_LESS_THAN(0, btnm_p->txt_sizes[i].x);
+    }
+    lv_refr_now(NULL);
+
+    /*"1" is narrower than "31". 1 March 2022 is Tuesday.*/
+    lv_coord_t w_1 = btnm_p->txt_sizes[7 + 2].x;
+    lv_coord_t w_31 = btnm_p->txt_sizes[7 + 2 + 30].x;
+    TEST_ASSERT_GREATER_THAN(w_1, w_31);
+}
+
+void test_calendar_month_change_should_draw_like_a_new_calendar(void)
+{
+    uint32_t i;
+    for(i = 0; i < 100; i++) {
+        lv_calendar_set_showed_date(calendar, 2000 + i / 12, 1 + i % 12);
+        lv_refr_now(NULL);
+    }
+    lv_test_save_ref_screen();
+
+    lv_obj_del(calendar);
+    setUp();
+    lv_calendar_set_showed_date(calendar, 2008, 4);
+    lv_test_refr_screen();
+    TEST_ASSERT_EQUAL_MEMORY(test_ref_fb, test_fb, FB_SIZE * sizeof(lv_color_t));
+}
+
+#endif
@@ -0,0 +1,161 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#define CANVAS_W    100
+#define CANVAS_H    80
+#define LINE_CNT    1000
+
+static lv_color_t buf1[LV_CANVAS_BUF_SIZE_TRUE_COLOR(CANVAS_W, CANVAS_H)];
+static lv_color_t buf2[LV_CANVAS_BUF_SIZE_TRUE_COLOR(CANVAS_W, CANVAS_H)];
+static lv_obj_t * canvas;
+
+void setUp(void)
+{
+    canvas = lv_canvas_create(lv_scr_act());
+    lv_canvas_set_buffer(canvas, buf1, CANVAS_W, CANVAS_H, LV_IMG_CF_TRUE_COLOR);
+    lv_canvas_fill_bg(canvas, lv_color_white(), LV_OPA_COVER);
+    lv_canvas_set_buffer(canvas, buf2, CANVAS_W, CANVAS_H, LV_IMG_CF_TRUE_COLOR);
+    lv_canvas_fill_bg(canvas, lv_color_white(), LV_OPA_COVER);
+    lv_refr_now(NULL);
+}
+
+void tearDown(void)
+{
+    lv_obj_del(canvas);
+}
+
+static void draw_lines(uint32_t cnt)
+{
+    lv_draw_line_dsc_t dsc;
+    lv_draw_line_dsc_init(&dsc);
+    dsc.width = 2;
+
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        /*Short segments like when plotting*/
+        lv_coord_t x = i % CANVAS_W;
+        lv_coord_t y = (i * 7) % CANVAS_H;
+        lv_point_t p[2] = {{x, y}, {x + (i * 13) % 8, y + (i * 3) % 8}};
+        dsc.color = lv_color_hex(i * 0x10305);
+        lv_canvas_draw_line(canvas, p, 2, &dsc);
+    }
+}
+
+static void draw_misc(void)
+{
+    lv_draw_rect_dsc_t rect_dsc;
+    lv_draw_rect_dsc_init(&rect_dsc);
+    rect_dsc.bg_color = lv_palette_main(LV_PALETTE_RED);
+    rect_dsc.radius = 5;
+    lv_canvas_draw_rect(canvas, 10, 10, 40, 30, &rect_dsc);
+
+    lv_draw_label_dsc_t label_dsc;
+    lv_draw_label_dsc_init(&label_dsc);
+    lv_canvas_draw_text(canvas, 5, 40, 90, &label_dsc, "Canvas");
+
+    lv_draw_arc_dsc_t arc_dsc;
+    lv_draw_arc_dsc_init(&arc_dsc);
+    arc_dsc.width = 4;
+    lv_canvas_draw_arc(canvas, 70, 40, 20, 0, 270, &arc_dsc);
+
+    draw_lines(20);
+}
+
+void test_canvas_session_should_draw_like_single_calls(void)
+{
+    lv_canvas_set_buffer(canvas, buf1, CANVAS_W, CANVAS_H, LV_IMG_CF_TRUE_COLOR);
+    draw_misc();
+
+    lv_canvas_set_buffer(canvas, buf2, CANVAS_W, CANVAS_H, LV_IMG_CF_TRUE_COLOR);
+    lv_canvas_draw_begin(canvas);
+    draw_misc();
+    lv_canvas_draw_end(canvas);
+
+    TEST_ASSERT_EQUAL_MEMORY(buf1, buf2, sizeof(buf1));
+}
+
+void test_canvas_session_should_invalidate_the_changed_area_once(void)
+{
+    lv_disp_t * disp = lv_disp_get_default();
+
+    lv_canvas_draw_begin(canvas);
+
+    lv_draw_rect_dsc_t rect_dsc;
+    lv_draw_rect_dsc_init(&rect_dsc);
+    lv_canvas_draw_rect(canvas, 10, 10, 5, 5, &rect_dsc);
+    lv_canvas_draw_rect(canvas, 30, 20, 5, 5, &rect_dsc);
+    lv_canvas_set_px_color(canvas, 40, 50, lv_color_black());
+    TEST_ASSERT_EQUAL(0, disp->inv_p);
+
+    lv_canvas_draw_end(canvas);
+    TEST_ASSERT_EQUAL(1, disp->inv_p);
+
+    lv_area_t content;
+    lv_obj_get_content_coords(canvas, &content);
+    TEST_ASSERT_EQUAL(content.x1 + 10, disp->inv_areas[0].x1);
+    TEST_ASSERT_EQUAL(content.y1 + 10, disp->inv_areas[0].y1);
+    TEST_ASSERT_EQUAL(content.x1 + 40, disp->inv_areas[0].x2);
+    TEST_ASSERT_EQUAL(content.y1 + 50, disp->inv_areas[0].y2);
+
+    /*Nothing is drawn*/
+    lv_refr_now(NULL);
+    lv_canvas_draw_begin(canvas);
+    lv_canvas_draw_end(canvas);
+    TEST_ASSERT_EQUAL(0, disp->inv_p);
+}
+
+void test_canvas_calls_out_of_session_should_invalidate_the_canvas_once(void)
+{
+    lv_disp_t * disp = lv_disp_get_default();
+
+    /*Many pixels and drawings don't fill the invalidation buffer of the display*/
+    lv_draw_rect_dsc_t rect_dsc;
+    lv_draw_rect_dsc_init(&rect_dsc);
+    uint32_t i;
+    for(i = 0; i < LV_INV_BUF_SIZE * 2; i++) {
+        lv_canvas_set_px_color(canvas, i % CANVAS_W, i / CANVAS_W, lv_color_black());
+        lv_canvas_draw_rect(canvas, i % (CANVAS_W - 5), 10, 5, 5, &rect_dsc);
+    }
+    TEST_ASSERT_EQUAL(1, disp->inv_p);
+    TEST_ASSERT_TRUE(_lv_area_is_equal(&canvas->coords, &disp->inv_areas[0]));
+
+    /*Zoomed canvases are invalidated entirely in a session too*/
+    lv_refr_now(NULL);
+    lv_img_set_zoom(canvas, 512);
+    lv_refr_now(NULL);
+    lv_canvas_draw_begin(canvas);
+    lv_canvas_draw_rect(canvas, 10, 10, 5, 5, &rect_dsc);
+    lv_canvas_draw_end(canvas);
+    TEST_ASSERT_EQUAL(1, disp->inv_p);
+    TEST_ASSERT_GREATER_THAN(CANVAS_W, lv_area_get_width(&disp->inv_areas[0]));
+}
+
+void test_canvas_many_lines_in_a_session_should_draw_like_single_calls(void)
+{
+    lv_disp_t * disp = lv_disp_get_default();
+
+    lv_canvas_set_buffer(canvas, buf1, CANVAS_W, CANVAS_H, LV_IMG_CF_TRUE_COLOR);
+    draw_lines(LINE_CNT);
+
+    lv_canvas_set_buffer(canvas, buf2, CANVAS_W, CANVAS_H, LV_IMG_CF_TRUE_COLOR);
+    lv_refr_now(NULL);
+    lv_canvas_draw_begin(canvas);
+    draw_lines(LINE_CNT);
+    TEST_ASSERT_EQUAL(0, disp->inv_p);
+    lv_canvas_draw_end(canvas);
+
+    TEST_ASSERT_EQUAL_MEMORY(buf1, buf2, sizeof(buf1));
+
+    /*The lines cover the whole canvas, it's invalidated only once*/
+    lv_area_t content;
+    lv_obj_get_content_coords(canvas, &content);
+    TEST_ASSERT_EQUAL(1, disp->inv_p);
+    TEST_ASSERT_EQUAL(content.x1, disp->inv_areas[0].x1);
+    TEST_ASSERT_EQUAL(content.y1, disp->inv_areas[0].y1);
+    TEST_ASSERT_EQUAL(content.x2, disp->inv_areas[0].x2);
+    TEST_ASSERT_EQUAL(content.y2, disp->inv_areas[0].y2);
+}
+
+#endif
@@ -0,0 +1,279 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include "lv_test_helpers.h"
+
+#define POINT_CNT   100000
+
+static lv_obj_t * chart;
+static lv_chart_series_t * ser;
+
+void setUp(void)
+{
+    chart = lv_chart_create(lv_scr_act());
+    lv_obj_set_size(chart, 300, 200);
+    lv_obj_set_style_pad_all(chart, 0, 0);
+    lv_obj_set_style_border_width(chart, 0, 0);
+    lv_chart_set_point_count(chart, POINT_CNT);
+    lv_chart_set_range(chart, LV_CHART_AXIS_PRIMARY_Y, -1000, 1000);
+    ser = lv_chart_add_series(chart, lv_palette_main(LV_PALETTE_RED), LV_CHART_AXIS_PRIMARY_Y);
+
+    uint32_t i;
+    for(i = 0; i < POINT_CNT; i++) {
+        ser->y_points[i] = ((int32_t)(i * 7919) % 2000) - 1000;
+    }
+    lv_chart_refresh(chart);
+}
+
+void tearDown(void)
+{
+    lv_obj_del(chart);
+}
+
+/*Calculate the vertical line of each x with the original per point logic*/
+static void ref_env(lv_coord_t * env, lv_coord_t w, lv_coord_t h)
+{
+    uint32_t cnt = lv_chart_get_point_count(chart);
+    lv_coord_t x;
+    for(x = 0; x < w; x++) env[x * 2] = LV_COORD_MIN;
+
+    int32_t y_prev = h - ((ser->y_points[0] + 1000) * h) / 2000;
+    int32_t x_prev = 0;
+    int32_t y_min = y_prev;
+    int32_t y_max = y_prev;
+    uint32_t i;
+    for(i = 1; i < cnt; i++) {
+        int32_t x_act = ((int64_t)w * i) / (cnt - 1);
+        int32_t y_act = h - ((ser->y_points[i] + 1000) * h) / 2000;
+        if(ser->y_points[i - 1] != LV_CHART_POINT_NONE && ser->y_points[i] != LV_CHART_POINT_NONE) {
+            y_max = LV_MAX(y_max, y_act);
+            y_min = LV_MIN(y_min, y_act);
+            if(x_prev != x_act) {
+                env[(x_act - 1) * 2] = y_min;
+                env[(x_act - 1) * 2 + 1] = y_min == y_max ? y_max + 1 : y_max;
+                y_min = y_act;
+                y_max = y_act;
+            }
+        }
+        x_prev = x_act;
+    }
+}
+
+static void check_env(void)
+{
+    static lv_coord_t ref[300 * 2];
+    lv_coord_t w = lv_obj_get_content_width(chart);
+    lv_coord_t h = lv_obj_get_content_height(chart);
+    TEST_ASSERT_NOT_NULL(ser->env);
+    TEST_ASSERT_EQUAL(w, ser->env_w);
+
+    ref_env(ref, w, h);
+    lv_coord_t x;
+    for(x = 0; x < w; x++) {
+        TEST_ASSERT_EQUAL(ref[x * 2], ser->env[x * 2]);
+        if(ref[x * 2] != LV_COORD_MIN) TEST_ASSERT_EQUAL(ref[x * 2 + 1], ser->env[x * 2 + 1]);
+    }
+}
+
+void test_chart_should_handle_more_than_65535_points(void)
+{
+    TEST_ASSERT_EQUAL_UINT32(POINT_CNT, lv_chart_get_point_count(chart));
+
+    lv_chart_set_update_mode(chart, LV_CHART_UPDATE_MODE_CIRCULAR);
+    lv_chart_set_x_start_point(chart, ser, POINT_CNT - 1);
+    TEST_ASSERT_EQUAL_UINT32(POINT_CNT - 1, lv_chart_get_x_start_point(chart, ser));
+
+    lv_chart_set_value_by_id(chart, ser, POINT_CNT - 1, 1000);
+    TEST_ASSERT_EQUAL(1000, ser->y_points[POINT_CNT - 1]);
+
+    lv_point_t p;
+    lv_chart_get_point_pos_by_id(chart, ser, POINT_CNT - 1, &p);
+    TEST_ASSERT_EQUAL(lv_obj_get_content_width(chart), p.x);
+    lv_chart_get_point_pos_by_id(chart, ser, POINT_CNT / 2, &p);
+    TEST_ASSERT_EQUAL(lv_obj_get_content_width(chart) / 2, p.x);
+}
+
+static uint32_t cursor_draw_cnt;
+
+static void cursor_draw_event_cb(lv_event_t * e)
+{
+    lv_obj_draw_part_dsc_t * dsc = lv_event_get_draw_part_dsc(e);
+    if(lv_obj_draw_part_check_type(dsc, &lv_chart_class, LV_CHART_DRAW_PART_CURSOR)) cursor_draw_cnt++;
+}
+
+void test_chart_point_ids_should_not_collide_with_the_none_value(void)
+{
+    TEST_ASSERT_EQUAL_UINT32(LV_CHART_POINT_ID_NONE, lv_chart_get_pressed_point(chart));
+
+    lv_obj_add_event_cb(chart, cursor_draw_event_cb, LV_EVENT_DRAW_PART_BEGIN, NULL);
+    lv_chart_cursor_t * cursor = lv_chart_add_cursor(chart, lv_palette_main(LV_PALETTE_BLUE), LV_DIR_ALL);
+
+    /*Not assigned to a point yet*/
+    cursor_draw_cnt = 0;
+    lv_test_refr_screen();
+    TEST_ASSERT_EQUAL_UINT32(0, cursor_draw_cnt);
+
+    /*Used to be the "none" value without LV_USE_LARGE_COORD*/
+    lv_chart_set_cursor_point(chart, cursor, ser, INT16_MAX);
+    lv_test_refr_screen();
+    TEST_ASSERT_GREATER_THAN(0, cursor_draw_cnt);
+
+    cursor_draw_cnt = 0;
+    lv_chart_set_cursor_point(chart, cursor, ser, LV_CHART_POINT_ID_NONE);
+    lv_test_refr_screen();
+    TEST_ASSERT_EQUAL_UINT32(0, cursor_draw_cnt);
+}
+
+void test_chart_min_max_lines_should_match_the_data(void)
+{
+    lv_refr_now(NULL);
+    check_env();
+
+    /*Gaps*/
+    ser->y_points[1000] = LV_CHART_POINT_NONE;
+    ser->y_points[50000] = LV_CHART_POINT_NONE;
+    ser->y_points[50001] = LV_CHART_POINT_NONE;
+    lv_chart_refresh(chart);
+    lv_refr_now(NULL);
+    check_env();
+}
+
+void test_chart_min_max_lines_should_be_cached_until_the_data_changes(void)
+{
+    lv_refr_now(NULL);
+    TEST_ASSERT_TRUE(ser->env_valid);
+
+    /*Redrawing doesn't change the cache*/
+    ser->y_points[POINT_CNT / 2] = 1000;
+    lv_obj_invalidate(chart);
+    lv_refr_now(NULL);
+    TEST_ASSERT_TRUE(ser->env_valid);
+
+    /*Setting a value updates it*/
+    lv_chart_set_value_by_id(chart, ser, POINT_CNT / 2, -1000);
+    TEST_ASSERT_FALSE(ser->env_valid);
+    lv_refr_now(NULL);
+    check_env();
+
+    /*Resizing the chart updates it too*/
+    lv_obj_set_width(chart, 250);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(250, ser->env_w);
+    check_env();
+}
+
+void test_chart_cached_min_max_lines_should_draw_like_the_calculated_ones(void)
+{
+
+    /*The first drawing calculates the min/max lines*/
+    TEST_ASSERT_FALSE(ser->env_valid);
+    lv_test_save_ref_screen();
+
+    /*The next one uses them as they are*/
+    TEST_ASSERT_TRUE(ser->env_valid);
+    lv_test_refr_screen();
+    TEST_ASSERT_TRUE(ser->env_valid);
+    TEST_ASSERT_EQUAL_MEMORY(test_ref_fb, test_fb, FB_SIZE * sizeof(lv_color_t));
+}
+
+void test_chart_set_next_values_should_wrap_around(void)
+{
+    lv_chart_set_point_count(chart, 10);
+    lv_chart_set_all_value(chart, ser, 0);
+
+    static const lv_coord_t values[] = {1, 2, 3, 4, 5, 6, 7};
+    lv_chart_set_next_values(chart, ser, values, 7);
+    TEST_ASSERT_EQUAL_UINT32(7, lv_chart_get_x_start_point(chart, ser));
+    lv_chart_set_next_values(chart, ser, values, 7);
+    TEST_ASSERT_EQUAL_UINT32(4, lv_chart_get_x_start_point(chart, ser));
+
+    static const lv_coord_t ref1[] = {4, 5, 6, 7, 5, 6, 7, 1, 2, 3};
+    TEST_ASSERT_EQUAL_INT16_ARRAY(ref1, ser->y_points, 10);
+
+    /*Only the last 10 values are kept*/
+    static const lv_coord_t many[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12};
+    lv_chart_set_next_values(chart, ser, many, 12);
+    TEST_ASSERT_EQUAL_UINT32(6, lv_chart_get_x_start_point(chart, ser));
+    static const lv_coord_t ref2[] = {7, 8, 9, 10, 11, 12, 3, 4, 5, 6};
+    TEST_ASSERT_EQUAL_INT16_ARRAY(ref2, ser->y_points, 10);
+}
+
+void test_chart_shift_mode_should_not_invalidate_the_ticks(void)
+{
+    lv_disp_t * disp = lv_disp_get_default();
+    lv_obj_center(chart);
+    lv_chart_set_axis_tick(chart, LV_CHART_AXIS_PRIMARY_Y, 10, 5, 6, 2, true, 50);
+    lv_chart_set_axis_tick(chart, LV_CHART_AXIS_PRIMARY_X, 10, 5, 6, 2, true, 50);
+    lv_refr_now(NULL);
+
+    lv_chart_set_next_value(chart, ser, 10);
+    TEST_ASSERT_EQUAL(1, disp->inv_p);
+    TEST_ASSERT_EQUAL(chart->coords.x1, disp->inv_areas[0].x1);
+    TEST_ASSERT_EQUAL(chart->coords.x2, disp->inv_areas[0].x2);
+    TEST_ASSERT_EQUAL(chart->coords.y2, disp->inv_areas[0].y2);
+}
+
+void test_chart_circular_mode_should_invalidate_only_the_new_points(void)
+{
+    lv_disp_t * disp = lv_disp_get_default();
+    lv_chart_set_point_count(chart, 300);
+    lv_chart_set_update_mode(chart, LV_CHART_UPDATE_MODE_CIRCULAR);
+    lv_obj_set_style_line_width(chart, 2, LV_PART_ITEMS);
+    lv_obj_set_style_size(chart, 0, LV_PART_INDICATOR);
+    lv_refr_now(NULL);
+
+    static const lv_coord_t values[] = {1, 2, 3, 4, 5};
+    lv_chart_set_next_values(chart, ser, values, 5);
+    TEST_ASSERT_EQUAL(1, disp->inv_p);
+    TEST_ASSERT_LESS_THAN(20, lv_area_get_width(&disp->inv_areas[0]));
+}
+
+/*Add `cnt` values in batches of `batch` values and redraw the screen after each batch*/
+static void stream_values(uint32_t cnt, uint32_t batch)
+{
+    lv_chart_set_all_value(chart, ser, 0);
+    lv_chart_set_x_start_point(chart, ser, 0);
+    lv_test_refr_screen();
+
+    lv_coord_t values[10];
+    uint32_t i;
+    for(i = 0; i < cnt; i += batch) {
+        uint32_t j;
+        for(j = 0; j < batch; j++) values[j] = ((int32_t)((i + j) * 7919) % 2000) - 1000;
+
+        if(batch == 1) lv_chart_set_next_value(chart, ser, values[0]);
+        else lv_chart_set_next_values(chart, ser, values, batch);
+        lv_refr_now(NULL);
+    }
+
+    lv_test_refr_screen();
+}
+
+void test_chart_next_values_should_draw_like_single_values(void)
+{
+    static lv_coord_t ref_points[100];
+
+    lv_obj_center(chart);
+    lv_chart_set_axis_tick(chart, LV_CHART_AXIS_PRIMARY_Y, 10, 5, 6, 2, true, 50);
+    lv_chart_set_axis_tick(chart, LV_CHART_AXIS_PRIMARY_X, 10, 5, 6, 2, true, 50);
+    lv_chart_set_point_count(chart, 100);
+
+    lv_chart_update_mode_t modes[] = {LV_CHART_UPDATE_MODE_SHIFT, LV_CHART_UPDATE_MODE_CIRCULAR};
+    uint32_t m;
+    for(m = 0; m < 2; m++) {
+        lv_chart_set_update_mode(chart, modes[m]);
+
+        stream_values(150, 1);
+        lv_memcpy(test_ref_fb, test_fb, FB_SIZE * sizeof(lv_color_t));
+        lv_memcpy(ref_points, ser->y_points, sizeof(ref_points));
+        uint32_t start = lv_chart_get_x_start_point(chart, ser);
+
+        stream_values(150, 10);
+        TEST_ASSERT_EQUAL_UINT32(start, lv_chart_get_x_start_point(chart, ser));
+        TEST_ASSERT_EQUAL_INT16_ARRAY(ref_points, ser->y_points, 100);
+        TEST_ASSERT_EQUAL_MEMORY(test_ref_fb, test_fb, FB_SIZE * sizeof(lv_color_t));
+    }
+}
+
+#endif
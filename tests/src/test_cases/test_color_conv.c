@@ -0,0 +1,146 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#define PX_CNT      67      /*Not a multiple of a vector's size*/
+
+static uint32_t src_buf[PX_CNT + 1];
+static uint32_t dst_buf[PX_CNT + 1];
+static uint32_t ref_buf[PX_CNT + 1];
+
+static const uint8_t fmt_layout[][5] = {
+    [LV_COLOR_CONV_RGBA8888] = {0, 1, 2, 3, 4},
+    [LV_COLOR_CONV_BGRA8888] = {2, 1, 0, 3, 4},
+    [LV_COLOR_CONV_RGB888] = {0, 1, 2, 0xFF, 3},
+    [LV_COLOR_CONV_BGR888] = {2, 1, 0, 0xFF, 3},
+};
+
+void setUp(void)
+{
+    uint32_t seed = 1;
+    uint32_t i;
+    for(i = 0; i < PX_CNT + 1; i++) {
+        seed = seed * 1103515245 + 12345;
+        src_buf[i] = seed;
+    }
+}
+
+void tearDown(void)
+{
+}
+
+/*Convert the pixels one by one with `lv_color_make()`*/
+static void ref_conv(uint8_t * dst, const uint8_t * src, lv_color_conv_fmt_t fmt, bool alpha)
+{
+    const uint8_t * l = fmt_layout[fmt];
+    uint32_t dst_px_size = alpha ? LV_IMG_PX_SIZE_ALPHA_BYTE : sizeof(lv_color_t);
+    uint32_t i;
+    for(i = 0; i < PX_CNT; i++) {
+        const uint8_t * s = &src[i * l[4]];
+        lv_color_t c = lv_color_make(s[l[0]], s[l[1]], s[l[2]]);
+        lv_memcpy(&dst[i * dst_px_size], &c, sizeof(c));
+        if(alpha) dst[(i + 1) * dst_px_size - 1] = l[3] == 0xFF ? 0xFF : s[l[3]];
+    }
+}
+
+static void check_fmt(lv_color_conv_fmt_t fmt, bool alpha)
+{
+    uint32_t dst_size = PX_CNT * (alpha ? LV_IMG_PX_SIZE_ALPHA_BYTE : sizeof(lv_color_t));
+    ref_conv((uint8_t *)ref_buf, (uint8_t *)src_buf, fmt, alpha);
+
+    /*To an other buffer*/
+    lv_memset_00(dst_buf, sizeof(dst_buf));
+    if(alpha) lv_color_conv_to_native_alpha(dst_buf, src_buf, PX_CNT, fmt);
+    else lv_color_conv_to_native(dst_buf, src_buf, PX_CNT, fmt);
+    TEST_ASSERT_EQUAL_MEMORY(ref_buf, dst_buf, dst_size);
+
+    /*In place*/
+    lv_memcpy(dst_buf, src_buf, sizeof(src_buf));
+    if(alpha) lv_color_conv_to_native_alpha(dst_buf, dst_buf, PX_CNT, fmt);
+    else lv_color_conv_to_native(dst_buf, dst_buf, PX_CNT, fmt);
+    TEST_ASSERT_EQUAL_MEMORY(ref_buf, dst_buf, dst_size);
+
+    /*Not aligned source*/
+    uint8_t * src_unaligned = (uint8_t *)src_buf + 1;
+    ref_conv((uint8_t *)ref_buf, src_unaligned, fmt, alpha);
+    lv_memset_00(dst_buf, sizeof(dst_buf));
+    if(alpha) lv_color_conv_to_native_alpha(dst_buf, src_unaligned, PX_CNT, fmt);
+    else lv_color_conv_to_native(dst_buf, src_unaligned, PX_CNT, fmt);
+    TEST_ASSERT_EQUAL_MEMORY(ref_buf, dst_buf, dst_size);
+}
+
+void test_color_conv_rgba8888(void)
+{
+    check_fmt(LV_COLOR_CONV_RGBA8888, false);
+    check_fmt(LV_COLOR_CONV_RGBA8888, true);
+}
+
+void test_color_conv_bgra8888(void)
+{
+    check_fmt(LV_COLOR_CONV_BGRA8888, false);
+    check_fmt(LV_COLOR_CONV_BGRA8888, true);
+}
+
+void test_color_conv_rgb888(void)
+{
+    check_fmt(LV_COLOR_CONV_RGB888, false);
+    check_fmt(LV_COLOR_CONV_RGB888, true);
+}
+
+void test_color_conv_bgr888(void)
+{
+    check_fmt(LV_COLOR_CONV_BGR888, false);
+    check_fmt(LV_COLOR_CONV_BGR888, true);
+}
+
+void test_color_conv_yuv420(void)
+{
+    /*2x2 blocks of black, white, red and blue with luma stride padding*/
+    static const uint8_t y[4][8] = {
+        {16, 16, 235, 235, 0, 0, 0, 0},
+        {16, 16, 235, 235, 0, 0, 0, 0},
+        {81, 81, 41, 41, 0, 0, 0, 0},
+        {81, 81, 41, 41, 0, 0, 0, 0},
+    };
+    static const uint8_t u[2][2] = {{128, 128}, {90, 240}};
+    static const uint8_t v[2][2] = {{128, 128}, {240, 110}};
+    static const lv_color32_t ref[4] = {
+        {.full = 0xFF000000}, {.full = 0xFFFFFFFF}, {.full = 0xFFFF0000}, {.full = 0xFF0000FF}
+    };
+
+    lv_color_t dst[4 * 4];
+    lv_color_conv_yuv420(dst, &y[0][0], &u[0][0], &v[0][0], 8, 2, 4, 4);
+
+    uint32_t i;
+    for(i = 0; i < 16; i++) {
+        const lv_color32_t * r = &ref[(i / 8) * 2 + (i % 4) / 2];
+        lv_color32_t c;
+        c.full = lv_color_to32(dst[i]);
+        TEST_ASSERT_UINT8_WITHIN(4, r->ch.red, c.ch.red);
+        TEST_ASSERT_UINT8_WITHIN(4, r->ch.green, c.ch.green);
+        TEST_ASSERT_UINT8_WITHIN(4, r->ch.blue, c.ch.blue);
+    }
+}
+
+void test_color_hsv_to_rgb_array(void)
+{
+    /*Every hue with a few saturations and values*/
+    static const uint8_t sv[] = {0, 1, 19, 20, 50, 99, 100};
+    static lv_color_hsv_t hsv[361 * sizeof(sv)];
+    static lv_color_t rgb[361 * sizeof(sv)];
+    uint32_t i;
+    for(i = 0; i < 361 * sizeof(sv); i++) {
+        hsv[i].h = i % 361;
+        hsv[i].s = sv[(i / 361) % sizeof(sv)];
+        hsv[i].v = sv[(i / 361 + 3) % sizeof(sv)];
+    }
+
+    lv_color_hsv_to_rgb_array(hsv, rgb, 361 * sizeof(sv));
+    for(i = 0; i < 361 * sizeof(sv); i++) {
+        lv_color_t ref = lv_color_hsv_to_rgb(hsv[i].h, hsv[i].s, hsv[i].v);
+        TEST_ASSERT_EQUAL_HEX32(lv_color_to32(ref), lv_color_to32(rgb[i]));
+    }
+}
+
+#endif
@@ -0,0 +1,141 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include "lv_test_helpers.h"
+
+static lv_obj_t * cw;
+
+void setUp(void)
+{
+    cw = lv_colorwheel_create(lv_scr_act(), true);
+    lv_obj_set_size(cw, 200, 200);
+    lv_obj_center(cw);
+}
+
+void tearDown(void)
+{
+    lv_obj_del(cw);
+}
+
+/*Only the old and new area of the knob should be invalidated*/
+static void check_knob_only_invalidated(void)
+{
+    lv_disp_t * disp = lv_disp_get_default();
+    TEST_ASSERT_GREATER_THAN(0, disp->inv_p);
+    uint32_t i;
+    for(i = 0; i < disp->inv_p; i++) {
+        if(disp->inv_area_joined[i]) continue;
+        TEST_ASSERT_LESS_THAN(lv_area_get_size(&cw->coords) / 4, lv_area_get_size(&disp->inv_areas[i]));
+    }
+}
+
+void test_colorwheel_ring_cache_should_draw_like_without_cache(void)
+{
+    lv_colorwheel_set_mode(cw, LV_COLORWHEEL_MODE_SATURATION);
+    lv_colorwheel_set_hsv(cw, (lv_color_hsv_t) {
+        .h = 200, .s = 60, .v = 80
+    });
+    lv_test_save_ref_screen();
+
+    lv_colorwheel_set_ring_cache(cw, true);
+    lv_test_refr_screen();
+    TEST_ASSERT_NOT_NULL(((lv_colorwheel_t *)cw)->ring_img);
+
+    /*The anti-aliased edges might be blended a little bit differently*/
+    TEST_ASSERT_LESS_OR_EQUAL(4, lv_test_ref_screen_diff());
+}
+
+void test_colorwheel_knob_move_should_invalidate_only_the_knob(void)
+{
+    lv_colorwheel_t * colorwheel = (lv_colorwheel_t *)cw;
+    lv_refr_now(NULL);
+
+    /*Also without the cache*/
+    lv_colorwheel_set_hsv(cw, (lv_color_hsv_t) {
+        .h = 90, .s = 100, .v = 100
+    });
+    check_knob_only_invalidated();
+    lv_refr_now(NULL);
+
+    lv_colorwheel_set_ring_cache(cw, true);
+    lv_refr_now(NULL);
+    const lv_img_dsc_t * img = colorwheel->ring_img;
+    TEST_ASSERT_NOT_NULL(img);
+
+    lv_colorwheel_set_hsv(cw, (lv_color_hsv_t) {
+        .h = 180, .s = 100, .v = 100
+    });
+    check_knob_only_invalidated();
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_PTR(img, colorwheel->ring_img);
+
+    /*The saturation is shown by the ring in hue mode*/
+    lv_colorwheel_set_hsv(cw, (lv_color_hsv_t) {
+        .h = 180, .s = 50, .v = 100
+    });
+    TEST_ASSERT_NULL(colorwheel->ring_img);
+    lv_refr_now(NULL);
+    TEST_ASSERT_NOT_NULL(colorwheel->ring_img);
+
+    /*In saturation mode the saturation moves only the knob*/
+    lv_colorwheel_set_mode(cw, LV_COLORWHEEL_MODE_SATURATION);
+    TEST_ASSERT_NULL(colorwheel->ring_img);
+    lv_refr_now(NULL);
+    img = colorwheel->ring_img;
+    lv_colorwheel_set_hsv(cw, (lv_color_hsv_t) {
+        .h = 180, .s = 70, .v = 100
+    });
+    check_knob_only_invalidated();
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_PTR(img, colorwheel->ring_img);
+
+    /*The size and the styles are followed too*/
+    lv_obj_set_size(cw, 150, 150);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(150, colorwheel->ring_img->header.w);
+
+    uint32_t style_cnt = colorwheel->ring_img_style_cnt;
+    lv_obj_set_style_line_opa(cw, LV_OPA_50, LV_PART_MAIN);
+    lv_refr_now(NULL);
+    TEST_ASSERT_NOT_NULL(colorwheel->ring_img);
+    TEST_ASSERT_NOT_EQUAL(style_cnt, colorwheel->ring_img_style_cnt);
+
+    lv_colorwheel_set_ring_cache(cw, false);
+    TEST_ASSERT_NULL(colorwheel->ring_img);
+}
+
+void test_colorwheel_moving_knob_should_draw_like_without_cache(void)
+{
+    lv_obj_t * ref_cw = lv_colorwheel_create(lv_scr_act(), true);
+    lv_obj_set_size(ref_cw, 200, 200);
+    lv_obj_center(ref_cw);
+
+    lv_colorwheel_set_ring_cache(cw, true);
+    lv_refr_now(NULL);
+    const lv_img_dsc_t * img = ((lv_colorwheel_t *)cw)->ring_img;
+    TEST_ASSERT_NOT_NULL(img);
+
+    uint32_t h;
+    for(h = 0; h < 360; h += 50) {
+        lv_color_hsv_t hsv = {.h = h, .s = 100, .v = 100};
+        lv_colorwheel_set_hsv(cw, hsv);
+        lv_colorwheel_set_hsv(ref_cw, hsv);
+
+        lv_obj_add_flag(cw, LV_OBJ_FLAG_HIDDEN);
+        lv_obj_clear_flag(ref_cw, LV_OBJ_FLAG_HIDDEN);
+        lv_test_save_ref_screen();
+
+        lv_obj_clear_flag(cw, LV_OBJ_FLAG_HIDDEN);
+        lv_obj_add_flag(ref_cw, LV_OBJ_FLAG_HIDDEN);
+        lv_test_refr_screen();
+
+        /*The same image is used for every knob position*/
+        TEST_ASSERT_EQUAL_PTR(img, ((lv_colorwheel_t *)cw)->ring_img);
+        TEST_ASSERT_LESS_OR_EQUAL(4, lv_test_ref_screen_diff());
+    }
+
+    lv_obj_del(ref_cw);
+}
+
+#endif
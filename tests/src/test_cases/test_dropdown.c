@@ -441,5 +441,53 @@ void test_dropdown_should_list_on_top(void)
     TEST_ASSERT_EQUAL_INT(2, lv_obj_get_index(list));
 }
 
+void test_dropdown_many_options(void)
+{
+    /*"Option 0\nOption 1\n ... Option 4999"*/
+    uint32_t opt_cnt = 5000;
+    char * opts = lv_mem_alloc(opt_cnt * 16);
+    uint32_t len = 0;
+    uint32_t i;
+    for(i = 0; i < opt_cnt; i++) {
+        len += lv_snprintf(&opts[len], 16, i == 0 ? "Option %d" : "\nOption %d", i);
+    }
+
+    lv_obj_t * dd = lv_dropdown_create(lv_scr_act());
+    lv_dropdown_set_options(dd, opts);
+    lv_dropdown_open(dd);
+    lv_refr_now(NULL);
+    lv_mem_free(opts);
+
+    TEST_ASSERT_EQUAL(opt_cnt, lv_dropdown_get_option_cnt(dd));
+
+    char buf[32];
+    lv_dropdown_set_selected(dd, 4321);
+    lv_dropdown_get_selected_str(dd, buf, sizeof(buf));
+    TEST_ASSERT_EQUAL_STRING("Option 4321", buf);
+
+    lv_dropdown_set_selected(dd, opt_cnt - 1);
+    lv_dropdown_get_selected_str(dd, buf, sizeof(buf));
+    TEST_ASSERT_EQUAL_STRING("Option 4999", buf);
+
+    /*The offsets follow the inserted options*/
+    lv_dropdown_add_option(dd, "First", 0);
+    lv_dropdown_add_option(dd, "Last", LV_DROPDOWN_POS_LAST);
+    TEST_ASSERT_EQUAL(opt_cnt + 2, lv_dropdown_get_option_cnt(dd));
+    lv_dropdown_set_selected(dd, 0);
+    lv_dropdown_get_selected_str(dd, buf, sizeof(buf));
+    TEST_ASSERT_EQUAL_STRING("First", buf);
+    lv_dropdown_set_selected(dd, 4322);
+    lv_dropdown_get_selected_str(dd, buf, sizeof(buf));
+    TEST_ASSERT_EQUAL_STRING("Option 4321", buf);
+    lv_dropdown_set_selected(dd, opt_cnt + 1);
+    lv_dropdown_get_selected_str(dd, buf, sizeof(buf));
+    TEST_ASSERT_EQUAL_STRING("Last", buf);
+
+    lv_dropdown_clear_options(dd);
+    TEST_ASSERT_EQUAL(0, lv_dropdown_get_option_cnt(dd));
+    lv_dropdown_get_selected_str(dd, buf, sizeof(buf));
+    TEST_ASSERT_EQUAL_STRING("", buf);
+}
+
 
 #endif
@@ -0,0 +1,142 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include "lv_test_helpers.h"
+
+#if LV_USE_FREETYPE
+
+#define FONT_PATH   "../examples/libs/freetype/arial.ttf"
+#define TEXT        "The quick brown fox jumps over the lazy dog. 0123456789 ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+
+static lv_ft_info_t info;
+static lv_obj_t * label;
+
+void setUp(void)
+{
+    /*FreeType is initialized by lv_init()*/
+    lv_ft_glyph_cache_set_size(64 * 1024);
+
+    info.name = FONT_PATH;
+    info.weight = 24;
+    info.style = FT_FONT_STYLE_NORMAL;
+    info.mem = NULL;
+    TEST_ASSERT_TRUE(lv_ft_font_init(&info));
+
+    label = lv_label_create(lv_scr_act());
+    lv_obj_set_width(label, 400);
+    lv_obj_set_style_text_font(label, info.font, 0);
+    lv_label_set_text(label, TEXT);
+}
+
+void tearDown(void)
+{
+    lv_obj_del(label);
+    lv_ft_font_destroy(info.font);
+    lv_ft_glyph_cache_clear();
+}
+
+void test_freetype_glyphs_should_render_the_same_after_eviction(void)
+{
+    lv_ft_glyph_cache_stat_t stat;
+
+    /*Rendered by FreeType only*/
+    lv_ft_glyph_cache_set_size(0);
+    lv_test_save_ref_screen();
+
+    /*Fill the cache and draw from it*/
+    lv_ft_glyph_cache_set_size(64 * 1024);
+    lv_test_refr_screen();
+    lv_ft_glyph_cache_get_stat(&stat);
+    TEST_ASSERT_GREATER_THAN(0, stat.entry_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stat.evictions);
+    TEST_ASSERT_EQUAL_MEMORY(test_ref_fb, test_fb, FB_SIZE * sizeof(lv_color_t));
+
+    uint32_t hits = stat.hits;
+    lv_test_refr_screen();
+    lv_ft_glyph_cache_get_stat(&stat);
+    TEST_ASSERT_GREATER_THAN(hits, stat.hits);
+    TEST_ASSERT_EQUAL_MEMORY(test_ref_fb, test_fb, FB_SIZE * sizeof(lv_color_t));
+
+    /*Only a few glyphs fit so they are evicted continuously while drawing*/
+    lv_ft_glyph_cache_set_size(stat.used_bytes / stat.entry_cnt * 4);
+    lv_ft_glyph_cache_get_stat(&stat);
+    TEST_ASSERT_GREATER_THAN(0, stat.evictions);
+    uint32_t evictions = stat.evictions;
+    lv_test_refr_screen();
+    lv_ft_glyph_cache_get_stat(&stat);
+    TEST_ASSERT_GREATER_THAN(evictions, stat.evictions);
+    TEST_ASSERT_LESS_OR_EQUAL(stat.max_bytes, stat.used_bytes);
+    TEST_ASSERT_EQUAL_MEMORY(test_ref_fb, test_fb, FB_SIZE * sizeof(lv_color_t));
+
+    /*A font created again finds the glyphs of the destroyed one*/
+    lv_ft_glyph_cache_set_size(64 * 1024);
+    lv_test_refr_screen();
+    lv_ft_font_destroy(info.font);
+    TEST_ASSERT_TRUE(lv_ft_font_init(&info));
+    lv_obj_set_style_text_font(label, info.font, 0);
+    lv_ft_glyph_cache_get_stat(&stat);
+    uint32_t misses = stat.misses;
+    lv_test_refr_screen();
+    lv_ft_glyph_cache_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(misses, stat.misses);
+    TEST_ASSERT_EQUAL_MEMORY(test_ref_fb, test_fb, FB_SIZE * sizeof(lv_color_t));
+}
+
+/*Draw the label with a new face, destroy the font and evict its glyphs*/
+static void draw_with_face_and_evict(const char * name)
+{
+    lv_ft_info_t info2 = info;
+    info2.name = name;
+
+    lv_ft_glyph_cache_set_size(64 * 1024);
+    TEST_ASSERT_TRUE(lv_ft_font_init(&info2));
+    lv_obj_set_style_text_font(label, info2.font, 0);
+    lv_test_refr_screen();
+    lv_obj_set_style_text_font(label, info.font, 0);
+    lv_ft_font_destroy(info2.font);
+
+    /*The cached glyphs keep the face's name until they are evicted*/
+    lv_ft_glyph_cache_stat_t stat;
+    lv_ft_glyph_cache_get_stat(&stat);
+    TEST_ASSERT_GREATER_THAN(0, stat.entry_cnt);
+    lv_ft_glyph_cache_set_size(0);
+    lv_ft_glyph_cache_get_stat(&stat);
+    TEST_ASSERT_EQUAL_UINT32(0, stat.entry_cnt);
+}
+
+void test_freetype_evicted_glyphs_should_release_the_face(void)
+{
+    /*The same file with other names to have separate faces. The first round allocates the buffers of drawing.*/
+    draw_with_face_and_evict("./" FONT_PATH);
+    uint32_t mem_before = lv_test_get_free_mem();
+    draw_with_face_and_evict("././" FONT_PATH);
+
+    LV_HEAP_CHECK(TEST_ASSERT_EQUAL_UINT32(mem_before, lv_test_get_free_mem()));
+}
+
+#else /*LV_USE_FREETYPE*/
+
+void setUp(void)
+{
+
+}
+
+void tearDown(void)
+{
+
+}
+
+void test_freetype_glyphs_should_render_the_same_after_eviction(void)
+{
+
+}
+
+void test_freetype_evicted_glyphs_should_release_the_face(void)
+{
+
+}
+
+#endif /*LV_USE_FREETYPE*/
+
+#endif
@@ -0,0 +1,214 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#define IMG_W   8
+#define IMG_H   8
+#define OBJ_X   10
+#define OBJ_Y   20
+
+/*An 8x8 infinite loop with 20 ms delays:
+ * 1. red on the whole image
+ * 2. green at (2;3) 3x2, restored to the black background after it
+ * 3. blue at (5;5) 2x2*/
+static const uint8_t gif_data[] = {
+    0x47, 0x49, 0x46, 0x38, 0x39, 0x61, 0x08, 0x00, 0x08, 0x00, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x21, 0xff, 0x0b, 0x4e, 0x45, 0x54, 0x53,
+    0x43, 0x41, 0x50, 0x45, 0x32, 0x2e, 0x30, 0x03, 0x01, 0x00, 0x00, 0x00, 0x21, 0xf9, 0x04, 0x04,
+    0x02, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x02, 0x31,
+    0x0c, 0xc3, 0x30, 0x0c, 0xc3, 0x30, 0x0c, 0xc3, 0x30, 0x0c, 0xc3, 0x30, 0x0c, 0xc3, 0x30, 0x0c,
+    0xc3, 0x30, 0x0c, 0xc3, 0x30, 0x0c, 0xc3, 0x30, 0x0c, 0xc3, 0x30, 0x0c, 0xc3, 0x30, 0x0c, 0xc3,
+    0x30, 0x0c, 0xc3, 0x30, 0x0c, 0xc3, 0x30, 0x0c, 0xc3, 0x30, 0x0c, 0xc3, 0x30, 0x0c, 0xc3, 0x30,
+    0x05, 0x00, 0x21, 0xf9, 0x04, 0x08, 0x02, 0x00, 0x00, 0x00, 0x2c, 0x02, 0x00, 0x03, 0x00, 0x03,
+    0x00, 0x02, 0x00, 0x00, 0x02, 0x05, 0x14, 0x45, 0x51, 0x14, 0x55, 0x00, 0x21, 0xf9, 0x04, 0x04,
+    0x02, 0x00, 0x00, 0x00, 0x2c, 0x05, 0x00, 0x05, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x02, 0x04,
+    0x1c, 0xc7, 0x71, 0x05, 0x00, 0x3b,
+};
+
+static const lv_img_dsc_t gif_img = {
+    .header.always_zero = 0,
+    .header.cf = LV_IMG_CF_RAW,
+    .data_size = sizeof(gif_data),
+    .data = gif_data,
+};
+
+static uint32_t ready_cnt;
+
+static void ready_event_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+    ready_cnt++;
+}
+
+/*Let the frame's delay elapse and call the GIF's timer without refreshing the screen*/
+static void next_frame(lv_obj_t * obj, uint32_t ms)
+{
+    lv_timer_t * t = ((lv_gif_t *)obj)->timer;
+    lv_tick_inc(ms);
+    t->timer_cb(t);
+}
+
+/*Get the bounding box of the invalidated areas*/
+static bool get_inv_area(lv_area_t * area)
+{
+    lv_disp_t * disp = lv_disp_get_default();
+    if(disp->inv_p == 0) return false;
+
+    lv_area_copy(area, &disp->inv_areas[0]);
+    uint16_t i;
+    for(i = 1; i < disp->inv_p; i++) {
+        _lv_area_join(area, area, &disp->inv_areas[i]);
+    }
+    return true;
+}
+
+static void assert_inv_area(lv_coord_t x1, lv_coord_t y1, lv_coord_t x2, lv_coord_t y2)
+{
+    lv_area_t a;
+    TEST_ASSERT_TRUE(get_inv_area(&a));
+    TEST_ASSERT_EQUAL(OBJ_X + x1, a.x1);
+    TEST_ASSERT_EQUAL(OBJ_Y + y1, a.y1);
+    TEST_ASSERT_EQUAL(OBJ_X + x2, a.x2);
+    TEST_ASSERT_EQUAL(OBJ_Y + y2, a.y2);
+}
+
+static lv_obj_t * gif_create(uint16_t ring_size)
+{
+    lv_obj_t * obj = lv_gif_create(lv_scr_act());
+    lv_obj_set_pos(obj, OBJ_X, OBJ_Y);
+    lv_gif_set_frame_ring(obj, ring_size);
+    lv_gif_set_src(obj, &gif_img);
+    lv_obj_add_event_cb(obj, ready_event_cb, LV_EVENT_READY, NULL);
+    lv_refr_now(NULL);
+    return obj;
+}
+
+void setUp(void)
+{
+    ready_cnt = 0;
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_scr_act());
+}
+
+void test_gif_only_the_changed_area_should_be_invalidated(void)
+{
+    lv_obj_t * obj = gif_create(0);
+
+    next_frame(obj, 20);
+    assert_inv_area(2, 3, 4, 4);
+    lv_refr_now(NULL);
+
+    /*The restored area of the previous frame is invalidated too*/
+    next_frame(obj, 20);
+    assert_inv_area(2, 3, 6, 6);
+    lv_refr_now(NULL);
+
+    const lv_color_t * px = (const lv_color_t *)((lv_gif_t *)obj)->imgdsc.data;
+    TEST_ASSERT_EQUAL_COLOR(lv_color_black(), px[3 * IMG_W + 3]);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_make(0xff, 0x00, 0x00), px[0]);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_make(0x00, 0x00, 0xff), px[5 * IMG_W + 5]);
+
+    /*Transformed images are invalidated entirely*/
+    lv_img_set_zoom(obj, 512);
+    lv_refr_now(NULL);
+    next_frame(obj, 20);
+    next_frame(obj, 20);
+    lv_area_t a;
+    TEST_ASSERT_TRUE(get_inv_area(&a));
+    TEST_ASSERT_TRUE(_lv_area_is_in(&obj->coords, &a, 0));
+}
+
+void test_gif_frame_should_not_be_decoded_before_its_delay(void)
+{
+    lv_obj_t * obj = gif_create(0);
+    gd_GIF * gif = ((lv_gif_t *)obj)->gif;
+
+    next_frame(obj, 10);
+    TEST_ASSERT_EQUAL(IMG_W, gif->fw);
+    lv_area_t a;
+    TEST_ASSERT_FALSE(get_inv_area(&a));
+
+    next_frame(obj, 10);
+    TEST_ASSERT_EQUAL(3, gif->fw);
+    assert_inv_area(2, 3, 4, 4);
+}
+
+void test_gif_short_loop_should_be_played_from_the_ring(void)
+{
+    static uint8_t frames[3][IMG_W * IMG_H * LV_IMG_PX_SIZE_ALPHA_BYTE];
+
+    lv_obj_t * obj = gif_create(4);
+    lv_gif_t * gifobj = (lv_gif_t *)obj;
+
+    /*Record the first loop*/
+    uint32_t i;
+    for(i = 0; i < 3; i++) {
+        if(i > 0) next_frame(obj, 20);
+        lv_memcpy(frames[i], gifobj->imgdsc.data, sizeof(frames[i]));
+        lv_refr_now(NULL);
+    }
+    TEST_ASSERT_FALSE(gifobj->ring_ready);
+    TEST_ASSERT_EQUAL(3, gifobj->ring_cnt);
+
+    /*When the loop restarts only the difference of the last and first frames is invalidated*/
+    next_frame(obj, 20);
+    TEST_ASSERT_TRUE(gifobj->ring_ready);
+    assert_inv_area(2, 3, 6, 6);
+    lv_refr_now(NULL);
+
+    for(i = 0; i < 6; i++) {
+        if(i > 0) next_frame(obj, 20);
+        TEST_ASSERT_NOT_EQUAL(gifobj->gif->canvas, gifobj->imgdsc.data);
+        TEST_ASSERT_EQUAL_MEMORY(frames[i % 3], gifobj->imgdsc.data, sizeof(frames[0]));
+        lv_refr_now(NULL);
+    }
+
+    /*Play the first frame again*/
+    lv_gif_restart(obj);
+    TEST_ASSERT_EQUAL_MEMORY(frames[0], gifobj->imgdsc.data, sizeof(frames[0]));
+}
+
+void test_gif_long_loop_should_be_decoded_on_the_fly(void)
+{
+    lv_obj_t * obj = gif_create(2);
+    lv_gif_t * gifobj = (lv_gif_t *)obj;
+
+    next_frame(obj, 20);
+    TEST_ASSERT_EQUAL(2, gifobj->ring_cnt);
+
+    next_frame(obj, 20);
+    TEST_ASSERT_TRUE(gifobj->ring_skip);
+    TEST_ASSERT_NULL(gifobj->ring);
+
+    uint32_t i;
+    for(i = 0; i < 4; i++) next_frame(obj, 20);
+    TEST_ASSERT_FALSE(gifobj->ring_ready);
+    TEST_ASSERT_EQUAL_PTR(gifobj->gif->canvas, gifobj->imgdsc.data);
+}
+
+void test_gif_ready_should_be_sent_once_after_the_last_repeat(void)
+{
+    lv_obj_t * obj = gif_create(4);
+    lv_gif_t * gifobj = (lv_gif_t *)obj;
+    gifobj->gif->loop_count = 2;
+
+    /*Both loops are played, the second from the ring*/
+    uint32_t i;
+    for(i = 0; i < 5; i++) next_frame(obj, 20);
+    TEST_ASSERT_EQUAL(0, ready_cnt);
+    TEST_ASSERT_TRUE(gifobj->ring_ready);
+
+    next_frame(obj, 20);
+    TEST_ASSERT_EQUAL(1, ready_cnt);
+    TEST_ASSERT_TRUE(gifobj->timer->paused);
+
+    /*Started again by the user*/
+    lv_gif_restart(obj);
+    TEST_ASSERT_FALSE(gifobj->timer->paused);
+}
+
+#endif
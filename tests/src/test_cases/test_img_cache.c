@@ -0,0 +1,542 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#if LV_IMG_CACHE_DEF_SIZE
+
+#define IMG_W   16
+#define IMG_H   16
+#define IMG_CNT 300
+
+/*Images "decoded" by the test decoder into a newly allocated buffer*/
+static lv_img_dsc_t decoded_imgs[4];
+
+/*Images drawn directly from their data by the built-in decoder*/
+static lv_img_dsc_t var_imgs[IMG_CNT];
+static lv_color_t var_img_data[IMG_W * IMG_H];
+
+static lv_img_decoder_t * decoder;
+static uint32_t open_cnt;
+static uint32_t img_size;
+static bool open_fail;
+
+static bool is_decoded_img(const void * src)
+{
+    return src >= (const void *)&decoded_imgs[0] && src < (const void *)&decoded_imgs[4];
+}
+
+static lv_res_t decoder_info(lv_img_decoder_t * d, const void * src, lv_img_header_t * header)
+{
+    LV_UNUSED(d);
+    if(!is_decoded_img(src)) return LV_RES_INV;
+
+    *header = ((const lv_img_dsc_t *)src)->header;
+    return LV_RES_OK;
+}
+
+static lv_res_t decoder_open(lv_img_decoder_t * d, lv_img_decoder_dsc_t * dsc)
+{
+    LV_UNUSED(d);
+    if(!is_decoded_img(dsc->src)) return LV_RES_INV;
+    if(open_fail) return LV_RES_INV;
+
+    /*The raw images are "decoded" to true color too*/
+    dsc->header.cf = LV_IMG_CF_TRUE_COLOR;
+    uint8_t * buf = lv_mem_alloc(img_size);
+    lv_memset_00(buf, img_size);
+    dsc->img_data = buf;
+    open_cnt++;
+    return LV_RES_OK;
+}
+
+static void decoder_close(lv_img_decoder_t * d, lv_img_decoder_dsc_t * dsc)
+{
+    LV_UNUSED(d);
+    lv_mem_free((void *)dsc->img_data);
+    dsc->img_data = NULL;
+}
+
+static void open_and_release(const void * src)
+{
+    _lv_img_cache_entry_t * entry = _lv_img_cache_open(src, lv_color_black(), 0);
+    TEST_ASSERT_NOT_NULL(entry);
+    _lv_img_cache_release(entry);
+}
+
+void setUp(void)
+{
+    uint32_t i;
+    for(i = 0; i < 4; i++) {
+        decoded_imgs[i].header.always_zero = 0;
+        decoded_imgs[i].header.w = IMG_W;
+        decoded_imgs[i].header.h = IMG_H;
+        decoded_imgs[i].header.cf = LV_IMG_CF_TRUE_COLOR;
+        decoded_imgs[i].data_size = sizeof(var_img_data);
+        decoded_imgs[i].data = (const uint8_t *)var_img_data;   /*Not used by the test decoder*/
+    }
+
+    for(i = 0; i < IMG_CNT; i++) {
+        var_imgs[i].header.always_zero = 0;
+        var_imgs[i].header.w = IMG_W;
+        var_imgs[i].header.h = IMG_H;
+        var_imgs[i].header.cf = LV_IMG_CF_TRUE_COLOR;
+        var_imgs[i].data_size = sizeof(var_img_data);
+        var_imgs[i].data = (const uint8_t *)var_img_data;
+    }
+
+    img_size = lv_img_buf_get_img_size(IMG_W, IMG_H, LV_IMG_CF_TRUE_COLOR);
+    open_cnt = 0;
+    open_fail = false;
+
+    decoder = lv_img_decoder_create();
+    lv_img_decoder_set_info_cb(decoder, decoder_info);
+    lv_img_decoder_set_open_cb(decoder, decoder_open);
+    lv_img_decoder_set_close_cb(decoder, decoder_close);
+
+    lv_img_cache_invalidate_src(NULL);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_scr_act());
+#if LV_IMG_CACHE_ASYNC
+    lv_img_cache_set_async_worker(NULL);
+    lv_img_cache_set_async_placeholder(NULL);
+#endif
+    lv_img_cache_set_mem_size(0);
+    lv_img_cache_set_size(LV_IMG_CACHE_DEF_SIZE);
+    lv_img_decoder_delete(decoder);
+}
+
+void test_img_cache_should_hit_opened_images(void)
+{
+    lv_img_cache_stat_t stat_start;
+    lv_img_cache_stat_t stat;
+    lv_img_cache_get_stat(&stat_start);
+
+    _lv_img_cache_entry_t * entry = _lv_img_cache_open(&decoded_imgs[0], lv_color_black(), 0);
+    _lv_img_cache_release(entry);
+    TEST_ASSERT_EQUAL_PTR(entry, _lv_img_cache_open(&decoded_imgs[0], lv_color_black(), 0));
+    _lv_img_cache_release(entry);
+
+    lv_img_cache_get_stat(&stat);
+    TEST_ASSERT_EQUAL(1, open_cnt);
+    TEST_ASSERT_EQUAL(1, stat.hit_cnt - stat_start.hit_cnt);
+    TEST_ASSERT_EQUAL(1, stat.miss_cnt - stat_start.miss_cnt);
+    TEST_ASSERT_EQUAL(1, stat.entry_cnt);
+    TEST_ASSERT_EQUAL(img_size, stat.mem_used);
+
+    /*Other frames and colors are different entries*/
+    open_and_release(&decoded_imgs[0]);
+    _lv_img_cache_release(_lv_img_cache_open(&decoded_imgs[0], lv_color_white(), 0));
+    _lv_img_cache_release(_lv_img_cache_open(&decoded_imgs[0], lv_color_black(), 1));
+    TEST_ASSERT_EQUAL(3, open_cnt);
+
+    lv_img_cache_invalidate_src(&decoded_imgs[0]);
+    lv_img_cache_get_stat(&stat);
+    TEST_ASSERT_EQUAL(0, stat.entry_cnt);
+    TEST_ASSERT_EQUAL(0, stat.mem_used);
+}
+
+void test_img_cache_should_evict_the_least_recently_used_image(void)
+{
+    lv_img_cache_set_mem_size(img_size * 2);
+
+    lv_img_cache_stat_t stat_start;
+    lv_img_cache_get_stat(&stat_start);
+    open_and_release(&decoded_imgs[0]);
+    open_and_release(&decoded_imgs[1]);
+    open_and_release(&decoded_imgs[0]);     /*Now image 1 is the least recently used*/
+    open_and_release(&decoded_imgs[2]);
+    TEST_ASSERT_EQUAL(3, open_cnt);
+
+    lv_img_cache_stat_t stat;
+    lv_img_cache_get_stat(&stat);
+    TEST_ASSERT_EQUAL(2, stat.entry_cnt);
+    TEST_ASSERT_EQUAL(img_size * 2, stat.mem_used);
+    TEST_ASSERT_EQUAL(1, stat.evict_cnt - stat_start.evict_cnt);
+
+    open_and_release(&decoded_imgs[0]);
+    open_and_release(&decoded_imgs[2]);
+    TEST_ASSERT_EQUAL(3, open_cnt);
+
+    open_and_release(&decoded_imgs[1]);
+    TEST_ASSERT_EQUAL(4, open_cnt);
+}
+
+void test_img_cache_should_stay_in_the_entry_count(void)
+{
+    lv_img_cache_set_size(2);
+
+    lv_img_cache_stat_t stat_start;
+    lv_img_cache_get_stat(&stat_start);
+    open_and_release(&decoded_imgs[0]);
+    open_and_release(&decoded_imgs[1]);
+    open_and_release(&decoded_imgs[2]);
+
+    lv_img_cache_stat_t stat;
+    lv_img_cache_get_stat(&stat);
+    TEST_ASSERT_EQUAL(2, stat.entry_max);
+    TEST_ASSERT_EQUAL(2, stat.entry_cnt);
+    TEST_ASSERT_EQUAL(1, stat.evict_cnt - stat_start.evict_cnt);
+
+    open_and_release(&decoded_imgs[1]);
+    open_and_release(&decoded_imgs[2]);
+    TEST_ASSERT_EQUAL(3, open_cnt);
+}
+
+void test_img_cache_should_not_evict_referenced_images(void)
+{
+    lv_img_cache_set_mem_size(img_size);
+
+    _lv_img_cache_entry_t * entry0 = _lv_img_cache_open(&decoded_imgs[0], lv_color_black(), 0);
+    _lv_img_cache_entry_t * entry1 = _lv_img_cache_open(&decoded_imgs[1], lv_color_black(), 0);
+    TEST_ASSERT_NOT_NULL(entry0);
+    TEST_ASSERT_NOT_NULL(entry1);
+
+    /*Both are kept while they are in use*/
+    lv_img_cache_stat_t stat;
+    lv_img_cache_get_stat(&stat);
+    TEST_ASSERT_EQUAL(2, stat.entry_cnt);
+    TEST_ASSERT_EQUAL_PTR(&decoded_imgs[0], entry0->dec_dsc.src);
+    TEST_ASSERT_NOT_NULL(entry0->dec_dsc.img_data);
+
+    _lv_img_cache_release(entry0);
+    _lv_img_cache_release(entry1);
+
+    open_and_release(&decoded_imgs[2]);
+    lv_img_cache_get_stat(&stat);
+    TEST_ASSERT_EQUAL(1, stat.entry_cnt);
+    TEST_ASSERT_EQUAL(img_size, stat.mem_used);
+
+    /*All entries are in use*/
+    lv_img_cache_set_size(1);
+    entry0 = _lv_img_cache_open(&decoded_imgs[0], lv_color_black(), 0);
+    TEST_ASSERT_NULL(_lv_img_cache_open(&decoded_imgs[1], lv_color_black(), 0));
+    _lv_img_cache_release(entry0);
+}
+
+void test_img_cache_should_find_many_images(void)
+{
+    lv_img_cache_set_size(IMG_CNT);
+
+    uint32_t i;
+    for(i = 0; i < IMG_CNT; i++) open_and_release(&var_imgs[i]);
+
+    lv_img_cache_stat_t stat_start;
+    lv_img_cache_stat_t stat;
+    lv_img_cache_get_stat(&stat_start);
+    TEST_ASSERT_EQUAL(IMG_CNT, stat_start.entry_cnt);
+
+    /*The images are used from their variables so they don't use memory*/
+    TEST_ASSERT_EQUAL(0, stat_start.mem_used);
+
+    for(i = 0; i < IMG_CNT; i++) {
+        _lv_img_cache_entry_t * entry = _lv_img_cache_open(&var_imgs[IMG_CNT - 1 - i], lv_color_black(), 0);
+        TEST_ASSERT_EQUAL_PTR(&var_imgs[IMG_CNT - 1 - i], entry->dec_dsc.src);
+        _lv_img_cache_release(entry);
+    }
+
+    lv_img_cache_get_stat(&stat);
+    TEST_ASSERT_EQUAL(IMG_CNT, stat.hit_cnt - stat_start.hit_cnt);
+    TEST_ASSERT_EQUAL(0, stat.miss_cnt - stat_start.miss_cnt);
+}
+
+void test_img_cache_should_find_images_with_more_than_32768_entries(void)
+{
+#ifdef LVGL_CI_USING_SYS_HEAP
+    /*It needs more memory than the LVGL heap of the tests*/
+    lv_img_cache_set_size(40000);
+    lv_img_cache_stat_t stat_start;
+    lv_img_cache_stat_t stat;
+    lv_img_cache_get_stat(&stat_start);
+    TEST_ASSERT_EQUAL(40000, stat_start.entry_max);
+
+    uint32_t i;
+    for(i = 0; i < IMG_CNT; i++) open_and_release(&var_imgs[i]);
+    for(i = 0; i < IMG_CNT; i++) open_and_release(&var_imgs[i]);
+
+    lv_img_cache_get_stat(&stat);
+    TEST_ASSERT_EQUAL(IMG_CNT, stat.entry_cnt);
+    TEST_ASSERT_EQUAL(IMG_CNT, stat.hit_cnt - stat_start.hit_cnt);
+    TEST_ASSERT_EQUAL(0, stat.evict_cnt - stat_start.evict_cnt);
+#endif
+}
+
+void test_img_cache_should_be_released_after_drawing(void)
+{
+    lv_obj_t * img = lv_img_create(lv_scr_act());
+    lv_img_set_src(img, &decoded_imgs[0]);
+    lv_refr_now(NULL);
+
+    lv_obj_invalidate(img);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(1, open_cnt);
+
+    _lv_img_cache_entry_t * entry = _lv_img_cache_open(&decoded_imgs[0], lv_color_black(), 0);
+    TEST_ASSERT_EQUAL(1, entry->ref_cnt);
+    _lv_img_cache_release(entry);
+}
+
+#if LV_IMG_CACHE_ASYNC
+
+/*A worker which runs the jobs only when the test asks for it*/
+static lv_img_cache_async_job_t * jobs[8];
+static uint32_t job_cnt;
+
+static void fake_worker(lv_img_cache_async_job_t * job)
+{
+    TEST_ASSERT_LESS_THAN(8, job_cnt);
+    jobs[job_cnt] = job;
+    job_cnt++;
+}
+
+static void fake_worker_run_all(void)
+{
+    uint32_t i;
+    for(i = 0; i < job_cnt; i++) lv_img_cache_async_job_run(jobs[i]);
+    job_cnt = 0;
+}
+
+static lv_obj_t * async_img_create(void)
+{
+    job_cnt = 0;
+    lv_img_cache_set_async_worker(fake_worker);
+    lv_img_cache_set_async_placeholder(&var_imgs[0]);
+
+    /*Raw images need a decoder so they are decoded asynchronously*/
+    decoded_imgs[3].header.cf = LV_IMG_CF_RAW;
+    lv_obj_t * img = lv_img_create(lv_scr_act());
+    lv_img_set_src(img, &decoded_imgs[3]);
+    lv_refr_now(NULL);
+    return img;
+}
+
+void test_img_cache_async_should_draw_the_image_when_decoded(void)
+{
+    lv_obj_t * img = async_img_create();
+
+    /*Not decoded in the draw, only a job is started*/
+    TEST_ASSERT_EQUAL(0, open_cnt);
+    TEST_ASSERT_EQUAL(1, job_cnt);
+
+    /*The placeholder was drawn so it's cached*/
+    lv_img_cache_stat_t stat_start;
+    lv_img_cache_stat_t stat;
+    lv_img_cache_get_stat(&stat_start);
+    open_and_release(&var_imgs[0]);
+    lv_img_cache_get_stat(&stat);
+    TEST_ASSERT_EQUAL(stat_start.hit_cnt + 1, stat.hit_cnt);
+
+    /*Drawn again while it's being decoded: no new job*/
+    lv_obj_invalidate(img);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(1, job_cnt);
+
+    fake_worker_run_all();
+    TEST_ASSERT_EQUAL(1, open_cnt);
+    lv_img_cache_get_stat(&stat_start);
+
+    /*The image is added to the cache and its area is invalidated*/
+    lv_disp_t * disp = lv_disp_get_default();
+    TEST_ASSERT_EQUAL(0, disp->inv_p);
+    lv_img_cache_async_process();
+    TEST_ASSERT_EQUAL(1, disp->inv_p);
+    TEST_ASSERT_TRUE(_lv_area_is_in(&img->coords, &disp->inv_areas[0], 0));
+
+    lv_img_cache_get_stat(&stat);
+    TEST_ASSERT_EQUAL(stat_start.entry_cnt + 1, stat.entry_cnt);
+    TEST_ASSERT_EQUAL(stat_start.mem_used + img_size, stat.mem_used);
+
+    lv_refr_now(NULL);
+    lv_img_cache_get_stat(&stat);
+    TEST_ASSERT_EQUAL(1, open_cnt);
+    TEST_ASSERT_EQUAL(0, job_cnt);
+    TEST_ASSERT_GREATER_THAN(stat_start.hit_cnt, stat.hit_cnt);
+}
+
+void test_img_cache_async_should_drop_invalidated_jobs(void)
+{
+    async_img_create();
+    TEST_ASSERT_EQUAL(1, job_cnt);
+
+    lv_img_cache_stat_t stat_start;
+    lv_img_cache_stat_t stat;
+    lv_img_cache_get_stat(&stat_start);
+
+    lv_img_cache_invalidate_src(&decoded_imgs[3]);
+    fake_worker_run_all();
+    lv_img_cache_async_process();
+
+    lv_img_cache_get_stat(&stat);
+    TEST_ASSERT_EQUAL(stat_start.entry_cnt, stat.entry_cnt);
+    TEST_ASSERT_EQUAL(stat_start.mem_used, stat.mem_used);
+
+    /*A new job is started*/
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(1, job_cnt);
+    fake_worker_run_all();
+}
+
+void test_img_cache_async_should_not_retry_failed_images(void)
+{
+    open_fail = true;
+    async_img_create();
+    TEST_ASSERT_EQUAL(1, job_cnt);
+    fake_worker_run_all();
+    lv_img_cache_async_process();
+
+    /*Opened synchronously to show the error*/
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(0, job_cnt);
+}
+
+void test_img_cache_async_should_not_be_used_for_canvases(void)
+{
+    async_img_create();
+    fake_worker_run_all();
+    lv_img_cache_invalidate_src(NULL);
+    open_cnt = 0;
+
+    /*The canvas is drawn with a temporary display and needs the image right now*/
+    static lv_color_t cbuf[LV_CANVAS_BUF_SIZE_TRUE_COLOR(IMG_W, IMG_H)];
+    lv_obj_t * canvas = lv_canvas_create(lv_scr_act());
+    lv_canvas_set_buffer(canvas, cbuf, IMG_W, IMG_H, LV_IMG_CF_TRUE_COLOR);
+
+    lv_draw_img_dsc_t dsc;
+    lv_draw_img_dsc_init(&dsc);
+    lv_canvas_draw_img(canvas, 0, 0, &decoded_imgs[3], &dsc);
+    TEST_ASSERT_EQUAL(1, open_cnt);
+    TEST_ASSERT_EQUAL(0, job_cnt);
+}
+
+void test_img_cache_async_should_invalidate_the_moved_and_not_the_deleted_objects(void)
+{
+    lv_obj_t * img = async_img_create();
+    lv_obj_t * img2 = lv_img_create(lv_scr_act());
+    lv_img_set_src(img2, &decoded_imgs[3]);
+    lv_obj_set_pos(img2, 100, 100);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(1, job_cnt);
+
+    /*Moved without drawing it*/
+    lv_obj_set_pos(img, 300, 200);
+    lv_obj_update_layout(img);
+    lv_obj_del(img2);
+    _lv_inv_area(lv_disp_get_default(), NULL);
+
+    fake_worker_run_all();
+    lv_img_cache_async_process();
+
+    lv_disp_t * disp = lv_disp_get_default();
+    TEST_ASSERT_EQUAL(1, disp->inv_p);
+    TEST_ASSERT_TRUE(_lv_area_is_in(&img->coords, &disp->inv_areas[0], 0));
+    TEST_ASSERT_FALSE(_lv_area_is_on(&disp->inv_areas[0], &(lv_area_t) {0, 0, 150, 150}));
+}
+
+#else /*LV_IMG_CACHE_ASYNC*/
+
+void test_img_cache_async_should_draw_the_image_when_decoded(void)
+{
+
+}
+
+void test_img_cache_async_should_drop_invalidated_jobs(void)
+{
+
+}
+
+void test_img_cache_async_should_not_retry_failed_images(void)
+{
+
+}
+
+void test_img_cache_async_should_not_be_used_for_canvases(void)
+{
+
+}
+
+void test_img_cache_async_should_invalidate_the_moved_and_not_the_deleted_objects(void)
+{
+
+}
+
+#endif /*LV_IMG_CACHE_ASYNC*/
+
+#else /*LV_IMG_CACHE_DEF_SIZE*/
+
+void setUp(void)
+{
+
+}
+
+void tearDown(void)
+{
+
+}
+
+void test_img_cache_should_hit_opened_images(void)
+{
+
+}
+
+void test_img_cache_should_evict_the_least_recently_used_image(void)
+{
+
+}
+
+void test_img_cache_should_stay_in_the_entry_count(void)
+{
+
+}
+
+void test_img_cache_should_not_evict_referenced_images(void)
+{
+
+}
+
+void test_img_cache_should_find_many_images(void)
+{
+
+}
+
+void test_img_cache_should_find_images_with_more_than_32768_entries(void)
+{
+
+}
+
+void test_img_cache_should_be_released_after_drawing(void)
+{
+
+}
+
+void test_img_cache_async_should_draw_the_image_when_decoded(void)
+{
+
+}
+
+void test_img_cache_async_should_drop_invalidated_jobs(void)
+{
+
+}
+
+void test_img_cache_async_should_not_retry_failed_images(void)
+{
+
+}
+
+void test_img_cache_async_should_not_be_used_for_canvases(void)
+{
+
+}
+
+void test_img_cache_async_should_invalidate_the_moved_and_not_the_deleted_objects(void)
+{
+
+}
+
+#endif /*LV_IMG_CACHE_DEF_SIZE*/
+
+#endif
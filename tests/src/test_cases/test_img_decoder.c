@@ -0,0 +1,215 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#define IMG_W   100
+#define IMG_H   80
+
+/*A file system serving the image from memory and counting the accesses*/
+static uint8_t file_data[4 + 1024 + IMG_W * IMG_H * LV_IMG_PX_SIZE_ALPHA_BYTE];
+static uint32_t file_size;
+static uint32_t file_pos;
+static uint32_t read_cnt;
+static uint32_t read_byte_cnt;
+static lv_fs_drv_t drv;
+
+static void * fs_open(lv_fs_drv_t * d, const char * path, lv_fs_mode_t mode)
+{
+    LV_UNUSED(d);
+    LV_UNUSED(path);
+    LV_UNUSED(mode);
+    file_pos = 0;
+    return &file_pos;
+}
+
+static lv_fs_res_t fs_close(lv_fs_drv_t * d, void * file_p)
+{
+    LV_UNUSED(d);
+    LV_UNUSED(file_p);
+    return LV_FS_RES_OK;
+}
+
+static lv_fs_res_t fs_read(lv_fs_drv_t * d, void * file_p, void * buf, uint32_t btr, uint32_t * br)
+{
+    LV_UNUSED(d);
+    LV_UNUSED(file_p);
+    if(file_pos + btr > file_size) btr = file_size - file_pos;
+    lv_memcpy(buf, &file_data[file_pos], btr);
+    file_pos += btr;
+    *br = btr;
+    read_cnt++;
+    read_byte_cnt += btr;
+    return LV_FS_RES_OK;
+}
+
+static lv_fs_res_t fs_seek(lv_fs_drv_t * d, void * file_p, uint32_t pos, lv_fs_whence_t whence)
+{
+    LV_UNUSED(d);
+    LV_UNUSED(file_p);
+    if(whence == LV_FS_SEEK_SET) file_pos = pos;
+    else if(whence == LV_FS_SEEK_CUR) file_pos += pos;
+    else file_pos = file_size + pos;
+    return LV_FS_RES_OK;
+}
+
+static lv_fs_res_t fs_tell(lv_fs_drv_t * d, void * file_p, uint32_t * pos_p)
+{
+    LV_UNUSED(d);
+    LV_UNUSED(file_p);
+    *pos_p = file_pos;
+    return LV_FS_RES_OK;
+}
+
+/*Create an image with a pattern both as a variable and as a file*/
+static void img_create(lv_img_dsc_t * img, lv_img_cf_t cf)
+{
+    img->header.always_zero = 0;
+    img->header.w = IMG_W;
+    img->header.h = IMG_H;
+    img->header.cf = cf;
+    img->data_size = lv_img_buf_get_img_size(IMG_W, IMG_H, cf);
+    img->data = &file_data[4];
+
+    uint32_t i;
+    for(i = 0; i < img->data_size; i++) file_data[4 + i] = (uint8_t)(i * 7 + (i >> 8));
+
+    /*Make the palette opaque*/
+    if(cf >= LV_IMG_CF_INDEXED_1BIT && cf <= LV_IMG_CF_INDEXED_8BIT) {
+        uint32_t palette_size = 1 << lv_img_cf_get_px_size(cf);
+        for(i = 0; i < palette_size; i++) file_data[4 + i * 4 + 3] = 0xff;
+    }
+
+    lv_memcpy(file_data, &img->header, sizeof(lv_img_header_t));
+    file_size = 4 + img->data_size;
+}
+
+void setUp(void)
+{
+    lv_fs_drv_init(&drv);
+    drv.letter = 'C';
+    drv.open_cb = fs_open;
+    drv.close_cb = fs_close;
+    drv.read_cb = fs_read;
+    drv.seek_cb = fs_seek;
+    drv.tell_cb = fs_tell;
+    lv_fs_drv_register(&drv);
+
+    read_cnt = 0;
+    read_byte_cnt = 0;
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_scr_act());
+    lv_img_cache_invalidate_src(NULL);
+}
+
+/*Compare the area read at once with the lines read one by one*/
+static void check_area(lv_img_decoder_dsc_t * dsc, const lv_area_t * area, uint32_t px_size)
+{
+    uint32_t w = lv_area_get_width(area);
+    uint32_t h = lv_area_get_height(area);
+    uint8_t * buf_area = lv_mem_alloc(w * h * px_size);
+    uint8_t * buf_line = lv_mem_alloc(w * px_size);
+
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_read_area(dsc, area, buf_area));
+
+    uint32_t y;
+    for(y = 0; y < h; y++) {
+        TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_read_line(dsc, area->x1, area->y1 + y, w, buf_line));
+        TEST_ASSERT_EQUAL_MEMORY(buf_line, buf_area + y * w * px_size, w * px_size);
+    }
+
+    lv_mem_free(buf_area);
+    lv_mem_free(buf_line);
+}
+
+static void check_img(lv_img_cf_t cf, uint32_t px_size)
+{
+    static const lv_area_t areas[] = {
+        {0, 0, IMG_W - 1, IMG_H - 1},
+        {0, 10, IMG_W - 1, 12},
+        {3, 5, 60, 70},
+        {91, 0, 97, 79},
+        {45, 40, 45, 40},
+    };
+
+    lv_img_dsc_t img;
+    img_create(&img, cf);
+
+    uint32_t i;
+    for(i = 0; i < sizeof(areas) / sizeof(areas[0]); i++) {
+        lv_img_decoder_dsc_t dsc;
+        TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_open(&dsc, "C:img.bin", lv_color_black(), 0));
+        check_area(&dsc, &areas[i], px_size);
+        lv_img_decoder_close(&dsc);
+
+        /*The true color variables are used directly*/
+        if(cf == LV_IMG_CF_TRUE_COLOR || cf == LV_IMG_CF_TRUE_COLOR_ALPHA) continue;
+
+        TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_open(&dsc, &img, lv_color_black(), 0));
+        check_area(&dsc, &areas[i], px_size);
+        lv_img_decoder_close(&dsc);
+    }
+}
+
+void test_img_decoder_read_area_should_give_the_same_pixels_as_read_line(void)
+{
+    check_img(LV_IMG_CF_TRUE_COLOR, LV_COLOR_SIZE / 8);
+    check_img(LV_IMG_CF_TRUE_COLOR_ALPHA, LV_IMG_PX_SIZE_ALPHA_BYTE);
+    check_img(LV_IMG_CF_ALPHA_1BIT, LV_IMG_PX_SIZE_ALPHA_BYTE);
+    check_img(LV_IMG_CF_ALPHA_4BIT, LV_IMG_PX_SIZE_ALPHA_BYTE);
+    check_img(LV_IMG_CF_ALPHA_8BIT, LV_IMG_PX_SIZE_ALPHA_BYTE);
+    check_img(LV_IMG_CF_INDEXED_2BIT, LV_IMG_PX_SIZE_ALPHA_BYTE);
+    check_img(LV_IMG_CF_INDEXED_8BIT, LV_IMG_PX_SIZE_ALPHA_BYTE);
+}
+
+void test_img_decoder_read_area_should_read_files_in_chunks(void)
+{
+    lv_img_dsc_t img;
+    img_create(&img, LV_IMG_CF_TRUE_COLOR);
+
+    lv_img_decoder_dsc_t dsc;
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_open(&dsc, "C:img.bin", lv_color_black(), 0));
+    uint8_t * buf = lv_mem_alloc(IMG_W * IMG_H * LV_COLOR_SIZE / 8);
+
+    /*Full width rows are read at once*/
+    lv_area_t area = {0, 0, IMG_W - 1, IMG_H - 1};
+    read_cnt = 0;
+    lv_img_decoder_read_area(&dsc, &area, buf);
+    TEST_ASSERT_EQUAL(1, read_cnt);
+
+    /*Wide areas are read in chunks of rows*/
+    lv_area_set(&area, 10, 0, IMG_W - 11, IMG_H - 1);
+    read_cnt = 0;
+    lv_img_decoder_read_area(&dsc, &area, buf);
+    TEST_ASSERT_LESS_THAN(IMG_H / 4, read_cnt);
+
+    /*Narrow areas are read line by line without the unused bytes*/
+    lv_area_set(&area, 10, 0, 19, IMG_H - 1);
+    read_byte_cnt = 0;
+    lv_img_decoder_read_area(&dsc, &area, buf);
+    TEST_ASSERT_EQUAL(10 * IMG_H * LV_COLOR_SIZE / 8, read_byte_cnt);
+
+    lv_mem_free(buf);
+    lv_img_decoder_close(&dsc);
+}
+
+void test_img_decoder_should_draw_file_images_with_a_few_reads(void)
+{
+    lv_img_dsc_t img;
+    img_create(&img, LV_IMG_CF_INDEXED_4BIT);
+
+    lv_obj_t * obj = lv_img_create(lv_scr_act());
+    lv_img_set_src(obj, "C:img.bin");
+    lv_refr_now(NULL);
+
+    read_cnt = 0;
+    lv_obj_invalidate(obj);
+    lv_refr_now(NULL);
+    TEST_ASSERT_GREATER_THAN(0, read_cnt);
+    TEST_ASSERT_LESS_THAN(IMG_H / 4, read_cnt);
+}
+
+#endif
@@ -0,0 +1,298 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include "lv_test_helpers.h"
+
+static lv_obj_t * active_screen = NULL;
+static lv_obj_t * label = NULL;
+
+/*Hebrew and Latin words mixed with numbers and brackets*/
+static const char * mixed_txt = "\xd7\xa9\xd7\x9c\xd7\x95\xd7\x9d abc (123) \xd7\xa2\xd7\x95\xd7\x9c\xd7\x9d def\n"
+                                "ghi \xd7\x90\xd7\x91\xd7\x92 [jkl] 456 \xd7\x93\xd7\x94\xd7\x95";
+
+void setUp(void)
+{
+    active_screen = lv_scr_act();
+    label = lv_label_create(active_screen);
+    lv_obj_set_width(label, 300);
+    lv_obj_set_style_base_dir(label, LV_BASE_DIR_RTL, 0);
+    lv_label_set_text(label, mixed_txt);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(active_screen);
+}
+
+#if LV_LABEL_IMG_CACHE_SIZE
+static uint32_t glyph_bitmap_cnt;
+
+/*Count the rendered glyphs. (Measuring the text might still get the glyph descriptors.)*/
+static const uint8_t * counting_get_glyph_bitmap(const lv_font_t * font, uint32_t letter)
+{
+    glyph_bitmap_cnt++;
+    return lv_font_montserrat_14.get_glyph_bitmap(font, letter);
+}
+
+void test_label_img_cache_should_draw_the_text_once(void)
+{
+    static lv_font_t font;
+    font = lv_font_montserrat_14;
+    font.get_glyph_bitmap = counting_get_glyph_bitmap;
+
+    lv_obj_t * title = lv_label_create(active_screen);
+    lv_obj_set_style_text_font(title, &font, 0);
+    lv_label_set_text(title, "Settings");
+    lv_label_set_img_cache(title, true);
+
+    lv_refr_now(NULL);
+    TEST_ASSERT_NOT_NULL(_lv_label_get_cached_img(title));
+    const void * data = _lv_label_get_cached_img(title)->data;
+
+    glyph_bitmap_cnt = 0;
+    lv_obj_invalidate(title);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(0, glyph_bitmap_cnt);
+    TEST_ASSERT_EQUAL_PTR(data, _lv_label_get_cached_img(title)->data);
+
+    /*Rendered again with the new color*/
+    lv_obj_set_style_text_color(title, lv_palette_main(LV_PALETTE_RED), 0);
+    lv_refr_now(NULL);
+    TEST_ASSERT_GREATER_THAN(0, glyph_bitmap_cnt);
+    TEST_ASSERT_NOT_NULL(_lv_label_get_cached_img(title));
+
+    /*Rendered again with the new text*/
+    glyph_bitmap_cnt = 0;
+    lv_label_set_text(title, "Display");
+    TEST_ASSERT_NULL(_lv_label_get_cached_img(title));
+    lv_refr_now(NULL);
+    TEST_ASSERT_GREATER_THAN(0, glyph_bitmap_cnt);
+    TEST_ASSERT_NOT_NULL(_lv_label_get_cached_img(title));
+
+    lv_label_set_img_cache(title, false);
+    TEST_ASSERT_NULL(_lv_label_get_cached_img(title));
+    lv_obj_del(title);
+    lv_font_width_cache_invalidate(&font);
+}
+
+void test_label_img_cache_should_stay_in_the_budget(void)
+{
+    uint32_t i;
+    lv_obj_t * labels[30];
+    for(i = 0; i < 30; i++) {
+        labels[i] = lv_label_create(active_screen);
+        lv_label_set_text_fmt(labels[i], "Menu entry %d", (int)i);
+        lv_obj_set_pos(labels[i], 0, i * 16);
+        lv_label_set_img_cache(labels[i], true);
+    }
+    lv_refr_now(NULL);
+
+    uint32_t used = 0;
+    uint32_t cached_cnt = 0;
+    for(i = 0; i < 30; i++) {
+        const lv_img_dsc_t * img = _lv_label_get_cached_img(labels[i]);
+        if(img) {
+            used += img->data_size;
+            cached_cnt++;
+        }
+    }
+
+    TEST_ASSERT_LESS_OR_EQUAL(LV_LABEL_IMG_CACHE_SIZE, used);
+    TEST_ASSERT_GREATER_THAN(0, cached_cnt);
+    TEST_ASSERT_LESS_THAN(30, cached_cnt);
+
+    /*The most recently drawn label is kept*/
+    TEST_ASSERT_NOT_NULL(_lv_label_get_cached_img(labels[29]));
+    TEST_ASSERT_NULL(_lv_label_get_cached_img(labels[0]));
+}
+
+/*Move the glyphs out of the text area to the left*/
+static bool overhang_get_glyph_dsc(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out, uint32_t letter,
+                                   uint32_t letter_next)
+{
+    bool ret = lv_font_montserrat_14.get_glyph_dsc(font, dsc_out, letter, letter_next);
+    dsc_out->ofs_x -= 6;
+    return ret;
+}
+
+void test_label_img_cache_should_draw_the_glyphs_out_of_the_text_area(void)
+{
+    static lv_font_t font;
+    font = lv_font_montserrat_14;
+    font.get_glyph_dsc = overhang_get_glyph_dsc;
+
+    lv_obj_t * title = lv_label_create(active_screen);
+    lv_obj_set_pos(title, 20, 300);
+    lv_obj_set_style_text_font(title, &font, 0);
+    lv_obj_set_style_pad_hor(title, 8, 0);
+    lv_obj_set_style_bg_color(title, lv_palette_main(LV_PALETTE_BLUE), 0);
+    lv_obj_set_style_bg_opa(title, LV_OPA_COVER, 0);
+    lv_label_set_text(title, "Wi-Fi");
+
+    lv_test_save_ref_screen();
+
+    lv_label_set_img_cache(title, true);
+    lv_test_refr_screen();
+    TEST_ASSERT_NOT_NULL(_lv_label_get_cached_img(title));
+
+    /*Blending the image can round differently, but no glyph should be cut*/
+    TEST_ASSERT_LESS_OR_EQUAL(2, lv_test_ref_screen_diff());
+
+    lv_obj_del(title);
+    lv_font_width_cache_invalidate(&font);
+}
+
+#else /*LV_LABEL_IMG_CACHE_SIZE*/
+
+void test_label_img_cache_should_draw_the_text_once(void)
+{
+
+}
+
+void test_label_img_cache_should_stay_in_the_budget(void)
+{
+
+}
+
+void test_label_img_cache_should_draw_the_glyphs_out_of_the_text_area(void)
+{
+
+}
+
+#endif /*LV_LABEL_IMG_CACHE_SIZE*/
+
+#if LV_USE_BIDI
+
+void test_label_bidi_lines_should_be_processed_only_once(void)
+{
+    lv_label_t * l = (lv_label_t *)label;
+    lv_refr_now(NULL);
+
+    uint32_t line_cnt = l->bidi_cache.line_cnt;
+    TEST_ASSERT_EQUAL(2, line_cnt);
+
+    const char * txt = lv_label_get_text(label);
+    uint32_t len = strchr(txt, '\n') - txt + 1;
+    const char * line = _lv_bidi_cache_get_line(&l->bidi_cache, txt, 0, len, LV_BASE_DIR_RTL);
+    TEST_ASSERT_NOT_NULL(line);
+
+    lv_obj_invalidate(label);
+    lv_refr_now(NULL);
+
+    TEST_ASSERT_EQUAL(line_cnt, l->bidi_cache.line_cnt);
+    TEST_ASSERT_EQUAL_PTR(line, _lv_bidi_cache_get_line(&l->bidi_cache, txt, 0, len, LV_BASE_DIR_RTL));
+}
+
+void test_label_bidi_cache_should_be_cleared_on_text_change(void)
+{
+    lv_label_t * l = (lv_label_t *)label;
+    lv_refr_now(NULL);
+    TEST_ASSERT_GREATER_THAN(0, l->bidi_cache.line_cnt);
+
+    lv_label_set_text(label, "abc \xd7\xa9\xd7\x9c\xd7\x95\xd7\x9d");
+    TEST_ASSERT_EQUAL(0, l->bidi_cache.line_cnt);
+
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(1, l->bidi_cache.line_cnt);
+
+    lv_obj_set_width(label, 20);
+    TEST_ASSERT_EQUAL(0, l->bidi_cache.line_cnt);
+}
+
+void test_label_bidi_cache_should_give_the_same_positions(void)
+{
+    lv_label_t * l = (lv_label_t *)label;
+    const char * txt = lv_label_get_text(label);
+    uint32_t len = strchr(txt, '\n') - txt;
+    uint32_t char_cnt = _lv_txt_encoded_get_char_id(txt, len);
+
+    char * processed = lv_mem_alloc(len + 1);
+    _lv_bidi_process_paragraph(txt, processed, len, LV_BASE_DIR_RTL, NULL, 0);
+    TEST_ASSERT_EQUAL_MEMORY(processed, _lv_bidi_cache_get_line(&l->bidi_cache, txt, 0, len, LV_BASE_DIR_RTL), len);
+    lv_mem_free(processed);
+
+    uint32_t i;
+    for(i = 0; i < char_cnt; i++) {
+        bool rtl_cached;
+        bool rtl;
+        uint16_t pos_cached = _lv_bidi_cache_get_visual_pos(&l->bidi_cache, txt, 0, len, LV_BASE_DIR_RTL, i, &rtl_cached);
+        uint16_t pos = _lv_bidi_get_visual_pos(txt, NULL, len, LV_BASE_DIR_RTL, i, &rtl);
+        TEST_ASSERT_EQUAL(pos, pos_cached);
+        TEST_ASSERT_EQUAL(rtl, rtl_cached);
+
+        pos_cached = _lv_bidi_cache_get_logical_pos(&l->bidi_cache, txt, 0, len, LV_BASE_DIR_RTL, i, &rtl_cached);
+        pos = _lv_bidi_get_logical_pos(txt, NULL, len, LV_BASE_DIR_RTL, i, &rtl);
+        TEST_ASSERT_EQUAL(pos, pos_cached);
+        TEST_ASSERT_EQUAL(rtl, rtl_cached);
+    }
+}
+
+void test_label_letter_pos_and_letter_on_should_use_the_cached_lines(void)
+{
+    lv_label_t * l = (lv_label_t *)label;
+    lv_refr_now(NULL);
+    uint32_t line_cnt = l->bidi_cache.line_cnt;
+
+    uint32_t char_cnt = _lv_txt_get_encoded_length(lv_label_get_text(label));
+    uint32_t i;
+    for(i = 0; i < char_cnt; i++) {
+        lv_point_t p;
+        lv_label_get_letter_pos(label, i, &p);
+        TEST_ASSERT_LESS_OR_EQUAL(lv_obj_get_content_width(label), p.x);
+        lv_label_get_letter_on(label, &p);
+    }
+
+    /*The lines processed during drawing are found again*/
+    TEST_ASSERT_EQUAL(line_cnt, l->bidi_cache.line_cnt);
+}
+
+void test_label_bidi_cache_should_find_lines_added_in_any_order(void)
+{
+    lv_label_t * l = (lv_label_t *)label;
+    const char * txt = lv_label_get_text(label);
+    uint32_t len1 = strchr(txt, '\n') - txt + 1;
+    uint32_t len2 = strlen(txt) - len1;
+
+    /*Add the second line first*/
+    const char * line2 = _lv_bidi_cache_get_line(&l->bidi_cache, txt, len1, len2, LV_BASE_DIR_RTL);
+    const char * line1 = _lv_bidi_cache_get_line(&l->bidi_cache, txt, 0, len1, LV_BASE_DIR_RTL);
+    const char * line1_ltr = _lv_bidi_cache_get_line(&l->bidi_cache, txt, 0, len1, LV_BASE_DIR_LTR);
+    TEST_ASSERT_EQUAL(3, l->bidi_cache.line_cnt);
+
+    TEST_ASSERT_EQUAL_PTR(line1, _lv_bidi_cache_get_line(&l->bidi_cache, txt, 0, len1, LV_BASE_DIR_RTL));
+    TEST_ASSERT_EQUAL_PTR(line1_ltr, _lv_bidi_cache_get_line(&l->bidi_cache, txt, 0, len1, LV_BASE_DIR_LTR));
+    TEST_ASSERT_EQUAL_PTR(line2, _lv_bidi_cache_get_line(&l->bidi_cache, txt, len1, len2, LV_BASE_DIR_RTL));
+    TEST_ASSERT_EQUAL(3, l->bidi_cache.line_cnt);
+}
+
+#else /*LV_USE_BIDI*/
+
+void test_label_bidi_lines_should_be_processed_only_once(void)
+{
+
+}
+
+void test_label_bidi_cache_should_be_cleared_on_text_change(void)
+{
+
+}
+
+void test_label_bidi_cache_should_give_the_same_positions(void)
+{
+
+}
+
+void test_label_letter_pos_and_letter_on_should_use_the_cached_lines(void)
+{
+
+}
+
+void test_label_bidi_cache_should_find_lines_added_in_any_order(void)
+{
+
+}
+
+#endif /*LV_USE_BIDI*/
+
+#endif
@@ -0,0 +1,172 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include "lv_test_indev.h"
+
+/*Without large coordinates the list can be at most 32767 px tall*/
+#if LV_USE_LARGE_COORD
+    #define ITEM_CNT    1000000
+#else
+    #define ITEM_CNT    800
+#endif
+#define ITEM_H      40
+
+static lv_obj_t * list;
+static uint32_t text_cb_cnt;
+static uint32_t clicked_id;
+
+void setUp(void)
+{
+    list = lv_list_create(lv_scr_act());
+    lv_obj_set_size(list, 200, 300);
+    text_cb_cnt = 0;
+    clicked_id = LV_LIST_ITEM_NONE;
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_scr_act());
+}
+
+static const char * text_cb(lv_obj_t * obj, uint32_t id)
+{
+    LV_UNUSED(obj);
+    static char buf[32];
+    text_cb_cnt++;
+    lv_snprintf(buf, sizeof(buf), "Item %d", id);
+    return buf;
+}
+
+static void clicked_event_cb(lv_event_t * e)
+{
+    clicked_id = lv_list_get_virtual_id(list, lv_event_get_target(e));
+}
+
+/*Check that each visible item is shown by a button at the right place*/
+static void check_pool(void)
+{
+    lv_list_t * list_p = (lv_list_t *)list;
+    lv_coord_t scroll_y = lv_obj_get_scroll_y(list);
+    uint32_t first = scroll_y / ITEM_H;
+    uint32_t last = LV_MIN((scroll_y + lv_obj_get_content_height(list)) / ITEM_H, ITEM_CNT - 1);
+
+    uint32_t id;
+    for(id = first; id <= last; id++) {
+        lv_obj_t * btn = lv_obj_get_child(list, id % list_p->pool_cnt);
+        TEST_ASSERT_EQUAL_UINT32(id, lv_list_get_virtual_id(list, btn));
+        TEST_ASSERT_FALSE(lv_obj_has_flag(btn, LV_OBJ_FLAG_HIDDEN));
+        TEST_ASSERT_EQUAL((lv_coord_t)id * ITEM_H, lv_obj_get_y(btn));
+
+        char buf[32];
+        lv_snprintf(buf, sizeof(buf), "Item %d", id);
+        TEST_ASSERT_EQUAL_STRING(buf, lv_list_get_btn_text(list, btn));
+    }
+}
+
+void test_list_virtual_should_use_a_small_pool(void)
+{
+    lv_list_t * list_p = (lv_list_t *)list;
+    lv_list_add_btn(list, NULL, "Normal item");
+    lv_list_set_virtual(list, ITEM_CNT, ITEM_H, text_cb);
+    lv_obj_update_layout(list);
+
+    uint32_t pool_cnt = lv_obj_get_content_height(list) / ITEM_H + 2;
+    TEST_ASSERT_EQUAL_UINT32(pool_cnt, list_p->pool_cnt);
+    TEST_ASSERT_EQUAL_UINT32(pool_cnt, lv_obj_get_child_cnt(list));
+    TEST_ASSERT_EQUAL((lv_coord_t)ITEM_CNT * ITEM_H, lv_obj_get_self_height(list));
+    check_pool();
+
+    /*Only the newly visible items are asked*/
+    text_cb_cnt = 0;
+    lv_obj_scroll_by(list, 0, -ITEM_H, LV_ANIM_OFF);
+    TEST_ASSERT_EQUAL_UINT32(1, text_cb_cnt);
+    check_pool();
+
+    lv_obj_scroll_to_y(list, (lv_coord_t)(ITEM_CNT / 2 * ITEM_H + 10), LV_ANIM_OFF);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(pool_cnt, lv_obj_get_child_cnt(list));
+    check_pool();
+
+    lv_obj_scroll_to_y(list, (lv_coord_t)ITEM_CNT * ITEM_H, LV_ANIM_OFF);
+    lv_refr_now(NULL);
+    check_pool();
+
+    /*Back to a normal list*/
+    lv_list_set_virtual(list, 0, 0, NULL);
+    TEST_ASSERT_EQUAL_UINT32(0, lv_obj_get_child_cnt(list));
+    lv_list_add_btn(list, NULL, "Normal item");
+    TEST_ASSERT_EQUAL_UINT32(1, lv_obj_get_child_cnt(list));
+}
+
+void test_list_virtual_should_follow_the_size(void)
+{
+    lv_list_t * list_p = (lv_list_t *)list;
+    lv_list_set_virtual(list, 3, ITEM_H, text_cb);
+    lv_obj_update_layout(list);
+    TEST_ASSERT_EQUAL_UINT32(3, list_p->pool_cnt);
+
+    lv_list_set_virtual(list, ITEM_CNT, ITEM_H, text_cb);
+    lv_obj_set_height(list, 600);
+    lv_obj_update_layout(list);
+    TEST_ASSERT_EQUAL_UINT32(lv_obj_get_content_height(list) / ITEM_H + 2, list_p->pool_cnt);
+    check_pool();
+}
+
+void test_list_virtual_should_clamp_the_height_of_too_many_items(void)
+{
+    /*The total height doesn't fit into `lv_coord_t`*/
+    uint32_t item_cnt = (uint32_t)(LV_COORD_MAX / ITEM_H) * 2;
+    lv_list_set_virtual(list, item_cnt, ITEM_H, text_cb);
+    lv_obj_update_layout(list);
+    TEST_ASSERT_EQUAL(LV_COORD_MAX, lv_obj_get_self_height(list));
+
+    /*The items below the limit are still at the right place*/
+    lv_obj_scroll_to_y(list, LV_COORD_MAX / 2, LV_ANIM_OFF);
+    lv_refr_now(NULL);
+    lv_coord_t scroll_y = lv_obj_get_scroll_y(list);
+    uint32_t id = scroll_y / ITEM_H;
+    lv_list_t * list_p = (lv_list_t *)list;
+    lv_obj_t * btn = lv_obj_get_child(list, id % list_p->pool_cnt);
+    TEST_ASSERT_EQUAL_UINT32(id, lv_list_get_virtual_id(list, btn));
+    TEST_ASSERT_EQUAL((lv_coord_t)(id * ITEM_H), lv_obj_get_y(btn));
+}
+
+void test_list_virtual_should_report_the_clicked_item(void)
+{
+    lv_list_set_virtual(list, ITEM_CNT, ITEM_H, text_cb);
+    lv_obj_add_event_cb(list, clicked_event_cb, LV_EVENT_CLICKED, NULL);
+    lv_obj_scroll_to_y(list, (lv_coord_t)(ITEM_CNT / 10 * 7 * ITEM_H), LV_ANIM_OFF);
+    lv_refr_now(NULL);
+
+    lv_area_t content;
+    lv_obj_get_content_coords(list, &content);
+    lv_test_mouse_click_at(content.x1 + 20, content.y1 + 2 * ITEM_H + ITEM_H / 2);
+    TEST_ASSERT_EQUAL_UINT32(ITEM_CNT / 10 * 7 + 2, clicked_id);
+}
+
+void test_list_virtual_should_ask_only_the_new_items_while_scrolling(void)
+{
+    lv_list_t * list_p = (lv_list_t *)list;
+    lv_list_set_virtual(list, ITEM_CNT, ITEM_H, text_cb);
+    lv_refr_now(NULL);
+
+    /*Scroll by a few items per frame and jump far sometimes*/
+    uint32_t i;
+    for(i = 0; i < 100; i++) {
+        text_cb_cnt = 0;
+        if(i % 10 == 0) {
+            lv_obj_scroll_to_y(list, (lv_coord_t)(i * (ITEM_CNT / 100) * ITEM_H), LV_ANIM_OFF);
+            lv_refr_now(NULL);
+            TEST_ASSERT_LESS_OR_EQUAL_UINT32(list_p->pool_cnt, text_cb_cnt);
+        }
+        else {
+            lv_obj_scroll_by(list, 0, -ITEM_H / 2 * 3, LV_ANIM_OFF);
+            lv_refr_now(NULL);
+            TEST_ASSERT_LESS_OR_EQUAL_UINT32(2, text_cb_cnt);
+        }
+        check_pool();
+    }
+}
+
+#endif
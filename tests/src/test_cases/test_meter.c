@@ -0,0 +1,170 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#if LV_USE_METER
+
+#include "unity/unity.h"
+#include "lv_test_helpers.h"
+
+static lv_obj_t * meter;
+static lv_meter_scale_t * scale;
+static lv_meter_indicator_t * needle;
+static lv_meter_indicator_t * arc;
+static lv_meter_indicator_t * lines;
+
+static lv_obj_t * meter_create(lv_meter_scale_t ** scale_p, lv_meter_indicator_t ** needle_p,
+                               lv_meter_indicator_t ** arc_p, lv_meter_indicator_t ** lines_p)
+{
+    lv_obj_t * obj = lv_meter_create(lv_scr_act());
+    lv_obj_set_size(obj, 200, 200);
+    lv_obj_center(obj);
+
+    *scale_p = lv_meter_add_scale(obj);
+    lv_meter_set_scale_ticks(obj, *scale_p, 41, 2, 10, lv_palette_main(LV_PALETTE_GREY));
+    lv_meter_set_scale_major_ticks(obj, *scale_p, 8, 4, 15, lv_color_black(), 10);
+
+    *arc_p = lv_meter_add_arc(obj, *scale_p, 3, lv_palette_main(LV_PALETTE_BLUE), 0);
+    *lines_p = lv_meter_add_scale_lines(obj, *scale_p, lv_palette_main(LV_PALETTE_RED),
+                                        lv_palette_main(LV_PALETTE_RED), false, 0);
+    lv_meter_set_indicator_start_value(obj, *lines_p, 80);
+    lv_meter_set_indicator_end_value(obj, *lines_p, 100);
+    *needle_p = lv_meter_add_needle_line(obj, *scale_p, 4, lv_palette_main(LV_PALETTE_GREY), -10);
+    lv_meter_set_indicator_value(obj, *needle_p, 30);
+    lv_meter_set_indicator_end_value(obj, *arc_p, 30);
+
+    return obj;
+}
+
+void setUp(void)
+{
+    meter = meter_create(&scale, &needle, &arc, &lines);
+}
+
+void tearDown(void)
+{
+    lv_obj_del(meter);
+}
+
+void test_meter_scale_cache_should_draw_like_without_cache(void)
+{
+    lv_test_save_ref_screen();
+
+    lv_meter_set_scale_cache(meter, true);
+    lv_test_refr_screen();
+    TEST_ASSERT_NOT_NULL(((lv_meter_t *)meter)->scale_img);
+
+    /*The anti-aliased edges might be blended a little bit differently*/
+    TEST_ASSERT_LESS_OR_EQUAL(4, lv_test_ref_screen_diff());
+}
+
+void test_meter_scale_cache_should_be_kept_while_the_needle_moves(void)
+{
+    lv_meter_t * m = (lv_meter_t *)meter;
+    lv_disp_t * disp = lv_disp_get_default();
+    lv_meter_set_scale_cache(meter, true);
+    lv_refr_now(NULL);
+    const lv_img_dsc_t * img = m->scale_img;
+    TEST_ASSERT_NOT_NULL(img);
+
+    /*Only the bounding boxes of the needle are invalidated*/
+    lv_meter_set_indicator_value(meter, needle, 35);
+    lv_meter_set_indicator_end_value(meter, arc, 35);
+    uint32_t i;
+    for(i = 0; i < disp->inv_p; i++) {
+        if(disp->inv_area_joined[i]) continue;
+        TEST_ASSERT_LESS_THAN(lv_area_get_size(&meter->coords) / 2, lv_area_get_size(&disp->inv_areas[i]));
+    }
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_PTR(img, m->scale_img);
+
+    /*The scale lines modify the ticks so they are rendered again*/
+    lv_meter_set_indicator_start_value(meter, lines, 70);
+    TEST_ASSERT_NULL(m->scale_img);
+    lv_refr_now(NULL);
+    TEST_ASSERT_NOT_NULL(m->scale_img);
+
+    /*And so are the scales and the styles*/
+    lv_meter_set_scale_range(meter, scale, 0, 200, 270, 135);
+    TEST_ASSERT_NULL(m->scale_img);
+    lv_refr_now(NULL);
+    img = m->scale_img;
+    TEST_ASSERT_NOT_NULL(img);
+
+    lv_obj_set_style_text_color(meter, lv_palette_main(LV_PALETTE_GREEN), LV_PART_TICKS);
+    lv_refr_now(NULL);
+    TEST_ASSERT_NOT_NULL(m->scale_img);
+
+    lv_obj_set_size(meter, 150, 150);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(150, m->scale_img->header.w);
+
+    lv_meter_set_scale_cache(meter, false);
+    TEST_ASSERT_NULL(m->scale_img);
+}
+
+void test_meter_moving_needle_should_draw_like_without_cache(void)
+{
+    lv_meter_scale_t * ref_scale;
+    lv_meter_indicator_t * ref_needle;
+    lv_meter_indicator_t * ref_arc;
+    lv_meter_indicator_t * ref_lines;
+    lv_obj_t * ref_meter = meter_create(&ref_scale, &ref_needle, &ref_arc, &ref_lines);
+
+    lv_meter_set_scale_cache(meter, true);
+    lv_refr_now(NULL);
+    const lv_img_dsc_t * img = ((lv_meter_t *)meter)->scale_img;
+    TEST_ASSERT_NOT_NULL(img);
+
+    int32_t v;
+    for(v = 0; v <= 100; v += 20) {
+        lv_meter_set_indicator_value(meter, needle, v);
+        lv_meter_set_indicator_end_value(meter, arc, v);
+        lv_meter_set_indicator_value(ref_meter, ref_needle, v);
+        lv_meter_set_indicator_end_value(ref_meter, ref_arc, v);
+
+        lv_obj_add_flag(meter, LV_OBJ_FLAG_HIDDEN);
+        lv_obj_clear_flag(ref_meter, LV_OBJ_FLAG_HIDDEN);
+        lv_test_save_ref_screen();
+
+        lv_obj_clear_flag(meter, LV_OBJ_FLAG_HIDDEN);
+        lv_obj_add_flag(ref_meter, LV_OBJ_FLAG_HIDDEN);
+        lv_test_refr_screen();
+
+        /*The same image is used for every needle position*/
+        TEST_ASSERT_EQUAL_PTR(img, ((lv_meter_t *)meter)->scale_img);
+        TEST_ASSERT_LESS_OR_EQUAL(4, lv_test_ref_screen_diff());
+    }
+
+    lv_obj_del(ref_meter);
+}
+
+#else /*LV_USE_METER*/
+
+void setUp(void)
+{
+
+}
+
+void tearDown(void)
+{
+
+}
+
+void test_meter_scale_cache_should_draw_like_without_cache(void)
+{
+
+}
+
+void test_meter_scale_cache_should_be_kept_while_the_needle_moves(void)
+{
+
+}
+
+void test_meter_moving_needle_should_draw_like_without_cache(void)
+{
+
+}
+
+#endif /*LV_USE_METER*/
+
+#endif
@@ -0,0 +1,204 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+#include <stdio.h>
+
+#define IMG_W           40
+#define IMG_H           24
+#define TILE_SIZE       8
+#define FILE_NAME       "src/test_files/nimg_32bit.nimg"
+#define FILE_TMP        "nimg_tmp.nimg"
+
+static uint32_t file_buf[4096 / 4];
+static uint8_t ref_map[IMG_W * IMG_H * LV_IMG_PX_SIZE_ALPHA_BYTE];
+static lv_img_dsc_t ref_img;
+
+/*The same pattern `scripts/img_to_nimg.py` converted to the test files*/
+static void ref_img_create(void)
+{
+    lv_coord_t x;
+    lv_coord_t y;
+    for(y = 0; y < IMG_H; y++) {
+        for(x = 0; x < IMG_W; x++) {
+            lv_opa_t a = x < 8 ? 0 : x >= 32 ? 255 : (x - 8) * 10 + 10;
+            lv_color_t c = a ? lv_color_make(x * 6, y * 10, 100) : lv_color_black();
+            uint8_t * px = &ref_map[(y * IMG_W + x) * LV_IMG_PX_SIZE_ALPHA_BYTE];
+            lv_memcpy(px, &c, LV_IMG_PX_SIZE_ALPHA_BYTE - 1);
+            px[LV_IMG_PX_SIZE_ALPHA_BYTE - 1] = a;
+        }
+    }
+
+    ref_img.header.always_zero = 0;
+    ref_img.header.w = IMG_W;
+    ref_img.header.h = IMG_H;
+    ref_img.header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA;
+    ref_img.data_size = sizeof(ref_map);
+    ref_img.data = ref_map;
+}
+
+static uint32_t file_load(const char * path)
+{
+    FILE * f = fopen(path, "rb");
+    TEST_ASSERT_NOT_NULL(f);
+    uint32_t size = fread(file_buf, 1, sizeof(file_buf), f);
+    fclose(f);
+    return size;
+}
+
+static void var_img_create(lv_img_dsc_t * img, const char * path)
+{
+    lv_memset_00(img, sizeof(lv_img_dsc_t));
+    img->header.w = IMG_W;
+    img->header.h = IMG_H;
+    img->header.cf = LV_IMG_CF_RAW_ALPHA;
+    img->data_size = file_load(path);
+    img->data = (const uint8_t *)file_buf;
+}
+
+void setUp(void)
+{
+    ref_img_create();
+}
+
+void tearDown(void)
+{
+    lv_img_cache_invalidate_src(NULL);
+    remove(FILE_TMP);
+}
+
+void test_nimg_variable_should_be_drawn_from_its_data(void)
+{
+    lv_img_dsc_t img;
+    var_img_create(&img, FILE_NAME);
+
+    lv_img_header_t header;
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_get_info(&img, &header));
+    TEST_ASSERT_EQUAL(IMG_W, header.w);
+    TEST_ASSERT_EQUAL(IMG_H, header.h);
+    TEST_ASSERT_EQUAL(LV_IMG_CF_TRUE_COLOR_ALPHA, header.cf);
+
+    lv_img_decoder_dsc_t dsc;
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_open(&dsc, &img, lv_color_black(), 0));
+    uint32_t data_offset = img.data[12] | (img.data[13] << 8);
+    TEST_ASSERT_EQUAL_PTR(img.data + data_offset, dsc.img_data);
+    TEST_ASSERT_EQUAL_MEMORY(ref_map, dsc.img_data, sizeof(ref_map));
+    lv_img_decoder_close(&dsc);
+}
+
+void test_nimg_file_should_be_read_like_the_variable(void)
+{
+    lv_img_decoder_dsc_t dsc;
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_open(&dsc, "A:" FILE_NAME, lv_color_black(), 0));
+    TEST_ASSERT_NULL(dsc.img_data);
+
+    static uint8_t buf[sizeof(ref_map)];
+    const lv_area_t areas[] = {
+        {0, 0, IMG_W - 1, IMG_H - 1},
+        {3, 5, 20, 17},
+        {0, 7, 7, 16},
+        {35, 23, 39, 23},
+    };
+
+    uint32_t i;
+    for(i = 0; i < sizeof(areas) / sizeof(areas[0]); i++) {
+        const lv_area_t * a = &areas[i];
+        TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_read_area(&dsc, a, buf));
+        lv_coord_t y;
+        uint32_t row_size = lv_area_get_width(a) * LV_IMG_PX_SIZE_ALPHA_BYTE;
+        for(y = a->y1; y <= a->y2; y++) {
+            TEST_ASSERT_EQUAL_MEMORY(&ref_map[(y * IMG_W + a->x1) * LV_IMG_PX_SIZE_ALPHA_BYTE],
+                                     &buf[(y - a->y1) * row_size], row_size);
+        }
+    }
+
+    lv_img_decoder_close(&dsc);
+}
+
+void test_nimg_should_be_drawn_like_true_color_alpha(void)
+{
+    static lv_color_t ref_buf[LV_CANVAS_BUF_SIZE_TRUE_COLOR(IMG_W, IMG_H)];
+    static lv_color_t var_buf[LV_CANVAS_BUF_SIZE_TRUE_COLOR(IMG_W, IMG_H)];
+    static lv_color_t file_buf_canvas[LV_CANVAS_BUF_SIZE_TRUE_COLOR(IMG_W, IMG_H)];
+
+    lv_draw_img_dsc_t draw_dsc;
+    lv_draw_img_dsc_init(&draw_dsc);
+
+    lv_img_dsc_t img;
+    var_img_create(&img, FILE_NAME);
+
+    lv_obj_t * canvas = lv_canvas_create(lv_scr_act());
+    lv_canvas_set_buffer(canvas, ref_buf, IMG_W, IMG_H, LV_IMG_CF_TRUE_COLOR);
+    lv_canvas_fill_bg(canvas, lv_palette_main(LV_PALETTE_BLUE), LV_OPA_COVER);
+    lv_canvas_draw_img(canvas, 0, 0, &ref_img, &draw_dsc);
+
+    lv_canvas_set_buffer(canvas, var_buf, IMG_W, IMG_H, LV_IMG_CF_TRUE_COLOR);
+    lv_canvas_fill_bg(canvas, lv_palette_main(LV_PALETTE_BLUE), LV_OPA_COVER);
+    lv_canvas_draw_img(canvas, 0, 0, &img, &draw_dsc);
+
+    lv_canvas_set_buffer(canvas, file_buf_canvas, IMG_W, IMG_H, LV_IMG_CF_TRUE_COLOR);
+    lv_canvas_fill_bg(canvas, lv_palette_main(LV_PALETTE_BLUE), LV_OPA_COVER);
+    lv_canvas_draw_img(canvas, 0, 0, "A:" FILE_NAME, &draw_dsc);
+
+    TEST_ASSERT_EQUAL_MEMORY(ref_buf, var_buf, sizeof(ref_buf));
+    TEST_ASSERT_EQUAL_MEMORY(ref_buf, file_buf_canvas, sizeof(ref_buf));
+
+    lv_obj_del(canvas);
+}
+
+void test_nimg_transparent_tiles_should_not_be_read(void)
+{
+    uint32_t size = file_load(FILE_NAME);
+    uint8_t * data = (uint8_t *)file_buf;
+    uint32_t data_offset = data[12] | (data[13] << 8);
+
+    /*Mess up the pixels of the transparent first tile column. They shouldn't be used.*/
+    lv_coord_t y;
+    for(y = 0; y < IMG_H; y++) {
+        lv_memset(data + data_offset + y * IMG_W * LV_IMG_PX_SIZE_ALPHA_BYTE, 0x55, TILE_SIZE * LV_IMG_PX_SIZE_ALPHA_BYTE);
+    }
+
+    FILE * f = fopen(FILE_TMP, "wb");
+    TEST_ASSERT_NOT_NULL(f);
+    fwrite(data, 1, size, f);
+    fclose(f);
+
+    lv_img_decoder_dsc_t dsc;
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_open(&dsc, "A:" FILE_TMP, lv_color_black(), 0));
+
+    static uint8_t buf[sizeof(ref_map)];
+    lv_area_t a = {0, 0, TILE_SIZE - 1, IMG_H - 1};
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_read_area(&dsc, &a, buf));
+    TEST_ASSERT_EACH_EQUAL_UINT8(0, buf, TILE_SIZE * IMG_H * LV_IMG_PX_SIZE_ALPHA_BYTE);
+
+    lv_img_decoder_close(&dsc);
+}
+
+void test_nimg_other_color_depth_should_be_rejected(void)
+{
+    lv_img_dsc_t img;
+    var_img_create(&img, FILE_NAME);
+    ((uint8_t *)file_buf)[5] = 16;
+
+    lv_img_header_t header;
+    TEST_ASSERT_EQUAL(LV_RES_INV, lv_img_decoder_get_info(&img, &header));
+
+    /*Truncated*/
+    var_img_create(&img, FILE_NAME);
+    img.data_size -= 4;
+    TEST_ASSERT_EQUAL(LV_RES_INV, lv_img_decoder_get_info(&img, &header));
+
+    /*Unknown flag, e.g. premultiplied colors*/
+    var_img_create(&img, FILE_NAME);
+    ((uint8_t *)file_buf)[6] |= 0x02;
+    TEST_ASSERT_EQUAL(LV_RES_INV, lv_img_decoder_get_info(&img, &header));
+
+    /*Wider than what `lv_img_header_t` can store*/
+    var_img_create(&img, FILE_NAME);
+    ((uint8_t *)file_buf)[8] = 2048 & 0xff;
+    ((uint8_t *)file_buf)[9] = 2048 >> 8;
+    TEST_ASSERT_EQUAL(LV_RES_INV, lv_img_decoder_get_info(&img, &header));
+}
+
+#endif
@@ -0,0 +1,129 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include "lv_test_helpers.h"
+#include "lv_test_indev.h"
+
+#define OPT_CNT     5000
+
+static lv_obj_t * roller;
+static char * opts;
+
+void setUp(void)
+{
+    roller = lv_roller_create(lv_scr_act());
+    lv_obj_center(roller);
+
+    /*"0\n1\n2\n ... 4999"*/
+    opts = lv_mem_alloc(OPT_CNT * 6);
+    uint32_t len = 0;
+    uint32_t i;
+    for(i = 0; i < OPT_CNT; i++) {
+        len += lv_snprintf(&opts[len], 6, i == 0 ? "%d" : "\n%d", i);
+    }
+}
+
+void tearDown(void)
+{
+    lv_mem_free(opts);
+    lv_obj_clean(lv_scr_act());
+}
+
+void test_roller_should_find_the_selected_option(void)
+{
+    lv_roller_set_options(roller, opts, LV_ROLLER_MODE_NORMAL);
+    TEST_ASSERT_EQUAL(OPT_CNT, lv_roller_get_option_cnt(roller));
+
+    char buf[16];
+    lv_roller_set_selected(roller, 4321, LV_ANIM_OFF);
+    TEST_ASSERT_EQUAL(4321, lv_roller_get_selected(roller));
+    lv_roller_get_selected_str(roller, buf, sizeof(buf));
+    TEST_ASSERT_EQUAL_STRING("4321", buf);
+
+    lv_roller_set_selected(roller, OPT_CNT - 1, LV_ANIM_OFF);
+    lv_roller_get_selected_str(roller, buf, sizeof(buf));
+    TEST_ASSERT_EQUAL_STRING("4999", buf);
+}
+
+void test_roller_infinite_should_not_copy_the_options(void)
+{
+    lv_roller_set_options(roller, opts, LV_ROLLER_MODE_INFINITE);
+    TEST_ASSERT_EQUAL(OPT_CNT, lv_roller_get_option_cnt(roller));
+    TEST_ASSERT_EQUAL_STRING(opts, lv_roller_get_options(roller));
+
+    /*The label is still as tall as all the pages*/
+    lv_obj_update_layout(roller);
+    lv_obj_t * label = lv_obj_get_child(roller, 0);
+    const lv_font_t * font = lv_obj_get_style_text_font(roller, LV_PART_MAIN);
+    lv_coord_t line_space = lv_obj_get_style_text_line_space(roller, LV_PART_MAIN);
+    lv_coord_t unit_h = lv_font_get_line_height(font) + line_space;
+    TEST_ASSERT_EQUAL(OPT_CNT * LV_ROLLER_INF_PAGES * unit_h - line_space, lv_obj_get_height(label));
+
+    /*Going over the end wraps around*/
+    char buf[16];
+    lv_roller_set_selected(roller, OPT_CNT - 1, LV_ANIM_OFF);
+    lv_group_t * g = lv_group_create();
+    lv_group_add_obj(g, roller);
+    lv_event_send(roller, LV_EVENT_KEY, (void *)&(uint32_t){LV_KEY_DOWN});
+    lv_roller_get_selected_str(roller, buf, sizeof(buf));
+    TEST_ASSERT_EQUAL_STRING("0", buf);
+    lv_event_send(roller, LV_EVENT_KEY, (void *)&(uint32_t){LV_KEY_UP});
+    lv_roller_get_selected_str(roller, buf, sizeof(buf));
+    TEST_ASSERT_EQUAL_STRING("4999", buf);
+    lv_group_del(g);
+}
+
+void test_roller_click_should_select_the_option(void)
+{
+    lv_roller_set_options(roller, opts, LV_ROLLER_MODE_INFINITE);
+    lv_roller_set_selected(roller, 2000, LV_ANIM_OFF);
+    lv_refr_now(NULL);
+
+    /*Click on the option below the selected one*/
+    const lv_font_t * font = lv_obj_get_style_text_font(roller, LV_PART_MAIN);
+    lv_coord_t line_space = lv_obj_get_style_text_line_space(roller, LV_PART_MAIN);
+    lv_coord_t unit_h = lv_font_get_line_height(font) + line_space;
+    lv_area_t a;
+    lv_obj_get_coords(roller, &a);
+    lv_test_mouse_click_at(a.x1 + lv_area_get_width(&a) / 2, a.y1 + lv_area_get_height(&a) / 2 + unit_h);
+    TEST_ASSERT_EQUAL(2001, lv_roller_get_selected(roller));
+}
+
+void test_roller_draw_should_match_the_normal_mode(void)
+{
+    lv_roller_set_options(roller, "Apple\nBanana\nOrange\nCherry\nGrape\nRaspberry", LV_ROLLER_MODE_NORMAL);
+    lv_roller_set_visible_row_count(roller, 3);
+    lv_roller_set_selected(roller, 3, LV_ANIM_OFF);
+    lv_obj_set_style_text_font(roller, &lv_font_unscii_8, LV_PART_SELECTED);
+    lv_test_save_ref_screen();
+
+    /*The middle page of the infinite roller looks the same*/
+    lv_roller_set_options(roller, "Apple\nBanana\nOrange\nCherry\nGrape\nRaspberry", LV_ROLLER_MODE_INFINITE);
+    lv_roller_set_selected(roller, 3, LV_ANIM_OFF);
+    lv_test_refr_screen();
+    TEST_ASSERT_EQUAL_MEMORY(test_ref_fb, test_fb, FB_SIZE * sizeof(lv_color_t));
+}
+
+void test_roller_5000_options_should_draw_like_the_visible_ones(void)
+{
+    /*Only the options around the selected one are visible*/
+    lv_obj_set_width(roller, 100);
+    lv_roller_set_visible_row_count(roller, 3);
+    lv_roller_set_options(roller, "4316\n4317\n4318\n4319\n4320\n4321\n4322\n4323\n4324\n4325\n4326",
+                          LV_ROLLER_MODE_NORMAL);
+    lv_roller_set_selected(roller, 5, LV_ANIM_OFF);
+    lv_test_save_ref_screen();
+
+    lv_roller_set_options(roller, opts, LV_ROLLER_MODE_NORMAL);
+    lv_roller_set_selected(roller, 4321, LV_ANIM_OFF);
+    lv_test_refr_screen();
+    TEST_ASSERT_EQUAL_MEMORY(test_ref_fb, test_fb, FB_SIZE * sizeof(lv_color_t));
+
+    lv_roller_set_options(roller, opts, LV_ROLLER_MODE_INFINITE);
+    lv_roller_set_selected(roller, 4321, LV_ANIM_OFF);
+    lv_test_refr_screen();
+    TEST_ASSERT_EQUAL_MEMORY(test_ref_fb, test_fb, FB_SIZE * sizeof(lv_color_t));
+}
+
+#endif
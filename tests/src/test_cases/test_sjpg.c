@@ -0,0 +1,252 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#if LV_USE_SJPG
+
+#include "unity/unity.h"
+
+#include <stdio.h>
+
+#define IMG_W       320
+#define IMG_H       240
+#define FRAME_H     16
+
+/*A file system serving the image from memory and counting the accesses*/
+static uint8_t file_data[32 * 1024];
+static uint32_t file_size;
+static uint32_t file_pos;
+static uint32_t read_cnt;
+static lv_fs_drv_t drv;
+
+static void * fs_open(lv_fs_drv_t * d, const char * path, lv_fs_mode_t mode)
+{
+    LV_UNUSED(d);
+    LV_UNUSED(path);
+    LV_UNUSED(mode);
+    file_pos = 0;
+    return &file_pos;
+}
+
+static lv_fs_res_t fs_close(lv_fs_drv_t * d, void * file_p)
+{
+    LV_UNUSED(d);
+    LV_UNUSED(file_p);
+    return LV_FS_RES_OK;
+}
+
+static lv_fs_res_t fs_read(lv_fs_drv_t * d, void * file_p, void * buf, uint32_t btr, uint32_t * br)
+{
+    LV_UNUSED(d);
+    LV_UNUSED(file_p);
+    if(file_pos + btr > file_size) btr = file_size - file_pos;
+    lv_memcpy(buf, &file_data[file_pos], btr);
+    file_pos += btr;
+    *br = btr;
+    read_cnt++;
+    return LV_FS_RES_OK;
+}
+
+static lv_fs_res_t fs_seek(lv_fs_drv_t * d, void * file_p, uint32_t pos, lv_fs_whence_t whence)
+{
+    LV_UNUSED(d);
+    LV_UNUSED(file_p);
+    if(whence == LV_FS_SEEK_SET) file_pos = pos;
+    else if(whence == LV_FS_SEEK_CUR) file_pos += pos;
+    else file_pos = file_size + pos;
+    return LV_FS_RES_OK;
+}
+
+static lv_fs_res_t fs_tell(lv_fs_drv_t * d, void * file_p, uint32_t * pos_p)
+{
+    LV_UNUSED(d);
+    LV_UNUSED(file_p);
+    *pos_p = file_pos;
+    return LV_FS_RES_OK;
+}
+
+static void var_img_create(lv_img_dsc_t * img, uint32_t w, uint32_t h)
+{
+    lv_memset_00(img, sizeof(lv_img_dsc_t));
+    img->header.w = w;
+    img->header.h = h;
+    img->header.cf = LV_IMG_CF_RAW;
+    img->data_size = file_size;
+    img->data = file_data;
+}
+
+void setUp(void)
+{
+    FILE * f = fopen("../examples/libs/sjpg/small_image.sjpg", "rb");
+    TEST_ASSERT_NOT_NULL(f);
+    file_size = fread(file_data, 1, sizeof(file_data), f);
+    fclose(f);
+
+    lv_fs_drv_init(&drv);
+    drv.letter = 'C';
+    drv.open_cb = fs_open;
+    drv.close_cb = fs_close;
+    drv.read_cb = fs_read;
+    drv.seek_cb = fs_seek;
+    drv.tell_cb = fs_tell;
+    lv_fs_drv_register(&drv);
+
+    read_cnt = 0;
+}
+
+void tearDown(void)
+{
+    lv_img_cache_invalidate_src(NULL);
+}
+
+void test_sjpg_frames_should_be_decoded_once(void)
+{
+    static uint8_t line1[IMG_W * sizeof(lv_color_t)];
+    static uint8_t line2[IMG_W * sizeof(lv_color_t)];
+
+    lv_img_decoder_dsc_t dsc;
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_open(&dsc, "C:img.sjpg", lv_color_black(), 0));
+
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_read_line(&dsc, 0, 3, IMG_W, line1));
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_read_line(&dsc, 0, 1 * FRAME_H, IMG_W, line2));
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_read_line(&dsc, 0, 2 * FRAME_H, IMG_W, line2));
+    uint32_t cnt = read_cnt;
+
+    /*Scrolling back uses the cached frames*/
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_read_line(&dsc, 0, 1 * FRAME_H + 5, IMG_W, line2));
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_read_line(&dsc, 0, 3, IMG_W, line2));
+    TEST_ASSERT_EQUAL(cnt, read_cnt);
+    TEST_ASSERT_EQUAL_MEMORY(line1, line2, sizeof(line1));
+
+    /*The least recently used frames are dropped*/
+    uint32_t i;
+    for(i = 3; i < 3 + LV_SJPG_FRAME_CACHE_CNT; i++) {
+        TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_read_line(&dsc, 0, i * FRAME_H, IMG_W, line2));
+    }
+    cnt = read_cnt;
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_read_line(&dsc, 0, 3, IMG_W, line2));
+    TEST_ASSERT_GREATER_THAN(cnt, read_cnt);
+    TEST_ASSERT_EQUAL_MEMORY(line1, line2, sizeof(line1));
+
+    lv_img_decoder_close(&dsc);
+}
+
+void test_sjpg_next_frame_should_be_prefetched(void)
+{
+    static uint8_t line[IMG_W * sizeof(lv_color_t)];
+
+    lv_img_decoder_dsc_t dsc;
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_open(&dsc, "C:img.sjpg", lv_color_black(), 0));
+
+    /*Scroll down*/
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_read_line(&dsc, 0, 5 * FRAME_H, IMG_W, line));
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_read_line(&dsc, 0, 6 * FRAME_H, IMG_W, line));
+    uint32_t cnt = read_cnt;
+
+    lv_timer_handler();
+    TEST_ASSERT_GREATER_THAN(cnt, read_cnt);
+
+    cnt = read_cnt;
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_read_line(&dsc, 0, 7 * FRAME_H, IMG_W, line));
+    TEST_ASSERT_EQUAL(cnt, read_cnt);
+
+    /*Scroll up*/
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_read_line(&dsc, 0, 5 * FRAME_H, IMG_W, line));
+    lv_timer_handler();
+    cnt = read_cnt;
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_read_line(&dsc, 0, 4 * FRAME_H, IMG_W, line));
+    TEST_ASSERT_EQUAL(cnt, read_cnt);
+
+    lv_img_decoder_close(&dsc);
+
+    /*The prefetching timer is deleted with the image*/
+    lv_timer_handler();
+}
+
+void test_sjpg_should_be_decoded_at_the_size_of_the_descriptor(void)
+{
+    lv_img_dsc_t img;
+    lv_img_header_t header;
+
+    var_img_create(&img, IMG_W, IMG_H);
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_get_info(&img, &header));
+    TEST_ASSERT_EQUAL(IMG_W, header.w);
+    TEST_ASSERT_EQUAL(IMG_H, header.h);
+
+    /*Not a supported scale*/
+    var_img_create(&img, IMG_W / 3, IMG_H / 3);
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_get_info(&img, &header));
+    TEST_ASSERT_EQUAL(IMG_W, header.w);
+    TEST_ASSERT_EQUAL(IMG_H, header.h);
+
+    var_img_create(&img, IMG_W / 8, IMG_H / 8);
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_get_info(&img, &header));
+    TEST_ASSERT_EQUAL(IMG_W / 8, header.w);
+    TEST_ASSERT_EQUAL(IMG_H / 8, header.h);
+
+    /*The pixels of the half size image are the average of 2x2 pixels*/
+    lv_img_dsc_t full_img;
+    var_img_create(&full_img, IMG_W, IMG_H);
+    lv_img_dsc_t half_img;
+    var_img_create(&half_img, IMG_W / 2, IMG_H / 2);
+
+    static lv_color_t full_line1[IMG_W];
+    static lv_color_t full_line2[IMG_W];
+    static lv_color_t half_line[IMG_W / 2];
+
+    lv_img_decoder_dsc_t full_dsc;
+    lv_img_decoder_dsc_t half_dsc;
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_open(&full_dsc, &full_img, lv_color_black(), 0));
+    TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_open(&half_dsc, &half_img, lv_color_black(), 0));
+    TEST_ASSERT_EQUAL(IMG_W / 2, half_dsc.header.w);
+
+    lv_coord_t y;
+    for(y = 0; y < IMG_H / 2; y += 7) {
+        TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_read_line(&full_dsc, 0, y * 2, IMG_W, (uint8_t *)full_line1));
+        TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_read_line(&full_dsc, 0, y * 2 + 1, IMG_W, (uint8_t *)full_line2));
+        TEST_ASSERT_EQUAL(LV_RES_OK, lv_img_decoder_read_line(&half_dsc, 0, y, IMG_W / 2, (uint8_t *)half_line));
+
+        lv_coord_t x;
+        for(x = 0; x < IMG_W / 2; x++) {
+            uint32_t r = LV_COLOR_GET_R(full_line1[x * 2]) + LV_COLOR_GET_R(full_line1[x * 2 + 1]) +
+                         LV_COLOR_GET_R(full_line2[x * 2]) + LV_COLOR_GET_R(full_line2[x * 2 + 1]);
+            uint32_t g = LV_COLOR_GET_G(full_line1[x * 2]) + LV_COLOR_GET_G(full_line1[x * 2 + 1]) +
+                         LV_COLOR_GET_G(full_line2[x * 2]) + LV_COLOR_GET_G(full_line2[x * 2 + 1]);
+            TEST_ASSERT_UINT32_WITHIN(2, r / 4, LV_COLOR_GET_R(half_line[x]));
+            TEST_ASSERT_UINT32_WITHIN(2, g / 4, LV_COLOR_GET_G(half_line[x]));
+        }
+    }
+
+    lv_img_decoder_close(&full_dsc);
+    lv_img_decoder_close(&half_dsc);
+}
+
+#else /*LV_USE_SJPG*/
+
+void setUp(void)
+{
+
+}
+
+void tearDown(void)
+{
+
+}
+
+void test_sjpg_frames_should_be_decoded_once(void)
+{
+
+}
+
+void test_sjpg_next_frame_should_be_prefetched(void)
+{
+
+}
+
+void test_sjpg_should_be_decoded_at_the_size_of_the_descriptor(void)
+{
+
+}
+
+#endif /*LV_USE_SJPG*/
+
+#endif
@@ -2,6 +2,7 @@
 #include "../lvgl.h"
 
 #include "unity/unity.h"
+#include "lv_test_helpers.h"
 #include "lv_test_indev.h"
 
 static lv_obj_t * active_screen = NULL;
@@ -211,4 +212,23 @@ void test_slider_range_event_hit_test(void)
     TEST_ASSERT(info.res);
 }
 
+void test_slider_value_change_should_redraw_the_knob(void)
+{
+    lv_obj_set_size(slider, 300, 10);
+    lv_obj_center(slider);
+    lv_obj_set_style_shadow_width(slider, 10, LV_PART_KNOB);
+    lv_disp_get_default()->driver->direct_mode = 1;
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+
+    lv_slider_set_value(slider, 40, LV_ANIM_OFF);
+    TEST_ASSERT_TRUE(lv_test_partial_redraw_matches());
+    lv_slider_set_value(slider, 41, LV_ANIM_OFF);
+    TEST_ASSERT_TRUE(lv_test_partial_redraw_matches());
+    lv_slider_set_value(slider, 0, LV_ANIM_OFF);
+    TEST_ASSERT_TRUE(lv_test_partial_redraw_matches());
+
+    lv_disp_get_default()->driver->direct_mode = 0;
+}
+
 #endif
@@ -0,0 +1,112 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+static lv_obj_t * active_screen = NULL;
+static lv_obj_t * spangroup = NULL;
+
+void setUp(void)
+{
+    active_screen = lv_scr_act();
+    spangroup = lv_spangroup_create(active_screen);
+    lv_obj_set_width(spangroup, 200);
+    lv_spangroup_set_mode(spangroup, LV_SPAN_MODE_BREAK);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(active_screen);
+}
+
+static void add_spans(uint32_t cnt)
+{
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        lv_span_t * span = lv_spangroup_new_span(spangroup);
+        lv_span_set_text_static(span, "Lorem ipsum dolor sit amet, ");
+        if(i % 2) lv_style_set_text_font(&span->style, &lv_font_unscii_8);
+    }
+}
+
+void test_span_layout_should_be_reused_while_nothing_changes(void)
+{
+    lv_spangroup_t * spans = (lv_spangroup_t *)spangroup;
+    add_spans(100);
+    lv_refr_now(NULL);
+
+    TEST_ASSERT_TRUE(spans->layout_valid);
+    TEST_ASSERT_GREATER_THAN(1, spans->layout_line_cnt);
+    TEST_ASSERT_GREATER_OR_EQUAL(100, spans->layout_snippet_cnt);
+
+    lv_snippet_t * snippets = spans->layout_snippets;
+    uint32_t line_cnt = spans->layout_line_cnt;
+
+    lv_obj_invalidate(spangroup);
+    lv_refr_now(NULL);
+
+    TEST_ASSERT_TRUE(spans->layout_valid);
+    TEST_ASSERT_EQUAL_PTR(snippets, spans->layout_snippets);
+    TEST_ASSERT_EQUAL(line_cnt, spans->layout_line_cnt);
+}
+
+void test_span_layout_should_match_the_expand_height(void)
+{
+    lv_spangroup_t * spans = (lv_spangroup_t *)spangroup;
+    add_spans(20);
+    lv_refr_now(NULL);
+
+    lv_coord_t line_space = lv_obj_get_style_text_line_space(spangroup, LV_PART_MAIN);
+    lv_span_line_t * last_line = &spans->layout_lines[spans->layout_line_cnt - 1];
+    TEST_ASSERT_EQUAL(last_line->y + last_line->max_line_h - line_space, lv_obj_get_content_height(spangroup));
+
+    /*The lines are continuous*/
+    uint32_t i;
+    for(i = 1; i < spans->layout_line_cnt; i++) {
+        TEST_ASSERT_EQUAL(spans->layout_lines[i - 1].y + spans->layout_lines[i - 1].max_line_h, spans->layout_lines[i].y);
+        TEST_ASSERT_EQUAL(spans->layout_lines[i - 1].snippet_start + spans->layout_lines[i - 1].snippet_cnt,
+                          spans->layout_lines[i].snippet_start);
+    }
+
+    lv_spangroup_set_lines(spangroup, 2);
+    lv_refr_now(NULL);
+    lv_coord_t h2 = spans->layout_lines[1].y + spans->layout_lines[1].max_line_h - line_space;
+    TEST_ASSERT_EQUAL(h2, lv_obj_get_content_height(spangroup));
+}
+
+void test_span_layout_should_be_updated_on_text_and_width_change(void)
+{
+    lv_spangroup_t * spans = (lv_spangroup_t *)spangroup;
+    add_spans(10);
+    lv_refr_now(NULL);
+    uint32_t line_cnt = spans->layout_line_cnt;
+
+    lv_span_t * span = lv_spangroup_new_span(spangroup);
+    lv_span_set_text(span, "A new span with a long text to create at least one more line.");
+    TEST_ASSERT_FALSE(spans->layout_valid);
+    lv_refr_now(NULL);
+    TEST_ASSERT_TRUE(spans->layout_valid);
+    TEST_ASSERT_GREATER_THAN(line_cnt, spans->layout_line_cnt);
+
+    line_cnt = spans->layout_line_cnt;
+    lv_obj_set_width(spangroup, 400);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL(lv_obj_get_content_width(spangroup), spans->layout_w);
+    TEST_ASSERT_LESS_THAN(line_cnt, spans->layout_line_cnt);
+}
+
+void test_span_layout_should_notice_span_style_change(void)
+{
+    lv_spangroup_t * spans = (lv_spangroup_t *)spangroup;
+    add_spans(4);
+    lv_refr_now(NULL);
+
+    lv_span_t * span = lv_spangroup_get_child(spangroup, 0);
+    lv_style_set_text_font(&span->style, &lv_font_unscii_8);
+    lv_obj_invalidate(spangroup);
+    lv_refr_now(NULL);
+
+    TEST_ASSERT_EQUAL_PTR(&lv_font_unscii_8, spans->layout_snippets[0].font);
+}
+
+#endif
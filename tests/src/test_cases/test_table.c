@@ -2,6 +2,7 @@
 #include "../lvgl.h"
 
 #include "unity/unity.h"
+#include "lv_test_indev.h"
 
 static lv_obj_t * scr = NULL;
 static lv_obj_t * table = NULL;
@@ -244,4 +245,237 @@ void test_table_should_reduce_cells_with_more_than_one_row(void)
     }
 }
 
+static void check_offsets(void)
+{
+    lv_table_t * t = (lv_table_t *)table;
+    uint32_t i;
+    TEST_ASSERT_EQUAL(0, t->row_y[0]);
+    for(i = 0; i < t->row_cnt; i++) {
+        TEST_ASSERT_EQUAL(t->row_y[i] + t->row_h[i], t->row_y[i + 1]);
+    }
+
+    TEST_ASSERT_EQUAL(0, t->col_x[0]);
+    for(i = 0; i < t->col_cnt; i++) {
+        TEST_ASSERT_EQUAL(t->col_x[i] + t->col_w[i], t->col_x[i + 1]);
+    }
+}
+
+void test_table_offsets_should_follow_the_cell_sizes(void)
+{
+    check_offsets();
+
+    lv_table_set_col_cnt(table, 3);
+    lv_table_set_row_cnt(table, 5);
+    check_offsets();
+
+    lv_table_set_col_width(table, 1, 30);
+    lv_table_set_cell_value(table, 2, 1, "Multi\nline\ntext");
+    check_offsets();
+
+    lv_table_set_cell_value(table, 2, 1, "Single line");
+    lv_table_set_cell_value(table, 6, 3, "Auto expand");
+    check_offsets();
+
+    lv_table_set_row_cnt(table, 2);
+    lv_table_set_col_cnt(table, 1);
+    check_offsets();
+}
+
+static uint32_t pressed_row;
+static uint16_t pressed_col;
+
+static void value_changed_event_cb(lv_event_t * e)
+{
+    uint16_t row;
+    lv_table_get_selected_cell(lv_event_get_target(e), &row, &pressed_col);
+    pressed_row = lv_table_get_selected_row(lv_event_get_target(e));
+
+    /*The old getter can't report the large rows*/
+    TEST_ASSERT_EQUAL_UINT16(LV_MIN(pressed_row, LV_TABLE_CELL_NONE - 1), row);
+}
+
+void test_table_should_find_the_pressed_cell_in_a_long_table(void)
+{
+    lv_table_t * t = (lv_table_t *)table;
+    lv_obj_set_size(table, 300, 200);
+    lv_table_set_col_cnt(table, 3);
+    lv_table_set_row_cnt(table, 10000);
+    lv_table_set_cell_value(table, 5000, 1, "Multi\nline");
+    lv_obj_add_event_cb(table, value_changed_event_cb, LV_EVENT_VALUE_CHANGED, NULL);
+
+    lv_obj_scroll_to_y(table, t->row_y[5000], LV_ANIM_OFF);
+    lv_refr_now(NULL);
+
+    lv_coord_t x = table->coords.x1 + lv_obj_get_style_pad_left(table, LV_PART_MAIN) + t->col_x[1] + 5;
+    lv_coord_t y = table->coords.y1 + lv_obj_get_style_pad_top(table, LV_PART_MAIN) + t->row_y[5000] +
+                   t->row_h[5000] - 5 - lv_obj_get_scroll_y(table);
+    lv_test_mouse_click_at(x, y);
+
+    TEST_ASSERT_EQUAL_UINT32(5000, pressed_row);
+    TEST_ASSERT_EQUAL_UINT16(1, pressed_col);
+}
+
+static uint32_t drawn_cnt;
+static uint32_t drawn_first_row;
+static uint32_t drawn_last_row;
+
+static void count_cells_event_cb(lv_event_t * e)
+{
+    lv_obj_draw_part_dsc_t * dsc = lv_event_get_draw_part_dsc(e);
+    if(dsc->class_p != &lv_table_class || dsc->type != LV_TABLE_DRAW_PART_CELL) return;
+
+    uint32_t row = dsc->id / lv_table_get_col_cnt(lv_event_get_target(e));
+    if(drawn_cnt == 0) drawn_first_row = row;
+    drawn_last_row = row;
+    drawn_cnt++;
+}
+
+/*Scroll to `row` and check that only the rows in view are drawn*/
+static void check_drawn_rows(uint32_t row, lv_coord_t row_h)
+{
+    lv_table_t * t = (lv_table_t *)table;
+    lv_obj_scroll_to_y(table, (int32_t)row * row_h, LV_ANIM_OFF);
+    lv_obj_invalidate(table);
+    drawn_cnt = 0;
+    lv_refr_now(NULL);
+
+    /*The padding can show a part of the row above*/
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(row, drawn_first_row);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(row == 0 ? 0 : row - 1, drawn_first_row);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(row + lv_obj_get_height(table) / row_h + 1, drawn_last_row);
+    TEST_ASSERT_EQUAL_UINT32((drawn_last_row - drawn_first_row + 1) * t->col_cnt, drawn_cnt);
+}
+
+void test_table_long_table_should_draw_only_the_rows_in_view(void)
+{
+    lv_table_t * t = (lv_table_t *)table;
+    lv_obj_set_size(table, 300, 200);
+    lv_table_set_col_cnt(table, 2);
+    lv_table_set_row_cnt(table, 10000);
+
+    uint32_t i;
+    for(i = 0; i < 10000; i++) {
+        lv_table_set_cell_value_fmt(table, i, 0, "%d", i);
+    }
+    lv_obj_add_event_cb(table, count_cells_event_cb, LV_EVENT_DRAW_PART_BEGIN, NULL);
+
+    check_drawn_rows(0, t->row_h[0]);
+    check_drawn_rows(5000, t->row_h[0]);
+    check_drawn_rows(9990, t->row_h[0]);
+}
+
+static uint32_t cell_cb_cnt;
+
+static const char * virtual_cell_cb(lv_obj_t * obj, uint32_t row, uint16_t col)
+{
+    LV_UNUSED(obj);
+    static char buf[32];
+    cell_cb_cnt++;
+    lv_snprintf(buf, sizeof(buf), "%d.%d", row, col);
+    return buf;
+}
+
+void test_table_virtual_should_ask_only_the_visible_cells(void)
+{
+    lv_table_t * t = (lv_table_t *)table;
+    lv_obj_set_size(table, 300, 200);
+    lv_table_set_col_cnt(table, 3);
+    lv_table_set_virtual(table, 1000000, virtual_cell_cb);
+
+    /*No memory is used for the rows*/
+    TEST_ASSERT_NULL(t->cell_data);
+    TEST_ASSERT_NULL(t->row_h);
+    TEST_ASSERT_NULL(t->row_y);
+    TEST_ASSERT_EQUAL_UINT32(1000000, lv_table_get_row_cnt(table));
+    TEST_ASSERT_GREATER_THAN(0, t->virt_row_h);
+
+    lv_obj_update_layout(table);
+    TEST_ASSERT_EQUAL(1000000 * t->virt_row_h - 1, lv_obj_get_self_height(table));
+
+    uint32_t visible_rows = lv_obj_get_content_height(table) / t->virt_row_h + 2;
+    cell_cb_cnt = 0;
+    lv_obj_scroll_to_y(table, 500000 * t->virt_row_h, LV_ANIM_OFF);
+    lv_refr_now(NULL);
+    TEST_ASSERT_GREATER_THAN(0, cell_cb_cnt);
+    TEST_ASSERT_LESS_OR_EQUAL(visible_rows * 3, cell_cb_cnt);
+
+    TEST_ASSERT_EQUAL_STRING("123456.2", lv_table_get_cell_value(table, 123456, 2));
+    TEST_ASSERT_TRUE(lv_table_has_cell_ctrl(table, 123456, 2, LV_TABLE_CELL_CTRL_TEXT_CROP));
+
+    /*Cells can't be set*/
+    lv_table_set_cell_value(table, 1, 1, "x");
+    TEST_ASSERT_NULL(t->cell_data);
+
+    /*Back to a normal table*/
+    lv_table_set_virtual(table, 5, NULL);
+    TEST_ASSERT_EQUAL_UINT32(5, lv_table_get_row_cnt(table));
+    TEST_ASSERT_EQUAL_STRING("", lv_table_get_cell_value(table, 4, 2));
+    lv_table_set_cell_value(table, 4, 2, "x");
+    TEST_ASSERT_EQUAL_STRING("x", lv_table_get_cell_value(table, 4, 2));
+    check_offsets();
+}
+
+void test_table_virtual_should_find_the_pressed_cell(void)
+{
+    lv_table_t * t = (lv_table_t *)table;
+    lv_obj_set_size(table, 300, 200);
+    lv_table_set_col_cnt(table, 3);
+    lv_table_set_virtual(table, 1000000, virtual_cell_cb);
+    lv_obj_add_event_cb(table, value_changed_event_cb, LV_EVENT_VALUE_CHANGED, NULL);
+
+    lv_obj_scroll_to_y(table, 700000 * t->virt_row_h, LV_ANIM_OFF);
+    lv_refr_now(NULL);
+
+    lv_coord_t x = table->coords.x1 + lv_obj_get_style_pad_left(table, LV_PART_MAIN) + t->col_x[2] + 5;
+    lv_coord_t y = table->coords.y1 + lv_obj_get_style_pad_top(table, LV_PART_MAIN) + 3 * t->virt_row_h + 2;
+    lv_test_mouse_click_at(x, y);
+
+    TEST_ASSERT_EQUAL_UINT32(700003, pressed_row);
+    TEST_ASSERT_EQUAL_UINT16(2, pressed_col);
+}
+
+void test_table_virtual_should_draw_and_ask_only_the_rows_in_view(void)
+{
+    lv_table_t * t = (lv_table_t *)table;
+    lv_obj_set_size(table, 300, 200);
+    lv_table_set_col_cnt(table, 2);
+    lv_table_set_virtual(table, 1000000, virtual_cell_cb);
+    lv_obj_add_event_cb(table, count_cells_event_cb, LV_EVENT_DRAW_PART_BEGIN, NULL);
+
+    uint32_t i;
+    for(i = 0; i < 50; i++) {
+        cell_cb_cnt = 0;
+        check_drawn_rows(i * 20000, t->virt_row_h);
+        TEST_ASSERT_EQUAL_UINT32(drawn_cnt, cell_cb_cnt);
+    }
+}
+
+void test_table_should_tell_row_65535_from_no_selection(void)
+{
+    lv_table_t * t = (lv_table_t *)table;
+    lv_obj_set_size(table, 300, 200);
+    lv_table_set_col_cnt(table, 3);
+    lv_table_set_virtual(table, 100000, virtual_cell_cb);
+    lv_obj_add_event_cb(table, value_changed_event_cb, LV_EVENT_VALUE_CHANGED, NULL);
+
+    uint16_t row;
+    uint16_t col;
+    lv_table_get_selected_cell(table, &row, &col);
+    TEST_ASSERT_EQUAL_UINT16(LV_TABLE_CELL_NONE, row);
+    TEST_ASSERT_EQUAL_UINT16(LV_TABLE_CELL_NONE, col);
+    TEST_ASSERT_EQUAL_UINT32(LV_TABLE_ROW_NONE, lv_table_get_selected_row(table));
+
+    /*Row 65535 was the "no cell" value of the 16 bit rows so it couldn't be clicked*/
+    pressed_row = 0;
+    lv_obj_scroll_to_y(table, 65535 * t->virt_row_h, LV_ANIM_OFF);
+    lv_refr_now(NULL);
+
+    lv_coord_t x = table->coords.x1 + lv_obj_get_style_pad_left(table, LV_PART_MAIN) + t->col_x[1] + 5;
+    lv_coord_t y = table->coords.y1 + lv_obj_get_style_pad_top(table, LV_PART_MAIN) + 2;
+    lv_test_mouse_click_at(x, y);
+
+    TEST_ASSERT_EQUAL_UINT32(65535, pressed_row);
+    TEST_ASSERT_EQUAL_UINT16(1, pressed_col);
+}
+
 #endif
@@ -0,0 +1,186 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+#include "lv_test_helpers.h"
+#include "lv_test_indev.h"
+
+
+static lv_obj_t * tv;
+static lv_obj_t * tiles[3];
+
+void setUp(void)
+{
+    /*Small enough to fit the images into LV_MEM_SIZE too*/
+    tv = lv_tileview_create(lv_scr_act());
+    lv_obj_set_size(tv, 400, 240);
+
+    uint32_t i;
+    for(i = 0; i < 3; i++) {
+        tiles[i] = lv_tileview_add_tile(tv, i, 0, i == 0 ? LV_DIR_RIGHT : LV_DIR_HOR);
+        lv_obj_set_flex_flow(tiles[i], LV_FLEX_FLOW_ROW_WRAP);
+
+        uint32_t j;
+        for(j = 0; j < 6; j++) {
+            lv_obj_t * btn = lv_btn_create(tiles[i]);
+            lv_obj_set_size(btn, 100, 60);
+            lv_obj_t * label = lv_label_create(btn);
+            lv_label_set_text_fmt(label, "Tile %d\nButton %d", i, j);
+            lv_obj_center(label);
+        }
+    }
+    lv_refr_now(NULL);
+}
+
+void tearDown(void)
+{
+    lv_test_mouse_release();
+    lv_obj_del(tv);
+}
+
+/*Read the mouse without refreshing the display*/
+static void mouse_read(void)
+{
+    lv_indev_t * indev = lv_indev_get_next(NULL);
+    while(indev && lv_indev_get_type(indev) != LV_INDEV_TYPE_POINTER) indev = lv_indev_get_next(indev);
+    lv_indev_read_timer_cb(indev->driver->read_timer);
+}
+
+static void drag_start(void)
+{
+    lv_test_mouse_move_to(350, 100);
+    lv_test_mouse_press();
+    mouse_read();
+
+    uint32_t i;
+    for(i = 0; i < 10; i++) {
+        lv_test_mouse_move_by(-20, 0);
+        mouse_read();
+    }
+}
+
+static void wait_scroll_end(void)
+{
+    lv_test_mouse_release();
+    lv_test_indev_wait(1000);
+}
+
+static void check_prerender_draw(lv_img_cf_t cf)
+{
+
+    lv_tileview_set_prerender(tv, true);
+    drag_start();
+    TEST_ASSERT_NOT_EQUAL(0, lv_obj_get_scroll_x(tv));
+    TEST_ASSERT_NOT_NULL(((lv_tileview_tile_t *)tiles[0])->img);
+    TEST_ASSERT_NOT_NULL(((lv_tileview_tile_t *)tiles[1])->img);
+    TEST_ASSERT_NULL(((lv_tileview_tile_t *)tiles[2])->img);
+    TEST_ASSERT_EQUAL(cf, ((lv_tileview_tile_t *)tiles[0])->img->header.cf);
+    TEST_ASSERT_FALSE(lv_obj_has_flag(lv_obj_get_child(tiles[0], 0), LV_OBJ_FLAG_HIDDEN));
+    lv_test_save_ref_screen();
+
+    /*Draw the same scroll position with the live tiles*/
+    lv_tileview_set_prerender(tv, false);
+    TEST_ASSERT_NULL(((lv_tileview_tile_t *)tiles[0])->img);
+    lv_test_refr_screen();
+
+    /*The anti-aliased edges might be blended a little bit differently*/
+    TEST_ASSERT_LESS_OR_EQUAL(4, lv_test_ref_screen_diff());
+
+    wait_scroll_end();
+}
+
+void test_tileview_prerender_should_draw_like_the_live_tiles(void)
+{
+    check_prerender_draw(LV_IMG_CF_TRUE_COLOR_ALPHA);
+}
+
+void test_tileview_prerender_should_draw_opaque_tiles_without_alpha(void)
+{
+    uint32_t i;
+    for(i = 0; i < 3; i++) {
+        lv_obj_set_style_bg_color(tiles[i], lv_palette_lighten(LV_PALETTE_BLUE, i + 1), 0);
+        lv_obj_set_style_bg_opa(tiles[i], LV_OPA_COVER, 0);
+    }
+
+    check_prerender_draw(LV_IMG_CF_TRUE_COLOR);
+}
+
+void test_tileview_prerender_should_restore_the_tiles_when_the_scrolling_ends(void)
+{
+    lv_tileview_set_prerender(tv, true);
+    lv_obj_add_flag(lv_obj_get_child(tiles[1], 0), LV_OBJ_FLAG_HIDDEN);
+
+    drag_start();
+    TEST_ASSERT_NOT_NULL(((lv_tileview_tile_t *)tiles[1])->img);
+    TEST_ASSERT_FALSE(lv_obj_has_flag(lv_obj_get_child(tiles[1], 1), LV_OBJ_FLAG_HIDDEN));
+    lv_test_mouse_move_by(-150, 0);
+    mouse_read();
+    wait_scroll_end();
+    TEST_ASSERT_EQUAL_PTR(tiles[1], lv_tileview_get_tile_act(tv));
+    TEST_ASSERT_NULL(((lv_tileview_tile_t *)tiles[0])->img);
+    TEST_ASSERT_NULL(((lv_tileview_tile_t *)tiles[1])->img);
+
+    /*The flags of the children are not changed by the prerendering*/
+    TEST_ASSERT_TRUE(lv_obj_has_flag(lv_obj_get_child(tiles[1], 0), LV_OBJ_FLAG_HIDDEN));
+    TEST_ASSERT_FALSE(lv_obj_has_flag(lv_obj_get_child(tiles[1], 1), LV_OBJ_FLAG_HIDDEN));
+
+    /*The neighbours in both directions are prerendered, even if a child is deleted meanwhile*/
+    lv_obj_set_tile_id(tv, 2, 0, LV_ANIM_ON);
+    TEST_ASSERT_NOT_NULL(((lv_tileview_tile_t *)tiles[0])->img);
+    TEST_ASSERT_NOT_NULL(((lv_tileview_tile_t *)tiles[2])->img);
+    lv_obj_del(lv_obj_get_child(tiles[2], 0));
+    wait_scroll_end();
+    TEST_ASSERT_EQUAL_PTR(tiles[2], lv_tileview_get_tile_act(tv));
+    TEST_ASSERT_NULL(((lv_tileview_tile_t *)tiles[2])->img);
+    TEST_ASSERT_EQUAL_UINT32(5, lv_obj_get_child_cnt(tiles[2]));
+    TEST_ASSERT_FALSE(lv_obj_has_flag(lv_obj_get_child(tiles[2], 0), LV_OBJ_FLAG_HIDDEN));
+
+    /*Scrolling without animation doesn't need the images*/
+    lv_obj_set_tile_id(tv, 0, 0, LV_ANIM_OFF);
+    TEST_ASSERT_NULL(((lv_tileview_tile_t *)tiles[0])->img);
+    TEST_ASSERT_NULL(((lv_tileview_tile_t *)tiles[1])->img);
+}
+
+void test_tileview_prerender_should_be_disabled_by_default(void)
+{
+    TEST_ASSERT_FALSE(lv_tileview_get_prerender(tv));
+    drag_start();
+    TEST_ASSERT_NULL(((lv_tileview_tile_t *)tiles[0])->img);
+    TEST_ASSERT_FALSE(lv_obj_has_flag(lv_obj_get_child(tiles[0], 0), LV_OBJ_FLAG_HIDDEN));
+    wait_scroll_end();
+}
+
+static uint32_t draw_cnt;
+static void draw_cnt_event_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+    draw_cnt++;
+}
+
+void test_tileview_prerender_should_not_draw_the_children_while_scrolling(void)
+{
+    lv_obj_t * btn = lv_obj_get_child(tiles[0], 0);
+    lv_obj_add_event_cb(btn, draw_cnt_event_cb, LV_EVENT_DRAW_MAIN, NULL);
+    lv_tileview_set_prerender(tv, true);
+
+    /*The children are drawn once into the image*/
+    draw_cnt = 0;
+    drag_start();
+    TEST_ASSERT_EQUAL(1, draw_cnt);
+
+    uint32_t i;
+    for(i = 0; i < 5; i++) {
+        lv_test_mouse_move_by(-5, 0);
+        mouse_read();
+        lv_test_refr_screen();
+    }
+    TEST_ASSERT_EQUAL(1, draw_cnt);
+
+    /*The children are drawn normally when the scrolling ends*/
+    wait_scroll_end();
+    lv_obj_set_tile_id(tv, 0, 0, LV_ANIM_OFF);
+    lv_test_refr_screen();
+    TEST_ASSERT_EQUAL(2, draw_cnt);
+}
+
+#endif
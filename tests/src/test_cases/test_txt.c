@@ -5,6 +5,28 @@
 
 static const char color_cmd = LV_TXT_COLOR_CMD[0];
 
+#if LV_FONT_WIDTH_CACHE_SIZE
+static uint32_t glyph_dsc_cnt;
+
+static bool counting_get_glyph_dsc(const lv_font_t * font, lv_font_glyph_dsc_t * dsc, uint32_t letter,
+                                   uint32_t letter_next)
+{
+    glyph_dsc_cnt++;
+    return lv_font_montserrat_14.get_glyph_dsc(font, dsc, letter, letter_next);
+}
+#endif
+
+static char * create_paragraph(uint32_t len)
+{
+    static const char words[] = "Lorem ipsum dolor sit amet, consectetur adipiscing elit. "
+                                "AVAWATaV kerning pairs: To, Ta, Yo. ";
+    char * txt = lv_mem_alloc(len + 1);
+    uint32_t i;
+    for(i = 0; i < len; i++) txt[i] = words[i % (sizeof(words) - 1)];
+    txt[len] = '\0';
+    return txt;
+}
+
 void test_txt_should_identify_valid_start_of_command(void)
 {
     uint32_t character = color_cmd;
@@ -204,4 +226,63 @@ void test_txt_next_line_should_handle_empty_string(void)
     TEST_ASSERT_EQUAL_UINT32(0, next_line);
 }
 
+void test_txt_get_size_should_give_the_same_result_with_cached_widths(void)
+{
+    char * txt = create_paragraph(4096);
+    lv_point_t size_cold;
+    lv_point_t size_warm;
+
+    lv_font_width_cache_invalidate(NULL);
+    lv_txt_get_size(&size_cold, txt, &lv_font_montserrat_14, 2, 3, 300, LV_TEXT_FLAG_NONE);
+    lv_txt_get_size(&size_warm, txt, &lv_font_montserrat_14, 2, 3, 300, LV_TEXT_FLAG_NONE);
+
+    TEST_ASSERT_EQUAL(size_cold.x, size_warm.x);
+    TEST_ASSERT_EQUAL(size_cold.y, size_warm.y);
+
+    /*The cached widths of the letter pairs (kerning) should match with the font's data*/
+    uint32_t i = 0;
+    while(txt[i] != '\0') {
+        uint32_t letter;
+        uint32_t letter_next;
+        _lv_txt_encoded_letter_next_2(txt, &letter, &letter_next, &i);
+
+        lv_font_glyph_dsc_t g;
+        lv_font_get_glyph_dsc(&lv_font_montserrat_14, &g, letter, letter_next);
+        TEST_ASSERT_EQUAL(g.adv_w, lv_font_get_glyph_width(&lv_font_montserrat_14, letter, letter_next));
+    }
+
+    lv_mem_free(txt);
+}
+
+void test_txt_get_size_should_reuse_cached_widths(void)
+{
+#if LV_FONT_WIDTH_CACHE_SIZE
+    lv_font_t font = lv_font_montserrat_14;
+    font.get_glyph_dsc = counting_get_glyph_dsc;
+    char * txt = create_paragraph(4096);
+    lv_point_t size;
+
+    glyph_dsc_cnt = 0;
+    lv_txt_get_size(&size, txt, &font, 0, 0, 300, LV_TEXT_FLAG_NONE);
+    uint32_t cnt_cold = glyph_dsc_cnt;
+
+    glyph_dsc_cnt = 0;
+    lv_txt_get_size(&size, txt, &font, 0, 0, 300, LV_TEXT_FLAG_NONE);
+    uint32_t cnt_warm = glyph_dsc_cnt;
+
+    TEST_ASSERT_LESS_THAN(cnt_cold / 10, cnt_warm);
+
+    /*The widths need to be measured again after invalidation*/
+    lv_font_width_cache_invalidate(&font);
+    glyph_dsc_cnt = 0;
+    lv_txt_get_size(&size, txt, &font, 0, 0, 300, LV_TEXT_FLAG_NONE);
+    TEST_ASSERT_GREATER_THAN(cnt_warm, glyph_dsc_cnt);
+
+    lv_font_width_cache_invalidate(&font);
+    lv_mem_free(txt);
+#else
+    TEST_IGNORE_MESSAGE("The width cache is disabled");
+#endif
+}
+
 #endif